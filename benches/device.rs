@@ -0,0 +1,269 @@
+//! Hardware benchmarks for regression tracking across DepthAI-Core versions.
+//!
+//! Requires a connected device:
+//!
+//! ```text
+//! cargo bench --features hit --bench device [-- xlink camera encoder]
+//! ```
+//!
+//! Every case prints one JSON object per line on stdout. Environment knobs:
+//! - `DEPTHAI_BENCH_OUTPUT`: also append the JSON lines to this file.
+//! - `DEPTHAI_BENCH_SECONDS`: measurement window per case (default 5).
+//! - `DEPTHAI_BENCH_XLINK_CHUNK`: XLink chunk size in bytes passed to every pipeline.
+
+use std::error::Error;
+use std::fs::OpenOptions;
+use std::io::Write;
+use std::time::{Duration, Instant};
+
+use depthai::camera::{CameraNode, CameraOutputConfig};
+use depthai::common::{CameraBoardSocket, ImageFrameType, ResizeMode};
+use depthai::{
+    BenchmarkInNode, BenchmarkOutNode, Buffer, Device, EncodedFrameType, LatencyHistogram, Pipeline,
+    PipelineStats, VideoEncoderNode, VideoEncoderProfile,
+};
+use serde_json::{json, Value};
+
+const XLINK_MESSAGE_SIZES: &[usize] = &[1 << 10, 64 << 10, 1 << 20, 4 << 20];
+const CAMERA_RESOLUTIONS: &[(u32, u32)] = &[(640, 400), (1280, 720), (1920, 1080)];
+const CAMERA_FRAME_TYPES: &[ImageFrameType] = &[ImageFrameType::NV12, ImageFrameType::RGB888i];
+const ENCODER_PROFILES: &[VideoEncoderProfile] =
+    &[VideoEncoderProfile::H264Main, VideoEncoderProfile::H265Main, VideoEncoderProfile::Mjpeg];
+const CAMERA_FPS: f32 = 30.0;
+
+type Result<T> = std::result::Result<T, Box<dyn Error>>;
+
+struct Bench {
+    device: Device,
+    window: Duration,
+    xlink_chunk: Option<i32>,
+    core_version: String,
+    output: Option<std::fs::File>,
+}
+
+impl Bench {
+    fn pipeline(&self) -> depthai::Result<Pipeline> {
+        let mut builder = Pipeline::new().with_device(&self.device);
+        if let Some(chunk) = self.xlink_chunk {
+            builder = builder.xlink_chunk_size(chunk);
+        }
+        builder.build()
+    }
+
+    fn emit(&mut self, suite: &str, params: Value, result: Result<Value>) {
+        let mut record = json!({
+            "suite": suite,
+            "depthai_core": self.core_version,
+            "xlink_chunk_size": self.xlink_chunk,
+            "window_s": self.window.as_secs_f64(),
+            "params": params,
+        });
+        match result {
+            Ok(metrics) => record["metrics"] = metrics,
+            Err(err) => record["error"] = json!(err.to_string()),
+        }
+        let line = record.to_string();
+        println!("{line}");
+        if let Some(file) = self.output.as_mut() {
+            let _ = writeln!(file, "{line}");
+        }
+    }
+}
+
+fn histogram_json(h: &LatencyHistogram) -> Value {
+    let ms = |d: Option<Duration>| d.map(|d| d.as_secs_f64() * 1e3);
+    json!({
+        "count": h.count,
+        "mean_ms": ms(h.mean()),
+        "p50_ms": ms(h.percentile(0.5)),
+        "p99_ms": ms(h.percentile(0.99)),
+        "max_ms": h.max().as_secs_f64() * 1e3,
+    })
+}
+
+/// Device-side `BenchmarkOut` replaying one message of `size` bytes into a host-side
+/// `BenchmarkIn`, so the report covers XLink transfer and host delivery.
+fn xlink_case(bench: &Bench, size: usize) -> Result<Value> {
+    let pipeline = bench.pipeline()?;
+    let out = pipeline.create::<BenchmarkOutNode>()?;
+    out.set_run_on_host(false);
+    out.set_fps(1000.0);
+    let input = pipeline.create::<BenchmarkInNode>()?;
+    input.set_run_on_host(true);
+    input.send_report_every_n_messages(50);
+    input.measure_individual_latencies(true);
+    out.out()?.link(&input.input()?)?;
+
+    let feed = out.input()?.create_input_queue(1, true)?;
+    let reports = input.report()?.create_message_queue(16, false)?;
+    pipeline.start()?;
+
+    feed.send_buffer(&Buffer::from_bytes(&vec![0xA5; size])?)?;
+
+    let deadline = Instant::now() + bench.window;
+    let mut last = None;
+    let mut received = 0u64;
+    while Instant::now() < deadline {
+        let Some(msg) = reports.get(Some(Duration::from_millis(500)))? else {
+            continue;
+        };
+        if let Some(report) = msg.as_benchmark_report()? {
+            received += report.num_messages_received;
+            last = Some(report);
+        }
+    }
+    pipeline.stop()?;
+
+    let report = last.ok_or("no BenchmarkReport received")?;
+    let ms = |d: Option<Duration>| d.map(|d| d.as_secs_f64() * 1e3);
+    Ok(json!({
+        "messages": received,
+        "fps": report.fps,
+        "throughput_mib_s": report.fps as f64 * size as f64 / (1 << 20) as f64,
+        "latency_mean_ms": report.average_latency().as_secs_f64() * 1e3,
+        "latency_p50_ms": ms(report.latency_percentile(0.5)),
+        "latency_p99_ms": ms(report.latency_percentile(0.99)),
+    }))
+}
+
+fn camera_case(bench: &Bench, (width, height): (u32, u32), frame_type: ImageFrameType) -> Result<Value> {
+    let pipeline = bench.pipeline()?;
+    let cam = pipeline.create_with::<CameraNode, _>(CameraBoardSocket::CamA)?;
+    let output = cam.request_output(CameraOutputConfig {
+        size: (width, height),
+        frame_type: Some(frame_type),
+        resize_mode: ResizeMode::Crop,
+        fps: Some(CAMERA_FPS),
+        enable_undistortion: None,
+    })?;
+    let queue = output.create_queue(8, false)?;
+    pipeline.start()?;
+
+    // Skip warm-up frames (auto-exposure, first allocations).
+    let _ = queue.blocking_next(Some(Duration::from_secs(5)))?;
+    PipelineStats::reset();
+    let started = Instant::now();
+    let mut frames = 0u64;
+    let mut bytes = 0u64;
+    while started.elapsed() < bench.window {
+        if let Some(frame) = queue.blocking_next(Some(Duration::from_millis(500)))? {
+            frames += 1;
+            bytes += frame.byte_len() as u64;
+        }
+    }
+    let elapsed = started.elapsed().as_secs_f64();
+    let stats = PipelineStats::snapshot()?;
+    pipeline.stop()?;
+
+    // The queue created above is the most recently registered one.
+    let queue_stats = stats.queues.last();
+    Ok(json!({
+        "frames": frames,
+        "fps": frames as f64 / elapsed,
+        "throughput_mib_s": bytes as f64 / elapsed / (1 << 20) as f64,
+        "dropped": queue_stats.map(|q| q.dropped),
+        "latency": queue_stats.map(|q| histogram_json(&q.latency)),
+    }))
+}
+
+fn encoder_case(bench: &Bench, profile: VideoEncoderProfile) -> Result<Value> {
+    let (width, height) = (1280, 720);
+    let pipeline = bench.pipeline()?;
+    let cam = pipeline.create_with::<CameraNode, _>(CameraBoardSocket::CamA)?;
+    let nv12 = cam.request_output(CameraOutputConfig {
+        size: (width, height),
+        frame_type: Some(ImageFrameType::NV12),
+        resize_mode: ResizeMode::Crop,
+        fps: Some(CAMERA_FPS),
+        enable_undistortion: None,
+    })?;
+    let enc = pipeline.create::<VideoEncoderNode>()?;
+    enc.set_default_profile_preset(CAMERA_FPS, profile);
+    nv12.link(&enc.input()?)?;
+    let queue = enc.out()?.create_encoded_frame_queue(16, false)?;
+    pipeline.start()?;
+
+    let _ = queue.blocking_next(Some(Duration::from_secs(5)))?;
+    let started = Instant::now();
+    let (mut frames, mut keyframes, mut bytes) = (0u64, 0u64, 0u64);
+    while started.elapsed() < bench.window {
+        if let Some(frame) = queue.blocking_next(Some(Duration::from_millis(500)))? {
+            frames += 1;
+            bytes += frame.data_len() as u64;
+            if frame.frame_type() == Some(EncodedFrameType::I) {
+                keyframes += 1;
+            }
+        }
+    }
+    let elapsed = started.elapsed().as_secs_f64();
+    pipeline.stop()?;
+
+    Ok(json!({
+        "frames": frames,
+        "keyframes": keyframes,
+        "fps": frames as f64 / elapsed,
+        "bitrate_kbps": bytes as f64 * 8.0 / elapsed / 1e3,
+        "mean_frame_bytes": if frames > 0 { bytes / frames } else { 0 },
+    }))
+}
+
+fn main() -> Result<()> {
+    // `cargo bench` passes `--bench`; remaining positional arguments select suites.
+    let suites: Vec<String> = std::env::args().skip(1).filter(|a| !a.starts_with('-')).collect();
+    let enabled = |name: &str| suites.is_empty() || suites.iter().any(|s| s == name);
+
+    let window = std::env::var("DEPTHAI_BENCH_SECONDS")
+        .ok()
+        .and_then(|s| s.parse::<f64>().ok())
+        .map_or(Duration::from_secs(5), Duration::from_secs_f64);
+    let xlink_chunk = std::env::var("DEPTHAI_BENCH_XLINK_CHUNK").ok().and_then(|s| s.parse().ok());
+    let output = match std::env::var("DEPTHAI_BENCH_OUTPUT") {
+        Ok(path) => Some(
+            OpenOptions::new()
+                .create(true)
+                .append(true)
+                .open(&path)
+                .map_err(|e| format!("failed to open {path}: {e}"))?,
+        ),
+        Err(_) => None,
+    };
+
+    // Queue latency and drop counters come from the telemetry layer.
+    PipelineStats::set_enabled(true);
+    let mut bench = Bench {
+        device: Device::new()?,
+        window,
+        xlink_chunk,
+        core_version: depthai::depthai_core_version()?,
+        output,
+    };
+
+    if enabled("xlink") {
+        for &size in XLINK_MESSAGE_SIZES {
+            let result = xlink_case(&bench, size);
+            bench.emit("xlink", json!({ "message_bytes": size }), result);
+        }
+    }
+    if enabled("camera") {
+        for &resolution in CAMERA_RESOLUTIONS {
+            for &frame_type in CAMERA_FRAME_TYPES {
+                let result = camera_case(&bench, resolution, frame_type);
+                let params = json!({
+                    "width": resolution.0,
+                    "height": resolution.1,
+                    "frame_type": format!("{frame_type:?}"),
+                    "fps_requested": CAMERA_FPS,
+                });
+                bench.emit("camera", params, result);
+            }
+        }
+    }
+    if enabled("encoder") {
+        for &profile in ENCODER_PROFILES {
+            let result = encoder_case(&bench, profile);
+            let params = json!({ "profile": format!("{profile:?}"), "width": 1280, "height": 720 });
+            bench.emit("encoder", params, result);
+        }
+    }
+    Ok(())
+}
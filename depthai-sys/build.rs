@@ -848,7 +848,7 @@ fn build_cpp_wrapper(include_paths: &[PathBuf], opencv_enabled: bool) {
         .file(PROJECT_ROOT.join("wrapper").join("wrapper.cpp"));
 
     if !opencv_enabled {
-        cc_build.file(PROJECT_ROOT.join("wrapper").join("image_filters_stub.cpp"));
+        cc_build.file(PROJECT_ROOT.join("wrapper").join("image_filters_host.cpp"));
     }
 
     for include in include_paths {
@@ -25,6 +25,9 @@ include_cpp! {
     generate!("dai::dai_device_delete")
     generate!("dai::dai_device_is_closed")
     generate!("dai::dai_device_close")
+    generate!("dai::dai_device_list_json")
+    generate!("dai::dai_device_open")
+    generate!("dai::dai_device_get_device_id")
     generate!("dai::dai_device_get_connected_camera_sockets")
     generate!("dai::dai_pipeline_new_with_device")
 
@@ -55,6 +58,10 @@ include_cpp! {
     generate!("dai::dai_pipeline_remove_node")
     generate!("dai::dai_pipeline_get_connections_json")
     generate!("dai::dai_pipeline_get_connection_map_json")
+    generate!("dai::dai_pipeline_graph_version")
+    generate!("dai::dai_pipeline_graph_snapshot")
+    generate!("dai::dai_graph_snapshot_release")
+    generate!("dai::dai_graph_snapshot_version")
     generate!("dai::dai_pipeline_is_calibration_data_available")
     generate!("dai::dai_pipeline_get_calibration_data_json")
     generate!("dai::dai_pipeline_set_calibration_data_json")
@@ -120,6 +127,18 @@ include_cpp! {
     generate!("dai::dai_image_align_set_output_size")
     generate!("dai::dai_image_align_set_out_keep_aspect_ratio")
 
+    // BenchmarkOut / BenchmarkIn helpers
+    generate!("dai::dai_benchmark_out_set_num_messages_to_send")
+    generate!("dai::dai_benchmark_out_set_fps")
+    generate!("dai::dai_benchmark_out_set_run_on_host")
+    generate!("dai::dai_benchmark_in_send_report_every_n_messages")
+    generate!("dai::dai_benchmark_in_set_run_on_host")
+    generate!("dai::dai_benchmark_in_log_reports_as_warnings")
+    generate!("dai::dai_benchmark_in_measure_individual_latencies")
+    generate!("dai::dai_image_filters_set_default_profile_preset")
+    generate!("dai::dai_image_filters_set_run_on_host")
+    generate!("dai::dai_depth_median")
+
     // ImageManip helpers
     generate!("dai::dai_image_manip_set_num_frames_pool")
     generate!("dai::dai_image_manip_set_max_output_frame_size")
@@ -154,6 +173,9 @@ include_cpp! {
     generate!("dai::dai_image_manip_config_set_skip_current_image")
     generate!("dai::dai_image_manip_config_get_reuse_previous_image")
     generate!("dai::dai_image_manip_config_get_skip_current_image")
+    generate!("dai::dai_buffer_is_image_manip_config")
+    generate!("dai::dai_manip_template_release")
+    generate!("dai::dai_manip_template_get_allocated")
 
     // VideoEncoder helpers
     generate!("dai::dai_video_encoder_set_default_profile_preset")
@@ -207,6 +229,7 @@ include_cpp! {
 
     // Queue/frame helpers
     generate!("dai::dai_output_create_queue")
+    generate!("dai::dai_output_create_latest_queue")
     generate!("dai::dai_queue_delete")
 
     // Generic queue controls / status
@@ -231,7 +254,10 @@ include_cpp! {
 
     // Queue callbacks
     generate!("dai::dai_queue_add_callback")
+    generate!("dai::dai_queue_add_wake_callback")
     generate!("dai::dai_queue_remove_callback")
+    generate!("dai::dai_queue_waitset_release")
+    generate!("dai::dai_queue_waitset_len")
 
     // Queue send helpers
     generate!("dai::dai_queue_send")
@@ -257,6 +283,7 @@ include_cpp! {
     generate!("dai::dai_datatype_as_rgbd")
     generate!("dai::dai_datatype_as_buffer")
     generate!("dai::dai_datatype_as_message_group")
+    generate!("dai::dai_datatype_benchmark_report_json")
     generate!("dai::dai_datatype_array_len")
     generate!("dai::dai_datatype_array_take")
     generate!("dai::dai_datatype_array_free")
@@ -265,6 +292,12 @@ include_cpp! {
     generate!("dai::dai_frame_get_height")
     generate!("dai::dai_frame_get_type")
     generate!("dai::dai_frame_get_size")
+    generate!("dai::dai_image_converted_size")
+    generate!("dai::dai_frame_convert")
+    generate!("dai::dai_image_swap_rb_inplace")
+    generate!("dai::dai_frame_set_format")
+    generate!("dai::dai_frame_set_sequence_num")
+    generate!("dai::dai_frame_set_timestamp_now")
     generate!("dai::dai_frame_release")
 
     // EncodedFrame accessors
@@ -280,14 +313,26 @@ include_cpp! {
     generate!("dai::dai_encoded_frame_get_bitrate")
     generate!("dai::dai_encoded_frame_get_lossless")
     generate!("dai::dai_encoded_frame_get_instance_num")
+    generate!("dai::dai_encoded_frame_get_sequence_num")
+    generate!("dai::dai_encoded_frame_get_timestamp_ns")
+    generate!("dai::dai_encoded_frame_get_timestamp_device_ns")
     generate!("dai::dai_encoded_frame_release")
+    generate!("dai::dai_encoded_frame_set_timestamp_now")
+    generate!("dai::dai_output_send_encoded_frame")
 
     // PointCloudData accessors
     generate!("dai::dai_pointcloud_get_width")
     generate!("dai::dai_pointcloud_get_height")
     generate!("dai::dai_pointcloud_get_points_rgba")
     generate!("dai::dai_pointcloud_get_points_rgba_len")
+    generate!("dai::dai_pointcloud_get_points_rgba_stride")
+    generate!("dai::dai_pointcloud_is_zero_copy")
+    generate!("dai::dai_pointcloud_fill_soa")
     generate!("dai::dai_pointcloud_release")
+    generate!("dai::dai_depth_projector_grid_size")
+    generate!("dai::dai_depth_projector_release")
+    generate!("dai::dai_remap_table_release")
+    generate!("dai::dai_remap_cache_size")
 
     // RGBDData accessors
     generate!("dai::dai_rgbd_get_rgb_frame")
@@ -299,11 +344,15 @@ include_cpp! {
     generate!("dai::dai_input_try_get_buffer")
     generate!("dai::dai_input_get_img_frame")
     generate!("dai::dai_input_try_get_img_frame")
+    generate!("dai::dai_input_get_encoded_frame")
+    generate!("dai::dai_input_try_get_encoded_frame")
 
     // Host -> device input queue (depthai::InputQueue)
     generate!("dai::dai_input_create_input_queue")
     generate!("dai::dai_input_queue_delete")
     generate!("dai::dai_input_queue_send")
+    generate!("dai::dai_input_queue_send_buffer")
+    generate!("dai::dai_input_queue_send_img_frame")
 
     // Output send helpers
     generate!("dai::dai_output_send_buffer")
@@ -314,19 +363,40 @@ include_cpp! {
     generate!("dai::dai_message_group_release")
     generate!("dai::dai_message_group_get_buffer")
     generate!("dai::dai_message_group_get_img_frame")
+    generate!("dai::dai_group_layout_release")
+    generate!("dai::dai_group_layout_len")
 
     // Buffer helpers
     generate!("dai::dai_buffer_new")
     generate!("dai::dai_buffer_release")
     generate!("dai::dai_buffer_set_data")
+    generate!("dai::dai_buffer_get_data")
+    generate!("dai::dai_buffer_get_size")
+    generate!("dai::dai_buffer_get_capacity")
+    generate!("dai::dai_buffer_resize")
+
+    // Buffer pools
+    generate!("dai::dai_buffer_pool_new")
+    generate!("dai::dai_buffer_pool_release")
+    generate!("dai::dai_buffer_pool_acquire")
+    generate!("dai::dai_buffer_pool_acquire_frame")
+    generate!("dai::dai_buffer_pool_get_allocated")
+    generate!("dai::dai_buffer_pool_get_available")
 
     // Utilities
     generate!("dai::dai_camera_socket_name")
     generate!("dai::dai_string_to_cstring")
     generate!("dai::dai_free_cstring")
     generate!("dai::dai_get_last_error")
+    generate!("dai::dai_get_last_error_code")
     generate!("dai::dai_clear_last_error")
 
+    // Telemetry
+    generate!("dai::dai_telemetry_set_enabled")
+    generate!("dai::dai_telemetry_is_enabled")
+    generate!("dai::dai_telemetry_reset")
+    generate!("dai::dai_telemetry_snapshot_json")
+
     safety!(unsafe_ffi)
 }
 
@@ -347,6 +417,181 @@ pub type DaiRGBDData = *mut autocxx::c_void;
 pub type DaiMessageGroup = *mut autocxx::c_void;
 pub type DaiBuffer = *mut autocxx::c_void;
 pub type DaiInputQueue = *mut autocxx::c_void;
+pub type DaiBufferPool = *mut autocxx::c_void;
+pub type DaiQueueWaitSet = *mut autocxx::c_void;
+pub type DaiGroupLayout = *mut autocxx::c_void;
+pub type DaiGraphSnapshot = *mut autocxx::c_void;
+pub type DaiManipTemplate = *mut autocxx::c_void;
+pub type DaiRemapTable = *mut autocxx::c_void;
+pub type DaiDepthProjector = *mut autocxx::c_void;
+
+/// Mirrors `DaiImgFrameInfo` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct DaiImgFrameInfo {
+    pub data: *const std::ffi::c_void,
+    pub size: usize,
+    pub width: i32,
+    pub height: i32,
+    pub type_: i32,
+    pub stride: u32,
+    pub bytes_per_pixel: u32,
+    pub plane_offsets: [u32; 3],
+    pub sequence_num: i64,
+    pub timestamp_ns: i64,
+    pub timestamp_device_ns: i64,
+    pub instance_num: i32,
+    pub exposure_us: i32,
+    pub sensitivity: i32,
+    pub lens_position: i32,
+}
+
+impl Default for DaiImgFrameInfo {
+    fn default() -> Self {
+        Self {
+            data: std::ptr::null(),
+            size: 0,
+            width: 0,
+            height: 0,
+            type_: 0,
+            stride: 0,
+            bytes_per_pixel: 0,
+            plane_offsets: [0; 3],
+            sequence_num: 0,
+            timestamp_ns: 0,
+            timestamp_device_ns: 0,
+            instance_num: 0,
+            exposure_us: 0,
+            sensitivity: 0,
+            lens_position: 0,
+        }
+    }
+}
+
+/// Mirrors `DaiStrRef` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiStrRef {
+    pub offset: u32,
+    pub len: u32,
+}
+
+/// Mirrors `DaiGraphNode` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiGraphNode {
+    pub id: i32,
+    pub name: DaiStrRef,
+    pub alias: DaiStrRef,
+    pub first_port: u32,
+    pub port_count: u32,
+}
+
+/// Mirrors `DaiGraphPort` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiGraphPort {
+    pub node_id: i32,
+    pub is_output: i32,
+    pub group: DaiStrRef,
+    pub name: DaiStrRef,
+}
+
+/// Mirrors `DaiGraphConnection` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiGraphConnection {
+    pub output_id: i32,
+    pub output_group: DaiStrRef,
+    pub output_name: DaiStrRef,
+    pub input_id: i32,
+    pub input_group: DaiStrRef,
+    pub input_name: DaiStrRef,
+}
+
+/// Mirrors `DaiEncodedFrameInfo` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiEncodedFrameInfo {
+    pub width: i32,
+    pub height: i32,
+    pub profile: i32,
+    pub frame_type: i32,
+    pub instance_num: u32,
+    pub sequence_num: i64,
+    pub timestamp_ns: i64,
+    pub timestamp_device_ns: i64,
+}
+
+/// Mirrors `DaiConflationStats` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiConflationStats {
+    pub received: u64,
+    pub overwritten: u64,
+    pub coalesced: u64,
+}
+
+/// Mirrors `DaiManipOp` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiManipOp {
+    pub kind: i32,
+    pub normalized: bool,
+    pub params: [f32; 16],
+}
+
+// `DaiManipOp::kind` values; mirror `DaiManipOpKind` in `wrapper.h`.
+pub const DAI_MANIP_OP_CROP_XYWH: i32 = 0;
+pub const DAI_MANIP_OP_CROP_RECT: i32 = 1;
+pub const DAI_MANIP_OP_CROP_ROTATED_RECT: i32 = 2;
+pub const DAI_MANIP_OP_SCALE: i32 = 3;
+pub const DAI_MANIP_OP_ROTATE: i32 = 4;
+pub const DAI_MANIP_OP_ROTATE_CENTER: i32 = 5;
+pub const DAI_MANIP_OP_FLIP_HORIZONTAL: i32 = 6;
+pub const DAI_MANIP_OP_FLIP_VERTICAL: i32 = 7;
+pub const DAI_MANIP_OP_AFFINE: i32 = 8;
+pub const DAI_MANIP_OP_PERSPECTIVE: i32 = 9;
+pub const DAI_MANIP_OP_FOUR_POINTS: i32 = 10;
+pub const DAI_MANIP_OP_ROI_CROP: i32 = 11;
+pub const DAI_MANIP_OP_ROI_CROP_ROTATED: i32 = 12;
+pub const DAI_MANIP_OP_ROI_ROTATE: i32 = 13;
+
+/// Mirrors `DaiManipRoi` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiManipRoi {
+    pub x: f32,
+    pub y: f32,
+    pub width: f32,
+    pub height: f32,
+    pub angle_deg: f32,
+}
+
+/// Mirrors `DaiCameraIntrinsics` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiCameraIntrinsics {
+    pub fx: f32,
+    pub fy: f32,
+    pub cx: f32,
+    pub cy: f32,
+    pub width: i32,
+    pub height: i32,
+    pub distortion: [f32; 14],
+    pub distortion_count: i32,
+}
+
+/// Mirrors `DaiProjectionOptions` in `wrapper.h`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct DaiProjectionOptions {
+    pub depth_scale: f32,
+    pub decimation: u32,
+    pub z_min: f32,
+    pub z_max: f32,
+    pub skip_invalid: bool,
+}
 
 pub mod string_utils;
 
@@ -371,6 +616,22 @@ pub mod depthai {
             drop_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
         ) -> super::DaiNode;
 
+        pub fn dai_pipeline_create_host_node_parallel(
+            pipeline: super::DaiPipeline,
+            ctx: *mut std::ffi::c_void,
+            process_cb: Option<
+                unsafe extern "C" fn(
+                    ctx: *mut std::ffi::c_void,
+                    group: super::DaiMessageGroup,
+                ) -> super::DaiBuffer,
+            >,
+            on_start_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
+            on_stop_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
+            drop_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
+            workers: usize,
+            max_in_flight: usize,
+        ) -> super::DaiNode;
+
         pub fn dai_pipeline_create_threaded_host_node(
             pipeline: super::DaiPipeline,
             ctx: *mut std::ffi::c_void,
@@ -379,5 +640,169 @@ pub mod depthai {
             on_stop_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
             drop_cb: Option<unsafe extern "C" fn(ctx: *mut std::ffi::c_void)>,
         ) -> super::DaiNode;
+
+        pub fn dai_frame_get_info(frame: super::DaiImgFrame, out: *mut super::DaiImgFrameInfo) -> bool;
+
+        pub fn dai_frame_set_info(frame: super::DaiImgFrame, info: *const super::DaiImgFrameInfo) -> bool;
+
+        pub fn dai_encoded_frame_create(
+            data: *const std::ffi::c_void,
+            len: usize,
+            info: *const super::DaiEncodedFrameInfo,
+        ) -> super::DaiEncodedFrame;
+
+        pub fn dai_image_convert(
+            src: *const super::DaiImgFrameInfo,
+            dst_type: i32,
+            dst: *mut std::ffi::c_void,
+            dst_capacity: usize,
+        ) -> usize;
+
+        pub fn dai_queue_try_drain_frames(
+            queue: super::DaiDataQueue,
+            out: *mut super::DaiImgFrame,
+            out_info: *mut super::DaiImgFrameInfo,
+            capacity: usize,
+        ) -> usize;
+
+        pub fn dai_queue_try_drain_encoded_frames(
+            queue: super::DaiDataQueue,
+            out: *mut super::DaiEncodedFrame,
+            capacity: usize,
+        ) -> usize;
+
+        pub fn dai_queue_try_drain_rgbd(queue: super::DaiDataQueue, out: *mut super::DaiRGBDData, capacity: usize) -> usize;
+
+        pub fn dai_group_layout_new(names: *const *const std::os::raw::c_char, count: usize) -> super::DaiGroupLayout;
+
+        pub fn dai_message_group_resolve(
+            group: super::DaiMessageGroup,
+            layout: super::DaiGroupLayout,
+            out_types: *mut i32,
+            out_handles: *mut *mut autocxx::c_void,
+            out_info: *mut super::DaiImgFrameInfo,
+            capacity: usize,
+        ) -> usize;
+
+        pub fn dai_device_open_many(
+            ids: *const *const std::os::raw::c_char,
+            count: usize,
+            out: *mut super::DaiDevice,
+            out_errors: *mut *mut std::os::raw::c_char,
+            out_codes: *mut i32,
+        ) -> usize;
+
+        pub fn dai_pipeline_start_many(
+            pipelines: *mut super::DaiPipeline,
+            count: usize,
+            out_errors: *mut *mut std::os::raw::c_char,
+            out_codes: *mut i32,
+        ) -> usize;
+
+        pub fn dai_graph_snapshot_nodes(snapshot: super::DaiGraphSnapshot, count: *mut usize) -> *const super::DaiGraphNode;
+
+        pub fn dai_graph_snapshot_ports(snapshot: super::DaiGraphSnapshot, count: *mut usize) -> *const super::DaiGraphPort;
+
+        pub fn dai_graph_snapshot_connections(
+            snapshot: super::DaiGraphSnapshot,
+            count: *mut usize,
+        ) -> *const super::DaiGraphConnection;
+
+        pub fn dai_graph_snapshot_strings(snapshot: super::DaiGraphSnapshot, len: *mut usize) -> *const std::os::raw::c_char;
+
+        pub fn dai_queue_get_conflation_stats(queue: super::DaiDataQueue, out: *mut super::DaiConflationStats) -> bool;
+
+        pub fn dai_queue_waitset_new(queues: *const super::DaiDataQueue, count: usize) -> super::DaiQueueWaitSet;
+
+        pub fn dai_queue_waitset_wait(ws: super::DaiQueueWaitSet, timeout_ms: i32, ready: *mut bool) -> i32;
+
+        pub fn dai_queue_wait_any(
+            queues: *const super::DaiDataQueue,
+            count: usize,
+            timeout_ms: i32,
+            ready: *mut bool,
+        ) -> i32;
+
+        pub fn dai_queue_send_many(
+            queue: super::DaiDataQueue,
+            msgs: *const super::DaiDatatype,
+            count: usize,
+            timeout_ms: i32,
+        ) -> usize;
+
+        pub fn dai_input_queue_send_many(queue: super::DaiInputQueue, msgs: *const super::DaiDatatype, count: usize) -> usize;
+
+        pub fn dai_input_queue_send_buffers(queue: super::DaiInputQueue, buffers: *const super::DaiBuffer, count: usize) -> usize;
+
+        pub fn dai_input_queue_send_img_frames(
+            queue: super::DaiInputQueue,
+            frames: *const super::DaiImgFrame,
+            count: usize,
+        ) -> usize;
+
+        pub fn dai_manip_template_new(
+            settings: super::DaiBuffer,
+            ops: *const super::DaiManipOp,
+            count: usize,
+            max_free: usize,
+        ) -> super::DaiManipTemplate;
+
+        pub fn dai_manip_template_instantiate(tpl: super::DaiManipTemplate, roi: *const super::DaiManipRoi) -> super::DaiBuffer;
+
+        pub fn dai_manip_template_send_rois(
+            tpl: super::DaiManipTemplate,
+            config_queue: super::DaiInputQueue,
+            image_queue: super::DaiInputQueue,
+            frame: super::DaiImgFrame,
+            rois: *const super::DaiManipRoi,
+            count: usize,
+        ) -> usize;
+
+        pub fn dai_depth_projector_new(
+            intrinsics: *const super::DaiCameraIntrinsics,
+            undistort: bool,
+            threads: u32,
+        ) -> super::DaiDepthProjector;
+
+        pub fn dai_depth_projector_project_soa(
+            projector: super::DaiDepthProjector,
+            depth: *const super::DaiImgFrameInfo,
+            rgb: *const super::DaiImgFrameInfo,
+            options: *const super::DaiProjectionOptions,
+            out_x: *mut f32,
+            out_y: *mut f32,
+            out_z: *mut f32,
+            out_rgba: *mut u32,
+            capacity: usize,
+        ) -> usize;
+
+        // `out` points at `DaiPoint3fRGBA` records (layout of `depthai::Point3fRGBA`).
+        pub fn dai_depth_projector_project_points(
+            projector: super::DaiDepthProjector,
+            depth: *const super::DaiImgFrameInfo,
+            rgb: *const super::DaiImgFrameInfo,
+            options: *const super::DaiProjectionOptions,
+            out: *mut std::ffi::c_void,
+            capacity: usize,
+        ) -> usize;
+
+        pub fn dai_remap_table_get(
+            socket: i32,
+            calibration_hash: u64,
+            camera: *const super::DaiCameraIntrinsics,
+            rotation: *const f32,
+            target: *const super::DaiCameraIntrinsics,
+            out_cache_hit: *mut bool,
+        ) -> super::DaiRemapTable;
+
+        pub fn dai_remap_table_get_size(table: super::DaiRemapTable, width: *mut u32, height: *mut u32);
+
+        pub fn dai_remap_apply(
+            table: super::DaiRemapTable,
+            src: *const super::DaiImgFrameInfo,
+            dst: *mut std::ffi::c_void,
+            dst_capacity: usize,
+            nearest: bool,
+        ) -> usize;
     }
 }
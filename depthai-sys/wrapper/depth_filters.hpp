@@ -0,0 +1,497 @@
+#pragma once
+
+// Dependency-free depth filters backing the host `ImageFilters` node when DepthAI is built
+// without OpenCV (see image_filters_host.cpp).
+//
+// Every filter works on 16-bit depth or disparity where 0 marks an invalid pixel. Rows are split
+// into tiles and run on a small persistent pool; median windows use 8-lane u16 min/max (SSE2 on
+// x86-64, NEON on ARM) with a scalar path for borders and other targets, which produces the same
+// values. The vertical recursive passes select per column so the compiler can vectorize them
+// across a row; the horizontal passes carry each pixel into the next and run serially per row.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define DAI_DF_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define DAI_DF_SSE2 0
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define DAI_DF_NEON 1
+    #include <arm_neon.h>
+#else
+    #define DAI_DF_NEON 0
+#endif
+
+// Fixed set of workers that split one job into tiles; the calling thread takes tiles too.
+class _DaiTilePool {
+   public:
+    explicit _DaiTilePool(size_t threads = 0) {
+        if(threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        for(size_t i = 1; i < threads; ++i) workers.emplace_back([this] { work(); });
+    }
+
+    ~_DaiTilePool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for(auto& t : workers) t.join();
+    }
+
+    _DaiTilePool(const _DaiTilePool&) = delete;
+    _DaiTilePool& operator=(const _DaiTilePool&) = delete;
+
+    size_t threads() const {
+        return workers.size() + 1;
+    }
+
+    // Calls `fn(tile)` once for every tile in `[0, tiles)` and returns when all are done.
+    void run(size_t tiles, const std::function<void(size_t)>& fn) {
+        if(tiles <= 1 || workers.empty()) {
+            for(size_t t = 0; t < tiles; ++t) fn(t);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &fn;
+            jobTiles = tiles;
+            next.store(0, std::memory_order_relaxed);
+            active = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+        drain(fn, tiles);
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return active == 0; });
+        job = nullptr;
+    }
+
+   private:
+    void drain(const std::function<void(size_t)>& fn, size_t tiles) {
+        for(size_t t; (t = next.fetch_add(1, std::memory_order_relaxed)) < tiles;) fn(t);
+    }
+
+    void work() {
+        uint64_t seen = 0;
+        for(;;) {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stop || generation != seen; });
+            if(stop) return;
+            seen = generation;
+            const auto* fn = job;
+            const size_t tiles = jobTiles;
+            lock.unlock();
+            drain(*fn, tiles);
+            lock.lock();
+            if(--active == 0) done.notify_one();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(size_t)>* job = nullptr;
+    size_t jobTiles = 0;
+    std::atomic<size_t> next{0};
+    size_t active = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+    std::vector<std::thread> workers;
+};
+
+// Runs `fn(y0, y1)` over row bands of at least `minRows` rows.
+template <typename F>
+static void _dai_df_for_rows(_DaiTilePool& pool, size_t rows, size_t minRows, F&& fn) {
+    if(rows == 0) return;
+    const size_t maxTiles = (rows + minRows - 1) / minRows;
+    const size_t tiles = std::min(maxTiles, pool.threads() * 4);
+    const size_t band = (rows + tiles - 1) / tiles;
+    pool.run(tiles, [&](size_t t) {
+        const size_t y0 = t * band;
+        const size_t y1 = std::min(rows, y0 + band);
+        if(y0 < y1) fn(y0, y1);
+    });
+}
+
+// u16 lanes for the median networks. `Scalar` doubles as the border / fallback path.
+struct _DaiDfScalar {
+    using V = uint16_t;
+    static constexpr size_t lanes = 1;
+    static V load(const uint16_t* p) {
+        return *p;
+    }
+    static void store(uint16_t* p, V v) {
+        *p = v;
+    }
+    static V min(V a, V b) {
+        return a < b ? a : b;
+    }
+    static V max(V a, V b) {
+        return a < b ? b : a;
+    }
+    static V splat(uint16_t v) {
+        return v;
+    }
+};
+
+#if DAI_DF_SSE2
+struct _DaiDfSse2 {
+    using V = __m128i;
+    static constexpr size_t lanes = 8;
+    static V load(const uint16_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(uint16_t* p, V v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    // SSE2 has no unsigned 16-bit min/max; a - sat(a - b) and b + sat(a - b) are exact.
+    static V min(V a, V b) {
+        return _mm_sub_epi16(a, _mm_subs_epu16(a, b));
+    }
+    static V max(V a, V b) {
+        return _mm_add_epi16(b, _mm_subs_epu16(a, b));
+    }
+    static V splat(uint16_t v) {
+        return _mm_set1_epi16(static_cast<short>(v));
+    }
+};
+using _DaiDfSimd = _DaiDfSse2;
+#elif DAI_DF_NEON
+struct _DaiDfNeon {
+    using V = uint16x8_t;
+    static constexpr size_t lanes = 8;
+    static V load(const uint16_t* p) {
+        return vld1q_u16(p);
+    }
+    static void store(uint16_t* p, V v) {
+        vst1q_u16(p, v);
+    }
+    static V min(V a, V b) {
+        return vminq_u16(a, b);
+    }
+    static V max(V a, V b) {
+        return vmaxq_u16(a, b);
+    }
+    static V splat(uint16_t v) {
+        return vdupq_n_u16(v);
+    }
+};
+using _DaiDfSimd = _DaiDfNeon;
+#else
+using _DaiDfSimd = _DaiDfScalar;
+#endif
+
+// Compare-exchange networks that leave the median of the window in the middle element.
+static const uint8_t _dai_df_med9[][2] = {{1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7}, {1, 2}, {4, 5}, {7, 8}, {0, 3},
+                                          {5, 8}, {4, 7}, {3, 6}, {1, 4}, {2, 5}, {4, 7}, {4, 2}, {6, 4}, {4, 2}};
+
+static const uint8_t _dai_df_med25[][2] = {
+    {0, 1},   {3, 4},   {2, 4},   {2, 3},   {6, 7},   {5, 7},   {5, 6},   {9, 10},  {8, 10},  {8, 9},   {12, 13}, {11, 13},
+    {11, 12}, {15, 16}, {14, 16}, {14, 15}, {18, 19}, {17, 19}, {17, 18}, {21, 22}, {20, 22}, {20, 21}, {23, 24}, {2, 5},
+    {3, 6},   {0, 6},   {0, 3},   {4, 7},   {1, 7},   {1, 4},   {11, 14}, {8, 14},  {8, 11},  {12, 15}, {9, 15},  {9, 12},
+    {13, 16}, {10, 16}, {10, 13}, {20, 23}, {17, 23}, {17, 20}, {21, 24}, {18, 24}, {18, 21}, {19, 22}, {8, 17},  {9, 18},
+    {0, 18},  {0, 9},   {10, 19}, {1, 19},  {1, 10},  {11, 20}, {2, 20},  {2, 11},  {12, 21}, {3, 21},  {3, 12},  {13, 22},
+    {4, 22},  {4, 13},  {14, 23}, {5, 23},  {5, 14},  {15, 24}, {6, 24},  {6, 15},  {7, 16},  {7, 19},  {13, 21}, {15, 23},
+    {7, 13},  {7, 15},  {1, 9},   {3, 11},  {5, 17},  {11, 17}, {9, 17},  {4, 10},  {6, 12},  {7, 14},  {4, 6},   {4, 7},
+    {12, 14}, {10, 14}, {6, 7},   {10, 12}, {6, 10},  {6, 17},  {12, 17}, {7, 17},  {7, 10},  {12, 18}, {7, 12},  {10, 18},
+    {12, 20}, {10, 20}, {10, 12}};
+
+// Median of the `k`x`k` window around `lanes` consecutive pixels starting at `x`; `rows` holds the
+// (edge-clamped) source rows and `cols` the (edge-clamped) column of every window offset.
+template <typename S>
+static typename S::V _dai_df_median_at(const uint16_t* const* rows, const size_t* cols, int k) {
+    using V = typename S::V;
+    V w[49];
+    int n = 0;
+    for(int dy = 0; dy < k; ++dy)
+        for(int dx = 0; dx < k; ++dx) w[n++] = S::load(rows[dy] + cols[dx]);
+    auto sort2 = [&](int a, int b) {
+        const V lo = S::min(w[a], w[b]);
+        w[b] = S::max(w[a], w[b]);
+        w[a] = lo;
+    };
+    if(k == 3) {
+        for(const auto& p : _dai_df_med9) sort2(p[0], p[1]);
+        return w[4];
+    }
+    if(k == 5) {
+        for(const auto& p : _dai_df_med25) sort2(p[0], p[1]);
+        return w[12];
+    }
+    // 7x7: keep the 25 smallest values sorted; the largest of them is the median.
+    V keep[25];
+    for(auto& v : keep) v = S::splat(0xFFFF);
+    for(int i = 0; i < n; ++i) {
+        V e = w[i];
+        for(auto& v : keep) {
+            const V lo = S::min(v, e);
+            e = S::max(v, e);
+            v = lo;
+        }
+    }
+    return keep[24];
+}
+
+// `k`x`k` median (k = 3, 5 or 7) of `src` into `dst`, replicating edge pixels. Strides are in
+// pixels.
+static inline void _dai_df_median(_DaiTilePool& pool, const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride, size_t width, size_t height, int k) {
+    const int r = k / 2;
+    _dai_df_for_rows(pool, height, 16, [&](size_t y0, size_t y1) {
+        const uint16_t* rows[7];
+        size_t cols[7];
+        for(size_t y = y0; y < y1; ++y) {
+            for(int dy = 0; dy < k; ++dy) {
+                const auto sy = std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(y) + dy - r, 0, static_cast<std::ptrdiff_t>(height) - 1);
+                rows[dy] = src + static_cast<size_t>(sy) * srcStride;
+            }
+            uint16_t* out = dst + y * dstStride;
+            size_t x = 0;
+            auto scalarUpTo = [&](size_t end) {
+                for(; x < end; ++x) {
+                    for(int dx = 0; dx < k; ++dx) {
+                        cols[dx] = static_cast<size_t>(
+                            std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(x) + dx - r, 0, static_cast<std::ptrdiff_t>(width) - 1));
+                    }
+                    out[x] = _dai_df_median_at<_DaiDfScalar>(rows, cols, k);
+                }
+            };
+            scalarUpTo(std::min<size_t>(r, width));
+            if(width >= static_cast<size_t>(2 * r) + _DaiDfSimd::lanes) {
+                for(; x + r + _DaiDfSimd::lanes <= width; x += _DaiDfSimd::lanes) {
+                    for(int dx = 0; dx < k; ++dx) cols[dx] = x + dx - r;
+                    _DaiDfSimd::store(out + x, _dai_df_median_at<_DaiDfSimd>(rows, cols, k));
+                }
+            }
+            scalarUpTo(width);
+        }
+    });
+}
+
+struct _DaiDfSpatialParams {
+    float alpha = 0.5f;
+    // Largest neighbour difference that is still smoothed; <= 0 means 3% of the local value.
+    float delta = 0.0f;
+    int holeFillingRadius = 2;
+    int iterations = 1;
+};
+
+static inline bool _dai_df_similar(float a, float b, float delta) {
+    const float limit = delta > 0.0f ? delta : 0.03f * std::max(a, b);
+    return a > 0.0f && b > 0.0f && std::fabs(a - b) <= limit;
+}
+
+// Fills interior holes of at most 2 * radius pixels, each half from its nearest valid neighbour.
+static inline void _dai_df_fill_row(float* row, size_t width, int radius) {
+    size_t x = 0;
+    while(x < width && row[x] <= 0.0f) ++x;
+    while(x < width) {
+        ++x;
+        while(x < width && row[x] > 0.0f) ++x;
+        const size_t holeStart = x;
+        while(x < width && row[x] <= 0.0f) ++x;
+        if(x >= width) break;
+        const size_t len = x - holeStart;
+        if(len == 0 || len > static_cast<size_t>(2 * radius)) continue;
+        const float l = row[holeStart - 1];
+        const float rv = row[x];
+        for(size_t i = 0; i < len; ++i) row[holeStart + i] = i < (len + 1) / 2 ? l : rv;
+    }
+}
+
+// Edge-preserving recursive smoothing (domain transform): horizontal passes over rows, then
+// vertical passes vectorized across columns. `work` holds `width * height` floats.
+static inline void _dai_df_spatial(_DaiTilePool& pool, uint16_t* img, size_t stride, size_t width, size_t height, const _DaiDfSpatialParams& p, std::vector<float>& work) {
+    if(width == 0 || height == 0) return;
+    work.resize(width * height);
+    const float a = std::clamp(p.alpha, 0.0f, 1.0f);
+    const float b = 1.0f - a;
+    const float delta = p.delta;
+    float* buf = work.data();
+
+    _dai_df_for_rows(pool, height, 16, [&](size_t y0, size_t y1) {
+        for(size_t y = y0; y < y1; ++y) {
+            const uint16_t* s = img + y * stride;
+            float* d = buf + y * width;
+            for(size_t x = 0; x < width; ++x) d[x] = s[x];
+            if(p.holeFillingRadius > 0) _dai_df_fill_row(d, width, p.holeFillingRadius);
+        }
+    });
+
+    for(int it = 0; it < std::max(1, p.iterations); ++it) {
+        _dai_df_for_rows(pool, height, 16, [&](size_t y0, size_t y1) {
+            for(size_t y = y0; y < y1; ++y) {
+                float* d = buf + y * width;
+                for(size_t x = 1; x < width; ++x) {
+                    if(_dai_df_similar(d[x], d[x - 1], delta)) d[x] = a * d[x] + b * d[x - 1];
+                }
+                for(size_t x = width - 1; x-- > 0;) {
+                    if(_dai_df_similar(d[x], d[x + 1], delta)) d[x] = a * d[x] + b * d[x + 1];
+                }
+            }
+        });
+        // Column bands of 64 floats keep neighbouring tiles off each other's cache lines.
+        const size_t bands = (width + 63) / 64;
+        _dai_df_for_rows(pool, bands, 1, [&](size_t b0, size_t b1) {
+            const size_t x0 = b0 * 64;
+            const size_t x1 = std::min(width, b1 * 64);
+            for(size_t y = 1; y < height; ++y) {
+                float* cur = buf + y * width;
+                const float* prev = cur - width;
+                for(size_t x = x0; x < x1; ++x) {
+                    const float c = cur[x];
+                    const float q = prev[x];
+                    cur[x] = _dai_df_similar(c, q, delta) ? a * c + b * q : c;
+                }
+            }
+            for(size_t y = height - 1; y-- > 0;) {
+                float* cur = buf + y * width;
+                const float* prev = cur + width;
+                for(size_t x = x0; x < x1; ++x) {
+                    const float c = cur[x];
+                    const float q = prev[x];
+                    cur[x] = _dai_df_similar(c, q, delta) ? a * c + b * q : c;
+                }
+            }
+        });
+    }
+
+    _dai_df_for_rows(pool, height, 16, [&](size_t y0, size_t y1) {
+        for(size_t y = y0; y < y1; ++y) {
+            const float* s = buf + y * width;
+            uint16_t* d = img + y * stride;
+            for(size_t x = 0; x < width; ++x) d[x] = static_cast<uint16_t>(std::min(s[x] + 0.5f, 65535.0f));
+        }
+    });
+}
+
+struct _DaiDfTemporalParams {
+    float alpha = 0.4f;
+    // Same meaning as `_DaiDfSpatialParams::delta`.
+    float delta = 0.0f;
+    // Values of DepthAI's `TemporalFilter::PersistencyMode` (0 = off ... 8 = indefinitely).
+    int persistency = 3;
+};
+
+// Per-stream history for the temporal filter; reset whenever the resolution changes.
+struct _DaiDfTemporalState {
+    size_t width = 0;
+    size_t height = 0;
+    std::vector<float> last;
+    std::vector<uint8_t> history;
+};
+
+// Last-8-frames validity mask and the number of valid frames required to keep a stale value.
+static inline void _dai_df_persistency(int mode, uint8_t& mask, int& need) {
+    static const uint8_t masks[] = {0x00, 0xFF, 0x07, 0x0F, 0xFF, 0x03, 0x1F, 0xFF, 0x00};
+    static const int needs[] = {9, 8, 2, 2, 2, 1, 1, 1, 0};
+    mode = std::clamp(mode, 0, 8);
+    mask = masks[mode];
+    need = needs[mode];
+}
+
+static inline int _dai_df_popcount8(uint8_t v) {
+    v = static_cast<uint8_t>(v - ((v >> 1) & 0x55));
+    v = static_cast<uint8_t>((v & 0x33) + ((v >> 2) & 0x33));
+    return (v + (v >> 4)) & 0x0F;
+}
+
+// Blends each pixel with its history where the two agree, and holds the last valid value over
+// dropouts while the persistency rule allows it.
+static inline void _dai_df_temporal(_DaiTilePool& pool, uint16_t* img, size_t stride, size_t width, size_t height, const _DaiDfTemporalParams& p, _DaiDfTemporalState& st) {
+    if(st.width != width || st.height != height) {
+        st.width = width;
+        st.height = height;
+        st.last.assign(width * height, 0.0f);
+        st.history.assign(width * height, 0);
+    }
+    const float a = std::clamp(p.alpha, 0.0f, 1.0f);
+    const float b = 1.0f - a;
+    uint8_t mask;
+    int need;
+    _dai_df_persistency(p.persistency, mask, need);
+    _dai_df_for_rows(pool, height, 16, [&](size_t y0, size_t y1) {
+        for(size_t y = y0; y < y1; ++y) {
+            uint16_t* d = img + y * stride;
+            float* last = st.last.data() + y * width;
+            uint8_t* hist = st.history.data() + y * width;
+            for(size_t x = 0; x < width; ++x) {
+                const float c = d[x];
+                const float q = last[x];
+                const uint8_t h = hist[x];
+                float out;
+                if(c > 0.0f) {
+                    out = _dai_df_similar(c, q, p.delta) ? a * c + b * q : c;
+                    last[x] = out;
+                    hist[x] = static_cast<uint8_t>((h << 1) | 1);
+                } else {
+                    const bool keep = q > 0.0f && _dai_df_popcount8(h & mask) >= need;
+                    out = keep ? q : 0.0f;
+                    hist[x] = static_cast<uint8_t>(h << 1);
+                }
+                d[x] = static_cast<uint16_t>(std::min(out + 0.5f, 65535.0f));
+            }
+        }
+    });
+}
+
+// Invalidates 4-connected blobs of at most `maxSize` pixels whose neighbours differ by at most
+// `maxDiff`. Blobs span tiles, so this one runs on the calling thread.
+struct _DaiDfSpeckleScratch {
+    std::vector<uint32_t> labels;
+    std::vector<uint32_t> stack;
+    std::vector<uint32_t> blob;
+};
+
+static inline void _dai_df_speckle(uint16_t* img, size_t stride, size_t width, size_t height, uint32_t maxSize, uint32_t maxDiff, _DaiDfSpeckleScratch& scratch) {
+    if(maxSize == 0 || width == 0 || height == 0) return;
+    auto& labels = scratch.labels;
+    auto& stack = scratch.stack;
+    auto& blob = scratch.blob;
+    labels.assign(width * height, 0);
+    uint32_t label = 0;
+    for(size_t y = 0; y < height; ++y) {
+        for(size_t x = 0; x < width; ++x) {
+            const size_t i = y * width + x;
+            if(labels[i] != 0 || img[y * stride + x] == 0) continue;
+            ++label;
+            labels[i] = label;
+            blob.clear();
+            stack.clear();
+            stack.push_back(static_cast<uint32_t>(i));
+            while(!stack.empty()) {
+                const uint32_t p = stack.back();
+                stack.pop_back();
+                blob.push_back(p);
+                const size_t px = p % width;
+                const size_t py = p / width;
+                const int v = img[py * stride + px];
+                auto visit = [&](size_t nx, size_t ny) {
+                    const size_t n = ny * width + nx;
+                    const int nv = img[ny * stride + nx];
+                    if(labels[n] != 0 || nv == 0 || static_cast<uint32_t>(std::abs(nv - v)) > maxDiff) return;
+                    labels[n] = label;
+                    stack.push_back(static_cast<uint32_t>(n));
+                };
+                if(px > 0) visit(px - 1, py);
+                if(px + 1 < width) visit(px + 1, py);
+                if(py > 0) visit(px, py - 1);
+                if(py + 1 < height) visit(px, py + 1);
+            }
+            if(blob.size() <= maxSize) {
+                for(const uint32_t p : blob) img[(p / width) * stride + p % width] = 0;
+            }
+        }
+    }
+}
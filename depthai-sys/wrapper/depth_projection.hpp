@@ -0,0 +1,228 @@
+#pragma once
+
+// Host depth -> point cloud projection backing `dai_depth_projector_*`.
+//
+// Rays are precomputed once per intrinsics: one table per axis for a pinhole camera, or one
+// entry per pixel when lens distortion is inverted. Projection is then a multiply per coordinate;
+// dense rows use 8-lane u16 -> f32 conversion (SSE2 / NEON, scalar elsewhere) and row bands run
+// on the same tile pool as the host depth filters. Points are written branch-free, so skipping
+// invalid pixels costs one compaction pass over the band results.
+
+#include <cstring>
+#include <mutex>
+
+#include "depth_filters.hpp"
+
+struct _DaiPinhole {
+    float fx = 0.0f;
+    float fy = 0.0f;
+    float cx = 0.0f;
+    float cy = 0.0f;
+    size_t width = 0;
+    size_t height = 0;
+    // OpenCV order: k1, k2, p1, p2, k3, k4, k5, k6, s1, s2, s3, s4.
+    std::vector<float> distortion;
+};
+
+struct _DaiProjectParams {
+    float depthScale = 0.001f;
+    size_t decimation = 1;
+    float zMin = 0.0f;
+    float zMax = 1e30f;
+    bool skipInvalid = true;
+};
+
+// Packed 3-byte pixels aligned with the depth frame (any resolution; sampled nearest).
+struct _DaiColorView {
+    const uint8_t* data = nullptr;
+    size_t stride = 0;
+    size_t width = 0;
+    size_t height = 0;
+    bool bgr = false;
+};
+
+// Normalized undistorted ray of distorted normalized coordinates (xd, yd), as cv::undistortPoints.
+static inline void _dai_undistort_ray(const std::vector<float>& k, float xd, float yd, float& x, float& y) {
+    float c[12] = {};
+    for(size_t i = 0; i < std::min<size_t>(12, k.size()); ++i) c[i] = k[i];
+    x = xd;
+    y = yd;
+    for(int it = 0; it < 10; ++it) {
+        const float r2 = x * x + y * y;
+        const float num = 1.0f + ((c[7] * r2 + c[6]) * r2 + c[5]) * r2;
+        const float den = 1.0f + ((c[4] * r2 + c[1]) * r2 + c[0]) * r2;
+        const float icdist = den != 0.0f ? num / den : 1.0f;
+        const float dx = 2.0f * c[2] * x * y + c[3] * (r2 + 2.0f * x * x) + c[8] * r2 + c[9] * r2 * r2;
+        const float dy = c[2] * (r2 + 2.0f * y * y) + 2.0f * c[3] * x * y + c[10] * r2 + c[11] * r2 * r2;
+        x = (xd - dx) * icdist;
+        y = (yd - dy) * icdist;
+    }
+}
+
+class _DaiDepthProjector {
+   public:
+    _DaiDepthProjector(const _DaiPinhole& k, bool undistort, size_t threads) : width(k.width), height(k.height), pool(threads) {
+        const bool distorted = undistort && std::any_of(k.distortion.begin(), k.distortion.end(), [](float c) { return c != 0.0f; });
+        if(!distorted) {
+            rayX.resize(width);
+            rayY.resize(height);
+            for(size_t u = 0; u < width; ++u) rayX[u] = (static_cast<float>(u) - k.cx) / k.fx;
+            for(size_t v = 0; v < height; ++v) rayY[v] = (static_cast<float>(v) - k.cy) / k.fy;
+            return;
+        }
+        perPixel = true;
+        rayX.resize(width * height);
+        rayY.resize(width * height);
+        for(size_t v = 0; v < height; ++v) {
+            for(size_t u = 0; u < width; ++u) {
+                const float xd = (static_cast<float>(u) - k.cx) / k.fx;
+                const float yd = (static_cast<float>(v) - k.cy) / k.fy;
+                _dai_undistort_ray(k.distortion, xd, yd, rayX[v * width + u], rayY[v * width + u]);
+            }
+        }
+    }
+
+    // Output grid size for `decimation`.
+    size_t outWidth(size_t decimation) const {
+        return (width + decimation - 1) / decimation;
+    }
+    size_t outHeight(size_t decimation) const {
+        return (height + decimation - 1) / decimation;
+    }
+
+    // Projects `depth` (width x height u16, `stride` pixels per row) into `out`, which needs
+    // room for `outWidth * outHeight` points and provides
+    //   put(index, x, y, z, rgba)  and  move(dst, src, count).
+    // Returns the number of points: all grid points (zeros where invalid) unless `skipInvalid`.
+    template <typename Out>
+    size_t project(const uint16_t* depth, size_t stride, const _DaiColorView& color, const _DaiProjectParams& p, Out& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const size_t dec = std::max<size_t>(1, p.decimation);
+        const size_t ow = outWidth(dec);
+        const size_t oh = outHeight(dec);
+        if(color.data) {
+            colorCol.resize(ow);
+            for(size_t i = 0; i < ow; ++i) colorCol[i] = std::min(color.width - 1, i * dec * color.width / width) * 3;
+        }
+
+        const size_t tiles = std::min(oh, pool.threads() * 4);
+        const size_t band = tiles ? (oh + tiles - 1) / tiles : 0;
+        counts.assign(tiles, 0);
+        // One scratch row per tile, kept across calls: only a larger (tiles, ow) reallocates.
+        if(scratchZ.size() < tiles * ow) {
+            scratchX.resize(tiles * ow);
+            scratchY.resize(tiles * ow);
+            scratchZ.resize(tiles * ow);
+            scratchValid.resize(tiles * ow);
+        }
+        pool.run(tiles, [&](size_t t) {
+            const size_t r0 = t * band;
+            const size_t r1 = std::min(oh, r0 + band);
+            float* xs = scratchX.data() + t * ow;
+            float* ys = scratchY.data() + t * ow;
+            float* zs = scratchZ.data() + t * ow;
+            uint8_t* valid = scratchValid.data() + t * ow;
+            size_t n = r0 * ow;
+            for(size_t r = r0; r < r1; ++r) {
+                const size_t v = r * dec;
+                row(depth + v * stride, v, dec, ow, p, xs, ys, zs, valid);
+                const uint8_t* crow = nullptr;
+                if(color.data) crow = color.data + std::min(color.height - 1, v * color.height / height) * color.stride;
+                for(size_t i = 0; i < ow; ++i) {
+                    uint32_t rgba = 0;
+                    if(crow) {
+                        const uint8_t* px = crow + colorCol[i];
+                        const uint32_t r8 = px[color.bgr ? 2 : 0], g8 = px[1], b8 = px[color.bgr ? 0 : 2];
+                        rgba = (r8 << 24) | (g8 << 16) | (b8 << 8) | 0xffu;
+                    }
+                    out.put(n, xs[i], ys[i], zs[i], rgba);
+                    n += p.skipInvalid ? valid[i] : 1;
+                }
+            }
+            counts[t] = n - r0 * ow;
+        });
+
+        size_t total = 0;
+        for(size_t t = 0; t < tiles; ++t) {
+            const size_t src = t * band * ow;
+            if(src != total && counts[t]) out.move(total, src, counts[t]);
+            total += counts[t];
+        }
+        return total;
+    }
+
+    const size_t width;
+    const size_t height;
+
+   private:
+    // Fills one output row; invalid or out-of-range pixels get zero coordinates.
+    void row(const uint16_t* d, size_t v, size_t dec, size_t ow, const _DaiProjectParams& p, float* xs, float* ys, float* zs, uint8_t* valid) const {
+        size_t i = 0;
+        if(dec == 1 && !perPixel) {
+            const float ry = rayY[v];
+#if DAI_DF_SSE2
+            const __m128 scale = _mm_set1_ps(p.depthScale), zmin = _mm_set1_ps(p.zMin), zmax = _mm_set1_ps(p.zMax), ryv = _mm_set1_ps(ry);
+            const __m128i zero = _mm_setzero_si128();
+            for(; i + 8 <= ow; i += 8) {
+                const __m128i d16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+                for(int h = 0; h < 2; ++h) {
+                    const __m128i d32 = h ? _mm_unpackhi_epi16(d16, zero) : _mm_unpacklo_epi16(d16, zero);
+                    const __m128 z = _mm_mul_ps(_mm_cvtepi32_ps(d32), scale);
+                    const __m128 nz = _mm_castsi128_ps(_mm_xor_si128(_mm_cmpeq_epi32(d32, zero), _mm_set1_epi32(-1)));
+                    const __m128 ok = _mm_and_ps(nz, _mm_and_ps(_mm_cmpge_ps(z, zmin), _mm_cmple_ps(z, zmax)));
+                    const __m128 zk = _mm_and_ps(z, ok);
+                    const size_t j = i + 4 * h;
+                    _mm_storeu_ps(zs + j, zk);
+                    _mm_storeu_ps(xs + j, _mm_mul_ps(_mm_loadu_ps(rayX.data() + j), zk));
+                    _mm_storeu_ps(ys + j, _mm_mul_ps(ryv, zk));
+                    const int m = _mm_movemask_ps(ok);
+                    for(int k = 0; k < 4; ++k) valid[j + k] = static_cast<uint8_t>((m >> k) & 1);
+                }
+            }
+#elif DAI_DF_NEON
+            const float32x4_t scale = vdupq_n_f32(p.depthScale), zmin = vdupq_n_f32(p.zMin), zmax = vdupq_n_f32(p.zMax), ryv = vdupq_n_f32(ry);
+            for(; i + 8 <= ow; i += 8) {
+                const uint16x8_t d16 = vld1q_u16(d + i);
+                for(int h = 0; h < 2; ++h) {
+                    const uint32x4_t d32 = vmovl_u16(h ? vget_high_u16(d16) : vget_low_u16(d16));
+                    const float32x4_t z = vmulq_f32(vcvtq_f32_u32(d32), scale);
+                    const uint32x4_t ok = vandq_u32(vtstq_u32(d32, d32), vandq_u32(vcgeq_f32(z, zmin), vcleq_f32(z, zmax)));
+                    const float32x4_t zk = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(z), ok));
+                    const size_t j = i + 4 * h;
+                    vst1q_f32(zs + j, zk);
+                    vst1q_f32(xs + j, vmulq_f32(vld1q_f32(rayX.data() + j), zk));
+                    vst1q_f32(ys + j, vmulq_f32(ryv, zk));
+                    uint32_t lanes[4];
+                    vst1q_u32(lanes, ok);
+                    for(int k = 0; k < 4; ++k) valid[j + k] = static_cast<uint8_t>(lanes[k] & 1);
+                }
+            }
+#endif
+        }
+        for(; i < ow; ++i) {
+            const size_t u = i * dec;
+            const uint16_t raw = d[u];
+            const float z = static_cast<float>(raw) * p.depthScale;
+            const bool ok = raw != 0 && z >= p.zMin && z <= p.zMax;
+            const float zk = ok ? z : 0.0f;
+            const float rx = perPixel ? rayX[v * width + u] : rayX[u];
+            const float ry = perPixel ? rayY[v * width + u] : rayY[v];
+            xs[i] = rx * zk;
+            ys[i] = ry * zk;
+            zs[i] = zk;
+            valid[i] = ok;
+        }
+    }
+
+    bool perPixel = false;
+    std::vector<float> rayX;
+    std::vector<float> rayY;
+    std::vector<size_t> colorCol;
+    std::vector<size_t> counts;
+    std::vector<float> scratchX;
+    std::vector<float> scratchY;
+    std::vector<float> scratchZ;
+    std::vector<uint8_t> scratchValid;
+    _DaiTilePool pool;
+    std::mutex mutex;
+};
@@ -0,0 +1,206 @@
+#include "depthai/pipeline/node/ImageFilters.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+#include "depth_filters.hpp"
+
+// Host implementation of `ImageFilters` for builds where DepthAI is built without OpenCV support.
+// When linking against a depthai-core that *does* provide these symbols (e.g. static
+// libdepthai-core.a), we must not create strong duplicate definitions.
+//
+// On ELF platforms (Linux), marking them weak allows the real definitions to win.
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__))
+#    define DEPTHAI_RS_WEAK __attribute__((weak))
+#else
+#    define DEPTHAI_RS_WEAK
+#endif
+
+namespace dai::node {
+
+namespace {
+[[noreturn]] void throw_not_available(const char* name) {
+    throw std::runtime_error(std::string(name) + " is unavailable because DepthAI was built without OpenCV support.");
+}
+
+using FilterParamsT = decltype(ImageFiltersConfig::filterParams)::value_type;
+
+// One configured filter plus the state it carries between frames.
+struct HostFilter {
+    FilterParamsT params;
+    _DaiDfTemporalState temporal;
+};
+
+class HostFilterChain {
+   public:
+    void configure(const ImageFiltersConfig& config) {
+        // A config with `filterIndices` updates those filters in place and keeps their state;
+        // otherwise it replaces the whole chain.
+        if(!config.filterIndices.empty() && config.filterIndices.size() == config.filterParams.size()) {
+            for(size_t i = 0; i < config.filterIndices.size(); ++i) {
+                const auto idx = config.filterIndices[i];
+                if(idx >= 0 && static_cast<size_t>(idx) < entries.size()) entries[idx].params = config.filterParams[i];
+            }
+            return;
+        }
+        entries.clear();
+        for(const auto& p : config.filterParams) entries.push_back(HostFilter{p, {}});
+    }
+
+    // Filters `width`x`height` depth pixels in `img` (row stride `stride` pixels) in place.
+    void apply(uint16_t* img, size_t stride, size_t width, size_t height) {
+        for(auto& f : entries) {
+            std::visit([&](const auto& p) { applyOne(f, p, img, stride, width, height); }, f.params);
+        }
+    }
+
+   private:
+    template <typename P>
+    void applyOne(HostFilter& f, const P& p, uint16_t* img, size_t stride, size_t width, size_t height) {
+        using T = std::decay_t<P>;
+        if constexpr(std::is_same_v<T, filters::params::MedianFilter>) {
+            const int k = static_cast<int>(p);
+            if(k != 3 && k != 5 && k != 7) return;
+            scratch.resize(width * height);
+            _dai_df_median(pool, img, stride, scratch.data(), width, width, height, k);
+            for(size_t y = 0; y < height; ++y) std::memcpy(img + y * stride, scratch.data() + y * width, width * sizeof(uint16_t));
+        } else if constexpr(std::is_same_v<T, filters::params::SpatialFilter>) {
+            if(!p.enable) return;
+            _DaiDfSpatialParams sp;
+            sp.alpha = p.alpha;
+            sp.delta = static_cast<float>(p.delta);
+            sp.holeFillingRadius = p.holeFillingRadius;
+            sp.iterations = p.numIterations;
+            _dai_df_spatial(pool, img, stride, width, height, sp, work);
+        } else if constexpr(std::is_same_v<T, filters::params::TemporalFilter>) {
+            if(!p.enable) return;
+            _DaiDfTemporalParams tp;
+            tp.alpha = p.alpha;
+            tp.delta = static_cast<float>(p.delta);
+            tp.persistency = static_cast<int>(p.persistencyMode);
+            _dai_df_temporal(pool, img, stride, width, height, tp, f.temporal);
+        } else if constexpr(std::is_same_v<T, filters::params::SpeckleFilter>) {
+            if(!p.enable) return;
+            _dai_df_speckle(img, stride, width, height, p.speckleRange, p.differenceThreshold, speckle);
+        }
+    }
+
+    std::vector<HostFilter> entries;
+    _DaiTilePool pool;
+    std::vector<uint16_t> scratch;
+    std::vector<float> work;
+    _DaiDfSpeckleScratch speckle;
+};
+}  // namespace
+
+DEPTHAI_RS_WEAK std::shared_ptr<ImageFilters> ImageFilters::build(Node::Output& input, ImageFiltersPresetMode presetMode) {
+    input.link(this->input);
+    setDefaultProfilePreset(presetMode);
+    return std::static_pointer_cast<ImageFilters>(shared_from_this());
+}
+
+DEPTHAI_RS_WEAK std::shared_ptr<ImageFilters> ImageFilters::build(ImageFiltersPresetMode presetMode) {
+    setDefaultProfilePreset(presetMode);
+    return std::static_pointer_cast<ImageFilters>(shared_from_this());
+}
+
+// Filters RAW16 frames (depth or disparity, 0 = invalid) with the configured chain; other frame
+// types pass through unchanged.
+DEPTHAI_RS_WEAK void ImageFilters::run() {
+    HostFilterChain chain;
+    chain.configure(*initialConfig);
+    while(isRunning()) {
+        std::shared_ptr<ImgFrame> frame;
+        try {
+            frame = input.get<ImgFrame>();
+            if(auto config = inputConfig.tryGet<ImageFiltersConfig>()) chain.configure(*config);
+        } catch(const MessageQueue::QueueException&) {
+            break;
+        }
+        if(!frame) continue;
+        if(frame->getType() != ImgFrame::Type::RAW16) {
+            output.send(frame);
+            continue;
+        }
+
+        const size_t width = frame->getWidth();
+        const size_t height = frame->getHeight();
+        const size_t strideBytes = frame->getStride() != 0 ? frame->getStride() : width * sizeof(uint16_t);
+        const auto src = frame->getData();
+        if(width == 0 || height == 0 || strideBytes % sizeof(uint16_t) != 0 || src.size() < strideBytes * (height - 1) + width * sizeof(uint16_t)) {
+            output.send(frame);
+            continue;
+        }
+
+        // Keep the source layout (stride and padding) so the copied metadata stays valid.
+        std::vector<std::uint8_t> bytes(src.begin(), src.end());
+        chain.apply(reinterpret_cast<uint16_t*>(bytes.data()), strideBytes / sizeof(uint16_t), width, height);
+        auto out = std::make_shared<ImgFrame>();
+        out->setMetadata(*frame);
+        out->setData(std::move(bytes));
+        output.send(out);
+    }
+}
+
+DEPTHAI_RS_WEAK void ImageFilters::setRunOnHost(bool runOnHost) {
+    runOnHostVar = runOnHost;
+}
+
+DEPTHAI_RS_WEAK bool ImageFilters::runOnHost() const {
+    return runOnHostVar;
+}
+
+// Speckle -> median -> spatial -> temporal chains, stronger for longer ranges where ToF depth is noisier.
+DEPTHAI_RS_WEAK void ImageFilters::setDefaultProfilePreset(ImageFiltersPresetMode mode) {
+    filters::params::SpatialFilter spatial;
+    spatial.enable = true;
+    filters::params::TemporalFilter temporal;
+    temporal.enable = true;
+    filters::params::SpeckleFilter speckle;
+    speckle.enable = true;
+    auto median = filters::params::MedianFilter::KERNEL_3x3;
+    switch(mode) {
+        case ImageFiltersPresetMode::TOF_LOW_RANGE:
+            spatial.alpha = 0.5f;
+            temporal.alpha = 0.5f;
+            break;
+        case ImageFiltersPresetMode::TOF_MID_RANGE:
+            median = filters::params::MedianFilter::KERNEL_5x5;
+            spatial.alpha = 0.4f;
+            temporal.alpha = 0.4f;
+            break;
+        case ImageFiltersPresetMode::TOF_HIGH_RANGE:
+        default:
+            median = filters::params::MedianFilter::KERNEL_5x5;
+            spatial.alpha = 0.3f;
+            spatial.numIterations = 2;
+            temporal.alpha = 0.3f;
+            break;
+    }
+    initialConfig->filterIndices.clear();
+    initialConfig->filterParams = {speckle, median, spatial, temporal};
+}
+
+DEPTHAI_RS_WEAK std::shared_ptr<ToFDepthConfidenceFilter> ToFDepthConfidenceFilter::build(Node::Output&, Node::Output&, ImageFiltersPresetMode) {
+    throw_not_available("ToFDepthConfidenceFilter");
+}
+
+DEPTHAI_RS_WEAK std::shared_ptr<ToFDepthConfidenceFilter> ToFDepthConfidenceFilter::build(ImageFiltersPresetMode) {
+    throw_not_available("ToFDepthConfidenceFilter");
+}
+
+DEPTHAI_RS_WEAK void ToFDepthConfidenceFilter::run() {
+    throw_not_available("ToFDepthConfidenceFilter");
+}
+
+DEPTHAI_RS_WEAK void ToFDepthConfidenceFilter::setRunOnHost(bool runOnHost) {
+    runOnHostVar = runOnHost;
+}
+
+DEPTHAI_RS_WEAK bool ToFDepthConfidenceFilter::runOnHost() const {
+    return runOnHostVar;
+}
+
+}  // namespace dai::node
@@ -0,0 +1,270 @@
+#pragma once
+
+// Host undistortion / rectification remap backing `dai_remap_*`.
+//
+// Maps follow cv::initUndistortRectifyMap and are stored in fixed point like OpenCV's
+// CV_16SC2 + interpolation index form: integer source coordinates plus 5-bit x/y fractions.
+// Remapping then needs no float math per pixel and runs in row bands on a shared tile pool.
+// Tables are immutable once built, so one table serves any number of nodes and threads.
+
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include "depth_filters.hpp"
+
+struct _DaiRemapCamera {
+    double fx = 0.0;
+    double fy = 0.0;
+    double cx = 0.0;
+    double cy = 0.0;
+    // OpenCV order: k1, k2, p1, p2, k3, k4, k5, k6, s1, s2, s3, s4.
+    double k[12] = {};
+};
+
+static constexpr int _DAI_REMAP_BITS = 5;
+static constexpr int _DAI_REMAP_ONE = 1 << _DAI_REMAP_BITS;
+
+// Runs `fn(y0, y1)` over row bands on the shared remap pool. `_DaiTilePool::run` takes one job
+// at a time, so a caller that finds the pool busy runs its rows inline instead of queueing:
+// concurrent remaps then proceed in parallel on their callers' threads.
+template <typename F>
+static void _dai_remap_for_rows(size_t rows, size_t minRows, F&& fn) {
+    static _DaiTilePool pool;
+    static std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if(!lock.owns_lock()) {
+        if(rows) fn(0, rows);
+        return;
+    }
+    _dai_df_for_rows(pool, rows, minRows, fn);
+}
+
+class _DaiRemapTable {
+   public:
+    // Output `width` x `height` pixels looked up in a `srcWidth` x `srcHeight` image of `camera`.
+    // `rotation` (row-major 3x3, may be null) rectifies like cv::stereoRectify's R; `target` are
+    // the intrinsics of the output image (the camera itself when undistorting only).
+    _DaiRemapTable(const _DaiRemapCamera& camera,
+                   const double* rotation,
+                   const _DaiRemapCamera& target,
+                   size_t width,
+                   size_t height,
+                   size_t srcWidth,
+                   size_t srcHeight)
+        : width(width), height(height), srcWidth(srcWidth), srcHeight(srcHeight), xy(width * height * 2), frac(width * height) {
+        double r[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+        if(rotation) std::memcpy(r, rotation, sizeof(r));
+        const double* k = camera.k;
+        _dai_remap_for_rows(height, 16, [&](size_t y0, size_t y1) {
+            for(size_t v = y0; v < y1; ++v) {
+                for(size_t u = 0; u < width; ++u) {
+                    const double xn = (static_cast<double>(u) - target.cx) / target.fx;
+                    const double yn = (static_cast<double>(v) - target.cy) / target.fy;
+                    // R^T maps the rectified ray back into the camera frame.
+                    const double X = r[0] * xn + r[3] * yn + r[6];
+                    const double Y = r[1] * xn + r[4] * yn + r[7];
+                    const double W = r[2] * xn + r[5] * yn + r[8];
+                    const size_t i = v * width + u;
+                    if(W <= 0.0) {
+                        invalidate(i);
+                        continue;
+                    }
+                    const double x = X / W, y = Y / W;
+                    const double r2 = x * x + y * y, r4 = r2 * r2, r6 = r4 * r2;
+                    const double kr = (1.0 + k[0] * r2 + k[1] * r4 + k[4] * r6) / (1.0 + k[5] * r2 + k[6] * r4 + k[7] * r6);
+                    const double xd = x * kr + 2.0 * k[2] * x * y + k[3] * (r2 + 2.0 * x * x) + k[8] * r2 + k[9] * r4;
+                    const double yd = y * kr + k[2] * (r2 + 2.0 * y * y) + 2.0 * k[3] * x * y + k[10] * r2 + k[11] * r4;
+                    store(i, camera.fx * xd + camera.cx, camera.fy * yd + camera.cy);
+                }
+            }
+        });
+    }
+
+    // Remaps tightly packed `bpp`-byte pixels (1 = GRAY8, 2 = 16-bit, 3 = 24-bit interleaved) from
+    // `src` (row stride in bytes) into packed `dst`. 16-bit data is sampled nearest when `nearest`,
+    // which keeps depth values from being blended across edges. Unmapped pixels become zero.
+    void apply(const uint8_t* src, size_t srcStride, size_t bpp, bool nearest, uint8_t* dst) const {
+        _dai_remap_for_rows(height, 8, [&](size_t y0, size_t y1) {
+            for(size_t v = y0; v < y1; ++v) {
+                uint8_t* out = dst + v * width * bpp;
+                const size_t base = v * width;
+                switch(bpp) {
+                    case 1:
+                        row<uint8_t, 1>(src, srcStride, base, nearest, out);
+                        break;
+                    case 2:
+                        row<uint16_t, 1>(src, srcStride, base, nearest, out);
+                        break;
+                    default:
+                        row<uint8_t, 3>(src, srcStride, base, nearest, out);
+                        break;
+                }
+            }
+        });
+    }
+
+    const size_t width;
+    const size_t height;
+    const size_t srcWidth;
+    const size_t srcHeight;
+
+   private:
+    void invalidate(size_t i) {
+        xy[2 * i] = -1;
+        xy[2 * i + 1] = -1;
+        frac[i] = 0;
+    }
+
+    // Rounds to 1/32 pixel. The last row / column is clamped so bilinear taps stay inside.
+    void store(size_t i, double mx, double my) {
+        const double limX = static_cast<double>(srcWidth - 1), limY = static_cast<double>(srcHeight - 1);
+        if(!(mx > -0.5 && my > -0.5 && mx < limX + 0.5 && my < limY + 0.5)) {
+            invalidate(i);
+            return;
+        }
+        const long ix = std::lround(std::min(std::max(mx, 0.0), limX) * _DAI_REMAP_ONE);
+        const long iy = std::lround(std::min(std::max(my, 0.0), limY) * _DAI_REMAP_ONE);
+        long x0 = ix >> _DAI_REMAP_BITS, y0 = iy >> _DAI_REMAP_BITS;
+        long fx = ix & (_DAI_REMAP_ONE - 1), fy = iy & (_DAI_REMAP_ONE - 1);
+        if(x0 >= static_cast<long>(srcWidth) - 1) {
+            x0 = static_cast<long>(srcWidth) - 1;
+            fx = 0;
+        }
+        if(y0 >= static_cast<long>(srcHeight) - 1) {
+            y0 = static_cast<long>(srcHeight) - 1;
+            fy = 0;
+        }
+        xy[2 * i] = static_cast<int16_t>(x0);
+        xy[2 * i + 1] = static_cast<int16_t>(y0);
+        frac[i] = static_cast<uint16_t>(fx | (fy << _DAI_REMAP_BITS));
+    }
+
+    template <typename T, size_t C>
+    void row(const uint8_t* src, size_t srcStride, size_t base, bool nearest, uint8_t* outBytes) const {
+        T* out = reinterpret_cast<T*>(outBytes);
+        constexpr int shift = 2 * _DAI_REMAP_BITS;
+        for(size_t u = 0; u < width; ++u) {
+            const int16_t x0 = xy[2 * (base + u)], y0 = xy[2 * (base + u) + 1];
+            T* px = out + u * C;
+            if(x0 < 0) {
+                for(size_t c = 0; c < C; ++c) px[c] = 0;
+                continue;
+            }
+            const int f = frac[base + u];
+            const int fx = f & (_DAI_REMAP_ONE - 1), fy = f >> _DAI_REMAP_BITS;
+            // Taps past the clamped edge use a zero weight, so a zero step keeps them in bounds.
+            const size_t dx = fx ? C : 0, dy = fy ? srcStride : 0;
+            const uint8_t* p00 = src + static_cast<size_t>(y0) * srcStride + static_cast<size_t>(x0) * C * sizeof(T);
+            if(nearest) {
+                const uint8_t* p = p00 + (fx >= _DAI_REMAP_ONE / 2 ? dx * sizeof(T) : 0) + (fy >= _DAI_REMAP_ONE / 2 ? dy : 0);
+                std::memcpy(px, p, C * sizeof(T));
+                continue;
+            }
+            const int w00 = (_DAI_REMAP_ONE - fx) * (_DAI_REMAP_ONE - fy), w01 = fx * (_DAI_REMAP_ONE - fy);
+            const int w10 = (_DAI_REMAP_ONE - fx) * fy, w11 = fx * fy;
+            const T* a = reinterpret_cast<const T*>(p00);
+            const T* b = reinterpret_cast<const T*>(p00 + dy);
+            for(size_t c = 0; c < C; ++c) {
+                const int64_t acc = static_cast<int64_t>(a[c]) * w00 + static_cast<int64_t>(a[c + dx]) * w01 + static_cast<int64_t>(b[c]) * w10
+                                    + static_cast<int64_t>(b[c + dx]) * w11;
+                px[c] = static_cast<T>((acc + (1 << (shift - 1))) >> shift);
+            }
+        }
+    }
+
+    std::vector<int16_t> xy;
+    std::vector<uint16_t> frac;
+};
+
+// Process-wide table cache. Entries are weak, so a table lives as long as some node uses it and
+// is rebuilt on the next request after the last user goes away.
+struct _DaiRemapCacheKey {
+    int32_t socket;
+    uint32_t width;
+    uint32_t height;
+    uint32_t srcWidth;
+    uint32_t srcHeight;
+    uint64_t calibrationHash;
+    uint64_t paramsHash;
+
+    bool operator<(const _DaiRemapCacheKey& o) const {
+        return std::tie(socket, width, height, srcWidth, srcHeight, calibrationHash, paramsHash)
+               < std::tie(o.socket, o.width, o.height, o.srcWidth, o.srcHeight, o.calibrationHash, o.paramsHash);
+    }
+};
+
+struct _DaiRemapCache {
+    // A table being built has `pending` set; requests for its key wait on it instead of building
+    // the same maps again.
+    struct Entry {
+        std::weak_ptr<_DaiRemapTable> table;
+        std::shared_future<std::shared_ptr<_DaiRemapTable>> pending;
+    };
+
+    std::mutex mutex;
+    std::map<_DaiRemapCacheKey, Entry> tables;
+
+    static _DaiRemapCache& instance() {
+        static _DaiRemapCache cache;
+        return cache;
+    }
+
+    // Returns the cached table for `key` or builds one with `make`; `hit` tells which happened.
+    // `make` runs outside the cache lock, so builds for different keys overlap and lookups of
+    // live tables never wait for one. A failed build is reported to every waiter and not cached.
+    template <typename Make>
+    std::shared_ptr<_DaiRemapTable> get(const _DaiRemapCacheKey& key, Make&& make, bool& hit) {
+        std::promise<std::shared_ptr<_DaiRemapTable>> promise;
+        std::shared_future<std::shared_ptr<_DaiRemapTable>> building;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto it = tables.begin(); it != tables.end();) {
+                const bool dead = it->second.table.expired() && !it->second.pending.valid();
+                it = dead ? tables.erase(it) : std::next(it);
+            }
+            auto& entry = tables[key];
+            if(auto table = entry.table.lock()) {
+                hit = true;
+                return table;
+            }
+            if(entry.pending.valid()) {
+                building = entry.pending;
+            } else {
+                entry.pending = promise.get_future().share();
+            }
+        }
+        if(building.valid()) {
+            // Another thread is building this table; rethrows if that build fails.
+            hit = true;
+            return building.get();
+        }
+        hit = false;
+        std::shared_ptr<_DaiRemapTable> table;
+        try {
+            table = make();
+        } catch(...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(mutex);
+            tables.erase(key);
+            throw;
+        }
+        promise.set_value(table);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = tables[key];
+        entry.table = table;
+        entry.pending = {};
+        return table;
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t live = 0;
+        for(const auto& entry : tables) live += entry.second.table.expired() ? 0 : 1;
+        return live;
+    }
+};
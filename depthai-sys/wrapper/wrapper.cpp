@@ -7,6 +7,7 @@
 #include "depthai/pipeline/datatype/PointCloudData.hpp"
 #include "depthai/pipeline/datatype/RGBDData.hpp"
 #include "depthai/pipeline/datatype/EncodedFrame.hpp"
+#include "depthai/pipeline/node/ImageFilters.hpp"
 #include "XLink/XLink.h"
 #include "XLink/XLinkPublicDefines.h"
 
@@ -31,19 +32,230 @@
     #define DAI_HAS_NODE_NEURAL_DEPTH 0
 #endif
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <cstring>
 #include <cstdlib>
+#include <deque>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <new>
 
-// Global error storage
-static std::string last_error = "";
+#include "depth_filters.hpp"
+#include "depth_projection.hpp"
+#include "remap.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define DAI_PX_X86 1
+    #include <tmmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#else
+    #define DAI_PX_X86 0
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define DAI_PX_NEON 1
+    #include <arm_neon.h>
+#else
+    #define DAI_PX_NEON 0
+#endif
+
+// Per-thread error storage. Callback threads, threaded host nodes and the caller's thread all
+// enter the ABI concurrently, so each one keeps its own message and code. The message buffer is
+// reused between failures and the success path never touches it.
+//
+// Every failure names its code at the call site (`last_error.set(DAI_ERROR_NULL_ARGUMENT, "fn:
+// null queue");`), so rewording a message never changes what callers see.
+namespace {
+struct DaiErrorState {
+    std::string message;
+    int code = dai::DAI_OK;
+
+    void set(int c, const char* msg) {
+        message.assign(msg ? msg : "");
+        code = c;
+    }
+
+    void set(int c, std::string msg) {
+        message = std::move(msg);
+        code = c;
+    }
+
+    // Records an expected condition without a message.
+    void set_code(int c) {
+        message.clear();
+        code = c;
+    }
+
+    bool empty() const {
+        return message.empty();
+    }
+
+    void clear() {
+        message.clear();
+        code = dai::DAI_OK;
+    }
+
+    const char* c_str() const {
+        return message.c_str();
+    }
+};
+}  // namespace
+
+static thread_local DaiErrorState last_error;
+
+// Handle slab. Every shared_ptr-backed handle (`DaiDatatype`, `DaiImgFrame`, `DaiBuffer`, ...)
+// is a heap-held `std::shared_ptr<T>`, and all of those have the same size and alignment, so
+// they share one pool of fixed-size slots. Each thread keeps a small free list and trades
+// slots with a global list in batches, which keeps per-message handle churn (queue gets,
+// `dai_datatype_as_*` casts, callbacks) off the global allocator.
+//
+// Handles must be created with `_dai_new_handle<T>(...)` and destroyed with
+// `_dai_delete_handle(ptr)`; never `new`/`delete` them directly.
+namespace {
+union HandleSlot {
+    HandleSlot* next;
+    alignas(std::shared_ptr<void>) unsigned char storage[sizeof(std::shared_ptr<void>)];
+};
+
+constexpr size_t kHandleSlabChunk = 256;  // slots allocated at once when the pool runs dry
+constexpr size_t kHandleCacheMax = 128;   // slots a thread keeps before returning half
+
+struct HandleSlabGlobal {
+    std::mutex mtx;
+    HandleSlot* free = nullptr;
+    size_t count = 0;
+};
+
+// Intentionally leaked: handles may still be released while statics are being destroyed.
+HandleSlabGlobal& handle_slab_global() {
+    static auto* global = new HandleSlabGlobal();
+    return *global;
+}
+
+// Trivially destructible so it stays usable (as `dead`) after the thread's flusher ran.
+struct HandleSlabCache {
+    HandleSlot* free;
+    size_t count;
+    bool dead;
+};
+thread_local HandleSlabCache handle_slab_cache = {nullptr, 0, false};
+
+// Moves up to `n` slots from the thread cache to the global list.
+void handle_slab_flush(HandleSlabCache& cache, size_t n) {
+    if(n == 0 || !cache.free) return;
+    HandleSlot* head = cache.free;
+    HandleSlot* tail = head;
+    size_t moved = 1;
+    while(moved < n && tail->next) {
+        tail = tail->next;
+        moved++;
+    }
+    cache.free = tail->next;
+    cache.count -= moved;
+    auto& global = handle_slab_global();
+    std::lock_guard<std::mutex> lock(global.mtx);
+    tail->next = global.free;
+    global.free = head;
+    global.count += moved;
+}
+
+struct HandleSlabFlusher {
+    ~HandleSlabFlusher() {
+        auto& cache = handle_slab_cache;
+        handle_slab_flush(cache, cache.count);
+        cache.dead = true;
+    }
+};
+thread_local HandleSlabFlusher handle_slab_flusher;
+
+void* handle_slot_alloc() {
+    auto& cache = handle_slab_cache;
+    if(!cache.free || cache.dead) {
+        auto& global = handle_slab_global();
+        std::lock_guard<std::mutex> lock(global.mtx);
+        if(!global.free) {
+            auto* chunk = new HandleSlot[kHandleSlabChunk];
+            for(size_t i = 0; i + 1 < kHandleSlabChunk; ++i) chunk[i].next = &chunk[i + 1];
+            chunk[kHandleSlabChunk - 1].next = nullptr;
+            global.free = chunk;
+            global.count = kHandleSlabChunk;
+        }
+        if(cache.dead) {
+            HandleSlot* slot = global.free;
+            global.free = slot->next;
+            global.count--;
+            return slot->storage;
+        }
+        // Touch the flusher so it is constructed (and later destroyed) on this thread.
+        (void)&handle_slab_flusher;
+        size_t take = std::min(global.count, kHandleCacheMax / 2);
+        for(size_t i = 0; i < take; ++i) {
+            HandleSlot* slot = global.free;
+            global.free = slot->next;
+            slot->next = cache.free;
+            cache.free = slot;
+        }
+        global.count -= take;
+        cache.count += take;
+    }
+    HandleSlot* slot = cache.free;
+    cache.free = slot->next;
+    cache.count--;
+    return slot->storage;
+}
+
+void handle_slot_free(void* p) {
+    auto* slot = reinterpret_cast<HandleSlot*>(p);
+    auto& cache = handle_slab_cache;
+    if(cache.dead) {
+        auto& global = handle_slab_global();
+        std::lock_guard<std::mutex> lock(global.mtx);
+        slot->next = global.free;
+        global.free = slot;
+        global.count++;
+        return;
+    }
+    slot->next = cache.free;
+    cache.free = slot;
+    cache.count++;
+    if(cache.count > kHandleCacheMax) {
+        handle_slab_flush(cache, kHandleCacheMax / 2);
+    }
+}
+}  // namespace
+
+template <typename T, typename... Args>
+static inline std::shared_ptr<T>* _dai_new_handle(Args&&... args) {
+    static_assert(sizeof(std::shared_ptr<T>) == sizeof(HandleSlot), "handle does not fit a slab slot");
+    static_assert(alignof(std::shared_ptr<T>) <= alignof(HandleSlot), "handle alignment exceeds slab slot");
+    void* slot = handle_slot_alloc();
+    try {
+        return new(slot) std::shared_ptr<T>(std::forward<Args>(args)...);
+    } catch(...) {
+        handle_slot_free(slot);
+        throw;
+    }
+}
+
+template <typename T>
+static inline void _dai_delete_handle(std::shared_ptr<T>* handle) {
+    if(!handle) return;
+    handle->~shared_ptr();
+    handle_slot_free(handle);
+}
 
 namespace {
 template <typename T>
@@ -76,6 +288,341 @@ static bool _dai_optionalish_to_out(const T& value, Out* out) {
     }
 }
 
+// Opt-in telemetry. While enabled, queues created through the wrapper and Rust host nodes record
+// message rate, drops, depth high-water mark, device-to-host latency and callback / processGroup
+// time, plus the producer's frame pool occupancy. Recording uses relaxed atomics and fixed log2
+// histograms, with one uncontended per-queue lock for the pool estimate; only registration and
+// `dai_telemetry_snapshot_json` take the registry mutex.
+struct _DaiHistogram {
+    // Bucket 0 holds values < 2 us, bucket i >= 1 holds [2^i, 2^(i+1)) us; the last is open-ended.
+    static constexpr int kBuckets = 24;
+    std::atomic<uint64_t> buckets[kBuckets] = {};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum_us{0};
+    std::atomic<uint64_t> max_us{0};
+
+    void record(int64_t us) {
+        const uint64_t v = us > 0 ? static_cast<uint64_t>(us) : 0;
+        int bucket = 0;
+        for(uint64_t x = v >> 1; x && bucket < kBuckets - 1; x >>= 1) bucket++;
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum_us.fetch_add(v, std::memory_order_relaxed);
+        uint64_t prev = max_us.load(std::memory_order_relaxed);
+        while(v > prev && !max_us.compare_exchange_weak(prev, v, std::memory_order_relaxed)) {
+        }
+    }
+
+    void reset() {
+        for(auto& b : buckets) b.store(0, std::memory_order_relaxed);
+        count.store(0, std::memory_order_relaxed);
+        sum_us.store(0, std::memory_order_relaxed);
+        max_us.store(0, std::memory_order_relaxed);
+    }
+
+    nlohmann::json toJson() const {
+        nlohmann::json j;
+        j["count"] = count.load(std::memory_order_relaxed);
+        j["sum_us"] = sum_us.load(std::memory_order_relaxed);
+        j["max_us"] = max_us.load(std::memory_order_relaxed);
+        auto arr = nlohmann::json::array();
+        for(const auto& b : buckets) arr.push_back(b.load(std::memory_order_relaxed));
+        j["buckets"] = std::move(arr);
+        return j;
+    }
+};
+
+static int64_t _dai_steady_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Producer-side frame pool occupancy seen from one output queue.
+//
+// The device does not report pool usage, so it is reconstructed on the host: a frame holds a
+// pool slot from capture until it has crossed the link, and frames arrive in order, so the slots
+// in use when frame F was captured are F itself plus every earlier frame that arrived after F's
+// capture time. Sequence number gaps are frames the producer numbered but never delivered, which
+// on camera and encoder outputs is a stall on an exhausted pool.
+struct _DaiPoolStats {
+    static constexpr size_t kRing = 64;
+    std::atomic<uint64_t> samples{0};
+    std::atomic<uint64_t> in_flight{0};
+    std::atomic<uint64_t> in_flight_sum{0};
+    std::atomic<uint64_t> in_flight_high_water{0};
+    std::atomic<uint64_t> sequence_gaps{0};
+    std::atomic<uint64_t> gap_events{0};
+
+    // Called from the queue callback, serialized per queue by `mtx`.
+    void record(int64_t capture_us, int64_t arrival_us, int64_t seq) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if(last_seq >= 0 && seq > last_seq + 1) {
+            sequence_gaps.fetch_add(static_cast<uint64_t>(seq - last_seq - 1), std::memory_order_relaxed);
+            gap_events.fetch_add(1, std::memory_order_relaxed);
+        }
+        if(seq >= 0) last_seq = seq;
+        if(capture_us <= 0) return;
+        uint64_t held = 1;
+        for(size_t i = 0; i < filled && arrivals[(head + kRing - 1 - i) % kRing] > capture_us; ++i) held++;
+        arrivals[head] = arrival_us;
+        head = (head + 1) % kRing;
+        filled = std::min(filled + 1, kRing);
+        samples.fetch_add(1, std::memory_order_relaxed);
+        in_flight.store(held, std::memory_order_relaxed);
+        in_flight_sum.fetch_add(held, std::memory_order_relaxed);
+        if(held > in_flight_high_water.load(std::memory_order_relaxed)) in_flight_high_water.store(held, std::memory_order_relaxed);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mtx);
+        samples.store(0, std::memory_order_relaxed);
+        in_flight.store(0, std::memory_order_relaxed);
+        in_flight_sum.store(0, std::memory_order_relaxed);
+        in_flight_high_water.store(0, std::memory_order_relaxed);
+        sequence_gaps.store(0, std::memory_order_relaxed);
+        gap_events.store(0, std::memory_order_relaxed);
+        // Keep `last_seq` and the arrival ring so the first message after a reset is measured
+        // against real history rather than counted as a gap or an empty pool.
+    }
+
+    nlohmann::json toJson() const {
+        nlohmann::json j;
+        j["samples"] = samples.load(std::memory_order_relaxed);
+        j["in_flight"] = in_flight.load(std::memory_order_relaxed);
+        j["in_flight_sum"] = in_flight_sum.load(std::memory_order_relaxed);
+        j["in_flight_high_water"] = in_flight_high_water.load(std::memory_order_relaxed);
+        j["sequence_gaps"] = sequence_gaps.load(std::memory_order_relaxed);
+        j["gap_events"] = gap_events.load(std::memory_order_relaxed);
+        return j;
+    }
+
+   private:
+    std::mutex mtx;
+    int64_t last_seq = -1;
+    int64_t arrivals[kRing] = {};
+    size_t head = 0;
+    size_t filled = 0;
+};
+
+struct _DaiQueueStats {
+    std::string name;
+    bool blocking = false;
+    int64_t node_id = -1;     // node owning the output the queue was created from
+    std::string node_name;
+    std::string output;
+    float output_fps = 0.0f;  // camera outputs with known rates, see `_DaiCameraRates`
+    float sensor_fps = 0.0f;
+    std::weak_ptr<dai::MessageQueue> queue;
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> depth_high_water{0};
+    std::atomic<int64_t> first_us{0};
+    std::atomic<int64_t> last_us{0};
+    _DaiHistogram latency;   // host arrival - message timestamp (host-synced device clock)
+    _DaiHistogram callback;  // time spent in user callbacks registered through the wrapper
+    _DaiPoolStats pool;
+
+    void reset() {
+        messages.store(0, std::memory_order_relaxed);
+        dropped.store(0, std::memory_order_relaxed);
+        depth_high_water.store(0, std::memory_order_relaxed);
+        first_us.store(0, std::memory_order_relaxed);
+        last_us.store(0, std::memory_order_relaxed);
+        latency.reset();
+        callback.reset();
+        pool.reset();
+    }
+};
+
+struct _DaiNodeStats {
+    std::string name;
+    int64_t node_id = -1;
+    std::atomic<uint64_t> groups{0};
+    _DaiHistogram process;  // time spent in the Rust processGroup callback
+    std::atomic<uint64_t> errors{0};  // groups lost to a failed process or send on a worker
+    std::mutex error_mtx;
+    std::string last_error;
+
+    void recordError(const char* stage, const char* what) noexcept {
+        errors.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(error_mtx);
+        try {
+            last_error = std::string(stage) + what;
+        } catch(...) {
+            // Out of memory for the message; the count above still records the failure.
+        }
+    }
+
+    std::string lastError() {
+        std::lock_guard<std::mutex> lock(error_mtx);
+        return last_error;
+    }
+
+    void reset() {
+        groups.store(0, std::memory_order_relaxed);
+        process.reset();
+        errors.store(0, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(error_mtx);
+        last_error.clear();
+    }
+};
+
+static std::atomic<bool> g_telemetry_enabled{false};
+
+// Entries live as long as their queue or host node; `prune` drops the rest on every
+// registration and snapshot so long-running processes that recreate queues stay bounded.
+struct _DaiTelemetryRegistry {
+    std::mutex mtx;
+    std::vector<std::shared_ptr<_DaiQueueStats>> queues;
+    std::unordered_map<const dai::MessageQueue*, std::weak_ptr<_DaiQueueStats>> by_queue;
+    std::vector<std::weak_ptr<_DaiNodeStats>> nodes;  // owned by the host node
+
+    // Caller holds `mtx`.
+    void prune() {
+        queues.erase(std::remove_if(queues.begin(), queues.end(), [](const auto& q) { return q->queue.expired(); }), queues.end());
+        for(auto it = by_queue.begin(); it != by_queue.end();) {
+            auto stats = it->second.lock();
+            it = (!stats || stats->queue.expired()) ? by_queue.erase(it) : std::next(it);
+        }
+        nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](const auto& n) { return n.expired(); }), nodes.end());
+    }
+};
+
+static _DaiTelemetryRegistry& _dai_telemetry() {
+    static _DaiTelemetryRegistry* registry = new _DaiTelemetryRegistry();  // never destroyed: callbacks may outlive main
+    return *registry;
+}
+
+// Frame rates asked of each camera through this wrapper: the sensor rate given to `build` and the
+// rate of every requested output (0 when left to the camera). The camera numbers every sensor
+// frame, so an output running slower than the sensor skips sequence numbers by design; telemetry
+// reports both rates so pool sizing can tell those gaps from stalls. Entries are dropped with
+// their pipeline.
+struct _DaiCameraRates {
+    float sensor_fps = 0.0f;
+    std::unordered_map<const dai::Node::Output*, float> outputs;
+};
+
+static std::mutex g_camera_rates_mtx;
+static std::unordered_map<const dai::Node*, _DaiCameraRates> g_camera_rates;
+
+static void _dai_camera_rates_build(const dai::Node* camera, float sensor_fps) {
+    std::lock_guard<std::mutex> lock(g_camera_rates_mtx);
+    g_camera_rates[camera] = _DaiCameraRates{sensor_fps > 0.0f ? sensor_fps : 0.0f, {}};
+}
+
+static void _dai_camera_rates_output(const dai::Node* camera, const dai::Node::Output* output, float fps) {
+    std::lock_guard<std::mutex> lock(g_camera_rates_mtx);
+    g_camera_rates[camera].outputs[output] = fps > 0.0f ? fps : 0.0f;
+}
+
+// Requested rate of `output` and the sensor rate behind it, or {0, 0} unless both are known.
+// Without an explicit sensor rate the camera runs at the fastest output it was asked for, which
+// is only known when every output gave one.
+static std::pair<float, float> _dai_camera_rates_for(const dai::Node::Output& output) {
+    std::lock_guard<std::mutex> lock(g_camera_rates_mtx);
+    auto cam = g_camera_rates.find(&output.getParent());
+    if(cam == g_camera_rates.end()) return {0.0f, 0.0f};
+    auto out = cam->second.outputs.find(&output);
+    if(out == cam->second.outputs.end() || out->second <= 0.0f) return {0.0f, 0.0f};
+    float sensor = cam->second.sensor_fps;
+    if(sensor <= 0.0f) {
+        for(const auto& [_, fps] : cam->second.outputs) {
+            if(fps <= 0.0f) return {0.0f, 0.0f};
+            sensor = std::max(sensor, fps);
+        }
+    }
+    return {out->second, sensor};
+}
+
+static void _dai_camera_rates_forget(dai::Pipeline* pipe) {
+    std::lock_guard<std::mutex> lock(g_camera_rates_mtx);
+    if(g_camera_rates.empty()) return;
+    for(const auto& n : pipe->getAllNodes()) g_camera_rates.erase(n.get());
+}
+
+// Installs the recording callback on a freshly created output queue of `output`.
+static void _dai_telemetry_track_queue(const std::shared_ptr<dai::MessageQueue>& queue, dai::Node::Output& output) {
+    if(!queue || !g_telemetry_enabled.load(std::memory_order_relaxed)) return;
+    auto stats = std::make_shared<_DaiQueueStats>();
+    stats->name = queue->getName();
+    stats->blocking = queue->getBlocking();
+    stats->node_id = output.getParent().id;
+    stats->node_name = output.getParent().getName();
+    stats->output = output.getName();
+    const auto [output_fps, sensor_fps] = _dai_camera_rates_for(output);
+    stats->output_fps = output_fps;
+    stats->sensor_fps = sensor_fps;
+    stats->queue = queue;
+    std::weak_ptr<dai::MessageQueue> weak = queue;
+    queue->addCallback([stats, weak](std::string, std::shared_ptr<dai::ADatatype> msg) {
+        if(!g_telemetry_enabled.load(std::memory_order_relaxed)) return;
+        const int64_t now = _dai_steady_now_us();
+        int64_t expected = 0;
+        stats->first_us.compare_exchange_strong(expected, now, std::memory_order_relaxed);
+        stats->last_us.store(now, std::memory_order_relaxed);
+        stats->messages.fetch_add(1, std::memory_order_relaxed);
+        // Callbacks run before the message is pushed, so a full non-blocking queue is about to
+        // evict its oldest entry.
+        if(auto q = weak.lock()) {
+            const uint64_t max_size = q->getMaxSize();
+            uint64_t depth = std::min<uint64_t>(static_cast<uint64_t>(q->getSize()) + 1, max_size ? max_size : UINT64_MAX);
+            if(!stats->blocking && q->isFull()) stats->dropped.fetch_add(1, std::memory_order_relaxed);
+            uint64_t prev = stats->depth_high_water.load(std::memory_order_relaxed);
+            while(depth > prev && !stats->depth_high_water.compare_exchange_weak(prev, depth, std::memory_order_relaxed)) {
+            }
+        }
+        if(auto buf = std::dynamic_pointer_cast<dai::Buffer>(msg)) {
+            const int64_t ts = std::chrono::duration_cast<std::chrono::microseconds>(buf->getTimestamp().time_since_epoch()).count();
+            if(ts > 0) stats->latency.record(now - ts);
+            stats->pool.record(ts, now, static_cast<int64_t>(buf->getSequenceNum()));
+        }
+    });
+    auto& reg = _dai_telemetry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    reg.prune();
+    reg.by_queue[queue.get()] = stats;
+    reg.queues.push_back(std::move(stats));
+}
+
+static std::shared_ptr<_DaiQueueStats> _dai_telemetry_queue_stats(const dai::MessageQueue* queue) {
+    if(!g_telemetry_enabled.load(std::memory_order_relaxed)) return nullptr;
+    auto& reg = _dai_telemetry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    auto it = reg.by_queue.find(queue);
+    return it == reg.by_queue.end() ? nullptr : it->second.lock();
+}
+
+static std::shared_ptr<_DaiNodeStats> _dai_telemetry_track_node(const dai::Node& node, const char* kind) {
+    if(!g_telemetry_enabled.load(std::memory_order_relaxed)) return nullptr;
+    auto stats = std::make_shared<_DaiNodeStats>();
+    stats->name = kind;
+    stats->node_id = node.id;
+    auto& reg = _dai_telemetry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    reg.prune();
+    reg.nodes.push_back(stats);
+    return stats;
+}
+
+// Source of graph versions: a pipeline whose structure changed takes the next value (see
+// `_dai_graph_version`), so versions are unique across pipelines and never repeat.
+static std::atomic<uint64_t> g_graph_generation{1};
+
+// Flat copy of a pipeline graph: POD tables whose strings point into one shared pool.
+struct _DaiGraphSnapshot {
+    uint64_t version = 0;
+    std::vector<dai::DaiGraphNode> nodes;
+    std::vector<dai::DaiGraphPort> ports;
+    std::vector<dai::DaiGraphConnection> connections;
+    std::string strings;
+
+    dai::DaiStrRef intern(const std::string& s) {
+        dai::DaiStrRef ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size())};
+        strings.append(s);
+        return ref;
+    }
+};
+
 struct HostNodeCallbacks {
     dai::DaiHostNodeProcessGroup process = nullptr;
     dai::DaiHostNodeCallback on_start = nullptr;
@@ -90,28 +637,172 @@ struct ThreadedHostNodeCallbacks {
     dai::DaiHostNodeCallback drop = nullptr;
 };
 
+// Opt-in parallel `processGroup`: groups are queued to `workers` threads and each result is
+// sent on `out` in arrival order, so output stays deterministic while processing scales with
+// cores. `submit` blocks while `max_in_flight` groups are queued, running or awaiting their turn,
+// which keeps the node's input queue policy (blocking / dropping) in charge of backpressure.
+// A group whose process or send throws is handed to `fail` with the reason and skipped, so the
+// groups after it still go out.
+class _DaiHostNodeWorkers {
+   public:
+    using Process = std::function<std::shared_ptr<dai::Buffer>(std::shared_ptr<dai::MessageGroup>)>;
+    using Emit = std::function<void(std::shared_ptr<dai::Buffer>)>;
+    using Fail = std::function<void(const char* stage, const char* what)>;
+
+    _DaiHostNodeWorkers(size_t workers, size_t max_in_flight, Process process, Emit emit, Fail fail)
+        : workerCount(std::max<size_t>(workers, 1)),
+          maxInFlight(std::max(max_in_flight, workerCount)),
+          process(std::move(process)),
+          emit(std::move(emit)),
+          fail(std::move(fail)) {}
+
+    ~_DaiHostNodeWorkers() {
+        stop();
+    }
+
+    void submit(std::shared_ptr<dai::MessageGroup> group) {
+        std::unique_lock<std::mutex> lock(mtx);
+        if(threads.empty() && !stopping) {
+            threads.reserve(workerCount);
+            for(size_t i = 0; i < workerCount; ++i) threads.emplace_back([this] { workerLoop(); });
+        }
+        space.wait(lock, [&] { return stopping || inFlight < maxInFlight; });
+        if(stopping) return;
+        jobs.push_back({nextTicket++, std::move(group)});
+        inFlight++;
+        work.notify_one();
+    }
+
+    // Finishes queued groups, joins the workers and leaves the pool ready to start again.
+    void stop() {
+        std::vector<std::thread> joining;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+            joining.swap(threads);
+        }
+        work.notify_all();
+        space.notify_all();
+        for(auto& t : joining) {
+            if(t.joinable()) t.join();
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = false;
+    }
+
+   private:
+    struct Job {
+        uint64_t ticket = 0;
+        std::shared_ptr<dai::MessageGroup> group;
+    };
+
+    void workerLoop() {
+        for(;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                work.wait(lock, [&] { return stopping || !jobs.empty(); });
+                if(jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            std::shared_ptr<dai::Buffer> out;
+            try {
+                out = process(std::move(job.group));
+            } catch(const std::exception& e) {
+                report("processGroup failed: ", e.what());
+            } catch(...) {
+                report("processGroup failed: ", "unknown exception");
+            }
+            finish(job.ticket, std::move(out));
+        }
+    }
+
+    // Whoever completes the next ticket in line sends every consecutive ready result; the others
+    // just park theirs in `done`.
+    void finish(uint64_t ticket, std::shared_ptr<dai::Buffer> out) {
+        std::unique_lock<std::mutex> lock(mtx);
+        done.emplace(ticket, std::move(out));
+        if(emitting) return;
+        emitting = true;
+        while(!done.empty() && done.begin()->first == nextEmit) {
+            auto result = std::move(done.begin()->second);
+            done.erase(done.begin());
+            nextEmit++;
+            inFlight--;
+            space.notify_one();
+            lock.unlock();
+            if(result) {
+                try {
+                    emit(std::move(result));
+                } catch(const std::exception& e) {
+                    report("sending the result failed: ", e.what());
+                } catch(...) {
+                    report("sending the result failed: ", "unknown exception");
+                }
+            }
+            lock.lock();
+        }
+        emitting = false;
+    }
+
+    void report(const char* stage, const char* what) noexcept {
+        if(fail) fail(stage, what);
+    }
+
+    const size_t workerCount;
+    const size_t maxInFlight;
+    Process process;
+    Emit emit;
+    Fail fail;
+
+    std::mutex mtx;
+    std::condition_variable work;
+    std::condition_variable space;
+    std::deque<Job> jobs;
+    std::map<uint64_t, std::shared_ptr<dai::Buffer>> done;
+    std::vector<std::thread> threads;
+    uint64_t nextTicket = 0;
+    uint64_t nextEmit = 0;
+    size_t inFlight = 0;
+    bool emitting = false;
+    bool stopping = false;
+};
+
 class RustHostNode : public dai::NodeCRTP<dai::node::HostNode, RustHostNode> {
    public:
     RustHostNode(HostNodeCallbacks callbacks, void* ctx) : callbacks(std::move(callbacks)), ctx(ctx) {}
     ~RustHostNode() override {
+        // Workers call into `ctx`; join them before Rust frees it.
+        workers.reset();
         if(callbacks.drop) {
             callbacks.drop(ctx);
         }
     }
 
+    // Called once the node is added to a pipeline and has its id.
+    void attachTelemetry() {
+        stats = _dai_telemetry_track_node(*this, workers ? "RustHostNode(parallel)" : "RustHostNode");
+    }
+
+    void enableWorkers(size_t count, size_t max_in_flight) {
+        workers = std::make_unique<_DaiHostNodeWorkers>(
+            count,
+            max_in_flight,
+            [this](std::shared_ptr<dai::MessageGroup> group) { return runProcess(std::move(group)); },
+            [this](std::shared_ptr<dai::Buffer> buffer) { out.send(std::move(buffer)); },
+            [this](const char* stage, const char* what) {
+                if(stats) stats->recordError(stage, what);
+            });
+    }
+
     std::shared_ptr<dai::Buffer> processGroup(std::shared_ptr<dai::MessageGroup> in) override {
-        if(!callbacks.process) {
-            return nullptr;
-        }
-        auto group_handle = new std::shared_ptr<dai::MessageGroup>(in);
-        auto out_handle = callbacks.process(ctx, static_cast<dai::DaiMessageGroup>(group_handle));
-        if(!out_handle) {
+        if(workers) {
+            // Results are sent by the pool in arrival order.
+            workers->submit(std::move(in));
             return nullptr;
         }
-        auto out_ptr = static_cast<std::shared_ptr<dai::Buffer>*>(out_handle);
-        std::shared_ptr<dai::Buffer> out = *out_ptr;
-        delete out_ptr;
-        return out;
+        return runProcess(std::move(in));
     }
 
     void onStart() override {
@@ -121,14 +812,39 @@ class RustHostNode : public dai::NodeCRTP<dai::node::HostNode, RustHostNode> {
     }
 
     void onStop() override {
+        if(workers) {
+            workers->stop();
+        }
         if(callbacks.on_stop) {
             callbacks.on_stop(ctx);
         }
     }
 
    private:
+    std::shared_ptr<dai::Buffer> runProcess(std::shared_ptr<dai::MessageGroup> in) {
+        if(!callbacks.process) {
+            return nullptr;
+        }
+        auto group_handle = _dai_new_handle<dai::MessageGroup>(std::move(in));
+        const int64_t started = stats ? _dai_steady_now_us() : 0;
+        auto out_handle = callbacks.process(ctx, static_cast<dai::DaiMessageGroup>(group_handle));
+        if(stats) {
+            stats->groups.fetch_add(1, std::memory_order_relaxed);
+            stats->process.record(_dai_steady_now_us() - started);
+        }
+        if(!out_handle) {
+            return nullptr;
+        }
+        auto out_ptr = static_cast<std::shared_ptr<dai::Buffer>*>(out_handle);
+        std::shared_ptr<dai::Buffer> result = *out_ptr;
+        _dai_delete_handle(out_ptr);
+        return result;
+    }
+
     HostNodeCallbacks callbacks;
     void* ctx = nullptr;
+    std::unique_ptr<_DaiHostNodeWorkers> workers;
+    std::shared_ptr<_DaiNodeStats> stats;
 };
 
 class RustThreadedHostNode : public dai::NodeCRTP<dai::node::ThreadedHostNode, RustThreadedHostNode> {
@@ -175,6 +891,7 @@ class RustThreadedHostNode : public dai::NodeCRTP<dai::node::ThreadedHostNode, R
 // heap-allocated `std::shared_ptr<dai::Device>`.
 //
 // We also keep a process-wide default device which `dai_device_new()` returns (or creates).
+// `dai_device_open*` bypass it (and its mutex), so explicitly addressed devices boot in parallel.
 static std::mutex g_device_mutex;
 static std::weak_ptr<dai::Device> g_default_device;
 
@@ -207,6 +924,131 @@ static bool select_first_device_info(dai::DeviceInfo& out) {
     return false;
 }
 
+static const char* _dai_xlink_state_name(XLinkDeviceState_t state) {
+    switch(state) {
+        case X_LINK_BOOTED:
+            return "booted";
+        case X_LINK_UNBOOTED:
+            return "unbooted";
+        case X_LINK_BOOTLOADER:
+            return "bootloader";
+        case X_LINK_FLASH_BOOTED:
+            return "flash_booted";
+        case X_LINK_GATE:
+            return "gate";
+        case X_LINK_GATE_SETUP:
+            return "gate_setup";
+        default:
+            return "unknown";
+    }
+}
+
+static const char* _dai_xlink_protocol_name(XLinkProtocol_t protocol) {
+    switch(protocol) {
+        case X_LINK_USB_VSC:
+            return "usb";
+        case X_LINK_USB_CDC:
+            return "usb_cdc";
+        case X_LINK_PCIE:
+            return "pcie";
+        case X_LINK_TCP_IP:
+            return "tcp_ip";
+        case X_LINK_IPC:
+            return "ipc";
+        default:
+            return "unknown";
+    }
+}
+
+// Resolves a device id (MXID / device id), IP address or USB path to a `DeviceInfo`.
+// Enumerated devices are preferred so the returned info carries the real state and protocol;
+// unknown ids fall back to `DeviceInfo(id)`, which lets DepthAI connect to IPs that are not
+// discoverable by broadcast.
+static dai::DeviceInfo _dai_resolve_device_info(const std::string& id, bool* listed) {
+    *listed = false;
+    try {
+        for(const auto& info : dai::XLinkConnection::getAllConnectedDevices(X_LINK_ANY_STATE, /*skipInvalidDevices=*/true)) {
+            if(info.deviceId == id || info.name == id) {
+                *listed = true;
+                return info;
+            }
+        }
+    } catch(...) {
+        // Enumeration failures are not fatal; try the id as given.
+    }
+    return dai::DeviceInfo(id);
+}
+
+// Failure carrying the `DaiErrorCode` to report, for helpers shared by single and batched calls.
+struct _DaiCodedError : std::runtime_error {
+    _DaiCodedError(int code, const std::string& what) : std::runtime_error(what), code(code) {}
+    int code;
+};
+
+// Opens a device without touching the process-wide default device, so several devices can
+// boot concurrently. An id that is neither enumerated nor reachable fails with
+// DAI_ERROR_NOT_FOUND.
+static std::shared_ptr<dai::Device> _dai_open_device(const std::string& id) {
+    bool listed = false;
+    auto info = _dai_resolve_device_info(id, &listed);
+    try {
+        return std::make_shared<dai::Device>(info, dai::DeviceBase::DEFAULT_USB_SPEED);
+    } catch(const std::exception& e) {
+        if(listed) throw;
+        throw _DaiCodedError(dai::DAI_ERROR_NOT_FOUND, "device " + id + " not found: " + e.what());
+    }
+}
+
+// Outcome of one `_dai_run_parallel` index; `message` may be empty even for a failure when it
+// could not be stored.
+struct _DaiParallelResult {
+    bool failed = false;
+    int code = dai::DAI_OK;
+    std::string message;
+};
+
+static void _dai_parallel_fail(_DaiParallelResult& result, int code, const char* what) noexcept {
+    result.failed = true;
+    result.code = code;
+    try {
+        result.message = (what && *what) ? what : "unknown error";
+    } catch(...) {
+    }
+}
+
+static const char* _dai_parallel_message(const _DaiParallelResult& result) {
+    return result.message.empty() ? "unknown error" : result.message.c_str();
+}
+
+// Runs `fn(i)` for every index on its own thread and returns one result per index. Indices whose
+// thread cannot be started fail with the reason instead of running; the ones already running are
+// joined either way.
+template <typename Fn>
+static std::vector<_DaiParallelResult> _dai_run_parallel(size_t count, Fn fn) {
+    std::vector<_DaiParallelResult> results(count);
+    auto run = [&](size_t i) noexcept {
+        try {
+            fn(i);
+        } catch(const _DaiCodedError& e) {
+            _dai_parallel_fail(results[i], e.code, e.what());
+        } catch(const std::exception& e) {
+            _dai_parallel_fail(results[i], dai::DAI_ERROR_EXCEPTION, e.what());
+        } catch(...) {
+            _dai_parallel_fail(results[i], dai::DAI_ERROR_EXCEPTION, nullptr);
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    size_t started = 0;
+    try {
+        for(; started < count; started++) threads.emplace_back(run, started);
+    } catch(const std::exception& e) {
+        for(size_t i = started; i < count; i++) _dai_parallel_fail(results[i], dai::DAI_ERROR_EXCEPTION, e.what());
+    }
+    for(auto& t : threads) t.join();
+    return results;
+}
+
 namespace dai {
 
 const char* dai_build_version() {
@@ -267,6 +1109,89 @@ void dai_free_cstring(char* cstring) {
     }
 }
 
+void dai_telemetry_set_enabled(bool enabled) {
+    g_telemetry_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool dai_telemetry_is_enabled() {
+    return g_telemetry_enabled.load(std::memory_order_relaxed);
+}
+
+void dai_telemetry_reset() {
+    auto& reg = _dai_telemetry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    for(auto& q : reg.queues) q->reset();
+    for(auto& n : reg.nodes) {
+        if(auto live = n.lock()) live->reset();
+    }
+}
+
+char* dai_telemetry_snapshot_json() {
+    try {
+        dai_clear_last_error();
+        auto& reg = _dai_telemetry();
+        nlohmann::json j;
+        j["enabled"] = g_telemetry_enabled.load(std::memory_order_relaxed);
+        j["timestamp_us"] = _dai_steady_now_us();
+        auto queues = nlohmann::json::array();
+        auto nodes = nlohmann::json::array();
+        {
+            std::lock_guard<std::mutex> lock(reg.mtx);
+            reg.prune();
+            for(const auto& q : reg.queues) {
+                nlohmann::json item;
+                auto live = q->queue.lock();
+                item["name"] = q->name;
+                item["blocking"] = q->blocking;
+                item["closed"] = !live || live->isClosed();
+                item["depth"] = live ? static_cast<uint64_t>(live->getSize()) : 0;
+                item["max_size"] = live ? static_cast<uint64_t>(live->getMaxSize()) : 0;
+                item["messages"] = q->messages.load(std::memory_order_relaxed);
+                item["dropped"] = q->dropped.load(std::memory_order_relaxed);
+                item["depth_high_water"] = q->depth_high_water.load(std::memory_order_relaxed);
+                item["first_us"] = q->first_us.load(std::memory_order_relaxed);
+                item["last_us"] = q->last_us.load(std::memory_order_relaxed);
+                item["latency"] = q->latency.toJson();
+                item["callback"] = q->callback.toJson();
+                item["node_id"] = q->node_id;
+                item["node_name"] = q->node_name;
+                item["output"] = q->output;
+                if(q->output_fps > 0.0f) {
+                    item["output_fps"] = q->output_fps;
+                    item["sensor_fps"] = q->sensor_fps;
+                }
+                item["pool"] = q->pool.toJson();
+                queues.push_back(std::move(item));
+            }
+            for(const auto& weak : reg.nodes) {
+                auto n = weak.lock();
+                if(!n) continue;
+                nlohmann::json item;
+                item["name"] = n->name;
+                item["node_id"] = n->node_id;
+                item["groups"] = n->groups.load(std::memory_order_relaxed);
+                item["process"] = n->process.toJson();
+                item["errors"] = n->errors.load(std::memory_order_relaxed);
+                item["last_error"] = n->lastError();
+                nodes.push_back(std::move(item));
+            }
+        }
+        j["queues"] = std::move(queues);
+        j["host_nodes"] = std::move(nodes);
+        auto dumped = j.dump();
+        return dai_string_to_cstring(dumped.c_str());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_telemetry_snapshot_json failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+static uint64_t _dai_fnv1a(uint64_t h, const void* data, size_t len) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    for(size_t i = 0; i < len; ++i) h = (h ^ bytes[i]) * 1099511628211ull;
+    return h;
+}
+
 // Low-level device operations - direct pointer manipulation
 DaiDevice dai_device_new() {
     try {
@@ -277,7 +1202,7 @@ DaiDevice dai_device_new() {
         if(auto existing = g_default_device.lock()) {
             try {
                 if(!existing->isClosed()) {
-                    return static_cast<DaiDevice>(new std::shared_ptr<dai::Device>(existing));
+                    return static_cast<DaiDevice>(_dai_new_handle<dai::Device>(existing));
                 }
             } catch(...) {
                 // If isClosed throws for some reason, fall back to creating a new device.
@@ -300,23 +1225,114 @@ DaiDevice dai_device_new() {
 
         auto created = std::make_shared<dai::Device>(info, dai::DeviceBase::DEFAULT_USB_SPEED);
         g_default_device = created;
-        return static_cast<DaiDevice>(new std::shared_ptr<dai::Device>(created));
+        return static_cast<DaiDevice>(_dai_new_handle<dai::Device>(created));
     } catch (const std::exception& e) {
-        last_error = std::string("dai_device_new failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_new failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+char* dai_device_list_json() {
+    try {
+        dai_clear_last_error();
+        auto arr = nlohmann::json::array();
+        for(const auto& info : dai::XLinkConnection::getAllConnectedDevices(X_LINK_ANY_STATE, /*skipInvalidDevices=*/true)) {
+            nlohmann::json item;
+            item["device_id"] = info.deviceId;
+            item["name"] = info.name;
+            item["state"] = _dai_xlink_state_name(info.state);
+            item["protocol"] = _dai_xlink_protocol_name(info.protocol);
+            arr.push_back(std::move(item));
+        }
+        auto dumped = arr.dump();
+        return dai_string_to_cstring(dumped.c_str());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_list_json failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+DaiDevice dai_device_open(const char* id) {
+    if(!id) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_open: null id");
+        return nullptr;
+    }
+    try {
+        dai_clear_last_error();
+        return static_cast<DaiDevice>(_dai_new_handle<dai::Device>(_dai_open_device(id)));
+    } catch(const _DaiCodedError& e) {
+        last_error.set(e.code, std::string("dai_device_open failed: ") + e.what());
+        return nullptr;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_open failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+size_t dai_device_open_many(const char* const* ids, size_t count, DaiDevice* out, char** out_errors, int* out_codes) {
+    if(!ids || !out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_open_many: null ids/out");
+        return 0;
+    }
+    try {
+        dai_clear_last_error();
+        std::vector<std::shared_ptr<dai::Device>> devices(count);
+        for(size_t i = 0; i < count; i++) {
+            out[i] = nullptr;
+            if(out_errors) out_errors[i] = nullptr;
+            if(out_codes) out_codes[i] = DAI_OK;
+        }
+        auto results = _dai_run_parallel(count, [&](size_t i) {
+            if(!ids[i]) throw _DaiCodedError(DAI_ERROR_NULL_ARGUMENT, "null id");
+            devices[i] = _dai_open_device(ids[i]);
+        });
+        size_t opened = 0;
+        for(size_t i = 0; i < count; i++) {
+            if(devices[i]) {
+                out[i] = static_cast<DaiDevice>(_dai_new_handle<dai::Device>(std::move(devices[i])));
+                opened++;
+                continue;
+            }
+            if(out_errors) out_errors[i] = dai_string_to_cstring(_dai_parallel_message(results[i]));
+            if(out_codes) out_codes[i] = results[i].failed ? results[i].code : DAI_ERROR_UNKNOWN;
+        }
+        return opened;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_open_many failed: ") + e.what());
+        return 0;
+    }
+}
+
+char* dai_device_get_device_id(DaiDevice device) {
+    if(!device) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_get_device_id: null device");
+        return nullptr;
+    }
+    try {
+        dai_clear_last_error();
+        auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
+        if(!dev->get() || !(*dev)) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_device_get_device_id: invalid device");
+            return nullptr;
+        }
+        auto id = (*dev)->getDeviceId();
+        return dai_string_to_cstring(id.c_str());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_get_device_id failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiDevice dai_device_clone(DaiDevice device) {
     if(!device) {
-        last_error = "dai_device_clone: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_clone: null device");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::Device>*>(device);
-        return static_cast<DaiDevice>(new std::shared_ptr<dai::Device>(*ptr));
+        return static_cast<DaiDevice>(_dai_new_handle<dai::Device>(*ptr));
     } catch (const std::exception& e) {
-        last_error = std::string("dai_device_clone failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_clone failed: ") + e.what());
         return nullptr;
     }
 }
@@ -334,13 +1350,13 @@ void dai_device_delete(DaiDevice device) {
         } catch(...) {
             // Best-effort: proceed with deletion.
         }
-        delete dev;
+        _dai_delete_handle(dev);
     }
 }
 
 bool dai_device_is_closed(DaiDevice device) {
     if (!device) {
-        last_error = "dai_device_is_closed: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_is_closed: null device");
         return true;
     }
     try {
@@ -348,25 +1364,25 @@ bool dai_device_is_closed(DaiDevice device) {
         if(!dev->get() || !(*dev)) return true;
         return (*dev)->isClosed();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_device_is_closed failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_is_closed failed: ") + e.what());
         return true;
     }
 }
 
 void dai_device_close(DaiDevice device) {
     if (!device) {
-        last_error = "dai_device_close: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_close: null device");
         return;
     }
     try {
         auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
         if(!dev->get() || !(*dev)) {
-            last_error = "dai_device_close: invalid device";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_device_close: invalid device");
             return;
         }
         (*dev)->close();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_device_close failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_close failed: ") + e.what());
     }
 }
 
@@ -378,7 +1394,7 @@ DaiPipeline dai_pipeline_new() {
         return static_cast<DaiPipeline>(pipeline);
     } catch (const std::exception& e) {
         // printf("DEBUG: dai::Pipeline creation failed: %s\n", e.what());
-        last_error = std::string("dai_pipeline_new failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_new failed: ") + e.what());
         return nullptr;
     }
 }
@@ -389,34 +1405,34 @@ DaiPipeline dai_pipeline_new_ex(bool create_implicit_device) {
         auto pipeline = new dai::Pipeline(create_implicit_device);
         return static_cast<DaiPipeline>(pipeline);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_new_ex failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_new_ex failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiPipeline dai_pipeline_new_with_device(DaiDevice device) {
     if(!device) {
-        last_error = "dai_pipeline_new_with_device: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_new_with_device: null device");
         return nullptr;
     }
     try {
         dai_clear_last_error();
         auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
         if(!dev->get() || !(*dev)) {
-            last_error = "dai_pipeline_new_with_device: invalid device";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_pipeline_new_with_device: invalid device");
             return nullptr;
         }
         auto pipeline = new dai::Pipeline(*dev);
         return static_cast<DaiPipeline>(pipeline);
     } catch (const std::exception& e) {
-        last_error = std::string("dai_pipeline_new_with_device failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_new_with_device failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiNode dai_rgbd_build(DaiNode rgbd) {
     if(!rgbd) {
-        last_error = "dai_rgbd_build: null rgbd";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_rgbd_build: null rgbd");
         return nullptr;
     }
     try {
@@ -425,14 +1441,14 @@ DaiNode dai_rgbd_build(DaiNode rgbd) {
         auto built = node->build();
         return static_cast<DaiNode>(built.get());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_rgbd_build failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_rgbd_build failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiNode dai_rgbd_build_ex(DaiNode rgbd, bool autocreate, int preset_mode, int width, int height, float fps) {
     if(!rgbd) {
-        last_error = "dai_rgbd_build_ex: null rgbd";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_rgbd_build_ex: null rgbd");
         return nullptr;
     }
     try {
@@ -448,64 +1464,162 @@ DaiNode dai_rgbd_build_ex(DaiNode rgbd, bool autocreate, int preset_mode, int wi
         auto built = node->build(autocreate, mode, {width, height}, fpsOpt);
         return static_cast<DaiNode>(built.get());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_rgbd_build_ex failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_rgbd_build_ex failed: ") + e.what());
         return nullptr;
     }
 }
 
-void dai_pipeline_delete(DaiPipeline pipeline) {
-    if (pipeline) {
-        auto pipe = static_cast<dai::Pipeline*>(pipeline);
-        delete pipe;
+// Hash of everything a graph snapshot contains: node ids and names, port names and connections.
+// Computed from the live pipeline rather than bumped at call sites, so mutations made by any
+// entry point (node `build` helpers, requestOutput, depthai-core internals) are all observed.
+static uint64_t _dai_graph_fingerprint(dai::Pipeline* pipe) {
+    uint64_t h = 14695981039346656037ull;
+    auto mix_str = [&h](const std::string& s) {
+        const uint64_t len = s.size();
+        h = _dai_fnv1a(h, &len, sizeof(len));
+        h = _dai_fnv1a(h, s.data(), s.size());
+    };
+    for(const auto& n : pipe->getAllNodes()) {
+        if(!n) continue;
+        h = _dai_fnv1a(h, &n->id, sizeof(n->id));
+        mix_str(std::string(n->getName()));
+        mix_str(n->getAlias());
+        for(auto* out : n->getOutputRefs()) {
+            if(!out) continue;
+            mix_str(out->getGroup());
+            mix_str(out->getName());
+        }
+        const uint8_t sep = 0xff;
+        h = _dai_fnv1a(h, &sep, sizeof(sep));
+        for(auto* in : n->getInputRefs()) {
+            if(!in) continue;
+            mix_str(in->getGroup());
+            mix_str(in->getName());
+        }
+    }
+    for(const auto& c : pipe->getConnections()) {
+        h = _dai_fnv1a(h, &c.outputId, sizeof(c.outputId));
+        mix_str(c.outputGroup);
+        mix_str(c.outputName);
+        h = _dai_fnv1a(h, &c.inputId, sizeof(c.inputId));
+        mix_str(c.inputGroup);
+        mix_str(c.inputName);
     }
+    return h;
 }
 
-bool dai_pipeline_start(DaiPipeline pipeline) {
-    if(!pipeline) {
-        last_error = "dai_pipeline_start: null pipeline";
-        return false;
-    }
+struct _DaiGraphVersion {
+    uint64_t fingerprint = 0;
+    uint64_t version = 0;
+};
+
+static std::mutex g_graph_versions_mtx;
+static std::unordered_map<const dai::Pipeline*, _DaiGraphVersion> g_graph_versions;
+
+// Current version of `pipe`'s graph: unchanged while its fingerprint is, a fresh generation
+// otherwise. Any exception from walking the graph propagates to the caller.
+static uint64_t _dai_graph_version(dai::Pipeline* pipe) {
+    const uint64_t fingerprint = _dai_graph_fingerprint(pipe);
+    std::lock_guard<std::mutex> lock(g_graph_versions_mtx);
+    auto& entry = g_graph_versions[pipe];
+    if(entry.version == 0 || entry.fingerprint != fingerprint) {
+        entry.fingerprint = fingerprint;
+        entry.version = g_graph_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+    return entry.version;
+}
+
+static void _dai_graph_version_forget(const dai::Pipeline* pipe) {
+    std::lock_guard<std::mutex> lock(g_graph_versions_mtx);
+    g_graph_versions.erase(pipe);
+}
+
+void dai_pipeline_delete(DaiPipeline pipeline) {
+    if (pipeline) {
+        auto pipe = static_cast<dai::Pipeline*>(pipeline);
+        _dai_graph_version_forget(pipe);
+        _dai_camera_rates_forget(pipe);
+        delete pipe;
+    }
+}
+
+bool dai_pipeline_start(DaiPipeline pipeline) {
+    if(!pipeline) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_start: null pipeline");
+        return false;
+    }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         pipe->start();
         return true;
     } catch (const std::exception& e) {
-        last_error = std::string("dai_pipeline_start failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_start failed: ") + e.what());
         return false;
     }
 }
 
+size_t dai_pipeline_start_many(DaiPipeline* pipelines, size_t count, char** out_errors, int* out_codes) {
+    if(!pipelines) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_start_many: null pipelines");
+        return 0;
+    }
+    try {
+        dai_clear_last_error();
+        for(size_t i = 0; i < count; i++) {
+            if(out_errors) out_errors[i] = nullptr;
+            if(out_codes) out_codes[i] = DAI_OK;
+        }
+        auto results = _dai_run_parallel(count, [&](size_t i) {
+            if(!pipelines[i]) throw _DaiCodedError(DAI_ERROR_NULL_ARGUMENT, "null pipeline");
+            static_cast<dai::Pipeline*>(pipelines[i])->start();
+        });
+        size_t started = 0;
+        for(size_t i = 0; i < count; i++) {
+            if(!results[i].failed) {
+                started++;
+                continue;
+            }
+            if(out_errors) out_errors[i] = dai_string_to_cstring(_dai_parallel_message(results[i]));
+            if(out_codes) out_codes[i] = results[i].code;
+        }
+        return started;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_start_many failed: ") + e.what());
+        return 0;
+    }
+}
+
 bool dai_pipeline_is_running(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_is_running: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_is_running: null pipeline");
         return false;
     }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         return pipe->isRunning();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_is_running failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_is_running failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_is_built(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_is_built: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_is_built: null pipeline");
         return false;
     }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         return pipe->isBuilt();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_is_built failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_is_built failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_build(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_build: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_build: null pipeline");
         return false;
     }
     try {
@@ -513,14 +1627,14 @@ bool dai_pipeline_build(DaiPipeline pipeline) {
         pipe->build();
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_build failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_build failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_wait(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_wait: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_wait: null pipeline");
         return false;
     }
     try {
@@ -528,14 +1642,14 @@ bool dai_pipeline_wait(DaiPipeline pipeline) {
         pipe->wait();
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_wait failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_wait failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_stop(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_stop: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_stop: null pipeline");
         return false;
     }
     try {
@@ -543,14 +1657,14 @@ bool dai_pipeline_stop(DaiPipeline pipeline) {
         pipe->stop();
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_stop failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_stop failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_run(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_run: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_run: null pipeline");
         return false;
     }
     try {
@@ -558,14 +1672,14 @@ bool dai_pipeline_run(DaiPipeline pipeline) {
         pipe->run();
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_run failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_run failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_process_tasks(DaiPipeline pipeline, bool wait_for_tasks, double timeout_seconds) {
     if(!pipeline) {
-        last_error = "dai_pipeline_process_tasks: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_process_tasks: null pipeline");
         return false;
     }
     try {
@@ -573,14 +1687,14 @@ bool dai_pipeline_process_tasks(DaiPipeline pipeline, bool wait_for_tasks, doubl
         pipe->processTasks(wait_for_tasks, timeout_seconds);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_process_tasks failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_process_tasks failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_set_xlink_chunk_size(DaiPipeline pipeline, int size_bytes) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_xlink_chunk_size: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_xlink_chunk_size: null pipeline");
         return false;
     }
     try {
@@ -588,14 +1702,14 @@ bool dai_pipeline_set_xlink_chunk_size(DaiPipeline pipeline, int size_bytes) {
         pipe->setXLinkChunkSize(size_bytes);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_xlink_chunk_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_xlink_chunk_size failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_set_sipp_buffer_size(DaiPipeline pipeline, int size_bytes) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_sipp_buffer_size: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_sipp_buffer_size: null pipeline");
         return false;
     }
     try {
@@ -603,14 +1717,14 @@ bool dai_pipeline_set_sipp_buffer_size(DaiPipeline pipeline, int size_bytes) {
         pipe->setSippBufferSize(size_bytes);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_sipp_buffer_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_sipp_buffer_size failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_set_sipp_dma_buffer_size(DaiPipeline pipeline, int size_bytes) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_sipp_dma_buffer_size: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_sipp_dma_buffer_size: null pipeline");
         return false;
     }
     try {
@@ -618,18 +1732,18 @@ bool dai_pipeline_set_sipp_dma_buffer_size(DaiPipeline pipeline, int size_bytes)
         pipe->setSippDmaBufferSize(size_bytes);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_sipp_dma_buffer_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_sipp_dma_buffer_size failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_set_camera_tuning_blob_path(DaiPipeline pipeline, const char* path) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_camera_tuning_blob_path: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_camera_tuning_blob_path: null pipeline");
         return false;
     }
     if(!path) {
-        last_error = "dai_pipeline_set_camera_tuning_blob_path: null path";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_camera_tuning_blob_path: null path");
         return false;
     }
     try {
@@ -638,14 +1752,14 @@ bool dai_pipeline_set_camera_tuning_blob_path(DaiPipeline pipeline, const char*
         pipe->setCameraTuningBlobPath(std::filesystem::u8path(path));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_camera_tuning_blob_path failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_camera_tuning_blob_path failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_set_openvino_version(DaiPipeline pipeline, int version) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_openvino_version: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_openvino_version: null pipeline");
         return false;
     }
     try {
@@ -653,14 +1767,14 @@ bool dai_pipeline_set_openvino_version(DaiPipeline pipeline, int version) {
         pipe->setOpenVINOVersion(static_cast<dai::OpenVINO::Version>(version));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_openvino_version failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_openvino_version failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_serialize_to_json(DaiPipeline pipeline, bool include_assets) {
     if(!pipeline) {
-        last_error = "dai_pipeline_serialize_to_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_serialize_to_json: null pipeline");
         return nullptr;
     }
     try {
@@ -670,14 +1784,14 @@ char* dai_pipeline_serialize_to_json(DaiPipeline pipeline, bool include_assets)
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_serialize_to_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_serialize_to_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 char* dai_pipeline_get_schema_json(DaiPipeline pipeline, int serialization_type) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_schema_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_schema_json: null pipeline");
         return nullptr;
     }
     try {
@@ -689,14 +1803,14 @@ char* dai_pipeline_get_schema_json(DaiPipeline pipeline, int serialization_type)
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_schema_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_schema_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 char* dai_pipeline_get_all_nodes_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_all_nodes_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_all_nodes_json: null pipeline");
         return nullptr;
     }
     try {
@@ -715,14 +1829,14 @@ char* dai_pipeline_get_all_nodes_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_all_nodes_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_all_nodes_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 char* dai_pipeline_get_source_nodes_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_source_nodes_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_source_nodes_json: null pipeline");
         return nullptr;
     }
     try {
@@ -741,14 +1855,14 @@ char* dai_pipeline_get_source_nodes_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_source_nodes_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_source_nodes_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiNode dai_pipeline_get_node_by_id(DaiPipeline pipeline, int id) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_node_by_id: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_node_by_id: null pipeline");
         return nullptr;
     }
     try {
@@ -760,18 +1874,18 @@ DaiNode dai_pipeline_get_node_by_id(DaiPipeline pipeline, int id) {
         }
         return static_cast<DaiNode>(n.get());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_node_by_id failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_node_by_id failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_pipeline_remove_node(DaiPipeline pipeline, DaiNode node) {
     if(!pipeline) {
-        last_error = "dai_pipeline_remove_node: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_remove_node: null pipeline");
         return false;
     }
     if(!node) {
-        last_error = "dai_pipeline_remove_node: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_remove_node: null node");
         return false;
     }
     try {
@@ -785,17 +1899,17 @@ bool dai_pipeline_remove_node(DaiPipeline pipeline, DaiNode node) {
                 return true;
             }
         }
-        last_error = "dai_pipeline_remove_node: node not found in pipeline";
+        last_error.set(DAI_ERROR_NOT_FOUND, "dai_pipeline_remove_node: node not found in pipeline");
         return false;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_remove_node failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_remove_node failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_get_connections_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_connections_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_connections_json: null pipeline");
         return nullptr;
     }
     try {
@@ -816,14 +1930,14 @@ char* dai_pipeline_get_connections_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_connections_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_connections_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 char* dai_pipeline_get_connection_map_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_connection_map_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_connection_map_json: null pipeline");
         return nullptr;
     }
     try {
@@ -857,14 +1971,111 @@ char* dai_pipeline_get_connection_map_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_connection_map_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_connection_map_json failed: ") + e.what());
         return nullptr;
     }
 }
 
+uint64_t dai_pipeline_graph_version(DaiPipeline pipeline) {
+    if(!pipeline) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_graph_version: null pipeline");
+        return 0;
+    }
+    try {
+        return _dai_graph_version(static_cast<dai::Pipeline*>(pipeline));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_graph_version failed: ") + e.what());
+        return 0;
+    }
+}
+
+DaiGraphSnapshot dai_pipeline_graph_snapshot(DaiPipeline pipeline, uint64_t known_version) {
+    if(!pipeline) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_graph_snapshot: null pipeline");
+        return nullptr;
+    }
+    try {
+        dai_clear_last_error();
+        // Version first: a mutation racing with the walk below then changes the fingerprint and
+        // yields a newer version on the next call instead of being missed.
+        auto pipe = static_cast<dai::Pipeline*>(pipeline);
+        const uint64_t version = _dai_graph_version(pipe);
+        if(known_version != 0 && known_version == version) return nullptr;
+
+        auto snap = std::make_unique<_DaiGraphSnapshot>();
+        snap->version = version;
+        auto nodes = pipe->getAllNodes();
+        snap->nodes.reserve(nodes.size());
+        for(const auto& n : nodes) {
+            if(!n) continue;
+            DaiGraphNode rec{};
+            rec.id = n->id;
+            rec.name = snap->intern(std::string(n->getName()));
+            rec.alias = snap->intern(n->getAlias());
+            rec.first_port = static_cast<uint32_t>(snap->ports.size());
+            for(auto* out : n->getOutputRefs()) {
+                if(!out) continue;
+                snap->ports.push_back(DaiGraphPort{n->id, 1, snap->intern(out->getGroup()), snap->intern(out->getName())});
+            }
+            for(auto* in : n->getInputRefs()) {
+                if(!in) continue;
+                snap->ports.push_back(DaiGraphPort{n->id, 0, snap->intern(in->getGroup()), snap->intern(in->getName())});
+            }
+            rec.port_count = static_cast<uint32_t>(snap->ports.size()) - rec.first_port;
+            snap->nodes.push_back(rec);
+        }
+        for(const auto& c : pipe->getConnections()) {
+            DaiGraphConnection rec{};
+            rec.output_id = c.outputId;
+            rec.output_group = snap->intern(c.outputGroup);
+            rec.output_name = snap->intern(c.outputName);
+            rec.input_id = c.inputId;
+            rec.input_group = snap->intern(c.inputGroup);
+            rec.input_name = snap->intern(c.inputName);
+            snap->connections.push_back(rec);
+        }
+        return static_cast<DaiGraphSnapshot>(snap.release());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_graph_snapshot failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_graph_snapshot_release(DaiGraphSnapshot snapshot) {
+    delete static_cast<_DaiGraphSnapshot*>(snapshot);
+}
+
+uint64_t dai_graph_snapshot_version(DaiGraphSnapshot snapshot) {
+    return snapshot ? static_cast<_DaiGraphSnapshot*>(snapshot)->version : 0;
+}
+
+const DaiGraphNode* dai_graph_snapshot_nodes(DaiGraphSnapshot snapshot, size_t* count) {
+    auto snap = static_cast<_DaiGraphSnapshot*>(snapshot);
+    if(count) *count = snap ? snap->nodes.size() : 0;
+    return snap ? snap->nodes.data() : nullptr;
+}
+
+const DaiGraphPort* dai_graph_snapshot_ports(DaiGraphSnapshot snapshot, size_t* count) {
+    auto snap = static_cast<_DaiGraphSnapshot*>(snapshot);
+    if(count) *count = snap ? snap->ports.size() : 0;
+    return snap ? snap->ports.data() : nullptr;
+}
+
+const DaiGraphConnection* dai_graph_snapshot_connections(DaiGraphSnapshot snapshot, size_t* count) {
+    auto snap = static_cast<_DaiGraphSnapshot*>(snapshot);
+    if(count) *count = snap ? snap->connections.size() : 0;
+    return snap ? snap->connections.data() : nullptr;
+}
+
+const char* dai_graph_snapshot_strings(DaiGraphSnapshot snapshot, size_t* len) {
+    auto snap = static_cast<_DaiGraphSnapshot*>(snapshot);
+    if(len) *len = snap ? snap->strings.size() : 0;
+    return snap ? snap->strings.data() : nullptr;
+}
+
 bool dai_pipeline_is_calibration_data_available(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_is_calibration_data_available: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_is_calibration_data_available: null pipeline");
         return false;
     }
     try {
@@ -872,14 +2083,14 @@ bool dai_pipeline_is_calibration_data_available(DaiPipeline pipeline) {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         return pipe->isCalibrationDataAvailable();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_is_calibration_data_available failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_is_calibration_data_available failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_get_calibration_data_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_calibration_data_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_calibration_data_json: null pipeline");
         return nullptr;
     }
     try {
@@ -895,18 +2106,18 @@ char* dai_pipeline_get_calibration_data_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_calibration_data_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_calibration_data_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_pipeline_set_calibration_data_json(DaiPipeline pipeline, const char* eeprom_data_json) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_calibration_data_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_calibration_data_json: null pipeline");
         return false;
     }
     if(!eeprom_data_json) {
-        last_error = "dai_pipeline_set_calibration_data_json: null eeprom_data_json";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_calibration_data_json: null eeprom_data_json");
         return false;
     }
     try {
@@ -914,21 +2125,21 @@ bool dai_pipeline_set_calibration_data_json(DaiPipeline pipeline, const char* ee
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         auto j = nlohmann::json::parse(eeprom_data_json);
         if(j.is_null()) {
-            last_error = "dai_pipeline_set_calibration_data_json: null is not supported";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_pipeline_set_calibration_data_json: null is not supported");
             return false;
         }
         auto calib = dai::CalibrationHandler::fromJson(j);
         pipe->setCalibrationData(std::move(calib));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_calibration_data_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_calibration_data_json failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_get_global_properties_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_global_properties_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_global_properties_json: null pipeline");
         return nullptr;
     }
     try {
@@ -939,18 +2150,18 @@ char* dai_pipeline_get_global_properties_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_global_properties_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_global_properties_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_pipeline_set_global_properties_json(DaiPipeline pipeline, const char* json) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_global_properties_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_global_properties_json: null pipeline");
         return false;
     }
     if(!json) {
-        last_error = "dai_pipeline_set_global_properties_json: null json";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_global_properties_json: null json");
         return false;
     }
     try {
@@ -961,14 +2172,14 @@ bool dai_pipeline_set_global_properties_json(DaiPipeline pipeline, const char* j
         pipe->setGlobalProperties(std::move(props));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_global_properties_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_global_properties_json failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_get_board_config_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_board_config_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_board_config_json: null pipeline");
         return nullptr;
     }
     try {
@@ -979,18 +2190,18 @@ char* dai_pipeline_get_board_config_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_board_config_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_board_config_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_pipeline_set_board_config_json(DaiPipeline pipeline, const char* json) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_board_config_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_board_config_json: null pipeline");
         return false;
     }
     if(!json) {
-        last_error = "dai_pipeline_set_board_config_json: null json";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_board_config_json: null json");
         return false;
     }
     try {
@@ -1001,14 +2212,14 @@ bool dai_pipeline_set_board_config_json(DaiPipeline pipeline, const char* json)
         pipe->setBoardConfig(std::move(cfg));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_board_config_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_board_config_json failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_pipeline_get_device_config_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_device_config_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_device_config_json: null pipeline");
         return nullptr;
     }
     try {
@@ -1035,14 +2246,14 @@ char* dai_pipeline_get_device_config_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_device_config_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_device_config_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 char* dai_pipeline_get_eeprom_data_json(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_eeprom_data_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_eeprom_data_json: null pipeline");
         return nullptr;
     }
     try {
@@ -1058,18 +2269,18 @@ char* dai_pipeline_get_eeprom_data_json(DaiPipeline pipeline) {
         auto dumped = j.dump();
         return dai_string_to_cstring(dumped.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_eeprom_data_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_eeprom_data_json failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_pipeline_set_eeprom_data_json(DaiPipeline pipeline, const char* json) {
     if(!pipeline) {
-        last_error = "dai_pipeline_set_eeprom_data_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_eeprom_data_json: null pipeline");
         return false;
     }
     if(!json) {
-        last_error = "dai_pipeline_set_eeprom_data_json: null json";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_set_eeprom_data_json: null json");
         return false;
     }
     try {
@@ -1085,32 +2296,32 @@ bool dai_pipeline_set_eeprom_data_json(DaiPipeline pipeline, const char* json) {
         }
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_set_eeprom_data_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_set_eeprom_data_json failed: ") + e.what());
         return false;
     }
 }
 
 uint32_t dai_pipeline_get_eeprom_id(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_eeprom_id: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_eeprom_id: null pipeline");
         return 0;
     }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         return pipe->getEepromId();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_eeprom_id failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_eeprom_id failed: ") + e.what());
         return 0;
     }
 }
 
 bool dai_pipeline_enable_holistic_record_json(DaiPipeline pipeline, const char* record_config_json) {
     if(!pipeline) {
-        last_error = "dai_pipeline_enable_holistic_record_json: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_enable_holistic_record_json: null pipeline");
         return false;
     }
     if(!record_config_json) {
-        last_error = "dai_pipeline_enable_holistic_record_json: null record_config_json";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_enable_holistic_record_json: null record_config_json");
         return false;
     }
     try {
@@ -1121,18 +2332,18 @@ bool dai_pipeline_enable_holistic_record_json(DaiPipeline pipeline, const char*
         pipe->enableHolisticRecord(cfg);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_enable_holistic_record_json failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_enable_holistic_record_json failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_pipeline_enable_holistic_replay(DaiPipeline pipeline, const char* path_to_recording) {
     if(!pipeline) {
-        last_error = "dai_pipeline_enable_holistic_replay: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_enable_holistic_replay: null pipeline");
         return false;
     }
     if(!path_to_recording) {
-        last_error = "dai_pipeline_enable_holistic_replay: null path_to_recording";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_enable_holistic_replay: null path_to_recording");
         return false;
     }
     try {
@@ -1141,7 +2352,7 @@ bool dai_pipeline_enable_holistic_replay(DaiPipeline pipeline, const char* path_
         pipe->enableHolisticReplay(std::string(path_to_recording));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_enable_holistic_replay failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_enable_holistic_replay failed: ") + e.what());
         return false;
     }
 }
@@ -1153,17 +2364,46 @@ DaiNode dai_pipeline_create_host_node(DaiPipeline pipeline,
                                       DaiHostNodeCallback on_stop_cb,
                                       DaiHostNodeCallback drop_cb) {
     if(!pipeline) {
-        last_error = "dai_pipeline_create_host_node: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_create_host_node: null pipeline");
+        return nullptr;
+    }
+    try {
+        auto pipe = static_cast<dai::Pipeline*>(pipeline);
+        HostNodeCallbacks callbacks{process_cb, on_start_cb, on_stop_cb, drop_cb};
+        auto node = std::make_shared<RustHostNode>(std::move(callbacks), ctx);
+        pipe->add(node);
+        node->attachTelemetry();
+        return static_cast<DaiNode>(node.get());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_create_host_node failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+DaiNode dai_pipeline_create_host_node_parallel(DaiPipeline pipeline,
+                                               void* ctx,
+                                               DaiHostNodeProcessGroup process_cb,
+                                               DaiHostNodeCallback on_start_cb,
+                                               DaiHostNodeCallback on_stop_cb,
+                                               DaiHostNodeCallback drop_cb,
+                                               size_t workers,
+                                               size_t max_in_flight) {
+    if(!pipeline) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_create_host_node_parallel: null pipeline");
         return nullptr;
     }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         HostNodeCallbacks callbacks{process_cb, on_start_cb, on_stop_cb, drop_cb};
         auto node = std::make_shared<RustHostNode>(std::move(callbacks), ctx);
+        if(workers > 1) {
+            node->enableWorkers(workers, max_in_flight);
+        }
         pipe->add(node);
+        node->attachTelemetry();
         return static_cast<DaiNode>(node.get());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_create_host_node failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_create_host_node_parallel failed: ") + e.what());
         return nullptr;
     }
 }
@@ -1175,7 +2415,7 @@ DaiNode dai_pipeline_create_threaded_host_node(DaiPipeline pipeline,
                                                DaiHostNodeCallback on_stop_cb,
                                                DaiHostNodeCallback drop_cb) {
     if(!pipeline) {
-        last_error = "dai_pipeline_create_threaded_host_node: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_create_threaded_host_node: null pipeline");
         return nullptr;
     }
     try {
@@ -1185,7 +2425,7 @@ DaiNode dai_pipeline_create_threaded_host_node(DaiPipeline pipeline,
         pipe->add(node);
         return static_cast<DaiNode>(node.get());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_pipeline_create_threaded_host_node failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_create_threaded_host_node failed: ") + e.what());
         return nullptr;
     }
 }
@@ -1198,19 +2438,19 @@ bool dai_pipeline_start_default(DaiPipeline pipeline) {
 
 DaiDevice dai_pipeline_get_default_device(DaiPipeline pipeline) {
     if(!pipeline) {
-        last_error = "dai_pipeline_get_default_device: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_get_default_device: null pipeline");
         return nullptr;
     }
     try {
         auto pipe = static_cast<dai::Pipeline*>(pipeline);
         auto dev = pipe->getDefaultDevice();
         if(!dev) {
-            last_error = "dai_pipeline_get_default_device: pipeline has no default device";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_pipeline_get_default_device: pipeline has no default device");
             return nullptr;
         }
-        return static_cast<DaiDevice>(new std::shared_ptr<dai::Device>(std::move(dev)));
+        return static_cast<DaiDevice>(_dai_new_handle<dai::Device>(std::move(dev)));
     } catch (const std::exception& e) {
-        last_error = std::string("dai_pipeline_get_default_device failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_get_default_device failed: ") + e.what());
         return nullptr;
     }
 }
@@ -1250,6 +2490,7 @@ static std::unordered_map<std::string, NodeCreator>& get_node_registry() {
         REGISTER_NODE(dai::node::SpatialDetectionNetwork);
         REGISTER_NODE(dai::node::BenchmarkIn);
         REGISTER_NODE(dai::node::BenchmarkOut);
+        REGISTER_NODE(dai::node::ImageFilters);
 
     #if DAI_HAS_NODE_RECTIFICATION
         REGISTER_NODE(dai::node::Rectification);
@@ -1274,7 +2515,7 @@ static std::unordered_map<std::string, NodeCreator>& get_node_registry() {
 
 DaiNode dai_pipeline_create_node_by_name(DaiPipeline pipeline, const char* name) {
     if (!pipeline || !name) {
-        last_error = "dai_pipeline_create_node_by_name: null pipeline or name";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_create_node_by_name: null pipeline or name");
         return nullptr;
     }
     try {
@@ -1282,13 +2523,14 @@ DaiNode dai_pipeline_create_node_by_name(DaiPipeline pipeline, const char* name)
         auto& registry = get_node_registry();
         auto it = registry.find(name);
         if (it != registry.end()) {
-            return static_cast<DaiNode>(it->second(pipe));
+            auto node = it->second(pipe);
+            return static_cast<DaiNode>(node);
         }
         
-        last_error = std::string("dai_pipeline_create_node_by_name: unknown node name: ") + name;
+        last_error.set(DAI_ERROR_NOT_FOUND, std::string("dai_pipeline_create_node_by_name: unknown node name: ") + name);
         return nullptr;
     } catch (const std::exception& e) {
-        last_error = std::string("dai_pipeline_create_node_by_name failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_create_node_by_name failed: ") + e.what());
         return nullptr;
     }
 }
@@ -1299,53 +2541,53 @@ static inline dai::Node::Input* _dai_pick_input_for_output(dai::Node* toNode, da
 
 DaiOutput dai_node_get_output(DaiNode node, const char* group, const char* name) {
     if(!node) {
-        last_error = "dai_node_get_output: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_get_output: null node");
         return nullptr;
     }
     if(_dai_cstr_empty(name)) {
-        last_error = "dai_node_get_output: empty name";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_node_get_output: empty name");
         return nullptr;
     }
     try {
         auto n = static_cast<dai::Node*>(node);
         dai::Node::Output* out = group ? n->getOutputRef(std::string(group), std::string(name)) : n->getOutputRef(std::string(name));
         if(!out) {
-            last_error = "dai_node_get_output: output not found";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_get_output: output not found");
             return nullptr;
         }
         return static_cast<DaiOutput>(out);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_get_output failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_get_output failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiInput dai_node_get_input(DaiNode node, const char* group, const char* name) {
     if(!node) {
-        last_error = "dai_node_get_input: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_get_input: null node");
         return nullptr;
     }
     if(_dai_cstr_empty(name)) {
-        last_error = "dai_node_get_input: empty name";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_node_get_input: empty name");
         return nullptr;
     }
     try {
         auto n = static_cast<dai::Node*>(node);
         dai::Node::Input* in = group ? n->getInputRef(std::string(group), std::string(name)) : n->getInputRef(std::string(name));
         if(!in) {
-            last_error = "dai_node_get_input: input not found";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_get_input: input not found");
             return nullptr;
         }
         return static_cast<DaiInput>(in);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_get_input failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_get_input failed: ") + e.what());
         return nullptr;
     }
 }
 
 int dai_node_get_id(DaiNode node) {
     if(!node) {
-        last_error = "dai_node_get_id: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_get_id: null node");
         return -1;
     }
     try {
@@ -1353,14 +2595,14 @@ int dai_node_get_id(DaiNode node) {
         auto n = static_cast<dai::Node*>(node);
         return n->id;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_get_id failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_get_id failed: ") + e.what());
         return -1;
     }
 }
 
 char* dai_node_get_alias(DaiNode node) {
     if(!node) {
-        last_error = "dai_node_get_alias: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_get_alias: null node");
         return nullptr;
     }
     try {
@@ -1369,18 +2611,18 @@ char* dai_node_get_alias(DaiNode node) {
         auto s = n->getAlias();
         return dai_string_to_cstring(s.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_get_alias failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_get_alias failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_node_set_alias(DaiNode node, const char* alias) {
     if(!node) {
-        last_error = "dai_node_set_alias: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_set_alias: null node");
         return false;
     }
     if(!alias) {
-        last_error = "dai_node_set_alias: null alias";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_set_alias: null alias");
         return false;
     }
     try {
@@ -1389,14 +2631,14 @@ bool dai_node_set_alias(DaiNode node, const char* alias) {
         n->setAlias(std::string(alias));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_set_alias failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_set_alias failed: ") + e.what());
         return false;
     }
 }
 
 char* dai_node_get_name(DaiNode node) {
     if(!node) {
-        last_error = "dai_node_get_name: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_get_name: null node");
         return nullptr;
     }
     try {
@@ -1408,14 +2650,14 @@ char* dai_node_get_name(DaiNode node) {
         }
         return dai_string_to_cstring(name);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_node_get_name failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_get_name failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_output_link(DaiOutput from, DaiNode to, const char* in_group, const char* in_name) {
     if(!from || !to) {
-        last_error = "dai_output_link: null from/to";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_link: null from/to");
         return false;
     }
     try {
@@ -1459,7 +2701,7 @@ bool dai_output_link(DaiOutput from, DaiNode to, const char* in_group, const cha
             }
 
             if(!input) {
-                last_error = "dai_output_link: input not found";
+                last_error.set(DAI_ERROR_NOT_FOUND, "dai_output_link: input not found");
                 return false;
             }
         } else {
@@ -1467,20 +2709,20 @@ bool dai_output_link(DaiOutput from, DaiNode to, const char* in_group, const cha
         }
 
         if(!input) {
-            last_error = "dai_output_link: no compatible input found";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_output_link: no compatible input found");
             return false;
         }
         out->link(*input);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_output_link failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_link failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_output_link_input(DaiOutput from, DaiInput to) {
     if(!from || !to) {
-        last_error = "dai_output_link_input: null from/to";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_link_input: null from/to");
         return false;
     }
     try {
@@ -1489,43 +2731,43 @@ bool dai_output_link_input(DaiOutput from, DaiInput to) {
         out->link(*in);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_output_link_input failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_link_input failed: ") + e.what());
         return false;
     }
 }
 
 int dai_device_get_platform(DaiDevice device) {
     if(!device) {
-        last_error = "dai_device_get_platform: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_get_platform: null device");
         return -1;
     }
     try {
         auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
         if(!dev->get() || !(*dev)) {
-            last_error = "dai_device_get_platform: invalid device";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_device_get_platform: invalid device");
             return -1;
         }
         return static_cast<int>((*dev)->getPlatform());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_device_get_platform failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_get_platform failed: ") + e.what());
         return -1;
     }
 }
 
 void dai_device_set_ir_laser_dot_projector_intensity(DaiDevice device, float intensity) {
     if(!device) {
-        last_error = "dai_device_set_ir_laser_dot_projector_intensity: null device";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_set_ir_laser_dot_projector_intensity: null device");
         return;
     }
     try {
         auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
         if(!dev->get() || !(*dev)) {
-            last_error = "dai_device_set_ir_laser_dot_projector_intensity: invalid device";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_device_set_ir_laser_dot_projector_intensity: invalid device");
             return;
         }
         (*dev)->setIrLaserDotProjectorIntensity(intensity);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_device_set_ir_laser_dot_projector_intensity failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_set_ir_laser_dot_projector_intensity failed: ") + e.what());
     }
 }
 
@@ -1535,144 +2777,144 @@ static inline dai::node::StereoDepth* _dai_as_stereo(DaiNode stereo) {
 
 void dai_stereo_set_subpixel(DaiNode stereo, bool enable) {
     if(!stereo) {
-        last_error = "dai_stereo_set_subpixel: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_subpixel: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setSubpixel(enable);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_subpixel failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_subpixel failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_extended_disparity(DaiNode stereo, bool enable) {
     if(!stereo) {
-        last_error = "dai_stereo_set_extended_disparity: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_extended_disparity: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setExtendedDisparity(enable);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_extended_disparity failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_extended_disparity failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_default_profile_preset(DaiNode stereo, int preset_mode) {
     if(!stereo) {
-        last_error = "dai_stereo_set_default_profile_preset: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_default_profile_preset: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setDefaultProfilePreset(static_cast<dai::node::StereoDepth::PresetMode>(preset_mode));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_default_profile_preset failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_default_profile_preset failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_left_right_check(DaiNode stereo, bool enable) {
     if(!stereo) {
-        last_error = "dai_stereo_set_left_right_check: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_left_right_check: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setLeftRightCheck(enable);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_left_right_check failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_left_right_check failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_rectify_edge_fill_color(DaiNode stereo, int color) {
     if(!stereo) {
-        last_error = "dai_stereo_set_rectify_edge_fill_color: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_rectify_edge_fill_color: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setRectifyEdgeFillColor(color);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_rectify_edge_fill_color failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_rectify_edge_fill_color failed: ") + e.what());
     }
 }
 
 void dai_stereo_enable_distortion_correction(DaiNode stereo, bool enable) {
     if(!stereo) {
-        last_error = "dai_stereo_enable_distortion_correction: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_enable_distortion_correction: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->enableDistortionCorrection(enable);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_enable_distortion_correction failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_enable_distortion_correction failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_output_size(DaiNode stereo, int width, int height) {
     if(!stereo) {
-        last_error = "dai_stereo_set_output_size: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_output_size: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setOutputSize(width, height);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_output_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_output_size failed: ") + e.what());
     }
 }
 
 void dai_stereo_set_output_keep_aspect_ratio(DaiNode stereo, bool keep) {
     if(!stereo) {
-        last_error = "dai_stereo_set_output_keep_aspect_ratio: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_set_output_keep_aspect_ratio: null stereo");
         return;
     }
     try {
         _dai_as_stereo(stereo)->setOutputKeepAspectRatio(keep);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_set_output_keep_aspect_ratio failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_set_output_keep_aspect_ratio failed: ") + e.what());
     }
 }
 
 void dai_stereo_initial_set_left_right_check_threshold(DaiNode stereo, int threshold) {
     if(!stereo) {
-        last_error = "dai_stereo_initial_set_left_right_check_threshold: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_initial_set_left_right_check_threshold: null stereo");
         return;
     }
     try {
         auto s = _dai_as_stereo(stereo);
         if(!s->initialConfig) {
-            last_error = "dai_stereo_initial_set_left_right_check_threshold: initialConfig is null";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_stereo_initial_set_left_right_check_threshold: initialConfig is null");
             return;
         }
         s->initialConfig->setLeftRightCheckThreshold(threshold);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_initial_set_left_right_check_threshold failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_initial_set_left_right_check_threshold failed: ") + e.what());
     }
 }
 
 void dai_stereo_initial_set_threshold_filter_max_range(DaiNode stereo, int max_range) {
     if(!stereo) {
-        last_error = "dai_stereo_initial_set_threshold_filter_max_range: null stereo";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_stereo_initial_set_threshold_filter_max_range: null stereo");
         return;
     }
     try {
         auto s = _dai_as_stereo(stereo);
         if(!s->initialConfig) {
-            last_error = "dai_stereo_initial_set_threshold_filter_max_range: initialConfig is null";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_stereo_initial_set_threshold_filter_max_range: initialConfig is null");
             return;
         }
         s->initialConfig->postProcessing.thresholdFilter.maxRange = max_range;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_stereo_initial_set_threshold_filter_max_range failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_stereo_initial_set_threshold_filter_max_range failed: ") + e.what());
     }
 }
 
 void dai_rgbd_set_depth_unit(DaiNode rgbd, int depth_unit) {
     if(!rgbd) {
-        last_error = "dai_rgbd_set_depth_unit: null rgbd";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_rgbd_set_depth_unit: null rgbd");
         return;
     }
     try {
         auto r = static_cast<dai::node::RGBD*>(rgbd);
         r->setDepthUnit(static_cast<dai::StereoDepthConfig::AlgorithmControl::DepthUnit>(depth_unit));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_rgbd_set_depth_unit failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_rgbd_set_depth_unit failed: ") + e.what());
     }
 }
 
@@ -1682,37 +2924,177 @@ static inline dai::node::ImageAlign* _dai_as_image_align(DaiNode align) {
 
 void dai_image_align_set_run_on_host(DaiNode align, bool run_on_host) {
     if(!align) {
-        last_error = "dai_image_align_set_run_on_host: null align";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_align_set_run_on_host: null align");
         return;
     }
     try {
         _dai_as_image_align(align)->setRunOnHost(run_on_host);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_align_set_run_on_host failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_align_set_run_on_host failed: ") + e.what());
     }
 }
 
 void dai_image_align_set_output_size(DaiNode align, int width, int height) {
     if(!align) {
-        last_error = "dai_image_align_set_output_size: null align";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_align_set_output_size: null align");
         return;
     }
     try {
         _dai_as_image_align(align)->setOutputSize(width, height);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_align_set_output_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_align_set_output_size failed: ") + e.what());
     }
 }
 
 void dai_image_align_set_out_keep_aspect_ratio(DaiNode align, bool keep) {
     if(!align) {
-        last_error = "dai_image_align_set_out_keep_aspect_ratio: null align";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_align_set_out_keep_aspect_ratio: null align");
         return;
     }
     try {
         _dai_as_image_align(align)->setOutKeepAspectRatio(keep);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_align_set_out_keep_aspect_ratio failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_align_set_out_keep_aspect_ratio failed: ") + e.what());
+    }
+}
+
+static inline dai::node::BenchmarkOut* _dai_as_benchmark_out(DaiNode bench) {
+    return static_cast<dai::node::BenchmarkOut*>(bench);
+}
+
+static inline dai::node::BenchmarkIn* _dai_as_benchmark_in(DaiNode bench) {
+    return static_cast<dai::node::BenchmarkIn*>(bench);
+}
+
+void dai_benchmark_out_set_num_messages_to_send(DaiNode bench, int num) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_out_set_num_messages_to_send: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_out(bench)->setNumMessagesToSend(num);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_out_set_num_messages_to_send failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_out_set_fps(DaiNode bench, float fps) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_out_set_fps: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_out(bench)->setFps(fps);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_out_set_fps failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_out_set_run_on_host(DaiNode bench, bool run_on_host) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_out_set_run_on_host: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_out(bench)->setRunOnHost(run_on_host);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_out_set_run_on_host failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_in_send_report_every_n_messages(DaiNode bench, uint32_t num) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_in_send_report_every_n_messages: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_in(bench)->sendReportEveryNMessages(num);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_in_send_report_every_n_messages failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_in_set_run_on_host(DaiNode bench, bool run_on_host) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_in_set_run_on_host: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_in(bench)->setRunOnHost(run_on_host);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_in_set_run_on_host failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_in_log_reports_as_warnings(DaiNode bench, bool log_as_warnings) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_in_log_reports_as_warnings: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_in(bench)->logReportsAsWarnings(log_as_warnings);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_in_log_reports_as_warnings failed: ") + e.what());
+    }
+}
+
+void dai_benchmark_in_measure_individual_latencies(DaiNode bench, bool measure) {
+    if(!bench) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_benchmark_in_measure_individual_latencies: null bench");
+        return;
+    }
+    try {
+        _dai_as_benchmark_in(bench)->measureIndividualLatencies(measure);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_benchmark_in_measure_individual_latencies failed: ") + e.what());
+    }
+}
+
+static inline dai::node::ImageFilters* _dai_as_image_filters(DaiNode filters) {
+    return static_cast<dai::node::ImageFilters*>(filters);
+}
+
+void dai_image_filters_set_default_profile_preset(DaiNode filters, int preset_mode) {
+    if(!filters) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_filters_set_default_profile_preset: null filters");
+        return;
+    }
+    try {
+        _dai_as_image_filters(filters)->setDefaultProfilePreset(static_cast<dai::node::ImageFiltersPresetMode>(preset_mode));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_filters_set_default_profile_preset failed: ") + e.what());
+    }
+}
+
+void dai_image_filters_set_run_on_host(DaiNode filters, bool run_on_host) {
+    if(!filters) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_filters_set_run_on_host: null filters");
+        return;
+    }
+    try {
+        _dai_as_image_filters(filters)->setRunOnHost(run_on_host);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_filters_set_run_on_host failed: ") + e.what());
+    }
+}
+
+bool dai_depth_median(const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t width, size_t height, int k) {
+    if(!src || !dst) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_depth_median: null src/dst");
+        return false;
+    }
+    if((k != 3 && k != 5 && k != 7) || src_stride < width || dst_stride < width) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_depth_median: k must be 3, 5 or 7 and strides at least the width");
+        return false;
+    }
+    if(width == 0 || height == 0) return true;
+    try {
+        static _DaiTilePool pool;
+        _dai_df_median(pool, static_cast<const uint16_t*>(src), src_stride, static_cast<uint16_t*>(dst), dst_stride, width, height, k);
+        return true;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_depth_median failed: ") + e.what());
+        return false;
     }
 }
 
@@ -1728,7 +3110,7 @@ static inline dai::node::VideoEncoder* _dai_as_video_encoder(DaiNode encoder) {
 // 
 // Error handling contract:
 // - Returns nullptr on failure (null cfg or wrong type)
-// - Sets global last_error with context-specific message
+// - Sets the calling thread's last_error with context-specific message
 // - Callers MUST check return value and return early on nullptr
 // - Error is propagated to Rust via dai_get_last_error()
 //
@@ -1736,13 +3118,13 @@ static inline dai::node::VideoEncoder* _dai_as_video_encoder(DaiNode encoder) {
 // to the Rust layer without requiring per-function error handling.
 static inline std::shared_ptr<dai::ImageManipConfig> _dai_as_image_manip_config(DaiBuffer cfg, const char* ctx) {
     if(!cfg) {
-        last_error = std::string(ctx) + ": null cfg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, std::string(ctx) + ": null cfg");
         return nullptr;
     }
     auto base_ptr = static_cast<std::shared_ptr<dai::Buffer>*>(cfg);
     auto typed = std::dynamic_pointer_cast<dai::ImageManipConfig>(*base_ptr);
     if(!typed) {
-        last_error = std::string(ctx) + ": cfg is not ImageManipConfig";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(ctx) + ": cfg is not ImageManipConfig");
         return nullptr;
     }
     return typed;
@@ -1750,92 +3132,92 @@ static inline std::shared_ptr<dai::ImageManipConfig> _dai_as_image_manip_config(
 
 void dai_image_manip_set_num_frames_pool(DaiNode manip, int num_frames_pool) {
     if(!manip) {
-        last_error = "dai_image_manip_set_num_frames_pool: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_set_num_frames_pool: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->setNumFramesPool(num_frames_pool);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_set_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_set_num_frames_pool failed: ") + e.what());
     }
 }
 
 void dai_image_manip_set_max_output_frame_size(DaiNode manip, int max_frame_size) {
     if(!manip) {
-        last_error = "dai_image_manip_set_max_output_frame_size: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_set_max_output_frame_size: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->setMaxOutputFrameSize(max_frame_size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_set_max_output_frame_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_set_max_output_frame_size failed: ") + e.what());
     }
 }
 
 void dai_image_manip_set_run_on_host(DaiNode manip, bool run_on_host) {
     if(!manip) {
-        last_error = "dai_image_manip_set_run_on_host: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_set_run_on_host: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->setRunOnHost(run_on_host);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_set_run_on_host failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_set_run_on_host failed: ") + e.what());
     }
 }
 
 void dai_image_manip_set_backend(DaiNode manip, int backend) {
     if(!manip) {
-        last_error = "dai_image_manip_set_backend: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_set_backend: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->setBackend(static_cast<dai::node::ImageManip::Backend>(backend));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_set_backend failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_set_backend failed: ") + e.what());
     }
 }
 
 void dai_image_manip_set_performance_mode(DaiNode manip, int performance_mode) {
     if(!manip) {
-        last_error = "dai_image_manip_set_performance_mode: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_set_performance_mode: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->setPerformanceMode(static_cast<dai::node::ImageManip::PerformanceMode>(performance_mode));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_set_performance_mode failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_set_performance_mode failed: ") + e.what());
     }
 }
 
 bool dai_image_manip_run_on_host(DaiNode manip) {
     if(!manip) {
-        last_error = "dai_image_manip_run_on_host: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_run_on_host: null manip");
         return false;
     }
     try {
         return _dai_as_image_manip(manip)->runOnHost();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_run_on_host failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_run_on_host failed: ") + e.what());
         return false;
     }
 }
 
 void dai_image_manip_run(DaiNode manip) {
     if(!manip) {
-        last_error = "dai_image_manip_run: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_run: null manip");
         return;
     }
     try {
         _dai_as_image_manip(manip)->run();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_run failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_run failed: ") + e.what());
     }
 }
 
 void dai_video_encoder_set_default_profile_preset(DaiNode encoder, float fps, int profile) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_default_profile_preset: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_default_profile_preset: null encoder");
         return;
     }
     try {
@@ -1844,38 +3226,38 @@ void dai_video_encoder_set_default_profile_preset(DaiNode encoder, float fps, in
             static_cast<dai::VideoEncoderProperties::Profile>(profile)
         );
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_default_profile_preset failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_default_profile_preset failed: ") + e.what());
     }
 }
 
 void dai_video_encoder_set_num_frames_pool(DaiNode encoder, int frames) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_num_frames_pool: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_num_frames_pool: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setNumFramesPool(frames);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_num_frames_pool failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_num_frames_pool(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_num_frames_pool: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_num_frames_pool: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getNumFramesPool();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_num_frames_pool failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_rate_control_mode(DaiNode encoder, int mode) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_rate_control_mode: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_rate_control_mode: null encoder");
         return;
     }
     try {
@@ -1883,26 +3265,26 @@ void dai_video_encoder_set_rate_control_mode(DaiNode encoder, int mode) {
             static_cast<dai::VideoEncoderProperties::RateControlMode>(mode)
         );
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_rate_control_mode failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_rate_control_mode failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_rate_control_mode(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_rate_control_mode: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_rate_control_mode: null encoder");
         return 0;
     }
     try {
         return static_cast<int>(_dai_as_video_encoder(encoder)->getRateControlMode());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_rate_control_mode failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_rate_control_mode failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_profile(DaiNode encoder, int profile) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_profile: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_profile: null encoder");
         return;
     }
     try {
@@ -1910,219 +3292,219 @@ void dai_video_encoder_set_profile(DaiNode encoder, int profile) {
             static_cast<dai::VideoEncoderProperties::Profile>(profile)
         );
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_profile failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_profile failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_profile(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_profile: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_profile: null encoder");
         return 0;
     }
     try {
         return static_cast<int>(_dai_as_video_encoder(encoder)->getProfile());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_profile failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_profile failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_bitrate(DaiNode encoder, int bitrate) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_bitrate: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_bitrate: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setBitrate(bitrate);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_bitrate failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_bitrate failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_bitrate(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_bitrate: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_bitrate: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getBitrate();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_bitrate failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_bitrate failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_bitrate_kbps(DaiNode encoder, int bitrate_kbps) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_bitrate_kbps: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_bitrate_kbps: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setBitrateKbps(bitrate_kbps);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_bitrate_kbps failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_bitrate_kbps failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_bitrate_kbps(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_bitrate_kbps: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_bitrate_kbps: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getBitrateKbps();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_bitrate_kbps failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_bitrate_kbps failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_keyframe_frequency(DaiNode encoder, int freq) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_keyframe_frequency: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_keyframe_frequency: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setKeyframeFrequency(freq);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_keyframe_frequency failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_keyframe_frequency failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_keyframe_frequency(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_keyframe_frequency: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_keyframe_frequency: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getKeyframeFrequency();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_keyframe_frequency failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_keyframe_frequency failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_num_bframes(DaiNode encoder, int num_bframes) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_num_bframes: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_num_bframes: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setNumBFrames(num_bframes);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_num_bframes failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_num_bframes failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_num_bframes(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_num_bframes: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_num_bframes: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getNumBFrames();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_num_bframes failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_num_bframes failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_quality(DaiNode encoder, int quality) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_quality: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_quality: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setQuality(quality);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_quality failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_quality failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_quality(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_quality: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_quality: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getQuality();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_quality failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_quality failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_video_encoder_set_lossless(DaiNode encoder, bool lossless) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_lossless: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_lossless: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setLossless(lossless);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_lossless failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_lossless failed: ") + e.what());
     }
 }
 
 bool dai_video_encoder_get_lossless(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_lossless: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_lossless: null encoder");
         return false;
     }
     try {
         return _dai_as_video_encoder(encoder)->getLossless();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_lossless failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_lossless failed: ") + e.what());
         return false;
     }
 }
 
 void dai_video_encoder_set_frame_rate(DaiNode encoder, float frame_rate) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_frame_rate: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_frame_rate: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setFrameRate(frame_rate);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_frame_rate failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_frame_rate failed: ") + e.what());
     }
 }
 
 float dai_video_encoder_get_frame_rate(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_frame_rate: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_frame_rate: null encoder");
         return 0.0f;
     }
     try {
         return _dai_as_video_encoder(encoder)->getFrameRate();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_frame_rate failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_frame_rate failed: ") + e.what());
         return 0.0f;
     }
 }
 
 void dai_video_encoder_set_max_output_frame_size(DaiNode encoder, int max_frame_size) {
     if(!encoder) {
-        last_error = "dai_video_encoder_set_max_output_frame_size: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_set_max_output_frame_size: null encoder");
         return;
     }
     try {
         _dai_as_video_encoder(encoder)->setMaxOutputFrameSize(max_frame_size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_set_max_output_frame_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_set_max_output_frame_size failed: ") + e.what());
     }
 }
 
 int dai_video_encoder_get_max_output_frame_size(DaiNode encoder) {
     if(!encoder) {
-        last_error = "dai_video_encoder_get_max_output_frame_size: null encoder";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_video_encoder_get_max_output_frame_size: null encoder");
         return 0;
     }
     try {
         return _dai_as_video_encoder(encoder)->getMaxOutputFrameSize();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_video_encoder_get_max_output_frame_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_video_encoder_get_max_output_frame_size failed: ") + e.what());
         return 0;
     }
 }
@@ -2130,27 +3512,27 @@ int dai_video_encoder_get_max_output_frame_size(DaiNode encoder) {
 DaiBuffer dai_image_manip_config_new() {
     try {
         auto cfg = std::make_shared<dai::ImageManipConfig>();
-        return new std::shared_ptr<dai::Buffer>(std::static_pointer_cast<dai::Buffer>(std::move(cfg)));
+        return _dai_new_handle<dai::Buffer>(std::static_pointer_cast<dai::Buffer>(std::move(cfg)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_new failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_new failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiBuffer dai_image_manip_get_initial_config(DaiNode manip) {
     if(!manip) {
-        last_error = "dai_image_manip_get_initial_config: null manip";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_get_initial_config: null manip");
         return nullptr;
     }
     try {
         auto m = _dai_as_image_manip(manip);
         if(!m->initialConfig) {
-            last_error = "dai_image_manip_get_initial_config: initialConfig is null";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_image_manip_get_initial_config: initialConfig is null");
             return nullptr;
         }
-        return new std::shared_ptr<dai::Buffer>(std::static_pointer_cast<dai::Buffer>(m->initialConfig));
+        return _dai_new_handle<dai::Buffer>(std::static_pointer_cast<dai::Buffer>(m->initialConfig));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_get_initial_config failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_get_initial_config failed: ") + e.what());
         return nullptr;
     }
 }
@@ -2161,7 +3543,7 @@ void dai_image_manip_config_clear_ops(DaiBuffer cfg) {
         if(!c) return;
         c->clearOps();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_clear_ops failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_clear_ops failed: ") + e.what());
     }
 }
 
@@ -2171,7 +3553,7 @@ void dai_image_manip_config_add_crop_xywh(DaiBuffer cfg, uint32_t x, uint32_t y,
         if(!c) return;
         c->addCrop(x, y, w, h);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_crop_xywh failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_crop_xywh failed: ") + e.what());
     }
 }
 
@@ -2188,7 +3570,7 @@ void dai_image_manip_config_add_crop_rect(DaiBuffer cfg, float x, float y, float
         r.normalized = normalized_coords;
         c->addCrop(r, normalized_coords);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_crop_rect failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_crop_rect failed: ") + e.what());
     }
 }
 
@@ -2201,7 +3583,7 @@ void dai_image_manip_config_add_crop_rotated_rect(DaiBuffer cfg, float cx, float
         dai::RotatedRect rr(center, size, angle_deg);
         c->addCropRotatedRect(rr, normalized_coords);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_crop_rotated_rect failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_crop_rotated_rect failed: ") + e.what());
     }
 }
 
@@ -2211,7 +3593,7 @@ void dai_image_manip_config_add_scale(DaiBuffer cfg, float scale_x, float scale_
         if(!c) return;
         c->addScale(scale_x, scale_y);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_scale failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_scale failed: ") + e.what());
     }
 }
 
@@ -2221,7 +3603,7 @@ void dai_image_manip_config_add_rotate_deg(DaiBuffer cfg, float angle_deg) {
         if(!c) return;
         c->addRotateDeg(angle_deg);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_rotate_deg failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_rotate_deg failed: ") + e.what());
     }
 }
 
@@ -2231,7 +3613,7 @@ void dai_image_manip_config_add_rotate_deg_center(DaiBuffer cfg, float angle_deg
         if(!c) return;
         c->addRotateDeg(angle_deg, dai::Point2f(center_x, center_y, true));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_rotate_deg_center failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_rotate_deg_center failed: ") + e.what());
     }
 }
 
@@ -2241,7 +3623,7 @@ void dai_image_manip_config_add_flip_horizontal(DaiBuffer cfg) {
         if(!c) return;
         c->addFlipHorizontal();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_flip_horizontal failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_flip_horizontal failed: ") + e.what());
     }
 }
 
@@ -2251,13 +3633,13 @@ void dai_image_manip_config_add_flip_vertical(DaiBuffer cfg) {
         if(!c) return;
         c->addFlipVertical();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_flip_vertical failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_flip_vertical failed: ") + e.what());
     }
 }
 
 void dai_image_manip_config_add_transform_affine(DaiBuffer cfg, const float* matrix4) {
     if(!matrix4) {
-        last_error = "dai_image_manip_config_add_transform_affine: null matrix4";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_config_add_transform_affine: null matrix4");
         return;
     }
     try {
@@ -2266,13 +3648,13 @@ void dai_image_manip_config_add_transform_affine(DaiBuffer cfg, const float* mat
         std::array<float, 4> m{{matrix4[0], matrix4[1], matrix4[2], matrix4[3]}};
         c->addTransformAffine(m);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_transform_affine failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_transform_affine failed: ") + e.what());
     }
 }
 
 void dai_image_manip_config_add_transform_perspective(DaiBuffer cfg, const float* matrix9) {
     if(!matrix9) {
-        last_error = "dai_image_manip_config_add_transform_perspective: null matrix9";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_config_add_transform_perspective: null matrix9");
         return;
     }
     try {
@@ -2285,13 +3667,13 @@ void dai_image_manip_config_add_transform_perspective(DaiBuffer cfg, const float
         }};
         c->addTransformPerspective(m);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_transform_perspective failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_transform_perspective failed: ") + e.what());
     }
 }
 
 void dai_image_manip_config_add_transform_four_points(DaiBuffer cfg, const float* src8, const float* dst8, bool normalized_coords) {
     if(!src8 || !dst8) {
-        last_error = "dai_image_manip_config_add_transform_four_points: null src8 or dst8";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_manip_config_add_transform_four_points: null src8 or dst8");
         return;
     }
     try {
@@ -2313,7 +3695,7 @@ void dai_image_manip_config_add_transform_four_points(DaiBuffer cfg, const float
 
         c->addTransformFourPoints(src, dst, normalized_coords);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_add_transform_four_points failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_add_transform_four_points failed: ") + e.what());
     }
 }
 
@@ -2323,7 +3705,7 @@ void dai_image_manip_config_set_output_size(DaiBuffer cfg, uint32_t w, uint32_t
         if(!c) return;
         c->setOutputSize(w, h, static_cast<dai::ImageManipConfig::ResizeMode>(resize_mode));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_output_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_output_size failed: ") + e.what());
     }
 }
 
@@ -2333,7 +3715,7 @@ void dai_image_manip_config_set_output_center(DaiBuffer cfg, bool center) {
         if(!c) return;
         c->setOutputCenter(center);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_output_center failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_output_center failed: ") + e.what());
     }
 }
 
@@ -2343,7 +3725,7 @@ void dai_image_manip_config_set_colormap(DaiBuffer cfg, int colormap) {
         if(!c) return;
         c->setColormap(static_cast<dai::Colormap>(colormap));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_colormap failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_colormap failed: ") + e.what());
     }
 }
 
@@ -2353,7 +3735,7 @@ void dai_image_manip_config_set_background_color_rgb(DaiBuffer cfg, uint32_t red
         if(!c) return;
         c->setBackgroundColor(red, green, blue);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_background_color_rgb failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_background_color_rgb failed: ") + e.what());
     }
 }
 
@@ -2363,7 +3745,7 @@ void dai_image_manip_config_set_background_color_gray(DaiBuffer cfg, uint32_t va
         if(!c) return;
         c->setBackgroundColor(val);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_background_color_gray failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_background_color_gray failed: ") + e.what());
     }
 }
 
@@ -2373,7 +3755,7 @@ void dai_image_manip_config_set_frame_type(DaiBuffer cfg, int frame_type) {
         if(!c) return;
         c->setFrameType(static_cast<dai::ImgFrame::Type>(frame_type));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_frame_type failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_frame_type failed: ") + e.what());
     }
 }
 
@@ -2383,7 +3765,7 @@ void dai_image_manip_config_set_undistort(DaiBuffer cfg, bool undistort) {
         if(!c) return;
         c->setUndistort(undistort);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_undistort failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_undistort failed: ") + e.what());
     }
 }
 
@@ -2393,7 +3775,7 @@ bool dai_image_manip_config_get_undistort(DaiBuffer cfg) {
         if(!c) return false;
         return c->getUndistort();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_get_undistort failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_get_undistort failed: ") + e.what());
         return false;
     }
 }
@@ -2404,7 +3786,7 @@ void dai_image_manip_config_set_reuse_previous_image(DaiBuffer cfg, bool reuse)
         if(!c) return;
         c->setReusePreviousImage(reuse);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_reuse_previous_image failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_reuse_previous_image failed: ") + e.what());
     }
 }
 
@@ -2414,7 +3796,7 @@ void dai_image_manip_config_set_skip_current_image(DaiBuffer cfg, bool skip) {
         if(!c) return;
         c->setSkipCurrentImage(skip);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_set_skip_current_image failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_set_skip_current_image failed: ") + e.what());
     }
 }
 
@@ -2424,7 +3806,7 @@ bool dai_image_manip_config_get_reuse_previous_image(DaiBuffer cfg) {
         if(!c) return false;
         return c->getReusePreviousImage();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_get_reuse_previous_image failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_get_reuse_previous_image failed: ") + e.what());
         return false;
     }
 }
@@ -2435,21 +3817,292 @@ bool dai_image_manip_config_get_skip_current_image(DaiBuffer cfg) {
         if(!c) return false;
         return c->getSkipCurrentImage();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_image_manip_config_get_skip_current_image failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_image_manip_config_get_skip_current_image failed: ") + e.what());
+        return false;
+    }
+}
+
+bool dai_buffer_is_image_manip_config(DaiBuffer buffer) {
+    if(!buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_is_image_manip_config: null buffer");
         return false;
     }
+    auto base_ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+    return std::dynamic_pointer_cast<dai::ImageManipConfig>(*base_ptr) != nullptr;
+}
+
+// ImageManipConfig templates. The operation chain and output settings are captured once; each
+// instance is a recycled config (same deleter trick as `_DaiBufferPool`) refilled from the
+// settings and the chain with the ROI slots patched in, so per-crop work on the host is a copy
+// plus a few op appends inside one ABI call.
+struct _DaiManipTemplate {
+    dai::ImageManipConfig settings;
+    std::vector<DaiManipOp> ops;
+    size_t max_free = 0;
+    std::mutex mtx;
+    std::vector<dai::ImageManipConfig*> free_list;
+    size_t allocated = 0;
+
+    ~_DaiManipTemplate() {
+        for(auto* cfg : free_list) delete cfg;
+    }
+};
+
+struct _DaiManipTemplateRecycler {
+    std::weak_ptr<_DaiManipTemplate> tpl;
+
+    void operator()(dai::ImageManipConfig* cfg) const {
+        if(auto t = tpl.lock()) {
+            std::lock_guard<std::mutex> lock(t->mtx);
+            if(t->free_list.size() < t->max_free) {
+                t->free_list.push_back(cfg);
+                return;
+            }
+            t->allocated--;
+        }
+        delete cfg;
+    }
+};
+
+static void _dai_manip_apply_op(dai::ImageManipConfig& c, const DaiManipOp& op, const DaiManipRoi& roi) {
+    const float* p = op.params;
+    const bool norm = op.normalized;
+    switch(op.kind) {
+        case DAI_MANIP_OP_CROP_XYWH:
+            c.addCrop(static_cast<uint32_t>(p[0]), static_cast<uint32_t>(p[1]), static_cast<uint32_t>(p[2]), static_cast<uint32_t>(p[3]));
+            break;
+        case DAI_MANIP_OP_CROP_RECT:
+        case DAI_MANIP_OP_ROI_CROP: {
+            const bool slot = op.kind == DAI_MANIP_OP_ROI_CROP;
+            dai::Rect r;
+            r.x = slot ? roi.x : p[0];
+            r.y = slot ? roi.y : p[1];
+            r.width = slot ? roi.width : p[2];
+            r.height = slot ? roi.height : p[3];
+            r.hasNormalized = true;
+            r.normalized = norm;
+            c.addCrop(r, norm);
+            break;
+        }
+        case DAI_MANIP_OP_CROP_ROTATED_RECT:
+        case DAI_MANIP_OP_ROI_CROP_ROTATED: {
+            const bool slot = op.kind == DAI_MANIP_OP_ROI_CROP_ROTATED;
+            dai::Point2f center(slot ? roi.x : p[0], slot ? roi.y : p[1], norm);
+            dai::Size2f size(slot ? roi.width : p[2], slot ? roi.height : p[3], norm);
+            c.addCropRotatedRect(dai::RotatedRect(center, size, slot ? roi.angle_deg : p[4]), norm);
+            break;
+        }
+        case DAI_MANIP_OP_SCALE:
+            c.addScale(p[0], p[1]);
+            break;
+        case DAI_MANIP_OP_ROTATE:
+            c.addRotateDeg(p[0]);
+            break;
+        case DAI_MANIP_OP_ROTATE_CENTER:
+            c.addRotateDeg(p[0], dai::Point2f(p[1], p[2], true));
+            break;
+        case DAI_MANIP_OP_ROI_ROTATE:
+            c.addRotateDeg(roi.angle_deg);
+            break;
+        case DAI_MANIP_OP_FLIP_HORIZONTAL:
+            c.addFlipHorizontal();
+            break;
+        case DAI_MANIP_OP_FLIP_VERTICAL:
+            c.addFlipVertical();
+            break;
+        case DAI_MANIP_OP_AFFINE: {
+            std::array<float, 4> m{{p[0], p[1], p[2], p[3]}};
+            c.addTransformAffine(m);
+            break;
+        }
+        case DAI_MANIP_OP_PERSPECTIVE: {
+            std::array<float, 9> m{{p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8]}};
+            c.addTransformPerspective(m);
+            break;
+        }
+        case DAI_MANIP_OP_FOUR_POINTS: {
+            auto pt = [&](size_t i) { return dai::Point2f(p[2 * i], p[2 * i + 1], norm); };
+            std::array<dai::Point2f, 4> src{{pt(0), pt(1), pt(2), pt(3)}};
+            std::array<dai::Point2f, 4> dst{{pt(4), pt(5), pt(6), pt(7)}};
+            c.addTransformFourPoints(src, dst, norm);
+            break;
+        }
+        default:
+            throw std::invalid_argument("unknown manip op kind " + std::to_string(op.kind));
+    }
+}
+
+static std::shared_ptr<dai::ImageManipConfig> _dai_manip_template_take(const std::shared_ptr<_DaiManipTemplate>& tpl, const DaiManipRoi& roi) {
+    dai::ImageManipConfig* cfg = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(tpl->mtx);
+        if(!tpl->free_list.empty()) {
+            cfg = tpl->free_list.back();
+            tpl->free_list.pop_back();
+        } else {
+            tpl->allocated++;
+        }
+    }
+    const bool recycled = cfg != nullptr;
+    std::shared_ptr<dai::ImageManipConfig> out;
+    try {
+        if(!cfg) cfg = new dai::ImageManipConfig(tpl->settings);
+        out = std::shared_ptr<dai::ImageManipConfig>(cfg, _DaiManipTemplateRecycler{tpl});
+    } catch(...) {
+        delete cfg;
+        std::lock_guard<std::mutex> lock(tpl->mtx);
+        tpl->allocated--;
+        throw;
+    }
+    if(recycled) *out = tpl->settings;
+    for(const auto& op : tpl->ops) _dai_manip_apply_op(*out, op, roi);
+    return out;
+}
+
+DaiManipTemplate dai_manip_template_new(DaiBuffer settings, const DaiManipOp* ops, size_t count, size_t max_free) {
+    if(!ops && count) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_manip_template_new: null ops");
+        return nullptr;
+    }
+    try {
+        auto tpl = std::make_shared<_DaiManipTemplate>();
+        if(settings) {
+            auto c = _dai_as_image_manip_config(settings, "dai_manip_template_new");
+            if(!c) return nullptr;
+            tpl->settings = *c;
+        }
+        tpl->settings.clearOps();
+        tpl->ops.assign(ops, ops + count);
+        tpl->max_free = max_free;
+        tpl->free_list.reserve(max_free);
+        // Validate the chain once up front so bad kinds fail here rather than per frame.
+        dai::ImageManipConfig probe(tpl->settings);
+        for(const auto& op : tpl->ops) _dai_manip_apply_op(probe, op, DaiManipRoi{0.0f, 0.0f, 1.0f, 1.0f, 0.0f});
+        return static_cast<DaiManipTemplate>(_dai_new_handle<_DaiManipTemplate>(std::move(tpl)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_manip_template_new failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_manip_template_release(DaiManipTemplate tpl) {
+    if(tpl) {
+        auto ptr = static_cast<std::shared_ptr<_DaiManipTemplate>*>(tpl);
+        _dai_delete_handle(ptr);
+    }
+}
+
+DaiBuffer dai_manip_template_instantiate(DaiManipTemplate tpl, const DaiManipRoi* roi) {
+    if(!tpl || !roi) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_manip_template_instantiate: null template/roi");
+        return nullptr;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<_DaiManipTemplate>*>(tpl);
+        auto cfg = _dai_manip_template_take(*ptr, *roi);
+        return _dai_new_handle<dai::Buffer>(std::static_pointer_cast<dai::Buffer>(std::move(cfg)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_manip_template_instantiate failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+size_t dai_manip_template_send_rois(DaiManipTemplate tpl,
+                                    DaiInputQueue config_queue,
+                                    DaiInputQueue image_queue,
+                                    DaiImgFrame frame,
+                                    const DaiManipRoi* rois,
+                                    size_t count) {
+    if(!tpl || !config_queue || (!rois && count)) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_manip_template_send_rois: null template/config_queue/rois");
+        return 0;
+    }
+    if(frame && !image_queue) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_manip_template_send_rois: frame given without image_queue");
+        return 0;
+    }
+    size_t sent = 0;
+    try {
+        auto ptr = static_cast<std::shared_ptr<_DaiManipTemplate>*>(tpl);
+        auto cq = static_cast<std::shared_ptr<dai::InputQueue>*>(config_queue);
+        if(!*cq) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_manip_template_send_rois: invalid config_queue");
+            return 0;
+        }
+        if(frame && count) {
+            auto iq = static_cast<std::shared_ptr<dai::InputQueue>*>(image_queue);
+            auto f = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+            if(!*iq || !*f) {
+                last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_manip_template_send_rois: invalid image_queue/frame");
+                return 0;
+            }
+            (*iq)->send(*f);
+        }
+        for(; sent < count; ++sent) {
+            auto cfg = _dai_manip_template_take(*ptr, rois[sent]);
+            // The first crop consumes the new frame, the rest crop the same image again.
+            cfg->setReusePreviousImage(sent > 0 || !frame);
+            cfg->setSkipCurrentImage(false);
+            (*cq)->send(cfg);
+        }
+        return sent;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_manip_template_send_rois failed: ") + e.what());
+        return sent;
+    }
+}
+
+size_t dai_manip_template_get_allocated(DaiManipTemplate tpl) {
+    if(!tpl) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_manip_template_get_allocated: null template");
+        return 0;
+    }
+    auto ptr = static_cast<std::shared_ptr<_DaiManipTemplate>*>(tpl);
+    std::lock_guard<std::mutex> lock((*ptr)->mtx);
+    return (*ptr)->allocated;
 }
 
-// Wrapper-owned pointcloud view. PointCloudData::getPointsRGB() returns by value, so we
-// store the returned vector and expose a stable pointer + length to Rust.
+// Wrapper-owned pointcloud view. For colored clouds the message buffer already stores
+// tightly packed `Point3fRGBA` records, so we borrow it in place (the view keeps the message
+// alive). PointCloudData::getPointsRGB() returns by value, so it is only used as a fallback
+// when the buffer layout does not match `DaiPoint3fRGBA`.
 struct DaiPointCloudView {
     std::shared_ptr<dai::PointCloudData> msg;
     std::vector<dai::Point3fRGBA> points;
+    const dai::Point3fRGBA* data = nullptr;
+    size_t count = 0;
+    size_t stride = sizeof(dai::Point3fRGBA);
+    bool borrowed = false;
 };
 
+static_assert(sizeof(dai::Point3fRGBA) == sizeof(DaiPoint3fRGBA), "Point3fRGBA layout mismatch");
+
+static DaiPointCloud _dai_make_pointcloud_view(std::shared_ptr<dai::PointCloudData> pcl) {
+    auto view = new DaiPointCloudView();
+    view->msg = std::move(pcl);
+    try {
+        auto bytes = view->msg->getData();
+        const auto addr = reinterpret_cast<std::uintptr_t>(bytes.data());
+        if(view->msg->isColor() && !bytes.empty() && bytes.size() % sizeof(dai::Point3fRGBA) == 0
+           && addr % alignof(dai::Point3fRGBA) == 0) {
+            view->data = reinterpret_cast<const dai::Point3fRGBA*>(bytes.data());
+            view->count = bytes.size() / sizeof(dai::Point3fRGBA);
+            view->borrowed = true;
+        } else {
+            view->points = view->msg->getPointsRGB();
+            view->data = view->points.empty() ? nullptr : view->points.data();
+            view->count = view->points.size();
+        }
+    } catch(...) {
+        delete view;
+        throw;
+    }
+    return static_cast<DaiPointCloud>(view);
+}
+
 DaiPointCloud dai_queue_get_pointcloud(DaiDataQueue queue, int timeout_ms) {
     if(!queue) {
-        last_error = "dai_queue_get_pointcloud: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_pointcloud: null queue");
         return nullptr;
     }
     try {
@@ -2460,42 +4113,39 @@ DaiPointCloud dai_queue_get_pointcloud(DaiDataQueue queue, int timeout_ms) {
         } else {
             bool timedOut = false;
             pcl = (*ptr)->get<dai::PointCloudData>(std::chrono::milliseconds(timeout_ms), timedOut);
-            if(timedOut) return nullptr;
+            if(timedOut) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
+                return nullptr;
+            }
         }
         if(!pcl) return nullptr;
 
-        auto view = new DaiPointCloudView();
-        view->msg = pcl;
-        view->points = pcl->getPointsRGB();
-        return static_cast<DaiPointCloud>(view);
+        return _dai_make_pointcloud_view(std::move(pcl));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_pointcloud failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_pointcloud failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiPointCloud dai_queue_try_get_pointcloud(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get_pointcloud: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get_pointcloud: null queue");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         auto pcl = (*ptr)->tryGet<dai::PointCloudData>();
         if(!pcl) return nullptr;
-        auto view = new DaiPointCloudView();
-        view->msg = pcl;
-        view->points = pcl->getPointsRGB();
-        return static_cast<DaiPointCloud>(view);
+        return _dai_make_pointcloud_view(std::move(pcl));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get_pointcloud failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get_pointcloud failed: ") + e.what());
         return nullptr;
     }
 }
 
 int dai_pointcloud_get_width(DaiPointCloud pcl) {
     if(!pcl) {
-        last_error = "dai_pointcloud_get_width: null pointcloud";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_get_width: null pointcloud");
         return 0;
     }
     auto view = static_cast<DaiPointCloudView*>(pcl);
@@ -2504,7 +4154,7 @@ int dai_pointcloud_get_width(DaiPointCloud pcl) {
 
 int dai_pointcloud_get_height(DaiPointCloud pcl) {
     if(!pcl) {
-        last_error = "dai_pointcloud_get_height: null pointcloud";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_get_height: null pointcloud");
         return 0;
     }
     auto view = static_cast<DaiPointCloudView*>(pcl);
@@ -2513,33 +4163,152 @@ int dai_pointcloud_get_height(DaiPointCloud pcl) {
 
 const DaiPoint3fRGBA* dai_pointcloud_get_points_rgba(DaiPointCloud pcl) {
     if(!pcl) {
-        last_error = "dai_pointcloud_get_points_rgba: null pointcloud";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_get_points_rgba: null pointcloud");
         return nullptr;
     }
     auto view = static_cast<DaiPointCloudView*>(pcl);
-    if(view->points.empty()) return nullptr;
-    return reinterpret_cast<const DaiPoint3fRGBA*>(view->points.data());
+    if(view->count == 0) return nullptr;
+    return reinterpret_cast<const DaiPoint3fRGBA*>(view->data);
 }
 
 size_t dai_pointcloud_get_points_rgba_len(DaiPointCloud pcl) {
     if(!pcl) {
-        last_error = "dai_pointcloud_get_points_rgba_len: null pointcloud";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_get_points_rgba_len: null pointcloud");
         return 0;
     }
     auto view = static_cast<DaiPointCloudView*>(pcl);
-    return view->points.size();
+    return view->count;
 }
 
-void dai_pointcloud_release(DaiPointCloud pcl) {
-    if(pcl) {
-        auto view = static_cast<DaiPointCloudView*>(pcl);
-        delete view;
+size_t dai_pointcloud_get_points_rgba_stride(DaiPointCloud pcl) {
+    if(!pcl) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_get_points_rgba_stride: null pointcloud");
+        return 0;
+    }
+    auto view = static_cast<DaiPointCloudView*>(pcl);
+    return view->stride;
+}
+
+bool dai_pointcloud_is_zero_copy(DaiPointCloud pcl) {
+    if(!pcl) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_is_zero_copy: null pointcloud");
+        return false;
+    }
+    auto view = static_cast<DaiPointCloudView*>(pcl);
+    return view->borrowed;
+}
+
+// Row staging for `dai_pointcloud_fill_soa`, kept per thread across calls.
+struct _DaiSoaScratch {
+    std::vector<float> x, y, z;
+    std::vector<uint32_t> rgba;
+    std::vector<uint8_t> keep;
+};
+
+// Copies `src[i]` to `dst` for every `keep[i]`; the write index only advances past kept values,
+// so the loop has no branch. Writes up to `n` slots of `dst`.
+template <typename T>
+static void _dai_soa_compact(T* dst, const T* src, const uint8_t* keep, size_t n) {
+    size_t w = 0;
+    for(size_t i = 0; i < n; ++i) {
+        dst[w] = src[i];
+        w += keep[i];
+    }
+}
+
+size_t dai_pointcloud_fill_soa(DaiPointCloud pcl,
+                               float* out_x,
+                               float* out_y,
+                               float* out_z,
+                               uint32_t* out_rgba,
+                               size_t capacity,
+                               uint32_t decimation,
+                               float z_min,
+                               float z_max,
+                               bool skip_invalid) {
+    if(!pcl) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pointcloud_fill_soa: null pointcloud");
+        return 0;
+    }
+    auto view = static_cast<DaiPointCloudView*>(pcl);
+    if(!view->data || view->count == 0 || capacity == 0) return 0;
+    const size_t step = decimation > 1 ? static_cast<size_t>(decimation) : 1;
+
+    // Organized clouds are decimated on the image grid, sparse ones by index.
+    size_t width = view->msg ? static_cast<size_t>(view->msg->getWidth()) : 0;
+    size_t height = view->msg ? static_cast<size_t>(view->msg->getHeight()) : 0;
+    if(width == 0 || height == 0 || width * height != view->count) {
+        width = view->count;
+        height = 1;
+    }
+    const size_t cols = (width + step - 1) / step;
+
+    // Each row is deinterleaved branch-free into scratch planes with a keep mask, then every
+    // requested plane is compacted in one pass (the scheme `_DaiDepthProjector::project` uses).
+    thread_local _DaiSoaScratch scratch;
+    try {
+        if(scratch.keep.size() < cols) {
+            scratch.x.resize(cols);
+            scratch.y.resize(cols);
+            scratch.z.resize(cols);
+            scratch.rgba.resize(cols);
+            scratch.keep.resize(cols);
+        }
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pointcloud_fill_soa failed: ") + e.what());
+        return 0;
+    }
+    float* const xs = scratch.x.data();
+    float* const ys = scratch.y.data();
+    float* const zs = scratch.z.data();
+    uint32_t* const rgba = scratch.rgba.data();
+    uint8_t* const keep = scratch.keep.data();
+
+    const dai::Point3fRGBA* const src = view->data;
+    size_t written = 0;
+    for(size_t row = 0; row < height && written < capacity; row += step) {
+        const dai::Point3fRGBA* line = src + row * width;
+        for(size_t i = 0; i < cols; ++i) {
+            const dai::Point3fRGBA& p = line[i * step];
+            const float z = p.z;
+            xs[i] = p.x;
+            ys[i] = p.y;
+            zs[i] = z;
+            rgba[i] = (static_cast<uint32_t>(p.r) << 24) | (static_cast<uint32_t>(p.g) << 16) | (static_cast<uint32_t>(p.b) << 8)
+                      | static_cast<uint32_t>(p.a);
+            // Written as negated drops so NaN depths are kept, as before.
+            keep[i] = static_cast<uint8_t>(!(z < z_min) & !(z > z_max) & !(skip_invalid & (z == 0.0f)));
+        }
+        // Compaction writes one slot per staged point, so a row that could overrun `capacity`
+        // is cut right after the point that fills it.
+        size_t n = cols;
+        size_t kept = 0;
+        const size_t room = capacity - written;
+        if(room < cols) {
+            n = 0;
+            while(n < cols && kept < room) kept += keep[n++];
+        } else {
+            for(size_t i = 0; i < cols; ++i) kept += keep[i];
+        }
+        if(out_x) _dai_soa_compact(out_x + written, xs, keep, n);
+        if(out_y) _dai_soa_compact(out_y + written, ys, keep, n);
+        if(out_z) _dai_soa_compact(out_z + written, zs, keep, n);
+        if(out_rgba) _dai_soa_compact(out_rgba + written, rgba, keep, n);
+        written += kept;
+    }
+    return written;
+}
+
+void dai_pointcloud_release(DaiPointCloud pcl) {
+    if(pcl) {
+        auto view = static_cast<DaiPointCloudView*>(pcl);
+        delete view;
     }
 }
 
 DaiRGBDData dai_queue_get_rgbd(DaiDataQueue queue, int timeout_ms) {
     if(!queue) {
-        last_error = "dai_queue_get_rgbd: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_rgbd: null queue");
         return nullptr;
     }
     try {
@@ -2550,60 +4319,63 @@ DaiRGBDData dai_queue_get_rgbd(DaiDataQueue queue, int timeout_ms) {
         } else {
             bool timedOut = false;
             rgbd = (*ptr)->get<dai::RGBDData>(std::chrono::milliseconds(timeout_ms), timedOut);
-            if(timedOut) return nullptr;
+            if(timedOut) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
+                return nullptr;
+            }
         }
         if(!rgbd) return nullptr;
-        return static_cast<DaiRGBDData>(new std::shared_ptr<dai::RGBDData>(rgbd));
+        return static_cast<DaiRGBDData>(_dai_new_handle<dai::RGBDData>(rgbd));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_rgbd failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_rgbd failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiRGBDData dai_queue_try_get_rgbd(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get_rgbd: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get_rgbd: null queue");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         auto rgbd = (*ptr)->tryGet<dai::RGBDData>();
         if(!rgbd) return nullptr;
-        return static_cast<DaiRGBDData>(new std::shared_ptr<dai::RGBDData>(rgbd));
+        return static_cast<DaiRGBDData>(_dai_new_handle<dai::RGBDData>(rgbd));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get_rgbd failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get_rgbd failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_rgbd_get_rgb_frame(DaiRGBDData rgbd) {
     if(!rgbd) {
-        last_error = "dai_rgbd_get_rgb_frame: null rgbd";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_rgbd_get_rgb_frame: null rgbd");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::RGBDData>*>(rgbd);
         auto frame = (*ptr)->getRGBFrame();
         if(!frame) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(frame);
+        return _dai_new_handle<dai::ImgFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_rgbd_get_rgb_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_rgbd_get_rgb_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_rgbd_get_depth_frame(DaiRGBDData rgbd) {
     if(!rgbd) {
-        last_error = "dai_rgbd_get_depth_frame: null rgbd";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_rgbd_get_depth_frame: null rgbd");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::RGBDData>*>(rgbd);
         auto frame = (*ptr)->getDepthFrame();
         if(!frame) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(frame);
+        return _dai_new_handle<dai::ImgFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_rgbd_get_depth_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_rgbd_get_depth_frame failed: ") + e.what());
         return nullptr;
     }
 }
@@ -2611,20 +4383,20 @@ DaiImgFrame dai_rgbd_get_depth_frame(DaiRGBDData rgbd) {
 void dai_rgbd_release(DaiRGBDData rgbd) {
     if(rgbd) {
         auto ptr = static_cast<std::shared_ptr<dai::RGBDData>*>(rgbd);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 DaiMessageGroup dai_message_group_clone(DaiMessageGroup group) {
     if(!group) {
-        last_error = "dai_message_group_clone: null group";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_message_group_clone: null group");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageGroup>*>(group);
-        return new std::shared_ptr<dai::MessageGroup>(*ptr);
+        return _dai_new_handle<dai::MessageGroup>(*ptr);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_message_group_clone failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_message_group_clone failed: ") + e.what());
         return nullptr;
     }
 }
@@ -2632,17 +4404,17 @@ DaiMessageGroup dai_message_group_clone(DaiMessageGroup group) {
 void dai_message_group_release(DaiMessageGroup group) {
     if(group) {
         auto ptr = static_cast<std::shared_ptr<dai::MessageGroup>*>(group);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 DaiBuffer dai_message_group_get_buffer(DaiMessageGroup group, const char* name) {
     if(!group) {
-        last_error = "dai_message_group_get_buffer: null group";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_message_group_get_buffer: null group");
         return nullptr;
     }
     if(_dai_cstr_empty(name)) {
-        last_error = "dai_message_group_get_buffer: empty name";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_message_group_get_buffer: empty name");
         return nullptr;
     }
     try {
@@ -2651,20 +4423,20 @@ DaiBuffer dai_message_group_get_buffer(DaiMessageGroup group, const char* name)
         if(!msg) return nullptr;
         auto buf = std::dynamic_pointer_cast<dai::Buffer>(msg);
         if(!buf) return nullptr;
-        return new std::shared_ptr<dai::Buffer>(buf);
+        return _dai_new_handle<dai::Buffer>(buf);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_message_group_get_buffer failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_message_group_get_buffer failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_message_group_get_img_frame(DaiMessageGroup group, const char* name) {
     if(!group) {
-        last_error = "dai_message_group_get_img_frame: null group";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_message_group_get_img_frame: null group");
         return nullptr;
     }
     if(_dai_cstr_empty(name)) {
-        last_error = "dai_message_group_get_img_frame: empty name";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_message_group_get_img_frame: empty name");
         return nullptr;
     }
     try {
@@ -2673,19 +4445,118 @@ DaiImgFrame dai_message_group_get_img_frame(DaiMessageGroup group, const char* n
         if(!msg) return nullptr;
         auto frame = std::dynamic_pointer_cast<dai::ImgFrame>(msg);
         if(!frame) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(frame);
+        return _dai_new_handle<dai::ImgFrame>(frame);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_message_group_get_img_frame failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+static void _dai_fill_frame_info(dai::ImgFrame& f, DaiImgFrameInfo* out);
+
+struct _DaiGroupLayout {
+    // (member name, caller slot), sorted by name so a group's std::map can be merge-walked.
+    std::vector<std::pair<std::string, size_t>> sorted;
+    size_t count = 0;
+};
+
+DaiGroupLayout dai_group_layout_new(const char* const* names, size_t count) {
+    if(!names && count > 0) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_group_layout_new: null names");
+        return nullptr;
+    }
+    try {
+        auto layout = std::make_unique<_DaiGroupLayout>();
+        layout->count = count;
+        layout->sorted.reserve(count);
+        for(size_t i = 0; i < count; ++i) {
+            if(_dai_cstr_empty(names[i])) {
+                last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_group_layout_new: empty name");
+                return nullptr;
+            }
+            layout->sorted.emplace_back(std::string(names[i]), i);
+        }
+        std::sort(layout->sorted.begin(), layout->sorted.end());
+        return static_cast<DaiGroupLayout>(layout.release());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_message_group_get_img_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_group_layout_new failed: ") + e.what());
         return nullptr;
     }
 }
 
+void dai_group_layout_release(DaiGroupLayout layout) {
+    delete static_cast<_DaiGroupLayout*>(layout);
+}
+
+size_t dai_group_layout_len(DaiGroupLayout layout) {
+    if(!layout) return 0;
+    return static_cast<_DaiGroupLayout*>(layout)->count;
+}
+
+size_t dai_message_group_resolve(DaiMessageGroup group,
+                                 DaiGroupLayout layout,
+                                 int* out_types,
+                                 void** out_handles,
+                                 DaiImgFrameInfo* out_info,
+                                 size_t capacity) {
+    if(!group || !layout || !out_types) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_message_group_resolve: null group/layout/out_types");
+        return 0;
+    }
+    auto lay = static_cast<_DaiGroupLayout*>(layout);
+    if(capacity < lay->count) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_message_group_resolve: capacity smaller than layout");
+        return 0;
+    }
+    for(size_t i = 0; i < lay->count; ++i) {
+        out_types[i] = -1;
+        if(out_handles) out_handles[i] = nullptr;
+        if(out_info) out_info[i] = DaiImgFrameInfo{};
+    }
+    size_t found = 0;
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::MessageGroup>*>(group);
+        const auto& members = (*ptr)->group;
+        auto it = members.begin();
+        for(const auto& [name, slot] : lay->sorted) {
+            while(it != members.end() && it->first < name) ++it;
+            if(it == members.end()) break;
+            if(it->first != name || !it->second) continue;
+            const auto& msg = it->second;
+            auto type = msg->getDatatype();
+            out_types[slot] = static_cast<int>(type);
+            if(type == dai::DatatypeEnum::ImgFrame) {
+                auto frame = std::static_pointer_cast<dai::ImgFrame>(msg);
+                if(out_info) _dai_fill_frame_info(*frame, &out_info[slot]);
+                if(out_handles) out_handles[slot] = _dai_new_handle<dai::ImgFrame>(std::move(frame));
+            } else if(auto buf = std::dynamic_pointer_cast<dai::Buffer>(msg)) {
+                if(out_info) {
+                    auto data = buf->getData();
+                    auto& info = out_info[slot];
+                    info.data = data.data();
+                    info.size = data.size();
+                    info.sequence_num = static_cast<int64_t>(buf->getSequenceNum());
+                    info.timestamp_ns =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(buf->getTimestamp().time_since_epoch()).count();
+                    info.timestamp_device_ns =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(buf->getTimestampDevice().time_since_epoch()).count();
+                }
+                if(out_handles) out_handles[slot] = _dai_new_handle<dai::Buffer>(std::move(buf));
+            }
+            found++;
+        }
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_message_group_resolve failed: ") + e.what());
+    }
+    return found;
+}
+
 DaiBuffer dai_buffer_new(size_t size) {
     try {
         auto buf = std::make_shared<dai::Buffer>(size);
-        return new std::shared_ptr<dai::Buffer>(std::move(buf));
+        return _dai_new_handle<dai::Buffer>(std::move(buf));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_buffer_new failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_new failed: ") + e.what());
         return nullptr;
     }
 }
@@ -2693,17 +4564,17 @@ DaiBuffer dai_buffer_new(size_t size) {
 void dai_buffer_release(DaiBuffer buffer) {
     if(buffer) {
         auto ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 void dai_buffer_set_data(DaiBuffer buffer, const void* data, size_t len) {
     if(!buffer) {
-        last_error = "dai_buffer_set_data: null buffer";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_set_data: null buffer");
         return;
     }
     if(!data && len > 0) {
-        last_error = "dai_buffer_set_data: null data";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_set_data: null data");
         return;
     }
     try {
@@ -2715,86 +4586,344 @@ void dai_buffer_set_data(DaiBuffer buffer, const void* data, size_t len) {
         }
         (*ptr)->setData(std::move(bytes));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_buffer_set_data failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_set_data failed: ") + e.what());
+    }
+}
+
+void* dai_buffer_get_data(DaiBuffer buffer) {
+    if(!buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_get_data: null buffer");
+        return nullptr;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+        if(!ptr->get()) return nullptr;
+        return (*ptr)->getData().data();
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_get_data failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+size_t dai_buffer_get_size(DaiBuffer buffer) {
+    if(!buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_get_size: null buffer");
+        return 0;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+        if(!ptr->get()) return 0;
+        return (*ptr)->getData().size();
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_get_size failed: ") + e.what());
+        return 0;
+    }
+}
+
+size_t dai_buffer_get_capacity(DaiBuffer buffer) {
+    if(!buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_get_capacity: null buffer");
+        return 0;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+        if(!ptr->get() || !(*ptr)->data) return 0;
+        return (*ptr)->data->getMaxSize();
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_get_capacity failed: ") + e.what());
+        return 0;
+    }
+}
+
+bool dai_buffer_resize(DaiBuffer buffer, size_t len) {
+    if(!buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_resize: null buffer");
+        return false;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+        if(!ptr->get()) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_buffer_resize: invalid buffer");
+            return false;
+        }
+        if(!(*ptr)->data) {
+            (*ptr)->setData(std::vector<std::uint8_t>(len));
+        } else {
+            (*ptr)->data->setSize(len);
+        }
+        return true;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_resize failed: ") + e.what());
+        return false;
+    }
+}
+
+// Buffer pool. Pooled messages are handed out as regular shared_ptrs whose deleter puts the
+// message back on the free list instead of destroying it, so recycling happens exactly when
+// DepthAI (queues, links, XLink writers) and the caller have all dropped their references.
+struct _DaiBufferPool {
+    size_t capacity = 0;
+    size_t max_free = 0;
+    bool img_frames = false;
+    std::mutex mtx;
+    std::vector<dai::Buffer*> free_list;
+    size_t allocated = 0;
+
+    ~_DaiBufferPool() {
+        for(auto* msg : free_list) delete msg;
+    }
+};
+
+struct _DaiBufferPoolRecycler {
+    std::weak_ptr<_DaiBufferPool> pool;
+
+    void operator()(dai::Buffer* msg) const {
+        if(auto p = pool.lock()) {
+            std::lock_guard<std::mutex> lock(p->mtx);
+            if(p->free_list.size() < p->max_free) {
+                p->free_list.push_back(msg);
+                return;
+            }
+            p->allocated--;
+        }
+        delete msg;
+    }
+};
+
+// Returns a recycled message to the state of a fresh one, keeping only its payload allocation,
+// so metadata from the previous send never leaks into the next one.
+static void _dai_buffer_pool_reset(dai::Buffer& msg, bool img_frame) {
+    msg.setSequenceNum(0);
+    msg.setTimestamp({});
+    msg.setTimestampDevice({});
+    if(img_frame) {
+        auto& f = static_cast<dai::ImgFrame&>(msg);
+        f.fb = decltype(f.fb){};
+        f.sourceFb = decltype(f.sourceFb){};
+        f.cam = decltype(f.cam){};
+        f.setInstanceNum(0);
+        f.transformation = decltype(f.transformation){};
+    }
+}
+
+static std::shared_ptr<dai::Buffer> _dai_buffer_pool_take(const std::shared_ptr<_DaiBufferPool>& pool) {
+    dai::Buffer* msg = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool->mtx);
+        if(!pool->free_list.empty()) {
+            msg = pool->free_list.back();
+            pool->free_list.pop_back();
+        } else {
+            pool->allocated++;
+        }
+    }
+    if(!msg) {
+        try {
+            if(pool->img_frames) {
+                msg = new dai::ImgFrame();
+            } else {
+                msg = new dai::Buffer();
+            }
+            msg->setData(std::vector<std::uint8_t>(pool->capacity));
+        } catch(...) {
+            delete msg;
+            std::lock_guard<std::mutex> lock(pool->mtx);
+            pool->allocated--;
+            throw;
+        }
+    } else {
+        _dai_buffer_pool_reset(*msg, pool->img_frames);
+        if(msg->data) msg->data->setSize(pool->capacity);
+    }
+    return std::shared_ptr<dai::Buffer>(msg, _DaiBufferPoolRecycler{pool});
+}
+
+DaiBufferPool dai_buffer_pool_new(size_t capacity, size_t max_free, bool img_frames) {
+    try {
+        auto pool = std::make_shared<_DaiBufferPool>();
+        pool->capacity = capacity;
+        pool->max_free = max_free;
+        pool->img_frames = img_frames;
+        pool->free_list.reserve(max_free);
+        return static_cast<DaiBufferPool>(_dai_new_handle<_DaiBufferPool>(std::move(pool)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_pool_new failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_buffer_pool_release(DaiBufferPool pool) {
+    if(pool) {
+        auto ptr = static_cast<std::shared_ptr<_DaiBufferPool>*>(pool);
+        _dai_delete_handle(ptr);
+    }
+}
+
+DaiBuffer dai_buffer_pool_acquire(DaiBufferPool pool) {
+    if(!pool) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_pool_acquire: null pool");
+        return nullptr;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<_DaiBufferPool>*>(pool);
+        if((*ptr)->img_frames) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_buffer_pool_acquire: invalid pool kind (pool serves ImgFrames)");
+            return nullptr;
+        }
+        return static_cast<DaiBuffer>(_dai_new_handle<dai::Buffer>(_dai_buffer_pool_take(*ptr)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_pool_acquire failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+DaiImgFrame dai_buffer_pool_acquire_frame(DaiBufferPool pool) {
+    if(!pool) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_pool_acquire_frame: null pool");
+        return nullptr;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<_DaiBufferPool>*>(pool);
+        if(!(*ptr)->img_frames) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_buffer_pool_acquire_frame: invalid pool kind (pool serves Buffers)");
+            return nullptr;
+        }
+        auto frame = std::static_pointer_cast<dai::ImgFrame>(_dai_buffer_pool_take(*ptr));
+        return static_cast<DaiImgFrame>(_dai_new_handle<dai::ImgFrame>(std::move(frame)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_buffer_pool_acquire_frame failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+size_t dai_buffer_pool_get_allocated(DaiBufferPool pool) {
+    if(!pool) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_pool_get_allocated: null pool");
+        return 0;
+    }
+    auto ptr = static_cast<std::shared_ptr<_DaiBufferPool>*>(pool);
+    std::lock_guard<std::mutex> lock((*ptr)->mtx);
+    return (*ptr)->allocated;
+}
+
+size_t dai_buffer_pool_get_available(DaiBufferPool pool) {
+    if(!pool) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_buffer_pool_get_available: null pool");
+        return 0;
     }
+    auto ptr = static_cast<std::shared_ptr<_DaiBufferPool>*>(pool);
+    std::lock_guard<std::mutex> lock((*ptr)->mtx);
+    return (*ptr)->free_list.size();
 }
 
 DaiBuffer dai_input_get_buffer(DaiInput input) {
     if(!input) {
-        last_error = "dai_input_get_buffer: null input";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_get_buffer: null input");
         return nullptr;
     }
     try {
         auto in = static_cast<dai::Node::Input*>(input);
         auto msg = in->get<dai::Buffer>();
         if(!msg) return nullptr;
-        return new std::shared_ptr<dai::Buffer>(msg);
+        return _dai_new_handle<dai::Buffer>(msg);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_get_buffer failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_get_buffer failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiBuffer dai_input_try_get_buffer(DaiInput input) {
     if(!input) {
-        last_error = "dai_input_try_get_buffer: null input";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_try_get_buffer: null input");
         return nullptr;
     }
     try {
         auto in = static_cast<dai::Node::Input*>(input);
         auto msg = in->tryGet<dai::Buffer>();
         if(!msg) return nullptr;
-        return new std::shared_ptr<dai::Buffer>(msg);
+        return _dai_new_handle<dai::Buffer>(msg);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_try_get_buffer failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_try_get_buffer failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_input_get_img_frame(DaiInput input) {
     if(!input) {
-        last_error = "dai_input_get_img_frame: null input";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_get_img_frame: null input");
         return nullptr;
     }
     try {
         auto in = static_cast<dai::Node::Input*>(input);
         auto msg = in->get<dai::ImgFrame>();
         if(!msg) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(msg);
+        return _dai_new_handle<dai::ImgFrame>(msg);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_get_img_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_get_img_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_input_try_get_img_frame(DaiInput input) {
     if(!input) {
-        last_error = "dai_input_try_get_img_frame: null input";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_try_get_img_frame: null input");
         return nullptr;
     }
     try {
         auto in = static_cast<dai::Node::Input*>(input);
         auto msg = in->tryGet<dai::ImgFrame>();
         if(!msg) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(msg);
+        return _dai_new_handle<dai::ImgFrame>(msg);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_try_get_img_frame failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+DaiEncodedFrame dai_input_get_encoded_frame(DaiInput input) {
+    if(!input) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_get_encoded_frame: null input");
+        return nullptr;
+    }
+    try {
+        auto in = static_cast<dai::Node::Input*>(input);
+        auto msg = in->get<dai::EncodedFrame>();
+        if(!msg) return nullptr;
+        return _dai_new_handle<dai::EncodedFrame>(msg);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_get_encoded_frame failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+DaiEncodedFrame dai_input_try_get_encoded_frame(DaiInput input) {
+    if(!input) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_try_get_encoded_frame: null input");
+        return nullptr;
+    }
+    try {
+        auto in = static_cast<dai::Node::Input*>(input);
+        auto msg = in->tryGet<dai::EncodedFrame>();
+        if(!msg) return nullptr;
+        return _dai_new_handle<dai::EncodedFrame>(msg);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_try_get_img_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_try_get_encoded_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiInputQueue dai_input_create_input_queue(DaiInput input, unsigned int max_size, bool blocking) {
     if(!input) {
-        last_error = "dai_input_create_input_queue: null input";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_create_input_queue: null input");
         return nullptr;
     }
     try {
         auto in = static_cast<dai::Node::Input*>(input);
         auto q = in->createInputQueue(max_size, blocking);
         if(!q) return nullptr;
-        return static_cast<DaiInputQueue>(new std::shared_ptr<dai::InputQueue>(std::move(q)));
+        return static_cast<DaiInputQueue>(_dai_new_handle<dai::InputQueue>(std::move(q)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_create_input_queue failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_create_input_queue failed: ") + e.what());
         return nullptr;
     }
 }
@@ -2802,35 +4931,115 @@ DaiInputQueue dai_input_create_input_queue(DaiInput input, unsigned int max_size
 void dai_input_queue_delete(DaiInputQueue queue) {
     if(queue) {
         auto ptr = static_cast<std::shared_ptr<dai::InputQueue>*>(queue);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 void dai_input_queue_send(DaiInputQueue queue, DaiDatatype msg) {
     if(!queue || !msg) {
-        last_error = "dai_input_queue_send: null queue/msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_queue_send: null queue/msg");
         return;
     }
     try {
         auto q = static_cast<std::shared_ptr<dai::InputQueue>*>(queue);
         auto m = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         if(!q->get() || !(*q)) {
-            last_error = "dai_input_queue_send: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_input_queue_send: invalid queue");
             return;
         }
         if(!m->get() || !(*m)) {
-            last_error = "dai_input_queue_send: invalid msg";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_input_queue_send: invalid msg");
             return;
         }
         (*q)->send(*m);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_input_queue_send failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_queue_send failed: ") + e.what());
     }
 }
 
+void dai_input_queue_send_buffer(DaiInputQueue queue, DaiBuffer buffer) {
+    if(!queue || !buffer) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_queue_send_buffer: null queue/buffer");
+        return;
+    }
+    try {
+        auto q = static_cast<std::shared_ptr<dai::InputQueue>*>(queue);
+        auto buf = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
+        if(!q->get() || !(*q)) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_input_queue_send_buffer: invalid queue");
+            return;
+        }
+        (*q)->send(*buf);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_queue_send_buffer failed: ") + e.what());
+    }
+}
+
+void dai_input_queue_send_img_frame(DaiInputQueue queue, DaiImgFrame frame) {
+    if(!queue || !frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_input_queue_send_img_frame: null queue/frame");
+        return;
+    }
+    try {
+        auto q = static_cast<std::shared_ptr<dai::InputQueue>*>(queue);
+        auto img = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        if(!q->get() || !(*q)) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_input_queue_send_img_frame: invalid queue");
+            return;
+        }
+        (*q)->send(*img);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_input_queue_send_img_frame failed: ") + e.what());
+    }
+}
+
+// Batched input queue sends. Every handle is checked before anything is sent, so a bad array
+// either fails as a whole or is submitted in order; a send that throws stops the batch there.
+template <typename T>
+static size_t _dai_input_queue_send_many(const char* fn, DaiInputQueue queue, void* const* handles, size_t count) {
+    if(!queue || (!handles && count)) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, std::string(fn) + ": null queue/msgs");
+        return 0;
+    }
+    auto q = static_cast<std::shared_ptr<dai::InputQueue>*>(queue);
+    if(!*q) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": invalid queue");
+        return 0;
+    }
+    for(size_t i = 0; i < count; ++i) {
+        if(!handles[i]) {
+            last_error.set(DAI_ERROR_NULL_ARGUMENT, std::string(fn) + ": null msg at index " + std::to_string(i));
+            return 0;
+        }
+        if(!*static_cast<std::shared_ptr<T>*>(handles[i])) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": invalid msg at index " + std::to_string(i));
+            return 0;
+        }
+    }
+    size_t sent = 0;
+    try {
+        for(; sent < count; ++sent) (*q)->send(*static_cast<std::shared_ptr<T>*>(handles[sent]));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string(fn) + " failed: " + e.what());
+    }
+    return sent;
+}
+
+size_t dai_input_queue_send_many(DaiInputQueue queue, const DaiDatatype* msgs, size_t count) {
+    return _dai_input_queue_send_many<dai::ADatatype>("dai_input_queue_send_many", queue, msgs, count);
+}
+
+size_t dai_input_queue_send_buffers(DaiInputQueue queue, const DaiBuffer* buffers, size_t count) {
+    return _dai_input_queue_send_many<dai::Buffer>("dai_input_queue_send_buffers", queue, buffers, count);
+}
+
+size_t dai_input_queue_send_img_frames(DaiInputQueue queue, const DaiImgFrame* frames, size_t count) {
+    return _dai_input_queue_send_many<dai::ImgFrame>("dai_input_queue_send_img_frames", queue, frames, count);
+}
+
 void dai_output_send_buffer(DaiOutput output, DaiBuffer buffer) {
     if(!output || !buffer) {
-        last_error = "dai_output_send_buffer: null output/buffer";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_send_buffer: null output/buffer");
         return;
     }
     try {
@@ -2838,13 +5047,13 @@ void dai_output_send_buffer(DaiOutput output, DaiBuffer buffer) {
         auto buf = static_cast<std::shared_ptr<dai::Buffer>*>(buffer);
         out->send(*buf);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_output_send_buffer failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_send_buffer failed: ") + e.what());
     }
 }
 
 void dai_output_send_img_frame(DaiOutput output, DaiImgFrame frame) {
     if(!output || !frame) {
-        last_error = "dai_output_send_img_frame: null output/frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_send_img_frame: null output/frame");
         return;
     }
     try {
@@ -2852,7 +5061,21 @@ void dai_output_send_img_frame(DaiOutput output, DaiImgFrame frame) {
         auto img = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
         out->send(*img);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_output_send_img_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_send_img_frame failed: ") + e.what());
+    }
+}
+
+void dai_output_send_encoded_frame(DaiOutput output, DaiEncodedFrame frame) {
+    if(!output || !frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_send_encoded_frame: null output/frame");
+        return;
+    }
+    try {
+        auto out = static_cast<dai::Node::Output*>(output);
+        auto encoded = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
+        out->send(*encoded);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_send_encoded_frame failed: ") + e.what());
     }
 }
 
@@ -2966,7 +5189,7 @@ static inline dai::Node::Input* _dai_pick_input_for_output(dai::Node* toNode, da
 
 bool dai_node_link(DaiNode from, const char* out_group, const char* out_name, DaiNode to, const char* in_group, const char* in_name) {
     if (!from || !to) {
-        last_error = "dai_node_link: null from/to";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_link: null from/to");
         return false;
     }
     try {
@@ -2982,14 +5205,14 @@ bool dai_node_link(DaiNode from, const char* out_group, const char* out_name, Da
         if(outSpecified) {
             out = out_group ? fromNode->getOutputRef(std::string(out_group), std::string(out_name)) : fromNode->getOutputRef(std::string(out_name));
             if(!out) {
-                last_error = "dai_node_link: output not found";
+                last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_link: output not found");
                 return false;
             }
         }
         if(inSpecified) {
             input = in_group ? toNode->getInputRef(std::string(in_group), std::string(in_name)) : toNode->getInputRef(std::string(in_name));
             if(!input) {
-                last_error = "dai_node_link: input not found";
+                last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_link: input not found");
                 return false;
             }
         }
@@ -3025,21 +5248,21 @@ bool dai_node_link(DaiNode from, const char* out_group, const char* out_name, Da
         }
 
         if(!out || !input) {
-            last_error = "dai_node_link: no compatible ports found";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_link: no compatible ports found");
             return false;
         }
 
         out->link(*input);
         return true;
     } catch (const std::exception& e) {
-        last_error = std::string("dai_node_link failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_link failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_node_unlink(DaiNode from, const char* out_group, const char* out_name, DaiNode to, const char* in_group, const char* in_name) {
     if (!from || !to) {
-        last_error = "dai_node_unlink: null from/to";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_node_unlink: null from/to");
         return false;
     }
     try {
@@ -3055,14 +5278,14 @@ bool dai_node_unlink(DaiNode from, const char* out_group, const char* out_name,
         if(outSpecified) {
             out = out_group ? fromNode->getOutputRef(std::string(out_group), std::string(out_name)) : fromNode->getOutputRef(std::string(out_name));
             if(!out) {
-                last_error = "dai_node_unlink: output not found";
+                last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_unlink: output not found");
                 return false;
             }
         }
         if(inSpecified) {
             input = in_group ? toNode->getInputRef(std::string(in_group), std::string(in_name)) : toNode->getInputRef(std::string(in_name));
             if(!input) {
-                last_error = "dai_node_unlink: input not found";
+                last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_unlink: input not found");
                 return false;
             }
         }
@@ -3098,88 +5321,88 @@ bool dai_node_unlink(DaiNode from, const char* out_group, const char* out_name,
         }
 
         if(!out || !input) {
-            last_error = "dai_node_unlink: no matching connection found";
+            last_error.set(DAI_ERROR_NOT_FOUND, "dai_node_unlink: no matching connection found");
             return false;
         }
         out->unlink(*input);
         return true;
     } catch (const std::exception& e) {
-        last_error = std::string("dai_node_unlink failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_node_unlink failed: ") + e.what());
         return false;
     }
 }
 
 DaiInput dai_hostnode_get_input(DaiNode node, const char* name) {
     if(!node) {
-        last_error = "dai_hostnode_get_input: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_hostnode_get_input: null node");
         return nullptr;
     }
     if(_dai_cstr_empty(name)) {
-        last_error = "dai_hostnode_get_input: empty name";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_hostnode_get_input: empty name");
         return nullptr;
     }
     try {
         auto host = dynamic_cast<dai::node::HostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_hostnode_get_input: node is not a HostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_hostnode_get_input: node is not a HostNode");
             return nullptr;
         }
         auto& input = host->inputs[std::string(name)];
         return static_cast<DaiInput>(&input);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_hostnode_get_input failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_hostnode_get_input failed: ") + e.what());
         return nullptr;
     }
 }
 
 void dai_hostnode_run_sync_on_host(DaiNode node) {
     if(!node) {
-        last_error = "dai_hostnode_run_sync_on_host: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_hostnode_run_sync_on_host: null node");
         return;
     }
     try {
         auto host = dynamic_cast<dai::node::HostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_hostnode_run_sync_on_host: node is not a HostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_hostnode_run_sync_on_host: node is not a HostNode");
             return;
         }
         host->runSyncingOnHost();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_hostnode_run_sync_on_host failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_hostnode_run_sync_on_host failed: ") + e.what());
     }
 }
 
 void dai_hostnode_run_sync_on_device(DaiNode node) {
     if(!node) {
-        last_error = "dai_hostnode_run_sync_on_device: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_hostnode_run_sync_on_device: null node");
         return;
     }
     try {
         auto host = dynamic_cast<dai::node::HostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_hostnode_run_sync_on_device: node is not a HostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_hostnode_run_sync_on_device: node is not a HostNode");
             return;
         }
         host->runSyncingOnDevice();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_hostnode_run_sync_on_device failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_hostnode_run_sync_on_device failed: ") + e.what());
     }
 }
 
 void dai_hostnode_send_processing_to_pipeline(DaiNode node, bool send) {
     if(!node) {
-        last_error = "dai_hostnode_send_processing_to_pipeline: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_hostnode_send_processing_to_pipeline: null node");
         return;
     }
     try {
         auto host = dynamic_cast<dai::node::HostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_hostnode_send_processing_to_pipeline: node is not a HostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_hostnode_send_processing_to_pipeline: node is not a HostNode");
             return;
         }
         host->sendProcessingToPipeline(send);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_hostnode_send_processing_to_pipeline failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_hostnode_send_processing_to_pipeline failed: ") + e.what());
     }
 }
 
@@ -3202,13 +5425,13 @@ DaiInput dai_threaded_hostnode_create_input(DaiNode node,
                                             int queue_size,
                                             bool wait_for_message) {
     if(!node) {
-        last_error = "dai_threaded_hostnode_create_input: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_threaded_hostnode_create_input: null node");
         return nullptr;
     }
     try {
         auto host = dynamic_cast<dai::node::ThreadedHostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_threaded_hostnode_create_input: node is not a ThreadedHostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_threaded_hostnode_create_input: node is not a ThreadedHostNode");
             return nullptr;
         }
         dai::Node::InputDescription desc;
@@ -3221,7 +5444,7 @@ DaiInput dai_threaded_hostnode_create_input(DaiNode node,
         auto* input = new dai::Node::Input(*host, desc, true);
         return static_cast<DaiInput>(input);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_threaded_hostnode_create_input failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_threaded_hostnode_create_input failed: ") + e.what());
         return nullptr;
     }
 }
@@ -3230,13 +5453,13 @@ DaiOutput dai_threaded_hostnode_create_output(DaiNode node,
                                               const char* name,
                                               const char* group) {
     if(!node) {
-        last_error = "dai_threaded_hostnode_create_output: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_threaded_hostnode_create_output: null node");
         return nullptr;
     }
     try {
         auto host = dynamic_cast<dai::node::ThreadedHostNode*>(static_cast<dai::Node*>(node));
         if(!host) {
-            last_error = "dai_threaded_hostnode_create_output: node is not a ThreadedHostNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_threaded_hostnode_create_output: node is not a ThreadedHostNode");
             return nullptr;
         }
         dai::Node::OutputDescription desc;
@@ -3249,25 +5472,25 @@ DaiOutput dai_threaded_hostnode_create_output(DaiNode node,
         auto* output = new dai::Node::Output(*host, desc, true);
         return static_cast<DaiOutput>(output);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_threaded_hostnode_create_output failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_threaded_hostnode_create_output failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_threaded_node_is_running(DaiNode node) {
     if(!node) {
-        last_error = "dai_threaded_node_is_running: null node";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_threaded_node_is_running: null node");
         return false;
     }
     try {
         auto threaded = dynamic_cast<dai::ThreadedNode*>(static_cast<dai::Node*>(node));
         if(!threaded) {
-            last_error = "dai_threaded_node_is_running: node is not a ThreadedNode";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_threaded_node_is_running: node is not a ThreadedNode");
             return false;
         }
         return threaded->isRunning();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_threaded_node_is_running failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_threaded_node_is_running failed: ") + e.what());
         return false;
     }
 }
@@ -3275,22 +5498,23 @@ bool dai_threaded_node_is_running(DaiNode node) {
 // Low-level camera operations
 DaiOutput dai_camera_request_full_resolution_output(DaiCameraNode camera) {
     if (!camera) {
-        last_error = "dai_camera_request_full_resolution_output: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_request_full_resolution_output: null camera");
         return nullptr;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         dai::Node::Output* output = cam->requestFullResolutionOutput();
+        _dai_camera_rates_output(cam, output, 0.0f);
         return static_cast<DaiOutput>(output);
     } catch (const std::exception& e) {
-        last_error = std::string("dai_camera_request_full_resolution_output failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_request_full_resolution_output failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiOutput dai_camera_request_full_resolution_output_ex(DaiCameraNode camera, int type, float fps, bool use_highest_resolution) {
     if (!camera) {
-        last_error = "dai_camera_request_full_resolution_output_ex: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_request_full_resolution_output_ex: null camera");
         return nullptr;
     }
     try {
@@ -3299,16 +5523,17 @@ DaiOutput dai_camera_request_full_resolution_output_ex(DaiCameraNode camera, int
                                                                   : std::nullopt;
         std::optional<float> opt_fps = (fps > 0.0f) ? std::optional<float>(fps) : std::nullopt;
         dai::Node::Output* output = cam->requestFullResolutionOutput(opt_type, opt_fps, use_highest_resolution);
+        _dai_camera_rates_output(cam, output, fps);
         return static_cast<DaiOutput>(output);
     } catch (const std::exception& e) {
-        last_error = std::string("dai_camera_request_full_resolution_output_ex failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_request_full_resolution_output_ex failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_camera_build(DaiCameraNode camera, int board_socket, int sensor_width, int sensor_height, float sensor_fps) {
     if(!camera) {
-        last_error = "dai_camera_build: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_build: null camera");
         return false;
     }
     try {
@@ -3322,245 +5547,246 @@ bool dai_camera_build(DaiCameraNode camera, int board_socket, int sensor_width,
         std::optional<float> opt_fps = (sensor_fps > 0.0f) ? std::optional<float>(sensor_fps) : std::nullopt;
 
         cam->build(socket, opt_res, opt_fps);
+        _dai_camera_rates_build(cam, sensor_fps);
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_build failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_build failed: ") + e.what());
         return false;
     }
 }
 
 int dai_camera_get_board_socket(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_board_socket: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_board_socket: null camera");
         return -1;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return static_cast<int>(cam->getBoardSocket());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_board_socket failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_board_socket failed: ") + e.what());
         return -1;
     }
 }
 
 uint32_t dai_camera_get_max_width(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_max_width: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_max_width: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getMaxWidth();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_max_width failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_max_width failed: ") + e.what());
         return 0;
     }
 }
 
 uint32_t dai_camera_get_max_height(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_max_height: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_max_height: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getMaxHeight();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_max_height failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_max_height failed: ") + e.what());
         return 0;
     }
 }
 
 void dai_camera_set_sensor_type(DaiCameraNode camera, int sensor_type) {
     if(!camera) {
-        last_error = "dai_camera_set_sensor_type: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_sensor_type: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setSensorType(static_cast<dai::CameraSensorType>(sensor_type));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_sensor_type failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_sensor_type failed: ") + e.what());
     }
 }
 
 int dai_camera_get_sensor_type(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_sensor_type: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_sensor_type: null camera");
         return -1;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return static_cast<int>(cam->getSensorType());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_sensor_type failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_sensor_type failed: ") + e.what());
         return -1;
     }
 }
 
 void dai_camera_set_raw_num_frames_pool(DaiCameraNode camera, int num) {
     if(!camera) {
-        last_error = "dai_camera_set_raw_num_frames_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_raw_num_frames_pool: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setRawNumFramesPool(num);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_raw_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_raw_num_frames_pool failed: ") + e.what());
     }
 }
 
 void dai_camera_set_max_size_pool_raw(DaiCameraNode camera, int size) {
     if(!camera) {
-        last_error = "dai_camera_set_max_size_pool_raw: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_max_size_pool_raw: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setMaxSizePoolRaw(size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_max_size_pool_raw failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_max_size_pool_raw failed: ") + e.what());
     }
 }
 
 void dai_camera_set_isp_num_frames_pool(DaiCameraNode camera, int num) {
     if(!camera) {
-        last_error = "dai_camera_set_isp_num_frames_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_isp_num_frames_pool: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setIspNumFramesPool(num);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_isp_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_isp_num_frames_pool failed: ") + e.what());
     }
 }
 
 void dai_camera_set_max_size_pool_isp(DaiCameraNode camera, int size) {
     if(!camera) {
-        last_error = "dai_camera_set_max_size_pool_isp: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_max_size_pool_isp: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setMaxSizePoolIsp(size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_max_size_pool_isp failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_max_size_pool_isp failed: ") + e.what());
     }
 }
 
 void dai_camera_set_num_frames_pools(DaiCameraNode camera, int raw, int isp, int outputs) {
     if(!camera) {
-        last_error = "dai_camera_set_num_frames_pools: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_num_frames_pools: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setNumFramesPools(raw, isp, outputs);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_num_frames_pools failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_num_frames_pools failed: ") + e.what());
     }
 }
 
 void dai_camera_set_max_size_pools(DaiCameraNode camera, int raw, int isp, int outputs) {
     if(!camera) {
-        last_error = "dai_camera_set_max_size_pools: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_max_size_pools: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setMaxSizePools(raw, isp, outputs);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_max_size_pools failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_max_size_pools failed: ") + e.what());
     }
 }
 
 void dai_camera_set_outputs_num_frames_pool(DaiCameraNode camera, int num) {
     if(!camera) {
-        last_error = "dai_camera_set_outputs_num_frames_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_outputs_num_frames_pool: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setOutputsNumFramesPool(num);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_outputs_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_outputs_num_frames_pool failed: ") + e.what());
     }
 }
 
 void dai_camera_set_outputs_max_size_pool(DaiCameraNode camera, int size) {
     if(!camera) {
-        last_error = "dai_camera_set_outputs_max_size_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_set_outputs_max_size_pool: null camera");
         return;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         cam->setOutputsMaxSizePool(size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_set_outputs_max_size_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_set_outputs_max_size_pool failed: ") + e.what());
     }
 }
 
 int dai_camera_get_raw_num_frames_pool(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_raw_num_frames_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_raw_num_frames_pool: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getRawNumFramesPool();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_raw_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_raw_num_frames_pool failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_camera_get_max_size_pool_raw(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_max_size_pool_raw: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_max_size_pool_raw: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getMaxSizePoolRaw();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_max_size_pool_raw failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_max_size_pool_raw failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_camera_get_isp_num_frames_pool(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_isp_num_frames_pool: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_isp_num_frames_pool: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getIspNumFramesPool();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_isp_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_isp_num_frames_pool failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_camera_get_max_size_pool_isp(DaiCameraNode camera) {
     if(!camera) {
-        last_error = "dai_camera_get_max_size_pool_isp: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_max_size_pool_isp: null camera");
         return 0;
     }
     try {
         auto cam = static_cast<dai::node::Camera*>(camera);
         return cam->getMaxSizePoolIsp();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_max_size_pool_isp failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_max_size_pool_isp failed: ") + e.what());
         return 0;
     }
 }
 
 bool dai_camera_get_outputs_num_frames_pool(DaiCameraNode camera, int* out_num) {
     if(!camera || !out_num) {
-        last_error = "dai_camera_get_outputs_num_frames_pool: null camera or out_num";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_outputs_num_frames_pool: null camera or out_num");
         return false;
     }
     try {
@@ -3568,14 +5794,14 @@ bool dai_camera_get_outputs_num_frames_pool(DaiCameraNode camera, int* out_num)
         auto value = cam->getOutputsNumFramesPool();
         return _dai_optionalish_to_out(value, out_num);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_outputs_num_frames_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_outputs_num_frames_pool failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_camera_get_outputs_max_size_pool(DaiCameraNode camera, size_t* out_size) {
     if(!camera || !out_size) {
-        last_error = "dai_camera_get_outputs_max_size_pool: null camera or out_size";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_get_outputs_max_size_pool: null camera or out_size");
         return false;
     }
     try {
@@ -3583,13 +5809,13 @@ bool dai_camera_get_outputs_max_size_pool(DaiCameraNode camera, size_t* out_size
         auto value = cam->getOutputsMaxSizePool();
         return _dai_optionalish_to_out(value, out_size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_camera_get_outputs_max_size_pool failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_get_outputs_max_size_pool failed: ") + e.what());
         return false;
     }
 }
 DaiCameraNode dai_pipeline_create_camera(DaiPipeline pipeline, int board_socket) {
     if (!pipeline) {
-        last_error = "dai_pipeline_create_camera: null pipeline";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_pipeline_create_camera: null pipeline");
         return nullptr;
     }
     try {
@@ -3599,14 +5825,14 @@ DaiCameraNode dai_pipeline_create_camera(DaiPipeline pipeline, int board_socket)
         auto camera = cameraBuilder->build(socket);
         return static_cast<DaiCameraNode>(camera.get());
     } catch (const std::exception& e) {
-        last_error = std::string("dai_pipeline_create_camera failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_pipeline_create_camera failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiOutput dai_camera_request_output(DaiCameraNode camera, int width, int height, int type, int resize_mode, float fps, int enable_undistortion) {
     if (!camera) {
-        last_error = "dai_camera_request_output: null camera";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_camera_request_output: null camera");
         return nullptr;
     }
     try {
@@ -3617,230 +5843,328 @@ DaiOutput dai_camera_request_output(DaiCameraNode camera, int width, int height,
         std::optional<float> opt_fps = (fps > 0.0f) ? std::optional<float>(fps) : std::nullopt;
         std::optional<bool> opt_undist = (enable_undistortion >= 0) ? std::optional<bool>(enable_undistortion != 0) : std::nullopt;
         dai::Node::Output* output = cam->requestOutput(size, opt_type, resize, opt_fps, opt_undist);
+        _dai_camera_rates_output(cam, output, fps);
         return static_cast<DaiOutput>(output);
     } catch (const std::exception& e) {
-        last_error = std::string("dai_camera_request_output failed: ") + e.what();
-        return nullptr;
-    }
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_request_output failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+// Latest-only ("conflating") queues. The DepthAI queue is a single non-blocking slot, so an
+// arrival replaces the unread message under the queue's own lock and stale messages never get a
+// handle; the wrapper only counts them. The state is owned by a callback on the queue and found
+// again through a weak registry, so it dies with the queue.
+struct _DaiConflation {
+    std::atomic<uint64_t> received{0};
+    std::atomic<uint64_t> overwritten{0};
+    std::atomic<uint64_t> coalesced{0};
+    // Coalesced callbacks attached to the queue (see `_DaiCoalescedCallback`). While there are
+    // any, every arrival counts as read: dropped deliveries are counted in `coalesced` instead.
+    std::atomic<int> callbacks{0};
+    std::mutex mtx;
+    // Last message handed to a callback; the slot still holding it after the callback is
+    // removed does not make the next arrival an overwrite.
+    std::weak_ptr<dai::ADatatype> delivered;
+};
+
+struct _DaiConflationRegistry {
+    std::mutex mtx;
+    std::unordered_map<const dai::MessageQueue*, std::weak_ptr<_DaiConflation>> by_queue;
+};
+
+static _DaiConflationRegistry& _dai_conflation_registry() {
+    static _DaiConflationRegistry* registry = new _DaiConflationRegistry();  // never destroyed: callbacks may outlive main
+    return *registry;
+}
+
+static std::shared_ptr<_DaiConflation> _dai_conflation_of(const dai::MessageQueue* queue) {
+    auto& reg = _dai_conflation_registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    auto it = reg.by_queue.find(queue);
+    if(it == reg.by_queue.end()) return nullptr;
+    auto state = it->second.lock();
+    if(!state) reg.by_queue.erase(it);
+    return state;
 }
 
 DaiDataQueue dai_output_create_queue(DaiOutput output, unsigned int max_size, bool blocking) {
     if (!output) {
-        last_error = "dai_output_create_queue: null output";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_create_queue: null output");
         return nullptr;
     }
     try {
         auto out = static_cast<dai::Node::Output*>(output);
         auto queue = out->createOutputQueue(max_size, blocking);
-        return new std::shared_ptr<dai::MessageQueue>(queue);
+        _dai_telemetry_track_queue(queue, *out);
+        return _dai_new_handle<dai::MessageQueue>(queue);
     } catch (const std::exception& e) {
-        last_error = std::string("dai_output_create_queue failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_create_queue failed: ") + e.what());
         return nullptr;
     }
 }
 
-void dai_queue_delete(DaiDataQueue queue) {
-    if(queue) {
+DaiDataQueue dai_output_create_latest_queue(DaiOutput output) {
+    if(!output) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_output_create_latest_queue: null output");
+        return nullptr;
+    }
+    try {
+        auto out = static_cast<dai::Node::Output*>(output);
+        auto queue = out->createOutputQueue(1, false);
+        _dai_telemetry_track_queue(queue, *out);
+        auto state = std::make_shared<_DaiConflation>();
+        std::weak_ptr<dai::MessageQueue> weak = queue;
+        // Registered before any user callback, so it sees each arrival first.
+        queue->addCallback([state, weak](std::string, std::shared_ptr<dai::ADatatype> msg) {
+            state->received.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(state->mtx);
+            if(state->callbacks.load(std::memory_order_relaxed) > 0) {
+                state->delivered = msg;
+                return;
+            }
+            // Callbacks run before the push, so an unread message in the slot is about to be
+            // replaced. A read racing this check can make one overwrite count that did not happen.
+            if(auto q = weak.lock()) {
+                auto held = q->front();
+                if(held && held != state->delivered.lock()) state->overwritten.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        {
+            auto& reg = _dai_conflation_registry();
+            std::lock_guard<std::mutex> lock(reg.mtx);
+            for(auto it = reg.by_queue.begin(); it != reg.by_queue.end();) {
+                it = it->second.expired() ? reg.by_queue.erase(it) : std::next(it);
+            }
+            reg.by_queue[queue.get()] = state;
+        }
+        return _dai_new_handle<dai::MessageQueue>(queue);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_output_create_latest_queue failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+bool dai_queue_get_conflation_stats(DaiDataQueue queue, DaiConflationStats* out) {
+    if(!queue) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_conflation_stats: null queue");
+        return false;
+    }
+    if(!out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_conflation_stats: null out");
+        return false;
+    }
+    auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
+    auto state = _dai_conflation_of(ptr->get());
+    if(!state) return false;
+    out->received = state->received.load(std::memory_order_relaxed);
+    out->overwritten = state->overwritten.load(std::memory_order_relaxed);
+    out->coalesced = state->coalesced.load(std::memory_order_relaxed);
+    return true;
+}
+
+void dai_queue_delete(DaiDataQueue queue) {
+    if(queue) {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 char* dai_queue_get_name(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_get_name: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_name: null queue");
         return nullptr;
     }
     try {
         dai_clear_last_error();
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_get_name: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_get_name: invalid queue");
             return nullptr;
         }
         auto name = (*ptr)->getName();
         return dai_string_to_cstring(name.c_str());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_name failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_name failed: ") + e.what());
         return nullptr;
     }
 }
 
 bool dai_queue_set_name(DaiDataQueue queue, const char* name) {
     if(!queue || !name) {
-        last_error = "dai_queue_set_name: null queue/name";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_set_name: null queue/name");
         return false;
     }
     try {
         dai_clear_last_error();
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_set_name: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_set_name: invalid queue");
             return false;
         }
         (*ptr)->setName(std::string(name));
         return true;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_set_name failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_set_name failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_queue_is_closed(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_is_closed: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_is_closed: null queue");
         return true;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_is_closed: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_is_closed: invalid queue");
             return true;
         }
         return (*ptr)->isClosed();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_is_closed failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_is_closed failed: ") + e.what());
         return true;
     }
 }
 
 void dai_queue_close(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_close: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_close: null queue");
         return;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_close: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_close: invalid queue");
             return;
         }
         (*ptr)->close();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_close failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_close failed: ") + e.what());
     }
 }
 
 void dai_queue_set_blocking(DaiDataQueue queue, bool blocking) {
     if(!queue) {
-        last_error = "dai_queue_set_blocking: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_set_blocking: null queue");
         return;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_set_blocking: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_set_blocking: invalid queue");
             return;
         }
         (*ptr)->setBlocking(blocking);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_set_blocking failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_set_blocking failed: ") + e.what());
     }
 }
 
 bool dai_queue_get_blocking(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_get_blocking: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_blocking: null queue");
         return false;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_get_blocking: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_get_blocking: invalid queue");
             return false;
         }
         return (*ptr)->getBlocking();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_blocking failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_blocking failed: ") + e.what());
         return false;
     }
 }
 
 void dai_queue_set_max_size(DaiDataQueue queue, unsigned int max_size) {
     if(!queue) {
-        last_error = "dai_queue_set_max_size: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_set_max_size: null queue");
         return;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_set_max_size: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_set_max_size: invalid queue");
             return;
         }
         (*ptr)->setMaxSize(max_size);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_set_max_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_set_max_size failed: ") + e.what());
     }
 }
 
 unsigned int dai_queue_get_max_size(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_get_max_size: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_max_size: null queue");
         return 0;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_get_max_size: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_get_max_size: invalid queue");
             return 0;
         }
         return (*ptr)->getMaxSize();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_max_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_max_size failed: ") + e.what());
         return 0;
     }
 }
 
 unsigned int dai_queue_get_size(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_get_size: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_size: null queue");
         return 0;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_get_size: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_get_size: invalid queue");
             return 0;
         }
         return (*ptr)->getSize();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_size failed: ") + e.what());
         return 0;
     }
 }
 
 unsigned int dai_queue_is_full(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_is_full: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_is_full: null queue");
         return 0;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_is_full: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_is_full: invalid queue");
             return 0;
         }
         return (*ptr)->isFull();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_is_full failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_is_full failed: ") + e.what());
         return 0;
     }
 }
 
 bool dai_queue_has(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_has: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_has: null queue");
         return false;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         if(!ptr->get() || !(*ptr)) {
-            last_error = "dai_queue_has: invalid queue";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_has: invalid queue");
             return false;
         }
         return (*ptr)->has();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_has failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_has failed: ") + e.what());
         return false;
     }
 }
@@ -3853,14 +6177,14 @@ static inline DaiDatatypeArray _dai_make_datatype_array(const std::vector<std::s
     auto out = new _DaiDatatypeArray();
     out->elems.reserve(msgs.size());
     for(const auto& m : msgs) {
-        out->elems.push_back(static_cast<DaiDatatype>(new std::shared_ptr<dai::ADatatype>(m)));
+        out->elems.push_back(static_cast<DaiDatatype>(_dai_new_handle<dai::ADatatype>(m)));
     }
     return static_cast<DaiDatatypeArray>(out);
 }
 
 DaiDatatype dai_queue_get(DaiDataQueue queue, int timeout_ms) {
     if(!queue) {
-        last_error = "dai_queue_get: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get: null queue");
         return nullptr;
     }
     try {
@@ -3872,52 +6196,53 @@ DaiDatatype dai_queue_get(DaiDataQueue queue, int timeout_ms) {
             bool timedOut = false;
             msg = (*ptr)->get(std::chrono::milliseconds(timeout_ms), timedOut);
             if(timedOut) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
                 return nullptr;
             }
         }
         if(!msg) return nullptr;
-        return static_cast<DaiDatatype>(new std::shared_ptr<dai::ADatatype>(std::move(msg)));
+        return static_cast<DaiDatatype>(_dai_new_handle<dai::ADatatype>(std::move(msg)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiDatatype dai_queue_try_get(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get: null queue");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         auto msg = (*ptr)->tryGet();
         if(!msg) return nullptr;
-        return static_cast<DaiDatatype>(new std::shared_ptr<dai::ADatatype>(std::move(msg)));
+        return static_cast<DaiDatatype>(_dai_new_handle<dai::ADatatype>(std::move(msg)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiDatatype dai_queue_front(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_front: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_front: null queue");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         auto msg = (*ptr)->front();
         if(!msg) return nullptr;
-        return static_cast<DaiDatatype>(new std::shared_ptr<dai::ADatatype>(std::move(msg)));
+        return static_cast<DaiDatatype>(_dai_new_handle<dai::ADatatype>(std::move(msg)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_front failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_front failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiDatatypeArray dai_queue_try_get_all(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get_all: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get_all: null queue");
         return nullptr;
     }
     try {
@@ -3925,7 +6250,7 @@ DaiDatatypeArray dai_queue_try_get_all(DaiDataQueue queue) {
         auto msgs = (*ptr)->tryGetAll();
         return _dai_make_datatype_array(msgs);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get_all failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get_all failed: ") + e.what());
         return nullptr;
     }
 }
@@ -3935,7 +6260,7 @@ DaiDatatypeArray dai_queue_get_all(DaiDataQueue queue, int timeout_ms, bool* has
         *has_timedout = false;
     }
     if(!queue) {
-        last_error = "dai_queue_get_all: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_all: null queue");
         return nullptr;
     }
     try {
@@ -3949,10 +6274,11 @@ DaiDatatypeArray dai_queue_get_all(DaiDataQueue queue, int timeout_ms, bool* has
             if(has_timedout) {
                 *has_timedout = timedOut;
             }
+            if(timedOut) last_error.set_code(DAI_ERROR_TIMEOUT);
         }
         return _dai_make_datatype_array(msgs);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_all failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_all failed: ") + e.what());
         return nullptr;
     }
 }
@@ -3968,13 +6294,78 @@ struct _DaiQueueCallbackState {
     }
 };
 
+// Callback delivery for latest-only queues: DepthAI's thread only parks the newest message and
+// a worker runs the user callback. The worker owns the shared core, so removing the callback
+// from inside itself detaches instead of deadlocking on join.
+struct _DaiCoalescerCore {
+    std::shared_ptr<_DaiQueueCallbackState> state;
+    std::shared_ptr<_DaiConflation> conflation;
+    std::shared_ptr<_DaiQueueStats> stats;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::string name;
+    std::shared_ptr<dai::ADatatype> pending;
+    bool stop = false;
+
+    void push(std::string queue_name, std::shared_ptr<dai::ADatatype> msg) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if(pending) conflation->coalesced.fetch_add(1, std::memory_order_relaxed);
+            pending = std::move(msg);
+            name = std::move(queue_name);
+        }
+        cv.notify_one();
+    }
+
+    void loop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true) {
+            cv.wait(lock, [this] { return stop || pending; });
+            if(stop) return;
+            auto msg = std::move(pending);
+            pending.reset();
+            const std::string queue_name = name;
+            lock.unlock();
+            const int64_t started = stats ? _dai_steady_now_us() : 0;
+            auto handle = _dai_new_handle<dai::ADatatype>(std::move(msg));
+            state->cb(state->ctx, queue_name.c_str(), static_cast<DaiDatatype>(handle));
+            if(stats) stats->callback.record(_dai_steady_now_us() - started);
+            lock.lock();
+        }
+    }
+};
+
+struct _DaiCoalescedCallback {
+    std::shared_ptr<_DaiCoalescerCore> core;
+    std::thread worker;
+
+    explicit _DaiCoalescedCallback(std::shared_ptr<_DaiCoalescerCore> c) : core(std::move(c)) {
+        core->conflation->callbacks.fetch_add(1, std::memory_order_relaxed);
+        worker = std::thread([core = core] { core->loop(); });
+    }
+
+    ~_DaiCoalescedCallback() {
+        core->conflation->callbacks.fetch_sub(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(core->mtx);
+            core->stop = true;
+        }
+        core->cv.notify_one();
+        if(worker.get_id() == std::this_thread::get_id()) {
+            worker.detach();
+        } else if(worker.joinable()) {
+            worker.join();
+        }
+    }
+};
+
 int dai_queue_add_callback(DaiDataQueue queue, void* ctx, uintptr_t cb, uintptr_t drop_cb) {
     if(!queue) {
-        last_error = "dai_queue_add_callback: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_add_callback: null queue");
         return -1;
     }
     if(cb == 0) {
-        last_error = "dai_queue_add_callback: null callback";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_add_callback: null callback");
         return -1;
     }
     try {
@@ -3986,36 +6377,335 @@ int dai_queue_add_callback(DaiDataQueue queue, void* ctx, uintptr_t cb, uintptr_
         state->cb = cb_fn;
         state->drop = drop_fn;
 
-        auto id = (*ptr)->addCallback([state](std::string name, std::shared_ptr<dai::ADatatype> msg) {
+        auto stats = _dai_telemetry_queue_stats(ptr->get());
+        if(auto conflation = _dai_conflation_of(ptr->get())) {
+            auto core = std::make_shared<_DaiCoalescerCore>();
+            core->state = state;
+            core->conflation = std::move(conflation);
+            core->stats = std::move(stats);
+            auto coalesced = std::make_shared<_DaiCoalescedCallback>(std::move(core));
+            auto id = (*ptr)->addCallback([coalesced](std::string name, std::shared_ptr<dai::ADatatype> msg) {
+                coalesced->core->push(std::move(name), std::move(msg));
+            });
+            return static_cast<int>(id);
+        }
+        auto id = (*ptr)->addCallback([state, stats](std::string name, std::shared_ptr<dai::ADatatype> msg) {
             if(!state || !state->cb) return;
+            const int64_t started = stats ? _dai_steady_now_us() : 0;
             // Transfer ownership of a new shared_ptr handle to the Rust side.
-            auto handle = new std::shared_ptr<dai::ADatatype>(std::move(msg));
+            auto handle = _dai_new_handle<dai::ADatatype>(std::move(msg));
             state->cb(state->ctx, name.c_str(), static_cast<DaiDatatype>(handle));
+            if(stats) stats->callback.record(_dai_steady_now_us() - started);
         });
         return static_cast<int>(id);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_add_callback failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_add_callback failed: ") + e.what());
+        return -1;
+    }
+}
+
+// Wake-only callbacks: no handle is created and no ownership is transferred, the callback just
+// learns that a message arrived. Intended for async runtimes that poll the queue afterwards.
+struct _DaiQueueWakeState {
+    void* ctx = nullptr;
+    dai::DaiHostNodeCallback wake = nullptr;
+    dai::DaiHostNodeCallback drop = nullptr;
+    ~_DaiQueueWakeState() {
+        if(drop) {
+            drop(ctx);
+        }
+    }
+};
+
+// DepthAI runs queue callbacks before it pushes the message, so a wake-up can reach a poller
+// that then finds the queue empty. Such wake-ups are handed to one shared thread that fires them
+// once the push has landed (or the queue closed), re-checking in 1 ms slices. After ~10 ms the
+// wake fires anyway, e.g. when another consumer took the message, so nothing waits forever.
+struct _DaiLateWake {
+    std::weak_ptr<dai::MessageQueue> queue;
+    std::shared_ptr<_DaiQueueWakeState> state;
+    std::chrono::steady_clock::time_point deadline;
+};
+
+class _DaiLateWaker {
+   public:
+    static _DaiLateWaker& instance() {
+        // Leaked on purpose: the worker is detached and may outlive static destruction.
+        static auto* waker = new _DaiLateWaker();
+        return *waker;
+    }
+
+    void defer(std::weak_ptr<dai::MessageQueue> queue, std::shared_ptr<_DaiQueueWakeState> state) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            pending.push_back({std::move(queue), std::move(state), std::chrono::steady_clock::now() + std::chrono::milliseconds(10)});
+        }
+        cv.notify_one();
+    }
+
+   private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<_DaiLateWake> pending;
+
+    _DaiLateWaker() {
+        std::thread([this] { loop(); }).detach();
+    }
+
+    void loop() {
+        std::vector<_DaiLateWake> batch;
+        std::vector<_DaiLateWake> waiting;
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true) {
+            if(pending.empty()) {
+                cv.wait(lock, [this] { return !pending.empty(); });
+            } else {
+                cv.wait_for(lock, std::chrono::milliseconds(1));
+            }
+            batch.swap(pending);
+            lock.unlock();
+            // Queue checks and wake callbacks run unlocked so senders deferring new wake-ups
+            // never wait on them.
+            const auto now = std::chrono::steady_clock::now();
+            for(auto& w : batch) {
+                auto q = w.queue.lock();
+                if(!q || q->isClosed() || q->has() || now >= w.deadline) {
+                    w.state->wake(w.state->ctx);
+                } else {
+                    waiting.push_back(std::move(w));
+                }
+            }
+            batch.clear();
+            lock.lock();
+            for(auto& w : waiting) pending.push_back(std::move(w));
+            waiting.clear();
+        }
+    }
+};
+
+int dai_queue_add_wake_callback(DaiDataQueue queue, void* ctx, uintptr_t wake_cb, uintptr_t drop_cb) {
+    if(!queue) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_add_wake_callback: null queue");
+        return -1;
+    }
+    if(wake_cb == 0) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_add_wake_callback: null callback");
+        return -1;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
+        auto state = std::make_shared<_DaiQueueWakeState>();
+        state->ctx = ctx;
+        state->wake = reinterpret_cast<DaiHostNodeCallback>(wake_cb);
+        state->drop = drop_cb == 0 ? nullptr : reinterpret_cast<DaiHostNodeCallback>(drop_cb);
+
+        std::weak_ptr<dai::MessageQueue> weak = *ptr;
+        auto id = (*ptr)->addCallback([state, weak](const std::string&, const std::shared_ptr<dai::ADatatype>&) {
+            auto q = weak.lock();
+            if(!q || q->has()) {
+                state->wake(state->ctx);
+            } else {
+                _DaiLateWaker::instance().defer(weak, state);
+            }
+        });
+        return static_cast<int>(id);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_add_wake_callback failed: ") + e.what());
         return -1;
     }
 }
 
 bool dai_queue_remove_callback(DaiDataQueue queue, int callback_id) {
     if(!queue) {
-        last_error = "dai_queue_remove_callback: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_remove_callback: null queue");
         return false;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
         return (*ptr)->removeCallback(static_cast<dai::MessageQueue::CallbackId>(callback_id));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_remove_callback failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_remove_callback failed: ") + e.what());
         return false;
     }
 }
 
+// Multi-queue wait. A wait set registers one wake-up callback per queue; the callback only bumps
+// a generation counter and notifies, readiness itself is always checked with `has()`. Queues
+// may run callbacks just before the message is pushed, so a wake-up that finds nothing ready
+// is followed by a few quick re-checks before going back to sleep.
+struct _DaiQueueWaitSignal {
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t generation = 0;
+};
+
+struct _DaiQueueWaitSet {
+    std::shared_ptr<_DaiQueueWaitSignal> signal = std::make_shared<_DaiQueueWaitSignal>();
+    std::vector<std::shared_ptr<dai::MessageQueue>> queues;
+    std::vector<dai::MessageQueue::CallbackId> callback_ids;
+
+    ~_DaiQueueWaitSet() {
+        for(size_t i = 0; i < callback_ids.size(); ++i) {
+            try {
+                queues[i]->removeCallback(callback_ids[i]);
+            } catch(...) {
+                // Queue may already be closed; nothing left to unregister.
+            }
+        }
+    }
+};
+
+static size_t _dai_queue_wait_poll(const std::vector<std::shared_ptr<dai::MessageQueue>>& queues, bool* ready) {
+    size_t count = 0;
+    for(size_t i = 0; i < queues.size(); ++i) {
+        // A closed queue counts as ready so callers observe the close on their next get.
+        const bool r = queues[i]->isClosed() || queues[i]->has();
+        if(ready) ready[i] = r;
+        if(r) count++;
+    }
+    return count;
+}
+
+static int _dai_queue_waitset_wait(_DaiQueueWaitSet& ws, int timeout_ms, bool* ready) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms);
+    int rechecks = 0;
+    while(true) {
+        uint64_t seen = 0;
+        {
+            std::lock_guard<std::mutex> lock(ws.signal->mtx);
+            seen = ws.signal->generation;
+        }
+        const size_t count = _dai_queue_wait_poll(ws.queues, ready);
+        if(count > 0) return static_cast<int>(count);
+        if(rechecks > 0 && rechecks < 64) {
+            rechecks++;
+            std::this_thread::yield();
+            continue;
+        }
+        if(timeout_ms >= 0 && std::chrono::steady_clock::now() >= deadline) {
+            last_error.set_code(DAI_ERROR_TIMEOUT);
+            return 0;
+        }
+
+        std::unique_lock<std::mutex> lock(ws.signal->mtx);
+        auto signalled = [&] { return ws.signal->generation != seen; };
+        bool woke = false;
+        if(rechecks >= 64) {
+            // Signalled but still nothing visible: poll in short slices instead of sleeping long.
+            auto slice = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+            if(timeout_ms >= 0 && deadline < slice) slice = deadline;
+            woke = ws.signal->cv.wait_until(lock, slice, signalled);
+        } else if(timeout_ms < 0) {
+            ws.signal->cv.wait(lock, signalled);
+            woke = true;
+        } else {
+            woke = ws.signal->cv.wait_until(lock, deadline, signalled);
+        }
+        if(woke) {
+            rechecks = 1;
+        } else if(rechecks >= 64 && ++rechecks > 74) {
+            // Nothing showed up after ~10 ms of short slices (e.g. another consumer took the
+            // message); go back to sleeping until the next signal.
+            rechecks = 0;
+        }
+    }
+}
+
+static _DaiQueueWaitSet* _dai_queue_waitset_create(const DaiDataQueue* queues, size_t count) {
+    auto ws = std::make_unique<_DaiQueueWaitSet>();
+    ws->queues.reserve(count);
+    ws->callback_ids.reserve(count);
+    for(size_t i = 0; i < count; ++i) {
+        if(!queues[i]) throw std::invalid_argument("null queue in wait set");
+        ws->queues.push_back(*static_cast<std::shared_ptr<dai::MessageQueue>*>(queues[i]));
+    }
+    for(auto& q : ws->queues) {
+        std::weak_ptr<_DaiQueueWaitSignal> weak = ws->signal;
+        ws->callback_ids.push_back(q->addCallback([weak](std::string, std::shared_ptr<dai::ADatatype>) {
+            if(auto signal = weak.lock()) {
+                {
+                    std::lock_guard<std::mutex> lock(signal->mtx);
+                    signal->generation++;
+                }
+                signal->cv.notify_all();
+            }
+        }));
+    }
+    return ws.release();
+}
+
+DaiQueueWaitSet dai_queue_waitset_new(const DaiDataQueue* queues, size_t count) {
+    if(!queues && count > 0) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_waitset_new: null queues");
+        return nullptr;
+    }
+    try {
+        return static_cast<DaiQueueWaitSet>(_dai_queue_waitset_create(queues, count));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_waitset_new failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_queue_waitset_release(DaiQueueWaitSet ws) {
+    if(ws) {
+        delete static_cast<_DaiQueueWaitSet*>(ws);
+    }
+}
+
+size_t dai_queue_waitset_len(DaiQueueWaitSet ws) {
+    if(!ws) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_waitset_len: null wait set");
+        return 0;
+    }
+    return static_cast<_DaiQueueWaitSet*>(ws)->queues.size();
+}
+
+int dai_queue_waitset_wait(DaiQueueWaitSet ws, int timeout_ms, bool* ready) {
+    if(!ws) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_waitset_wait: null wait set");
+        return -1;
+    }
+    try {
+        return _dai_queue_waitset_wait(*static_cast<_DaiQueueWaitSet*>(ws), timeout_ms, ready);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_waitset_wait failed: ") + e.what());
+        return -1;
+    }
+}
+
+int dai_queue_wait_any(const DaiDataQueue* queues, size_t count, int timeout_ms, bool* ready) {
+    if(!queues && count > 0) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_wait_any: null queues");
+        return -1;
+    }
+    try {
+        // Fast path: something is already queued, no need to register callbacks.
+        std::vector<std::shared_ptr<dai::MessageQueue>> qs;
+        qs.reserve(count);
+        for(size_t i = 0; i < count; ++i) {
+            if(!queues[i]) {
+                last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_wait_any: null queue");
+                return -1;
+            }
+            qs.push_back(*static_cast<std::shared_ptr<dai::MessageQueue>*>(queues[i]));
+        }
+        const size_t ready_now = _dai_queue_wait_poll(qs, ready);
+        if(ready_now > 0 || timeout_ms == 0) {
+            if(ready_now == 0) last_error.set_code(DAI_ERROR_TIMEOUT);
+            return static_cast<int>(ready_now);
+        }
+        std::unique_ptr<_DaiQueueWaitSet> ws(_dai_queue_waitset_create(queues, count));
+        return _dai_queue_waitset_wait(*ws, timeout_ms, ready);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_wait_any failed: ") + e.what());
+        return -1;
+    }
+}
+
 void dai_queue_send(DaiDataQueue queue, DaiDatatype msg) {
     if(!queue || !msg) {
-        last_error = "dai_queue_send: null queue/msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_send: null queue/msg");
         return;
     }
     try {
@@ -4023,13 +6713,13 @@ void dai_queue_send(DaiDataQueue queue, DaiDatatype msg) {
         auto m = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         (*q)->send(*m);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_send failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_send failed: ") + e.what());
     }
 }
 
 bool dai_queue_send_timeout(DaiDataQueue queue, DaiDatatype msg, int timeout_ms) {
     if(!queue || !msg) {
-        last_error = "dai_queue_send_timeout: null queue/msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_send_timeout: null queue/msg");
         return false;
     }
     try {
@@ -4038,14 +6728,14 @@ bool dai_queue_send_timeout(DaiDataQueue queue, DaiDatatype msg, int timeout_ms)
         const int t = timeout_ms < 0 ? 0 : timeout_ms;
         return (*q)->send(*m, std::chrono::milliseconds(t));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_send_timeout failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_send_timeout failed: ") + e.what());
         return false;
     }
 }
 
 bool dai_queue_try_send(DaiDataQueue queue, DaiDatatype msg) {
     if(!queue || !msg) {
-        last_error = "dai_queue_try_send: null queue/msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_send: null queue/msg");
         return false;
     }
     try {
@@ -4053,14 +6743,59 @@ bool dai_queue_try_send(DaiDataQueue queue, DaiDatatype msg) {
         auto m = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         return (*q)->trySend(*m);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_send failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_send failed: ") + e.what());
         return false;
     }
 }
 
+size_t dai_queue_send_many(DaiDataQueue queue, const DaiDatatype* msgs, size_t count, int timeout_ms) {
+    if(!queue || (!msgs && count)) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_send_many: null queue/msgs");
+        return 0;
+    }
+    auto q = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
+    if(!*q) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_send_many: invalid queue");
+        return 0;
+    }
+    for(size_t i = 0; i < count; ++i) {
+        if(!msgs[i]) {
+            last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_send_many: null msg at index " + std::to_string(i));
+            return 0;
+        }
+        if(!*static_cast<std::shared_ptr<dai::ADatatype>*>(msgs[i])) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_queue_send_many: invalid msg at index " + std::to_string(i));
+            return 0;
+        }
+    }
+    size_t sent = 0;
+    try {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeout_ms, 0));
+        for(; sent < count; ++sent) {
+            const auto& m = *static_cast<std::shared_ptr<dai::ADatatype>*>(msgs[sent]);
+            bool accepted = true;
+            if(timeout_ms < 0) {
+                (*q)->send(m);
+            } else if(timeout_ms == 0) {
+                accepted = (*q)->trySend(m);
+            } else {
+                const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+                accepted = left.count() > 0 ? (*q)->send(m, left) : (*q)->trySend(m);
+            }
+            if(!accepted) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
+                break;
+            }
+        }
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_send_many failed: ") + e.what());
+    }
+    return sent;
+}
+
 DaiImgFrame dai_queue_get_frame(DaiDataQueue queue, int timeout_ms) {
     if(!queue) {
-        last_error = "dai_queue_get_frame: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_frame: null queue");
         return nullptr;
     }
     try {
@@ -4072,22 +6807,23 @@ DaiImgFrame dai_queue_get_frame(DaiDataQueue queue, int timeout_ms) {
             bool timedOut = false;
             frame = (*ptr)->get<dai::ImgFrame>(std::chrono::milliseconds(timeout_ms), timedOut);
             if(timedOut) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
                 return nullptr;
             }
         }
         if(!frame) {
             return nullptr;
         }
-        return new std::shared_ptr<dai::ImgFrame>(frame);
+        return _dai_new_handle<dai::ImgFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiImgFrame dai_queue_try_get_frame(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get_frame: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get_frame: null queue");
         return nullptr;
     }
     try {
@@ -4096,16 +6832,16 @@ DaiImgFrame dai_queue_try_get_frame(DaiDataQueue queue) {
         if(!frame) {
             return nullptr;
         }
-        return new std::shared_ptr<dai::ImgFrame>(frame);
+        return _dai_new_handle<dai::ImgFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiEncodedFrame dai_queue_get_encoded_frame(DaiDataQueue queue, int timeout_ms) {
     if(!queue) {
-        last_error = "dai_queue_get_encoded_frame: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_get_encoded_frame: null queue");
         return nullptr;
     }
     try {
@@ -4117,22 +6853,23 @@ DaiEncodedFrame dai_queue_get_encoded_frame(DaiDataQueue queue, int timeout_ms)
             bool timedOut = false;
             frame = (*ptr)->get<dai::EncodedFrame>(std::chrono::milliseconds(timeout_ms), timedOut);
             if(timedOut) {
+                last_error.set_code(DAI_ERROR_TIMEOUT);
                 return nullptr;
             }
         }
         if(!frame) {
             return nullptr;
         }
-        return new std::shared_ptr<dai::EncodedFrame>(frame);
+        return _dai_new_handle<dai::EncodedFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_get_encoded_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_get_encoded_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiEncodedFrame dai_queue_try_get_encoded_frame(DaiDataQueue queue) {
     if(!queue) {
-        last_error = "dai_queue_try_get_encoded_frame: null queue";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_get_encoded_frame: null queue");
         return nullptr;
     }
     try {
@@ -4141,9 +6878,9 @@ DaiEncodedFrame dai_queue_try_get_encoded_frame(DaiDataQueue queue) {
         if(!frame) {
             return nullptr;
         }
-        return new std::shared_ptr<dai::EncodedFrame>(frame);
+        return _dai_new_handle<dai::EncodedFrame>(frame);
     } catch(const std::exception& e) {
-        last_error = std::string("dai_queue_try_get_encoded_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_get_encoded_frame failed: ") + e.what());
         return nullptr;
     }
 }
@@ -4151,28 +6888,28 @@ DaiEncodedFrame dai_queue_try_get_encoded_frame(DaiDataQueue queue) {
 void dai_datatype_release(DaiDatatype msg) {
     if(msg) {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 DaiDatatype dai_datatype_clone(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_clone: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_clone: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         if(!ptr->get() || !(*ptr)) return nullptr;
-        return static_cast<DaiDatatype>(new std::shared_ptr<dai::ADatatype>(*ptr));
+        return static_cast<DaiDatatype>(_dai_new_handle<dai::ADatatype>(*ptr));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_clone failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_clone failed: ") + e.what());
         return nullptr;
     }
 }
 
 int dai_datatype_get_datatype_enum(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_get_datatype_enum: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_get_datatype_enum: null msg");
         return -1;
     }
     try {
@@ -4180,46 +6917,46 @@ int dai_datatype_get_datatype_enum(DaiDatatype msg) {
         if(!ptr->get() || !(*ptr)) return -1;
         return static_cast<int>((*ptr)->getDatatype());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_get_datatype_enum failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_get_datatype_enum failed: ") + e.what());
         return -1;
     }
 }
 
 DaiImgFrame dai_datatype_as_img_frame(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_img_frame: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_img_frame: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         auto frame = std::dynamic_pointer_cast<dai::ImgFrame>(*ptr);
         if(!frame) return nullptr;
-        return new std::shared_ptr<dai::ImgFrame>(std::move(frame));
+        return _dai_new_handle<dai::ImgFrame>(std::move(frame));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_img_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_img_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiEncodedFrame dai_datatype_as_encoded_frame(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_encoded_frame: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_encoded_frame: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         auto frame = std::dynamic_pointer_cast<dai::EncodedFrame>(*ptr);
         if(!frame) return nullptr;
-        return new std::shared_ptr<dai::EncodedFrame>(std::move(frame));
+        return _dai_new_handle<dai::EncodedFrame>(std::move(frame));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_encoded_frame failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_encoded_frame failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiPointCloud dai_datatype_as_pointcloud(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_pointcloud: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_pointcloud: null msg");
         return nullptr;
     }
     try {
@@ -4227,60 +6964,80 @@ DaiPointCloud dai_datatype_as_pointcloud(DaiDatatype msg) {
         auto pcl = std::dynamic_pointer_cast<dai::PointCloudData>(*ptr);
         if(!pcl) return nullptr;
 
-        auto view = new DaiPointCloudView();
-        view->msg = pcl;
-        view->points = pcl->getPointsRGB();
-        return static_cast<DaiPointCloud>(view);
+        return _dai_make_pointcloud_view(std::move(pcl));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_pointcloud failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_pointcloud failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiRGBDData dai_datatype_as_rgbd(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_rgbd: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_rgbd: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         auto rgbd = std::dynamic_pointer_cast<dai::RGBDData>(*ptr);
         if(!rgbd) return nullptr;
-        return static_cast<DaiRGBDData>(new std::shared_ptr<dai::RGBDData>(std::move(rgbd)));
+        return static_cast<DaiRGBDData>(_dai_new_handle<dai::RGBDData>(std::move(rgbd)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_rgbd failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_rgbd failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiBuffer dai_datatype_as_buffer(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_buffer: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_buffer: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         auto buf = std::dynamic_pointer_cast<dai::Buffer>(*ptr);
         if(!buf) return nullptr;
-        return static_cast<DaiBuffer>(new std::shared_ptr<dai::Buffer>(std::move(buf)));
+        return static_cast<DaiBuffer>(_dai_new_handle<dai::Buffer>(std::move(buf)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_buffer failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_buffer failed: ") + e.what());
         return nullptr;
     }
 }
 
 DaiMessageGroup dai_datatype_as_message_group(DaiDatatype msg) {
     if(!msg) {
-        last_error = "dai_datatype_as_message_group: null msg";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_as_message_group: null msg");
         return nullptr;
     }
     try {
         auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
         auto group = std::dynamic_pointer_cast<dai::MessageGroup>(*ptr);
         if(!group) return nullptr;
-        return static_cast<DaiMessageGroup>(new std::shared_ptr<dai::MessageGroup>(std::move(group)));
+        return static_cast<DaiMessageGroup>(_dai_new_handle<dai::MessageGroup>(std::move(group)));
     } catch(const std::exception& e) {
-        last_error = std::string("dai_datatype_as_message_group failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_as_message_group failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+char* dai_datatype_benchmark_report_json(DaiDatatype msg) {
+    if(!msg) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_benchmark_report_json: null msg");
+        return nullptr;
+    }
+    try {
+        auto ptr = static_cast<std::shared_ptr<dai::ADatatype>*>(msg);
+        auto report = std::dynamic_pointer_cast<dai::BenchmarkReport>(*ptr);
+        if(!report) return nullptr;
+        nlohmann::json j;
+        j["fps"] = report->fps;
+        j["time_total"] = report->timeTotal;
+        j["num_messages_received"] = static_cast<uint64_t>(report->numMessagesReceived);
+        j["average_latency"] = report->averageLatency;
+        j["latencies"] = report->latencies;
+        auto dumped = j.dump();
+        return dai_string_to_cstring(dumped.c_str());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_datatype_benchmark_report_json failed: ") + e.what());
         return nullptr;
     }
 }
@@ -4295,12 +7052,12 @@ size_t dai_datatype_array_len(DaiDatatypeArray arr) {
 
 DaiDatatype dai_datatype_array_take(DaiDatatypeArray arr, size_t index) {
     if(!arr) {
-        last_error = "dai_datatype_array_take: null array";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_datatype_array_take: null array");
         return nullptr;
     }
     auto ptr = static_cast<_DaiDatatypeArray*>(arr);
     if(index >= ptr->elems.size()) {
-        last_error = "dai_datatype_array_take: index out of bounds";
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_datatype_array_take: index out of bounds");
         return nullptr;
     }
     auto out = ptr->elems[index];
@@ -4316,7 +7073,7 @@ void dai_datatype_array_free(DaiDatatypeArray arr) {
     for(auto& h : ptr->elems) {
         if(h) {
             // Release any remaining elements (ones not taken by the caller).
-            delete static_cast<std::shared_ptr<dai::ADatatype>*>(h);
+            _dai_delete_handle(static_cast<std::shared_ptr<dai::ADatatype>*>(h));
             h = nullptr;
         }
     }
@@ -4326,7 +7083,7 @@ void dai_datatype_array_free(DaiDatatypeArray arr) {
 // Low-level frame operations
 void* dai_frame_get_data(DaiImgFrame frame) {
     if (!frame) {
-        last_error = "dai_frame_get_data: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_data: null frame");
         return nullptr;
     }
     try {
@@ -4336,14 +7093,14 @@ void* dai_frame_get_data(DaiImgFrame frame) {
         }
         return (*sharedFrame)->getData().data();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_frame_get_data failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_data failed: ") + e.what());
         return nullptr;
     }
 }
 
 int dai_frame_get_width(DaiImgFrame frame) {
     if (!frame) {
-        last_error = "dai_frame_get_width: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_width: null frame");
         return 0;
     }
     try {
@@ -4353,14 +7110,14 @@ int dai_frame_get_width(DaiImgFrame frame) {
         }
         return (*sharedFrame)->getWidth();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_frame_get_width failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_width failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_frame_get_height(DaiImgFrame frame) {
     if (!frame) {
-        last_error = "dai_frame_get_height: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_height: null frame");
         return 0;
     }
     try {
@@ -4370,14 +7127,14 @@ int dai_frame_get_height(DaiImgFrame frame) {
         }
         return (*sharedFrame)->getHeight();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_frame_get_height failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_height failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_frame_get_type(DaiImgFrame frame) {
     if (!frame) {
-        last_error = "dai_frame_get_type: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_type: null frame");
         return 0;
     }
     try {
@@ -4387,14 +7144,14 @@ int dai_frame_get_type(DaiImgFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getType());
     } catch (const std::exception& e) {
-        last_error = std::string("dai_frame_get_type failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_type failed: ") + e.what());
         return 0;
     }
 }
 
 size_t dai_frame_get_size(DaiImgFrame frame) {
     if (!frame) {
-        last_error = "dai_frame_get_size: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_size: null frame");
         return 0;
     }
     try {
@@ -4404,21 +7161,997 @@ size_t dai_frame_get_size(DaiImgFrame frame) {
         }
         return (*sharedFrame)->getData().size();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_frame_get_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_size failed: ") + e.what());
+        return 0;
+    }
+}
+
+static void _dai_fill_frame_info(dai::ImgFrame& f, DaiImgFrameInfo* out) {
+    auto data = f.getData();
+    out->data = data.data();
+    out->size = data.size();
+    out->width = static_cast<int>(f.getWidth());
+    out->height = static_cast<int>(f.getHeight());
+    out->type = static_cast<int>(f.getType());
+    out->stride = f.fb.stride;
+    out->bytes_per_pixel = f.fb.bytesPP;
+    out->plane_offsets[0] = f.fb.p1Offset;
+    out->plane_offsets[1] = f.fb.p2Offset;
+    out->plane_offsets[2] = f.fb.p3Offset;
+    out->sequence_num = static_cast<int64_t>(f.getSequenceNum());
+    out->timestamp_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(f.getTimestamp().time_since_epoch()).count();
+    out->timestamp_device_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(f.getTimestampDevice().time_since_epoch()).count();
+    out->instance_num = static_cast<int>(f.getInstanceNum());
+    out->exposure_us = static_cast<int>(f.getExposureTime().count());
+    out->sensitivity = f.getSensitivity();
+    out->lens_position = f.getLensPosition();
+}
+
+bool dai_frame_get_info(DaiImgFrame frame, DaiImgFrameInfo* out) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_info: null frame");
+        return false;
+    }
+    if(!out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_get_info: null out");
+        return false;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        const auto& f = *sharedFrame;
+        if(!f) {
+            return false;
+        }
+        _dai_fill_frame_info(*f, out);
+        return true;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_get_info failed: ") + e.what());
+        return false;
+    }
+}
+
+// Host-side pixel conversion
+//
+// Row kernels use SSSE3 on x86 (picked at runtime) and NEON on ARM; the scalar code handles row
+// tails and other targets. YUV input uses BT.601 limited-range coefficients in Q6 fixed point.
+// Intermediate sums saturate in 16 bits only where the exact result would clamp to 255 anyway,
+// so the SIMD and scalar paths produce identical bytes.
+#if DAI_PX_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define DAI_PX_TARGET_SSSE3
+    #else
+        #define DAI_PX_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #endif
+
+static bool _dai_px_has_ssse3() {
+    static const bool has = [] {
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+    #else
+        return __builtin_cpu_supports("ssse3") != 0;
+    #endif
+    }();
+    return has;
+}
+
+// Byte shuffles that interleave 16 samples of three planes into 48 bytes (three stores).
+alignas(16) static const int8_t _dai_px_interleave_masks[3][3][16] = {
+    {{0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5},
+     {-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1},
+     {-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1}},
+    {{-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1},
+     {5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10},
+     {-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1}},
+    {{-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1},
+     {-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1},
+     {10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15}},
+};
+
+DAI_PX_TARGET_SSSE3 static inline void _dai_px_store3_ssse3(uint8_t* dst, __m128i a, __m128i b, __m128i c) {
+    for(int j = 0; j < 3; ++j) {
+        auto ma = _mm_load_si128(reinterpret_cast<const __m128i*>(_dai_px_interleave_masks[0][j]));
+        auto mb = _mm_load_si128(reinterpret_cast<const __m128i*>(_dai_px_interleave_masks[1][j]));
+        auto mc = _mm_load_si128(reinterpret_cast<const __m128i*>(_dai_px_interleave_masks[2][j]));
+        auto out = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, ma), _mm_shuffle_epi8(b, mb)), _mm_shuffle_epi8(c, mc));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16 * j), out);
+    }
+}
+
+// Swaps bytes 0 and 2 of five pixels per step; byte 15 is passed through and redone next step.
+DAI_PX_TARGET_SSSE3 static size_t _dai_px_swap_rb_ssse3(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    const auto mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    size_t bytes = pixels * 3;
+    size_t i = 0;
+    for(; i + 16 <= bytes; i += 15) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+    return i / 3;
+}
+
+DAI_PX_TARGET_SSSE3 static size_t _dai_px_interleave_ssse3(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* dst, size_t pixels) {
+    size_t x = 0;
+    for(; x + 16 <= pixels; x += 16) {
+        _dai_px_store3_ssse3(dst + 3 * x,
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x)),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x)),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + x)));
+    }
+    return x;
+}
+
+DAI_PX_TARGET_SSSE3 static size_t _dai_px_yuv_ssse3(
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, bool interleaved, uint8_t* dst, size_t width, bool bgr) {
+    const auto zero = _mm_setzero_si128();
+    const auto c16 = _mm_set1_epi16(16), c128 = _mm_set1_epi16(128), c32 = _mm_set1_epi16(32);
+    const auto c74 = _mm_set1_epi16(74), c102 = _mm_set1_epi16(102), c25 = _mm_set1_epi16(25);
+    const auto c52 = _mm_set1_epi16(52), c129 = _mm_set1_epi16(129), lo = _mm_set1_epi16(0x00FF);
+    const uint8_t* uv = interleaved ? std::min(u, v) : nullptr;
+    const bool u_low = u < v;
+    size_t x = 0;
+    for(; x + 16 <= width; x += 16) {
+        __m128i u16, v16;
+        if(interleaved) {
+            auto pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + x));
+            auto low = _mm_and_si128(pairs, lo), high = _mm_srli_epi16(pairs, 8);
+            u16 = u_low ? low : high;
+            v16 = u_low ? high : low;
+        } else {
+            u16 = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2)), zero);
+            v16 = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2)), zero);
+        }
+        auto yv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+        __m128i r[2], g[2], b[2];
+        for(int h = 0; h < 2; ++h) {
+            auto yy = h ? _mm_unpackhi_epi8(yv, zero) : _mm_unpacklo_epi8(yv, zero);
+            auto uu = h ? _mm_unpackhi_epi16(u16, u16) : _mm_unpacklo_epi16(u16, u16);
+            auto vv = h ? _mm_unpackhi_epi16(v16, v16) : _mm_unpacklo_epi16(v16, v16);
+            yy = _mm_mullo_epi16(_mm_sub_epi16(yy, c16), c74);
+            uu = _mm_sub_epi16(uu, c128);
+            vv = _mm_sub_epi16(vv, c128);
+            r[h] = _mm_srai_epi16(_mm_adds_epi16(_mm_adds_epi16(yy, _mm_mullo_epi16(vv, c102)), c32), 6);
+            g[h] = _mm_srai_epi16(
+                _mm_adds_epi16(_mm_subs_epi16(_mm_subs_epi16(yy, _mm_mullo_epi16(uu, c25)), _mm_mullo_epi16(vv, c52)), c32), 6);
+            b[h] = _mm_srai_epi16(_mm_adds_epi16(_mm_adds_epi16(yy, _mm_mullo_epi16(uu, c129)), c32), 6);
+        }
+        auto R = _mm_packus_epi16(r[0], r[1]), G = _mm_packus_epi16(g[0], g[1]), B = _mm_packus_epi16(b[0], b[1]);
+        if(bgr) {
+            _dai_px_store3_ssse3(dst + 3 * x, B, G, R);
+        } else {
+            _dai_px_store3_ssse3(dst + 3 * x, R, G, B);
+        }
+    }
+    return x;
+}
+#endif  // DAI_PX_X86
+
+#if DAI_PX_NEON
+static size_t _dai_px_swap_rb_neon(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    size_t x = 0;
+    for(; x + 16 <= pixels; x += 16) {
+        auto px = vld3q_u8(src + 3 * x);
+        std::swap(px.val[0], px.val[2]);
+        vst3q_u8(dst + 3 * x, px);
+    }
+    return x;
+}
+
+static size_t _dai_px_interleave_neon(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* dst, size_t pixels) {
+    size_t x = 0;
+    for(; x + 16 <= pixels; x += 16) {
+        uint8x16x3_t px;
+        px.val[0] = vld1q_u8(a + x);
+        px.val[1] = vld1q_u8(b + x);
+        px.val[2] = vld1q_u8(c + x);
+        vst3q_u8(dst + 3 * x, px);
+    }
+    return x;
+}
+
+static size_t _dai_px_yuv_neon(
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, bool interleaved, uint8_t* dst, size_t width, bool bgr) {
+    const uint8_t* uv = interleaved ? std::min(u, v) : nullptr;
+    const bool u_low = u < v;
+    size_t x = 0;
+    for(; x + 16 <= width; x += 16) {
+        uint8x8_t u8, v8;
+        if(interleaved) {
+            auto pairs = vld2_u8(uv + x);
+            u8 = u_low ? pairs.val[0] : pairs.val[1];
+            v8 = u_low ? pairs.val[1] : pairs.val[0];
+        } else {
+            u8 = vld1_u8(u + x / 2);
+            v8 = vld1_u8(v + x / 2);
+        }
+        auto uu2 = vzip_u8(u8, u8), vv2 = vzip_u8(v8, v8);
+        auto yv = vld1q_u8(y + x);
+        uint8x8_t r[2], g[2], b[2];
+        for(int h = 0; h < 2; ++h) {
+            auto yy = vreinterpretq_s16_u16(vmovl_u8(h ? vget_high_u8(yv) : vget_low_u8(yv)));
+            auto uu = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(uu2.val[h])), vdupq_n_s16(128));
+            auto vv = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vv2.val[h])), vdupq_n_s16(128));
+            yy = vmulq_n_s16(vsubq_s16(yy, vdupq_n_s16(16)), 74);
+            r[h] = vqrshrun_n_s16(vqaddq_s16(yy, vmulq_n_s16(vv, 102)), 6);
+            g[h] = vqrshrun_n_s16(vqsubq_s16(vqsubq_s16(yy, vmulq_n_s16(uu, 25)), vmulq_n_s16(vv, 52)), 6);
+            b[h] = vqrshrun_n_s16(vqaddq_s16(yy, vmulq_n_s16(uu, 129)), 6);
+        }
+        uint8x16x3_t px;
+        px.val[bgr ? 2 : 0] = vcombine_u8(r[0], r[1]);
+        px.val[1] = vcombine_u8(g[0], g[1]);
+        px.val[bgr ? 0 : 2] = vcombine_u8(b[0], b[1]);
+        vst3q_u8(dst + 3 * x, px);
+    }
+    return x;
+}
+#endif  // DAI_PX_NEON
+
+static inline uint8_t _dai_px_clamp(int value) {
+    return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+static void _dai_px_swap_rb_row(const uint8_t* src, uint8_t* dst, size_t pixels) {
+    size_t x = 0;
+#if DAI_PX_X86
+    if(_dai_px_has_ssse3()) x = _dai_px_swap_rb_ssse3(src, dst, pixels);
+#elif DAI_PX_NEON
+    x = _dai_px_swap_rb_neon(src, dst, pixels);
+#endif
+    for(; x < pixels; ++x) {
+        uint8_t r = src[3 * x], g = src[3 * x + 1], b = src[3 * x + 2];
+        dst[3 * x] = b;
+        dst[3 * x + 1] = g;
+        dst[3 * x + 2] = r;
+    }
+}
+
+static void _dai_px_interleave_row(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* dst, size_t pixels) {
+    size_t x = 0;
+#if DAI_PX_X86
+    if(_dai_px_has_ssse3()) x = _dai_px_interleave_ssse3(a, b, c, dst, pixels);
+#elif DAI_PX_NEON
+    x = _dai_px_interleave_neon(a, b, c, dst, pixels);
+#endif
+    for(; x < pixels; ++x) {
+        dst[3 * x] = a[x];
+        dst[3 * x + 1] = b[x];
+        dst[3 * x + 2] = c[x];
+    }
+}
+
+// `u` / `v` point at the row's first chroma sample; with `interleaved` (NV12 / NV21) they are
+// adjacent bytes of one plane, otherwise separate half-width planes.
+static void _dai_px_yuv_row(
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, bool interleaved, uint8_t* dst, size_t width, bool bgr) {
+    size_t x = 0;
+#if DAI_PX_X86
+    if(_dai_px_has_ssse3()) x = _dai_px_yuv_ssse3(y, u, v, interleaved, dst, width, bgr);
+#elif DAI_PX_NEON
+    x = _dai_px_yuv_neon(y, u, v, interleaved, dst, width, bgr);
+#endif
+    const size_t step = interleaved ? 2 : 1;
+    for(; x < width; ++x) {
+        int yy = 74 * (y[x] - 16);
+        int uu = u[(x / 2) * step] - 128;
+        int vv = v[(x / 2) * step] - 128;
+        auto r = _dai_px_clamp((yy + 102 * vv + 32) >> 6);
+        auto g = _dai_px_clamp((yy - 25 * uu - 52 * vv + 32) >> 6);
+        auto b = _dai_px_clamp((yy + 129 * uu + 32) >> 6);
+        dst[3 * x] = bgr ? b : r;
+        dst[3 * x + 1] = g;
+        dst[3 * x + 2] = bgr ? r : b;
+    }
+}
+
+static size_t _dai_px_output_size(size_t width, size_t height, int dst_type) {
+    using T = dai::ImgFrame::Type;
+    switch(static_cast<T>(dst_type)) {
+        case T::RGB888i:
+        case T::BGR888i:
+            return width * height * 3;
+        case T::GRAY8:
+            return width * height;
+        case T::RAW16:
+            return width * height * 2;
+        default:
+            return 0;
+    }
+}
+
+// Converts the image described by `src` into tightly packed `dst_type` pixels. Returns the
+// number of bytes written, or 0 with `err` set.
+static size_t _dai_px_convert(const DaiImgFrameInfo& src, int dst_type, uint8_t* dst, size_t capacity, const char** err) {
+    using T = dai::ImgFrame::Type;
+    if(src.width <= 0 || src.height <= 0) {
+        *err = "empty image";
+        return 0;
+    }
+    const size_t w = static_cast<size_t>(src.width), h = static_cast<size_t>(src.height);
+    const size_t out_size = _dai_px_output_size(w, h, dst_type);
+    if(out_size == 0) {
+        *err = "unsupported destination format";
+        return 0;
+    }
+    if(capacity < out_size) {
+        *err = "destination too small";
+        return 0;
+    }
+    const auto in = static_cast<T>(src.type);
+    const auto out = static_cast<T>(dst_type);
+    const bool to_rgb = out == T::RGB888i || out == T::BGR888i;
+    const auto base = static_cast<const uint8_t*>(src.data);
+    auto fits = [&](size_t offset, size_t stride, size_t rows, size_t row_bytes) {
+        return base && offset + (rows - 1) * stride + row_bytes <= src.size;
+    };
+    auto stride_or = [&](size_t packed) { return src.stride ? static_cast<size_t>(src.stride) : packed; };
+
+    switch(in) {
+        case T::RGB888i:
+        case T::BGR888i: {
+            const size_t stride = stride_or(w * 3);
+            if(!to_rgb) break;
+            if(!fits(0, stride, h, w * 3)) {
+                *err = "source buffer too small";
+                return 0;
+            }
+            for(size_t row = 0; row < h; ++row) {
+                if(in == out) {
+                    std::memcpy(dst + row * w * 3, base + row * stride, w * 3);
+                } else {
+                    _dai_px_swap_rb_row(base + row * stride, dst + row * w * 3, w);
+                }
+            }
+            return out_size;
+        }
+        case T::RGB888p:
+        case T::BGR888p: {
+            if(!to_rgb) break;
+            const size_t stride = stride_or(w);
+            const size_t plane = stride * h;
+            const size_t off[3] = {src.plane_offsets[0],
+                                   src.plane_offsets[1] ? src.plane_offsets[1] : plane,
+                                   src.plane_offsets[2] ? src.plane_offsets[2] : 2 * plane};
+            for(size_t p = 0; p < 3; ++p) {
+                if(!fits(off[p], stride, h, w)) {
+                    *err = "source buffer too small";
+                    return 0;
+                }
+            }
+            // Plane 0 is red for RGB888p and blue for BGR888p.
+            const bool swap = (in == T::RGB888p) != (out == T::RGB888i);
+            for(size_t row = 0; row < h; ++row) {
+                const uint8_t* p0 = base + off[0] + row * stride;
+                const uint8_t* p1 = base + off[1] + row * stride;
+                const uint8_t* p2 = base + off[2] + row * stride;
+                _dai_px_interleave_row(swap ? p2 : p0, p1, swap ? p0 : p2, dst + row * w * 3, w);
+            }
+            return out_size;
+        }
+        case T::GRAY8:
+        case T::RAW8: {
+            const size_t stride = stride_or(w);
+            if(!to_rgb && out != T::GRAY8) break;
+            if(!fits(0, stride, h, w)) {
+                *err = "source buffer too small";
+                return 0;
+            }
+            for(size_t row = 0; row < h; ++row) {
+                const uint8_t* line = base + row * stride;
+                if(to_rgb) {
+                    _dai_px_interleave_row(line, line, line, dst + row * w * 3, w);
+                } else {
+                    std::memcpy(dst + row * w, line, w);
+                }
+            }
+            return out_size;
+        }
+        case T::NV12:
+        case T::NV21:
+        case T::YUV420p: {
+            if(!to_rgb && out != T::GRAY8) break;
+            const size_t stride = stride_or(w);
+            const size_t cw = (w + 1) / 2, ch = (h + 1) / 2;
+            const bool interleaved = in != T::YUV420p;
+            const size_t cstride = interleaved ? stride : (stride + 1) / 2;
+            const size_t off_y = src.plane_offsets[0];
+            const size_t off_u = src.plane_offsets[1] ? src.plane_offsets[1] : off_y + stride * h;
+            const size_t off_v = interleaved ? off_u : (src.plane_offsets[2] ? src.plane_offsets[2] : off_u + cstride * ch);
+            const bool ok = fits(off_y, stride, h, w)
+                            && (out == T::GRAY8 || (fits(off_u, cstride, ch, interleaved ? 2 * cw : cw) && fits(off_v, cstride, ch, cw)));
+            if(!ok) {
+                *err = "source buffer too small";
+                return 0;
+            }
+            for(size_t row = 0; row < h; ++row) {
+                const uint8_t* line = base + off_y + row * stride;
+                if(out == T::GRAY8) {
+                    std::memcpy(dst + row * w, line, w);
+                    continue;
+                }
+                const uint8_t* chroma_u = base + off_u + (row / 2) * cstride;
+                const uint8_t* chroma_v = base + off_v + (row / 2) * cstride;
+                if(interleaved) {
+                    // NV12 stores U first, NV21 stores V first.
+                    if(in == T::NV12) {
+                        chroma_v = chroma_u + 1;
+                    } else {
+                        chroma_u = chroma_v + 1;
+                    }
+                }
+                _dai_px_yuv_row(line, chroma_u, chroma_v, interleaved, dst + row * w * 3, w, out == T::BGR888i);
+            }
+            return out_size;
+        }
+        case T::RAW16: {
+            if(out != T::RAW16) break;
+            const size_t stride = stride_or(w * 2);
+            if(!fits(0, stride, h, w * 2)) {
+                *err = "source buffer too small";
+                return 0;
+            }
+            for(size_t row = 0; row < h; ++row) {
+                std::memcpy(dst + row * w * 2, base + row * stride, w * 2);
+            }
+            return out_size;
+        }
+        default:
+            break;
+    }
+    *err = "unsupported conversion";
+    return 0;
+}
+
+size_t dai_image_converted_size(int width, int height, int dst_type) {
+    if(width <= 0 || height <= 0) return 0;
+    return _dai_px_output_size(static_cast<size_t>(width), static_cast<size_t>(height), dst_type);
+}
+
+size_t dai_image_convert(const DaiImgFrameInfo* src, int dst_type, void* dst, size_t dst_capacity) {
+    if(!src || !dst) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_convert: null src/dst");
+        return 0;
+    }
+    const char* err = nullptr;
+    size_t written = _dai_px_convert(*src, dst_type, static_cast<uint8_t*>(dst), dst_capacity, &err);
+    if(!written) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string("dai_image_convert: ") + (err ? err : "conversion failed"));
+    }
+    return written;
+}
+
+size_t dai_frame_convert(DaiImgFrame frame, int dst_type, void* dst, size_t dst_capacity) {
+    if(!frame || !dst) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_convert: null frame/dst");
+        return 0;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        if(!*sharedFrame) {
+            last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_convert: null frame");
+            return 0;
+        }
+        DaiImgFrameInfo info{};
+        _dai_fill_frame_info(**sharedFrame, &info);
+        const char* err = nullptr;
+        size_t written = _dai_px_convert(info, dst_type, static_cast<uint8_t*>(dst), dst_capacity, &err);
+        if(!written) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string("dai_frame_convert: ") + (err ? err : "conversion failed"));
+        }
+        return written;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_convert failed: ") + e.what());
+        return 0;
+    }
+}
+
+// Output adapters for `_DaiDepthProjector::project`.
+struct _DaiProjectSoaOut {
+    float* x;
+    float* y;
+    float* z;
+    uint32_t* rgba;
+    void put(size_t i, float px, float py, float pz, uint32_t c) {
+        if(x) x[i] = px;
+        if(y) y[i] = py;
+        if(z) z[i] = pz;
+        if(rgba) rgba[i] = c;
+    }
+    void move(size_t dst, size_t src, size_t n) {
+        if(x) std::memmove(x + dst, x + src, n * sizeof(float));
+        if(y) std::memmove(y + dst, y + src, n * sizeof(float));
+        if(z) std::memmove(z + dst, z + src, n * sizeof(float));
+        if(rgba) std::memmove(rgba + dst, rgba + src, n * sizeof(uint32_t));
+    }
+};
+
+struct _DaiProjectPointsOut {
+    DaiPoint3fRGBA* points;
+    void put(size_t i, float px, float py, float pz, uint32_t c) {
+        points[i] = DaiPoint3fRGBA{px,
+                                   py,
+                                   pz,
+                                   static_cast<unsigned char>(c >> 24),
+                                   static_cast<unsigned char>(c >> 16),
+                                   static_cast<unsigned char>(c >> 8),
+                                   static_cast<unsigned char>(c)};
+    }
+    void move(size_t dst, size_t src, size_t n) {
+        std::memmove(points + dst, points + src, n * sizeof(DaiPoint3fRGBA));
+    }
+};
+
+DaiDepthProjector dai_depth_projector_new(const DaiCameraIntrinsics* intrinsics, bool undistort, uint32_t threads) {
+    if(!intrinsics) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_depth_projector_new: null intrinsics");
+        return nullptr;
+    }
+    if(intrinsics->width <= 0 || intrinsics->height <= 0 || intrinsics->fx == 0.0f || intrinsics->fy == 0.0f) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_depth_projector_new: invalid intrinsics");
+        return nullptr;
+    }
+    try {
+        _DaiPinhole k;
+        k.fx = intrinsics->fx;
+        k.fy = intrinsics->fy;
+        k.cx = intrinsics->cx;
+        k.cy = intrinsics->cy;
+        k.width = static_cast<size_t>(intrinsics->width);
+        k.height = static_cast<size_t>(intrinsics->height);
+        const int32_t count = std::clamp<int32_t>(intrinsics->distortion_count, 0, 14);
+        k.distortion.assign(intrinsics->distortion, intrinsics->distortion + count);
+        return new _DaiDepthProjector(k, undistort, threads);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_depth_projector_new failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+// Validates the frames, resolves the color view (converting to RGB888i when needed) and runs
+// the projection into `out`.
+template <typename Out>
+static size_t _dai_depth_project(const char* fn,
+                                 DaiDepthProjector projector,
+                                 const DaiImgFrameInfo* depth,
+                                 const DaiImgFrameInfo* rgb,
+                                 const DaiProjectionOptions* options,
+                                 size_t capacity,
+                                 Out& out) {
+    using T = dai::ImgFrame::Type;
+    if(!projector || !depth || !options) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, std::string(fn) + ": null projector/depth/options");
+        return 0;
+    }
+    auto proj = static_cast<_DaiDepthProjector*>(projector);
+    if(static_cast<T>(depth->type) != T::RAW16 || !depth->data) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": depth frame must be RAW16");
+        return 0;
+    }
+    if(static_cast<size_t>(depth->width) != proj->width || static_cast<size_t>(depth->height) != proj->height) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": depth size does not match intrinsics");
+        return 0;
+    }
+    const size_t stride = depth->stride ? depth->stride / 2 : proj->width;
+    if(stride < proj->width || (proj->height - 1) * stride * 2 + proj->width * 2 > depth->size) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": depth buffer too small");
         return 0;
     }
+    _DaiProjectParams params;
+    params.depthScale = options->depth_scale;
+    params.decimation = options->decimation ? options->decimation : 1;
+    params.zMin = options->z_min;
+    params.zMax = options->z_max;
+    params.skipInvalid = options->skip_invalid;
+    if(capacity < proj->outWidth(params.decimation) * proj->outHeight(params.decimation)) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": capacity smaller than the projection grid");
+        return 0;
+    }
+
+    _DaiColorView color;
+    thread_local std::vector<uint8_t> converted;
+    if(rgb && rgb->data && rgb->width > 0 && rgb->height > 0) {
+        color.width = static_cast<size_t>(rgb->width);
+        color.height = static_cast<size_t>(rgb->height);
+        const auto type = static_cast<T>(rgb->type);
+        const size_t rowBytes = rgb->stride ? rgb->stride : color.width * 3;
+        if((type == T::RGB888i || type == T::BGR888i) && rowBytes >= color.width * 3
+           && (color.height - 1) * rowBytes + color.width * 3 <= rgb->size) {
+            color.data = static_cast<const uint8_t*>(rgb->data);
+            color.stride = rowBytes;
+            color.bgr = type == T::BGR888i;
+        } else {
+            converted.resize(color.width * color.height * 3);
+            const char* err = nullptr;
+            if(!_dai_px_convert(*rgb, static_cast<int>(T::RGB888i), converted.data(), converted.size(), &err)) {
+                last_error.set(DAI_ERROR_INVALID_ARGUMENT, std::string(fn) + ": rgb frame: " + (err ? err : "conversion failed"));
+                return 0;
+            }
+            color.data = converted.data();
+            color.stride = color.width * 3;
+        }
+    }
+    try {
+        return proj->project(static_cast<const uint16_t*>(depth->data), stride, color, params, out);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string(fn) + " failed: " + e.what());
+        return 0;
+    }
+}
+
+size_t dai_depth_projector_project_soa(DaiDepthProjector projector,
+                                       const DaiImgFrameInfo* depth,
+                                       const DaiImgFrameInfo* rgb,
+                                       const DaiProjectionOptions* options,
+                                       float* out_x,
+                                       float* out_y,
+                                       float* out_z,
+                                       uint32_t* out_rgba,
+                                       size_t capacity) {
+    _DaiProjectSoaOut out{out_x, out_y, out_z, out_rgba};
+    return _dai_depth_project("dai_depth_projector_project_soa", projector, depth, rgb, options, capacity, out);
+}
+
+size_t dai_depth_projector_project_points(DaiDepthProjector projector,
+                                          const DaiImgFrameInfo* depth,
+                                          const DaiImgFrameInfo* rgb,
+                                          const DaiProjectionOptions* options,
+                                          DaiPoint3fRGBA* out,
+                                          size_t capacity) {
+    if(!out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_depth_projector_project_points: null out");
+        return 0;
+    }
+    _DaiProjectPointsOut points{out};
+    return _dai_depth_project("dai_depth_projector_project_points", projector, depth, rgb, options, capacity, points);
+}
+
+size_t dai_depth_projector_grid_size(DaiDepthProjector projector, uint32_t decimation) {
+    if(!projector) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_depth_projector_grid_size: null projector");
+        return 0;
+    }
+    auto proj = static_cast<_DaiDepthProjector*>(projector);
+    const size_t dec = decimation ? decimation : 1;
+    return proj->outWidth(dec) * proj->outHeight(dec);
+}
+
+void dai_depth_projector_release(DaiDepthProjector projector) {
+    delete static_cast<_DaiDepthProjector*>(projector);
+}
+
+// Distortion coefficients the remap uses; `_DaiRemapCamera::k` has no room for tauX / tauY.
+static int32_t _dai_remap_distortion_count(const DaiCameraIntrinsics& in) {
+    return std::clamp<int32_t>(in.distortion_count, 0, 12);
+}
+
+static _DaiRemapCamera _dai_remap_camera(const DaiCameraIntrinsics& in) {
+    _DaiRemapCamera c;
+    c.fx = in.fx;
+    c.fy = in.fy;
+    c.cx = in.cx;
+    c.cy = in.cy;
+    const int32_t count = _dai_remap_distortion_count(in);
+    for(int32_t i = 0; i < count; ++i) c.k[i] = in.distortion[i];
+    return c;
+}
+
+// Hashes what the maps depend on, so stale coefficients past `distortion_count` do not split
+// the cache.
+static uint64_t _dai_remap_hash_intrinsics(uint64_t h, const DaiCameraIntrinsics& in) {
+    const int32_t count = _dai_remap_distortion_count(in);
+    const float pinhole[4] = {in.fx, in.fy, in.cx, in.cy};
+    const int32_t size[3] = {in.width, in.height, count};
+    h = _dai_fnv1a(h, pinhole, sizeof(pinhole));
+    h = _dai_fnv1a(h, size, sizeof(size));
+    return _dai_fnv1a(h, in.distortion, count * sizeof(float));
+}
+
+DaiRemapTable dai_remap_table_get(int socket,
+                                  uint64_t calibration_hash,
+                                  const DaiCameraIntrinsics* camera,
+                                  const float* rotation,
+                                  const DaiCameraIntrinsics* target,
+                                  bool* out_cache_hit) {
+    if(!camera) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_remap_table_get: null camera");
+        return nullptr;
+    }
+    const DaiCameraIntrinsics& out = target ? *target : *camera;
+    if(camera->width <= 0 || camera->height <= 0 || out.width <= 0 || out.height <= 0 || camera->fx == 0.0f || camera->fy == 0.0f
+       || out.fx == 0.0f || out.fy == 0.0f) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_table_get: invalid intrinsics");
+        return nullptr;
+    }
+    if(camera->width > 32767 || camera->height > 32767) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_table_get: source larger than 32767 pixels");
+        return nullptr;
+    }
+    try {
+        _DaiRemapCacheKey key{socket,
+                              static_cast<uint32_t>(out.width),
+                              static_cast<uint32_t>(out.height),
+                              static_cast<uint32_t>(camera->width),
+                              static_cast<uint32_t>(camera->height),
+                              calibration_hash,
+                              14695981039346656037ull};
+        key.paramsHash = _dai_remap_hash_intrinsics(key.paramsHash, *camera);
+        key.paramsHash = _dai_remap_hash_intrinsics(key.paramsHash, out);
+        if(rotation) key.paramsHash = _dai_fnv1a(key.paramsHash, rotation, 9 * sizeof(float));
+        bool hit = false;
+        auto table = _DaiRemapCache::instance().get(
+            key,
+            [&] {
+                double r[9];
+                if(rotation) std::copy(rotation, rotation + 9, r);
+                return std::make_shared<_DaiRemapTable>(_dai_remap_camera(*camera),
+                                                        rotation ? r : nullptr,
+                                                        _dai_remap_camera(out),
+                                                        key.width,
+                                                        key.height,
+                                                        key.srcWidth,
+                                                        key.srcHeight);
+            },
+            hit);
+        if(out_cache_hit) *out_cache_hit = hit;
+        return static_cast<DaiRemapTable>(_dai_new_handle<_DaiRemapTable>(std::move(table)));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_remap_table_get failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_remap_table_get_size(DaiRemapTable table, uint32_t* width, uint32_t* height) {
+    if(!table) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_remap_table_get_size: null table");
+        return;
+    }
+    auto t = *static_cast<std::shared_ptr<_DaiRemapTable>*>(table);
+    if(width) *width = static_cast<uint32_t>(t->width);
+    if(height) *height = static_cast<uint32_t>(t->height);
+}
+
+size_t dai_remap_apply(DaiRemapTable table, const DaiImgFrameInfo* src, void* dst, size_t dst_capacity, bool nearest) {
+    using T = dai::ImgFrame::Type;
+    if(!table || !src || !dst) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_remap_apply: null table/src/dst");
+        return 0;
+    }
+    const auto& t = *static_cast<std::shared_ptr<_DaiRemapTable>*>(table);
+    size_t bpp = 0;
+    switch(static_cast<T>(src->type)) {
+        case T::GRAY8:
+        case T::RAW8:
+            bpp = 1;
+            break;
+        case T::RAW16:
+            bpp = 2;
+            break;
+        case T::RGB888i:
+        case T::BGR888i:
+            bpp = 3;
+            break;
+        default:
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_apply: unsupported frame type");
+            return 0;
+    }
+    if(static_cast<size_t>(src->width) != t->srcWidth || static_cast<size_t>(src->height) != t->srcHeight || !src->data) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_apply: source size does not match the table");
+        return 0;
+    }
+    const size_t stride = src->stride ? src->stride : t->srcWidth * bpp;
+    if(stride < t->srcWidth * bpp || (t->srcHeight - 1) * stride + t->srcWidth * bpp > src->size) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_apply: source buffer too small");
+        return 0;
+    }
+    const size_t out_size = t->width * t->height * bpp;
+    if(dst_capacity < out_size) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_remap_apply: destination too small");
+        return 0;
+    }
+    try {
+        t->apply(static_cast<const uint8_t*>(src->data), stride, bpp, nearest, static_cast<uint8_t*>(dst));
+        return out_size;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_remap_apply failed: ") + e.what());
+        return 0;
+    }
+}
+
+void dai_remap_table_release(DaiRemapTable table) {
+    if(table) {
+        auto ptr = static_cast<std::shared_ptr<_DaiRemapTable>*>(table);
+        _dai_delete_handle(ptr);
+    }
+}
+
+size_t dai_remap_cache_size() {
+    return _DaiRemapCache::instance().size();
+}
+
+void dai_image_swap_rb_inplace(void* data, size_t pixels) {
+    if(!data) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_image_swap_rb_inplace: null data");
+        return;
+    }
+    auto bytes = static_cast<uint8_t*>(data);
+    _dai_px_swap_rb_row(bytes, bytes, pixels);
+}
+
+// Typed batch drains: pop up to `capacity` queued messages in one call. Messages of another
+// type are consumed and dropped, matching `MessageQueue::tryGet<T>()`. If a later pop throws,
+// the callers still report the handles already written so none of them leak.
+template <typename T, typename OnMessage>
+static size_t _dai_queue_drain(DaiDataQueue queue, size_t capacity, OnMessage&& on_message) {
+    auto ptr = static_cast<std::shared_ptr<dai::MessageQueue>*>(queue);
+    size_t count = 0;
+    while(count < capacity) {
+        auto msg = (*ptr)->tryGet();
+        if(!msg) break;
+        auto typed = std::dynamic_pointer_cast<T>(msg);
+        if(!typed) continue;
+        on_message(count, std::move(typed));
+        count++;
+    }
+    return count;
+}
+
+size_t dai_queue_try_drain_frames(DaiDataQueue queue, DaiImgFrame* out, DaiImgFrameInfo* out_info, size_t capacity) {
+    if(!queue || !out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_drain_frames: null queue/out");
+        return 0;
+    }
+    size_t count = 0;
+    try {
+        count = _dai_queue_drain<dai::ImgFrame>(queue, capacity, [&](size_t i, std::shared_ptr<dai::ImgFrame> frame) {
+            if(out_info) _dai_fill_frame_info(*frame, &out_info[i]);
+            out[i] = _dai_new_handle<dai::ImgFrame>(std::move(frame));
+            count = i + 1;
+        });
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_drain_frames failed: ") + e.what());
+    }
+    return count;
+}
+
+size_t dai_queue_try_drain_encoded_frames(DaiDataQueue queue, DaiEncodedFrame* out, size_t capacity) {
+    if(!queue || !out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_drain_encoded_frames: null queue/out");
+        return 0;
+    }
+    size_t count = 0;
+    try {
+        count = _dai_queue_drain<dai::EncodedFrame>(queue, capacity, [&](size_t i, std::shared_ptr<dai::EncodedFrame> frame) {
+            out[i] = _dai_new_handle<dai::EncodedFrame>(std::move(frame));
+            count = i + 1;
+        });
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_drain_encoded_frames failed: ") + e.what());
+    }
+    return count;
+}
+
+size_t dai_queue_try_drain_rgbd(DaiDataQueue queue, DaiRGBDData* out, size_t capacity) {
+    if(!queue || !out) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_queue_try_drain_rgbd: null queue/out");
+        return 0;
+    }
+    size_t count = 0;
+    try {
+        count = _dai_queue_drain<dai::RGBDData>(queue, capacity, [&](size_t i, std::shared_ptr<dai::RGBDData> rgbd) {
+            out[i] = _dai_new_handle<dai::RGBDData>(std::move(rgbd));
+            count = i + 1;
+        });
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_queue_try_drain_rgbd failed: ") + e.what());
+    }
+    return count;
+}
+
+bool dai_frame_set_format(DaiImgFrame frame, int width, int height, int type, size_t data_len) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_set_format: null frame");
+        return false;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        const auto& f = *sharedFrame;
+        if(!f) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_frame_set_format: invalid frame");
+            return false;
+        }
+        // Type first: setWidth derives the row stride from the current type's bytes per pixel.
+        f->setType(static_cast<dai::ImgFrame::Type>(type));
+        f->setWidth(static_cast<unsigned int>(width));
+        f->setHeight(static_cast<unsigned int>(height));
+        if(!f->data) {
+            f->setData(std::vector<std::uint8_t>(data_len));
+        } else {
+            f->data->setSize(data_len);
+        }
+        return true;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_set_format failed: ") + e.what());
+        return false;
+    }
+}
+
+void dai_frame_set_sequence_num(DaiImgFrame frame, int64_t seq) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_set_sequence_num: null frame");
+        return;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        if(!sharedFrame->get()) return;
+        (*sharedFrame)->setSequenceNum(seq);
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_set_sequence_num failed: ") + e.what());
+    }
+}
+
+void dai_frame_set_timestamp_now(DaiImgFrame frame) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_set_timestamp_now: null frame");
+        return;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        if(!sharedFrame->get()) return;
+        (*sharedFrame)->setTimestamp(std::chrono::steady_clock::now());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_set_timestamp_now failed: ") + e.what());
+    }
+}
+
+bool dai_frame_set_info(DaiImgFrame frame, const DaiImgFrameInfo* info) {
+    dai_clear_last_error();
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_set_info: null frame");
+        return false;
+    }
+    if(!info) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_frame_set_info: null info");
+        return false;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
+        const auto& f = *sharedFrame;
+        if(!f) {
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_frame_set_info: invalid frame");
+            return false;
+        }
+        const auto toSteady = [](int64_t ns) {
+            return std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(ns)));
+        };
+        // Applied after setWidth/setType, which reset the layout to the packed default.
+        f->fb.stride = info->stride;
+        f->fb.p1Offset = info->plane_offsets[0];
+        f->fb.p2Offset = info->plane_offsets[1];
+        f->fb.p3Offset = info->plane_offsets[2];
+        f->setSequenceNum(info->sequence_num);
+        f->setTimestamp(toSteady(info->timestamp_ns));
+        f->setTimestampDevice(toSteady(info->timestamp_device_ns));
+        f->setInstanceNum(static_cast<unsigned int>(std::max(info->instance_num, 0)));
+        return true;
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_frame_set_info failed: ") + e.what());
+        return false;
+    }
 }
 
 void dai_frame_release(DaiImgFrame frame) {
     if(frame) {
         auto ptr = static_cast<std::shared_ptr<dai::ImgFrame>*>(frame);
-        delete ptr;
+        _dai_delete_handle(ptr);
     }
 }
 
 void* dai_encoded_frame_get_data(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_data: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_data: null frame");
         return nullptr;
     }
     try {
@@ -4428,14 +8161,14 @@ void* dai_encoded_frame_get_data(DaiEncodedFrame frame) {
         }
         return (*sharedFrame)->getData().data();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_data failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_data failed: ") + e.what());
         return nullptr;
     }
 }
 
 size_t dai_encoded_frame_get_data_size(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_data_size: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_data_size: null frame");
         return 0;
     }
     try {
@@ -4445,14 +8178,14 @@ size_t dai_encoded_frame_get_data_size(DaiEncodedFrame frame) {
         }
         return (*sharedFrame)->getData().size();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_data_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_data_size failed: ") + e.what());
         return 0;
     }
 }
 
 uint32_t dai_encoded_frame_get_frame_offset(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_frame_offset: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_frame_offset: null frame");
         return 0;
     }
     try {
@@ -4462,14 +8195,14 @@ uint32_t dai_encoded_frame_get_frame_offset(DaiEncodedFrame frame) {
         }
         return (*sharedFrame)->frameOffset;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_frame_offset failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_frame_offset failed: ") + e.what());
         return 0;
     }
 }
 
 uint32_t dai_encoded_frame_get_frame_size(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_frame_size: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_frame_size: null frame");
         return 0;
     }
     try {
@@ -4479,14 +8212,14 @@ uint32_t dai_encoded_frame_get_frame_size(DaiEncodedFrame frame) {
         }
         return (*sharedFrame)->frameSize;
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_frame_size failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_frame_size failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_width(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_width: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_width: null frame");
         return 0;
     }
     try {
@@ -4496,14 +8229,14 @@ int dai_encoded_frame_get_width(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getWidth());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_width failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_width failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_height(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_height: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_height: null frame");
         return 0;
     }
     try {
@@ -4513,14 +8246,14 @@ int dai_encoded_frame_get_height(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getHeight());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_height failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_height failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_profile(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_profile: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_profile: null frame");
         return 0;
     }
     try {
@@ -4530,14 +8263,14 @@ int dai_encoded_frame_get_profile(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getProfile());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_profile failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_profile failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_frame_type(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_frame_type: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_frame_type: null frame");
         return 0;
     }
     try {
@@ -4547,14 +8280,14 @@ int dai_encoded_frame_get_frame_type(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getFrameType());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_frame_type failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_frame_type failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_quality(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_quality: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_quality: null frame");
         return 0;
     }
     try {
@@ -4564,14 +8297,14 @@ int dai_encoded_frame_get_quality(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getQuality());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_quality failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_quality failed: ") + e.what());
         return 0;
     }
 }
 
 int dai_encoded_frame_get_bitrate(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_bitrate: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_bitrate: null frame");
         return 0;
     }
     try {
@@ -4581,14 +8314,14 @@ int dai_encoded_frame_get_bitrate(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getBitrate());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_bitrate failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_bitrate failed: ") + e.what());
         return 0;
     }
 }
 
 bool dai_encoded_frame_get_lossless(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_lossless: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_lossless: null frame");
         return false;
     }
     try {
@@ -4598,14 +8331,14 @@ bool dai_encoded_frame_get_lossless(DaiEncodedFrame frame) {
         }
         return (*sharedFrame)->getLossless();
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_lossless failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_lossless failed: ") + e.what());
         return false;
     }
 }
 
 int dai_encoded_frame_get_instance_num(DaiEncodedFrame frame) {
     if(!frame) {
-        last_error = "dai_encoded_frame_get_instance_num: null frame";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_instance_num: null frame");
         return 0;
     }
     try {
@@ -4615,7 +8348,58 @@ int dai_encoded_frame_get_instance_num(DaiEncodedFrame frame) {
         }
         return static_cast<int>((*sharedFrame)->getInstanceNum());
     } catch(const std::exception& e) {
-        last_error = std::string("dai_encoded_frame_get_instance_num failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_instance_num failed: ") + e.what());
+        return 0;
+    }
+}
+
+int64_t dai_encoded_frame_get_sequence_num(DaiEncodedFrame frame) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_sequence_num: null frame");
+        return 0;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
+        if(!sharedFrame->get()) {
+            return 0;
+        }
+        return static_cast<int64_t>((*sharedFrame)->getSequenceNum());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_sequence_num failed: ") + e.what());
+        return 0;
+    }
+}
+
+int64_t dai_encoded_frame_get_timestamp_ns(DaiEncodedFrame frame) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_timestamp_ns: null frame");
+        return 0;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
+        if(!sharedFrame->get()) {
+            return 0;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>((*sharedFrame)->getTimestamp().time_since_epoch()).count();
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_timestamp_ns failed: ") + e.what());
+        return 0;
+    }
+}
+
+int64_t dai_encoded_frame_get_timestamp_device_ns(DaiEncodedFrame frame) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_get_timestamp_device_ns: null frame");
+        return 0;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
+        if(!sharedFrame->get()) {
+            return 0;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>((*sharedFrame)->getTimestampDevice().time_since_epoch()).count();
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_get_timestamp_device_ns failed: ") + e.what());
         return 0;
     }
 }
@@ -4623,20 +8407,68 @@ int dai_encoded_frame_get_instance_num(DaiEncodedFrame frame) {
 void dai_encoded_frame_release(DaiEncodedFrame frame) {
     if(frame) {
         auto ptr = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
-        delete ptr;
+        _dai_delete_handle(ptr);
+    }
+}
+
+DaiEncodedFrame dai_encoded_frame_create(const void* data, size_t len, const DaiEncodedFrameInfo* info) {
+    if((!data && len != 0) || !info) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_create: null data or info");
+        return nullptr;
+    }
+    if(len > std::numeric_limits<uint32_t>::max()) {
+        last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_encoded_frame_create: payload too large");
+        return nullptr;
+    }
+    try {
+        const auto toSteady = [](int64_t ns) {
+            return std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(ns)));
+        };
+        auto frame = std::make_shared<dai::EncodedFrame>();
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        frame->setData(std::vector<uint8_t>(bytes, bytes + len));
+        frame->frameOffset = 0;
+        frame->frameSize = static_cast<uint32_t>(len);
+        frame->setWidth(static_cast<unsigned int>(std::max(info->width, 0)));
+        frame->setHeight(static_cast<unsigned int>(std::max(info->height, 0)));
+        frame->setProfile(static_cast<dai::EncodedFrame::Profile>(info->profile));
+        frame->setFrameType(static_cast<dai::EncodedFrame::FrameType>(info->frame_type));
+        frame->setInstanceNum(info->instance_num);
+        frame->setSequenceNum(info->sequence_num);
+        frame->setTimestamp(toSteady(info->timestamp_ns));
+        frame->setTimestampDevice(toSteady(info->timestamp_device_ns));
+        return _dai_new_handle<dai::EncodedFrame>(std::move(frame));
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_create failed: ") + e.what());
+        return nullptr;
+    }
+}
+
+void dai_encoded_frame_set_timestamp_now(DaiEncodedFrame frame) {
+    if(!frame) {
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_encoded_frame_set_timestamp_now: null frame");
+        return;
+    }
+    try {
+        auto sharedFrame = static_cast<std::shared_ptr<dai::EncodedFrame>*>(frame);
+        if(!sharedFrame->get()) return;
+        (*sharedFrame)->setTimestamp(std::chrono::steady_clock::now());
+    } catch(const std::exception& e) {
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_encoded_frame_set_timestamp_now failed: ") + e.what());
     }
 }
 
 // Low-level utility functions  
 int dai_device_get_connected_camera_sockets(DaiDevice device, int* sockets, int max_count) {
     if (!device || !sockets) {
-        last_error = "dai_device_get_connected_camera_sockets: null device or sockets";
+        last_error.set(DAI_ERROR_NULL_ARGUMENT, "dai_device_get_connected_camera_sockets: null device or sockets");
         return 0;
     }
     try {
         auto dev = static_cast<std::shared_ptr<dai::Device>*>(device);
         if(!dev->get() || !(*dev)) {
-            last_error = "dai_device_get_connected_camera_sockets: invalid device";
+            last_error.set(DAI_ERROR_INVALID_ARGUMENT, "dai_device_get_connected_camera_sockets: invalid device");
             return 0;
         }
         auto connected = (*dev)->getConnectedCameras();
@@ -4648,7 +8480,7 @@ int dai_device_get_connected_camera_sockets(DaiDevice device, int* sockets, int
         }
         return count;
     } catch (const std::exception& e) {
-        last_error = std::string("dai_device_get_connected_camera_sockets failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_device_get_connected_camera_sockets failed: ") + e.what());
         return 0;
     }
 }
@@ -4659,7 +8491,7 @@ const char* dai_camera_socket_name(int socket) {
         static std::string name = toString(board_socket);
         return name.c_str();
     } catch (const std::exception& e) {
-        last_error = std::string("dai_camera_socket_name failed: ") + e.what();
+        last_error.set(DAI_ERROR_EXCEPTION, std::string("dai_camera_socket_name failed: ") + e.what());
         return "UNKNOWN";
     }
 }
@@ -4672,6 +8504,10 @@ const char* dai_get_last_error() {
     return last_error.c_str();
 }
 
+int dai_get_last_error_code() {
+    return last_error.code;
+}
+
 void dai_clear_last_error() {
     last_error.clear();
 }
@@ -39,7 +39,17 @@ API const char* dai_build_device_rvc4_version();
 API char* dai_string_to_cstring(const char* str);
 API void dai_free_cstring(char* cstring);
 
+// Opt-in telemetry (process-wide). Only queues and Rust host nodes created while enabled are
+// tracked. The snapshot is a JSON document; free it with dai_free_cstring.
+API void dai_telemetry_set_enabled(bool enabled);
+API bool dai_telemetry_is_enabled();
+API void dai_telemetry_reset();
+API char* dai_telemetry_snapshot_json();
+
 // Opaque handle types
+//
+// `std::shared_ptr<...>*` handles live in a wrapper-side slab allocator; always release them via
+// the matching `dai_*_release` / `dai_*_delete` function.
 typedef void* DaiDevice;      // currently: `std::shared_ptr<dai::Device>*`
 typedef void* DaiPipeline;    // currently: `dai::Pipeline*`
 typedef void* DaiNode;        // currently: `dai::Node*` (derived node instance)
@@ -50,11 +60,18 @@ typedef void* DaiDataQueue;   // currently: `std::shared_ptr<dai::MessageQueue>*
 typedef void* DaiDatatype;    // currently: `std::shared_ptr<dai::ADatatype>*`
 typedef void* DaiImgFrame;    // currently: `std::shared_ptr<dai::ImgFrame>*`
 typedef void* DaiEncodedFrame; // currently: `std::shared_ptr<dai::EncodedFrame>*`
-typedef void* DaiPointCloud;  // currently: wrapper-owned view of `std::shared_ptr<dai::PointCloudData>`
+typedef void* DaiPointCloud;  // currently: wrapper-owned view of `std::shared_ptr<dai::PointCloudData>` (borrows its buffer when possible)
 typedef void* DaiRGBDData;    // currently: `std::shared_ptr<dai::RGBDData>*`
 typedef void* DaiMessageGroup; // currently: `std::shared_ptr<dai::MessageGroup>*`
 typedef void* DaiBuffer;       // currently: `std::shared_ptr<dai::Buffer>*`
 typedef void* DaiInputQueue;   // currently: `std::shared_ptr<dai::InputQueue>*`
+typedef void* DaiQueueWaitSet; // currently: `_DaiQueueWaitSet*` (wake-up callbacks registered on several queues)
+typedef void* DaiBufferPool;   // currently: `std::shared_ptr<_DaiBufferPool>*` (recycles Buffer / ImgFrame messages)
+typedef void* DaiGroupLayout;  // currently: `_DaiGroupLayout*` (MessageGroup member names resolved by index)
+typedef void* DaiGraphSnapshot; // currently: `_DaiGraphSnapshot*` (flat node/port/connection tables of one pipeline)
+typedef void* DaiManipTemplate; // currently: `std::shared_ptr<_DaiManipTemplate>*` (recycled ImageManipConfigs built from one op chain)
+typedef void* DaiRemapTable; // currently: `std::shared_ptr<_DaiRemapTable>*` (shared fixed-point undistort / rectify maps)
+typedef void* DaiDepthProjector; // currently: `_DaiDepthProjector*` (ray tables + worker pool for host depth projection)
 
 // Opaque handle to a heap-allocated array of `DaiDatatype` handles.
 //
@@ -81,12 +98,96 @@ typedef struct DaiPoint3fRGBA {
 	unsigned char a;
 } DaiPoint3fRGBA;
 
+// POD snapshot of the `dai::ImgFrame` fields consumers need per frame, filled by
+// `dai_frame_get_info` in a single call. `data` stays valid while the frame handle is alive.
+typedef struct DaiImgFrameInfo {
+	const void* data;
+	size_t size;
+	int width;
+	int height;
+	int type;
+	unsigned int stride;
+	unsigned int bytes_per_pixel;
+	unsigned int plane_offsets[3];
+	int64_t sequence_num;
+	int64_t timestamp_ns;         // host-synced steady clock
+	int64_t timestamp_device_ns;  // device clock
+	int instance_num;
+	int exposure_us;
+	int sensitivity;
+	int lens_position;
+} DaiImgFrameInfo;
+
+// Metadata for `dai_encoded_frame_create`; `profile` / `frame_type` use the `EncodedFrame`
+// enum values.
+typedef struct DaiEncodedFrameInfo {
+	int width;
+	int height;
+	int profile;
+	int frame_type;
+	unsigned int instance_num;
+	int64_t sequence_num;
+	int64_t timestamp_ns;         // host-synced steady clock
+	int64_t timestamp_device_ns;  // device clock
+} DaiEncodedFrameInfo;
+
+// Pipeline graph snapshot records (see `dai_pipeline_graph_snapshot`). Strings are
+// `offset`/`len` ranges into the snapshot string pool, not NUL-terminated.
+typedef struct DaiStrRef {
+	uint32_t offset;
+	uint32_t len;
+} DaiStrRef;
+
+typedef struct DaiGraphNode {
+	int id;
+	DaiStrRef name;
+	DaiStrRef alias;
+	uint32_t first_port;  // index into the port table
+	uint32_t port_count;
+} DaiGraphNode;
+
+typedef struct DaiGraphPort {
+	int node_id;
+	int is_output;
+	DaiStrRef group;
+	DaiStrRef name;
+} DaiGraphPort;
+
+typedef struct DaiGraphConnection {
+	int output_id;
+	DaiStrRef output_group;
+	DaiStrRef output_name;
+	int input_id;
+	DaiStrRef input_group;
+	DaiStrRef input_name;
+} DaiGraphConnection;
+
+// Counters of a latest-only queue (see `dai_output_create_latest_queue`).
+typedef struct DaiConflationStats {
+	uint64_t received;     // messages that arrived on the queue
+	uint64_t overwritten;  // arrivals that replaced an unread message
+	uint64_t coalesced;    // messages a callback skipped because a newer one arrived first
+} DaiConflationStats;
+
 // Low-level device operations
 API DaiDevice dai_device_new();
 API DaiDevice dai_device_clone(DaiDevice device);
 API void dai_device_delete(DaiDevice device);
 API bool dai_device_is_closed(DaiDevice device);
 API void dai_device_close(DaiDevice device);
+// Enumerates connected devices as a JSON array of {device_id, name, state, protocol}.
+// Free with dai_free_cstring.
+API char* dai_device_list_json();
+// Opens the device with this device id (MXID), IP address or USB path. Unlike dai_device_new this
+// does not use (or lock) the process-wide default device.
+API DaiDevice dai_device_open(const char* id);
+// Opens `count` devices concurrently. `out[i]` is null for devices that failed; when `out_errors`
+// is not null, `out_errors[i]` then holds the reason (free with dai_free_cstring), and when
+// `out_codes` is not null, `out_codes[i]` holds its DaiErrorCode (DAI_OK for opened devices; an
+// id that is not connected is DAI_ERROR_NOT_FOUND). Returns the number of devices opened.
+API size_t dai_device_open_many(const char* const* ids, size_t count, DaiDevice* out, char** out_errors, int* out_codes);
+// Returned strings must be freed with dai_free_cstring.
+API char* dai_device_get_device_id(DaiDevice device);
 
 // Low-level pipeline operations  
 API DaiPipeline dai_pipeline_new();
@@ -94,6 +195,9 @@ API DaiPipeline dai_pipeline_new_ex(bool create_implicit_device);
 API DaiPipeline dai_pipeline_new_with_device(DaiDevice device);
 API void dai_pipeline_delete(DaiPipeline pipeline);
 API bool dai_pipeline_start(DaiPipeline pipeline);
+// Starts (builds and uploads) `count` pipelines concurrently, typically one per device.
+// Per-pipeline failures are reported like dai_device_open_many. Returns the number started.
+API size_t dai_pipeline_start_many(DaiPipeline* pipelines, size_t count, char** out_errors, int* out_codes);
 
 // Pipeline lifecycle / status
 API bool dai_pipeline_is_running(DaiPipeline pipeline);
@@ -124,6 +228,20 @@ API DaiNode dai_pipeline_get_node_by_id(DaiPipeline pipeline, int id);
 API bool dai_pipeline_remove_node(DaiPipeline pipeline, DaiNode node);
 API char* dai_pipeline_get_connections_json(DaiPipeline pipeline);
 API char* dai_pipeline_get_connection_map_json(DaiPipeline pipeline);
+// Graph version: changes whenever the pipeline's nodes, ports or connections change, however
+// the change was made (node build helpers included). Derived from a hash of the structure, so
+// polling walks the graph but copies nothing.
+API uint64_t dai_pipeline_graph_version(DaiPipeline pipeline);
+// Copies nodes, ports and connections into flat tables. Returns nullptr without an error when
+// `known_version` is non-zero and equals the current graph version; the graph is hashed either
+// way, the match only saves building the tables.
+API DaiGraphSnapshot dai_pipeline_graph_snapshot(DaiPipeline pipeline, uint64_t known_version);
+API void dai_graph_snapshot_release(DaiGraphSnapshot snapshot);
+API uint64_t dai_graph_snapshot_version(DaiGraphSnapshot snapshot);
+API const DaiGraphNode* dai_graph_snapshot_nodes(DaiGraphSnapshot snapshot, size_t* count);
+API const DaiGraphPort* dai_graph_snapshot_ports(DaiGraphSnapshot snapshot, size_t* count);
+API const DaiGraphConnection* dai_graph_snapshot_connections(DaiGraphSnapshot snapshot, size_t* count);
+API const char* dai_graph_snapshot_strings(DaiGraphSnapshot snapshot, size_t* len);
 
 // Calibration data helpers (JSON)
 // Returned strings must be freed with dai_free_cstring.
@@ -154,6 +272,17 @@ API DaiNode dai_pipeline_create_host_node(DaiPipeline pipeline,
                                           DaiHostNodeCallback on_start_cb,
                                           DaiHostNodeCallback on_stop_cb,
                                           DaiHostNodeCallback drop_cb);
+// Like `dai_pipeline_create_host_node`, but `process_cb` runs concurrently on `workers` threads
+// (it must be thread-safe) and results are sent on `out` in input order. At most `max_in_flight`
+// groups (clamped to at least `workers`) are buffered before the node stops taking input.
+API DaiNode dai_pipeline_create_host_node_parallel(DaiPipeline pipeline,
+                                                   void* ctx,
+                                                   DaiHostNodeProcessGroup process_cb,
+                                                   DaiHostNodeCallback on_start_cb,
+                                                   DaiHostNodeCallback on_stop_cb,
+                                                   DaiHostNodeCallback drop_cb,
+                                                   size_t workers,
+                                                   size_t max_in_flight);
 API DaiNode dai_pipeline_create_threaded_host_node(DaiPipeline pipeline,
                                                    void* ctx,
                                                    DaiThreadedHostNodeRun run_cb,
@@ -229,6 +358,22 @@ API void dai_image_align_set_run_on_host(DaiNode align, bool run_on_host);
 API void dai_image_align_set_output_size(DaiNode align, int width, int height);
 API void dai_image_align_set_out_keep_aspect_ratio(DaiNode align, bool keep);
 
+// BenchmarkOut / BenchmarkIn node helpers
+API void dai_benchmark_out_set_num_messages_to_send(DaiNode bench, int num);
+API void dai_benchmark_out_set_fps(DaiNode bench, float fps);
+API void dai_benchmark_out_set_run_on_host(DaiNode bench, bool run_on_host);
+API void dai_benchmark_in_send_report_every_n_messages(DaiNode bench, uint32_t num);
+API void dai_benchmark_in_set_run_on_host(DaiNode bench, bool run_on_host);
+API void dai_benchmark_in_log_reports_as_warnings(DaiNode bench, bool log_as_warnings);
+API void dai_benchmark_in_measure_individual_latencies(DaiNode bench, bool measure);
+
+// ImageFilters node helpers
+API void dai_image_filters_set_default_profile_preset(DaiNode filters, int preset_mode);
+API void dai_image_filters_set_run_on_host(DaiNode filters, bool run_on_host);
+// `k`x`k` median (k = 3, 5 or 7) of u16 `src` into `dst` with edge pixels replicated, as run by
+// the host ImageFilters median stage. Strides are in pixels. Returns false with an error set.
+API bool dai_depth_median(const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t width, size_t height, int k);
+
 // ImageManip node helpers
 API void dai_image_manip_set_num_frames_pool(DaiNode manip, int num_frames_pool);
 API void dai_image_manip_set_max_output_frame_size(DaiNode manip, int max_frame_size);
@@ -292,6 +437,62 @@ API void dai_image_manip_config_set_reuse_previous_image(DaiBuffer cfg, bool reu
 API void dai_image_manip_config_set_skip_current_image(DaiBuffer cfg, bool skip);
 API bool dai_image_manip_config_get_reuse_previous_image(DaiBuffer cfg);
 API bool dai_image_manip_config_get_skip_current_image(DaiBuffer cfg);
+// Whether a `Buffer` handle (e.g. one taken off a host input) holds an `ImageManipConfig`.
+API bool dai_buffer_is_image_manip_config(DaiBuffer buffer);
+
+// ImageManipConfig templates
+//
+// A template captures an operation chain plus the output settings of a config once. Instances
+// are recycled configs refilled from the template, with the ROI slot ops taking their values
+// from a `DaiManipRoi`, so a per-frame crop costs one call and no fresh config allocation.
+enum DaiManipOpKind {
+    DAI_MANIP_OP_CROP_XYWH = 0,         // params: x, y, w, h (pixels)
+    DAI_MANIP_OP_CROP_RECT = 1,         // params: x, y, w, h
+    DAI_MANIP_OP_CROP_ROTATED_RECT = 2, // params: cx, cy, w, h, angle_deg
+    DAI_MANIP_OP_SCALE = 3,             // params: scale_x, scale_y
+    DAI_MANIP_OP_ROTATE = 4,            // params: angle_deg
+    DAI_MANIP_OP_ROTATE_CENTER = 5,     // params: angle_deg, center_x, center_y (normalized)
+    DAI_MANIP_OP_FLIP_HORIZONTAL = 6,
+    DAI_MANIP_OP_FLIP_VERTICAL = 7,
+    DAI_MANIP_OP_AFFINE = 8,            // params: 2x2 matrix
+    DAI_MANIP_OP_PERSPECTIVE = 9,       // params: 3x3 matrix
+    DAI_MANIP_OP_FOUR_POINTS = 10,      // params: src x0,y0..x3,y3 then dst x0,y0..x3,y3
+    DAI_MANIP_OP_ROI_CROP = 11,         // crop to the ROI rect (x, y = top-left)
+    DAI_MANIP_OP_ROI_CROP_ROTATED = 12, // crop to the ROI as a rotated rect (x, y = center)
+    DAI_MANIP_OP_ROI_ROTATE = 13,       // rotate by the ROI angle
+};
+
+typedef struct DaiManipOp {
+	int32_t kind;      // DaiManipOpKind
+	bool normalized;   // coordinates are normalized to [0, 1]
+	float params[16];
+} DaiManipOp;
+
+typedef struct DaiManipRoi {
+	float x;
+	float y;
+	float width;
+	float height;
+	float angle_deg;
+} DaiManipRoi;
+
+// `settings` (may be NULL) provides output size, resize mode, colormap, frame type etc.; its own
+// operations are ignored. At most `max_free` idle instances are kept for reuse.
+API DaiManipTemplate dai_manip_template_new(DaiBuffer settings, const DaiManipOp* ops, size_t count, size_t max_free);
+API void dai_manip_template_release(DaiManipTemplate tpl);
+// Returns a config (ImageManipConfig behind a Buffer handle) for one ROI.
+API DaiBuffer dai_manip_template_instantiate(DaiManipTemplate tpl, const DaiManipRoi* roi);
+// Sends `frame` to `image_queue` (both may be NULL to crop the image the node already holds),
+// then one config per ROI to `config_queue`; every config after the first reuses the previous
+// image. The ImageManip node's config input must wait for messages. Returns the configs sent.
+API size_t dai_manip_template_send_rois(DaiManipTemplate tpl,
+                                        DaiInputQueue config_queue,
+                                        DaiInputQueue image_queue,
+                                        DaiImgFrame frame,
+                                        const DaiManipRoi* rois,
+                                        size_t count);
+// Configs currently allocated by the template (in flight plus idle).
+API size_t dai_manip_template_get_allocated(DaiManipTemplate tpl);
 
 // Low-level camera node operations
 API DaiCameraNode dai_pipeline_create_camera(DaiPipeline pipeline, int board_socket);
@@ -329,6 +530,12 @@ API bool dai_camera_get_outputs_max_size_pool(DaiCameraNode camera, size_t* out_
 
 // Low-level output operations
 API DaiDataQueue dai_output_create_queue(DaiOutput output, unsigned int max_size, bool blocking);
+// Latest-only queue: one non-blocking slot that each arrival replaces, counting overwrites.
+// Callbacks added with `dai_queue_add_callback` run on their own worker thread and see only the
+// newest message, so a slow callback skips stale ones instead of stalling DepthAI's thread.
+API DaiDataQueue dai_output_create_latest_queue(DaiOutput output);
+// Fills `out` and returns true for latest-only queues; returns false for other queues.
+API bool dai_queue_get_conflation_stats(DaiDataQueue queue, DaiConflationStats* out);
 
 // Low-level queue operations
 API void dai_queue_delete(DaiDataQueue queue);
@@ -357,11 +564,36 @@ API DaiDatatypeArray dai_queue_get_all(DaiDataQueue queue, int timeout_ms, bool*
 // Queue callbacks
 API int dai_queue_add_callback(DaiDataQueue queue, void* ctx, uintptr_t cb, uintptr_t drop_cb);
 API bool dai_queue_remove_callback(DaiDataQueue queue, int callback_id);
+// Wake-only notification: `wake_cb(ctx)` (a `DaiHostNodeCallback`) runs on DepthAI's thread for
+// every message, without creating a handle. The queue is not consumed; callers poll it afterwards.
+// DepthAI notifies before it pushes; a wake that would find the queue empty is held back until
+// the message is visible to `try_get` (bounded to ~10 ms), so one wake per message suffices.
+// Remove with `dai_queue_remove_callback`; `drop_cb(ctx)` runs once the callback is destroyed.
+API int dai_queue_add_wake_callback(DaiDataQueue queue, void* ctx, uintptr_t wake_cb, uintptr_t drop_cb);
+
+// Multi-queue wait
+//
+// Blocks until at least one queue has a message (or is closed), or the timeout expires
+// (`timeout_ms < 0` waits forever). Returns the number of ready queues, 0 on timeout and -1 on
+// error; `ready` (may be NULL) receives one flag per queue. Messages are not consumed.
+// A wait set registers its wake-up callbacks once and can be waited on repeatedly;
+// `dai_queue_wait_any` is the one-shot form.
+API DaiQueueWaitSet dai_queue_waitset_new(const DaiDataQueue* queues, size_t count);
+API void dai_queue_waitset_release(DaiQueueWaitSet ws);
+API size_t dai_queue_waitset_len(DaiQueueWaitSet ws);
+API int dai_queue_waitset_wait(DaiQueueWaitSet ws, int timeout_ms, bool* ready);
+API int dai_queue_wait_any(const DaiDataQueue* queues, size_t count, int timeout_ms, bool* ready);
 
 // Queue send helpers (mirrors depthai::MessageQueue)
 API void dai_queue_send(DaiDataQueue queue, DaiDatatype msg);
 API bool dai_queue_send_timeout(DaiDataQueue queue, DaiDatatype msg, int timeout_ms);
 API bool dai_queue_try_send(DaiDataQueue queue, DaiDatatype msg);
+// Sends `msgs` in order in one call and returns how many were accepted. `timeout_ms` < 0 blocks
+// on every message, 0 try-sends each one, and > 0 is one deadline for the whole batch. A null or
+// empty handle fails the call before anything is sent. The batch stops at the first message that
+// is not accepted in time (error code DAI_ERROR_TIMEOUT, no message) or whose send throws; the
+// messages before it stay sent.
+API size_t dai_queue_send_many(DaiDataQueue queue, const DaiDatatype* msgs, size_t count, int timeout_ms);
 
 API DaiImgFrame dai_queue_get_frame(DaiDataQueue queue, int timeout_ms);
 API DaiImgFrame dai_queue_try_get_frame(DaiDataQueue queue);
@@ -369,6 +601,13 @@ API DaiImgFrame dai_queue_try_get_frame(DaiDataQueue queue);
 API DaiEncodedFrame dai_queue_get_encoded_frame(DaiDataQueue queue, int timeout_ms);
 API DaiEncodedFrame dai_queue_try_get_encoded_frame(DaiDataQueue queue);
 
+// Typed batch drains: pop up to `capacity` queued messages into caller-owned arrays in one call
+// and return how many were written. `out_info` (may be NULL) receives per-frame metadata.
+// Each returned handle must be released individually.
+API size_t dai_queue_try_drain_frames(DaiDataQueue queue, DaiImgFrame* out, DaiImgFrameInfo* out_info, size_t capacity);
+API size_t dai_queue_try_drain_encoded_frames(DaiDataQueue queue, DaiEncodedFrame* out, size_t capacity);
+API size_t dai_queue_try_drain_rgbd(DaiDataQueue queue, DaiRGBDData* out, size_t capacity);
+
 // Message retrieval for non-ImgFrame outputs
 API DaiPointCloud dai_queue_get_pointcloud(DaiDataQueue queue, int timeout_ms);
 API DaiPointCloud dai_queue_try_get_pointcloud(DaiDataQueue queue);
@@ -385,6 +624,8 @@ API DaiPointCloud dai_datatype_as_pointcloud(DaiDatatype msg);
 API DaiRGBDData dai_datatype_as_rgbd(DaiDatatype msg);
 API DaiBuffer dai_datatype_as_buffer(DaiDatatype msg);
 API DaiMessageGroup dai_datatype_as_message_group(DaiDatatype msg);
+// Returns nullptr without setting an error when msg is not a BenchmarkReport. Free with dai_free_cstring.
+API char* dai_datatype_benchmark_report_json(DaiDatatype msg);
 API size_t dai_datatype_array_len(DaiDatatypeArray arr);
 API DaiDatatype dai_datatype_array_take(DaiDatatypeArray arr, size_t index);
 API void dai_datatype_array_free(DaiDatatypeArray arr);
@@ -394,8 +635,100 @@ API int dai_pointcloud_get_width(DaiPointCloud pcl);
 API int dai_pointcloud_get_height(DaiPointCloud pcl);
 API const DaiPoint3fRGBA* dai_pointcloud_get_points_rgba(DaiPointCloud pcl);
 API size_t dai_pointcloud_get_points_rgba_len(DaiPointCloud pcl);
+// Byte distance between consecutive points returned by `dai_pointcloud_get_points_rgba`.
+API size_t dai_pointcloud_get_points_rgba_stride(DaiPointCloud pcl);
+// True when the points borrow the message buffer instead of a wrapper-side copy.
+API bool dai_pointcloud_is_zero_copy(DaiPointCloud pcl);
+// Copies points into caller-provided structure-of-arrays planes in a single pass.
+// Any output plane may be NULL to skip it; colors are packed as 0xRRGGBBAA.
+// `decimation` keeps every Nth point (on both image axes for organized clouds), points with
+// z outside [z_min, z_max] are dropped, and z == 0 points are dropped when `skip_invalid`.
+// Returns the number of points written (at most `capacity`).
+API size_t dai_pointcloud_fill_soa(DaiPointCloud pcl,
+                                   float* out_x,
+                                   float* out_y,
+                                   float* out_z,
+                                   uint32_t* out_rgba,
+                                   size_t capacity,
+                                   uint32_t decimation,
+                                   float z_min,
+                                   float z_max,
+                                   bool skip_invalid);
 API void dai_pointcloud_release(DaiPointCloud pcl);
 
+// Host depth projection
+//
+// Pinhole intrinsics of the camera the depth frame is aligned to, already scaled to the depth
+// resolution. `distortion` uses the OpenCV order (k1, k2, p1, p2, k3, k4, k5, k6, s1..s4).
+typedef struct DaiCameraIntrinsics {
+	float fx;
+	float fy;
+	float cx;
+	float cy;
+	int32_t width;
+	int32_t height;
+	float distortion[14];
+	int32_t distortion_count;
+} DaiCameraIntrinsics;
+
+typedef struct DaiProjectionOptions {
+	float depth_scale;   // depth unit in output units (0.001 for millimetres -> metres)
+	uint32_t decimation; // keep every Nth pixel on both axes
+	float z_min;
+	float z_max;
+	bool skip_invalid;   // drop zero / out-of-range pixels instead of emitting (0, 0, 0)
+} DaiProjectionOptions;
+
+// Precomputes per-pixel rays once; `undistort` inverts the lens distortion into the table.
+// `threads` == 0 uses all hardware threads.
+API DaiDepthProjector dai_depth_projector_new(const DaiCameraIntrinsics* intrinsics, bool undistort, uint32_t threads);
+// Projects a RAW16 depth frame matching the intrinsics resolution. `rgb` may be NULL; otherwise
+// it is sampled nearest-neighbour onto the depth grid (RGB888i / BGR888i are read directly, other
+// formats are converted first). Any output plane may be NULL to skip it; colors are packed as
+// 0xRRGGBBAA. `capacity` must cover the decimated grid (see `dai_depth_projector_grid_size`).
+// Returns the number of points written.
+API size_t dai_depth_projector_project_soa(DaiDepthProjector projector,
+                                           const DaiImgFrameInfo* depth,
+                                           const DaiImgFrameInfo* rgb,
+                                           const DaiProjectionOptions* options,
+                                           float* out_x,
+                                           float* out_y,
+                                           float* out_z,
+                                           uint32_t* out_rgba,
+                                           size_t capacity);
+// Same as `dai_depth_projector_project_soa`, writing `DaiPoint3fRGBA` records.
+API size_t dai_depth_projector_project_points(DaiDepthProjector projector,
+                                              const DaiImgFrameInfo* depth,
+                                              const DaiImgFrameInfo* rgb,
+                                              const DaiProjectionOptions* options,
+                                              DaiPoint3fRGBA* out,
+                                              size_t capacity);
+// Number of grid points produced for `decimation` (the capacity the project calls require).
+API size_t dai_depth_projector_grid_size(DaiDepthProjector projector, uint32_t decimation);
+API void dai_depth_projector_release(DaiDepthProjector projector);
+
+// Host undistortion / rectification remap tables
+//
+// Tables are cached process-wide by (socket, resolution, calibration hash, parameters) and
+// shared by every caller asking for the same key while any handle to them is alive.
+// `camera` describes the source image (its size is the source resolution). `rotation`
+// (row-major 3x3, may be NULL) is the rectification rotation; `target` (may be NULL for plain
+// undistortion into the same intrinsics) gives the output intrinsics and size.
+API DaiRemapTable dai_remap_table_get(int socket,
+                                      uint64_t calibration_hash,
+                                      const DaiCameraIntrinsics* camera,
+                                      const float* rotation,
+                                      const DaiCameraIntrinsics* target,
+                                      bool* out_cache_hit);
+API void dai_remap_table_get_size(DaiRemapTable table, uint32_t* width, uint32_t* height);
+// Remaps a GRAY8 / RAW8, RAW16 or RGB888i / BGR888i image of the table's source size into
+// tightly packed pixels of the same type. `nearest` skips interpolation (use it for depth).
+// Returns the number of bytes written.
+API size_t dai_remap_apply(DaiRemapTable table, const DaiImgFrameInfo* src, void* dst, size_t dst_capacity, bool nearest);
+API void dai_remap_table_release(DaiRemapTable table);
+// Tables currently alive in the cache.
+API size_t dai_remap_cache_size();
+
 // RGBDData accessors
 API DaiImgFrame dai_rgbd_get_rgb_frame(DaiRGBDData rgbd);
 API DaiImgFrame dai_rgbd_get_depth_frame(DaiRGBDData rgbd);
@@ -406,15 +739,26 @@ API DaiBuffer dai_input_get_buffer(DaiInput input);
 API DaiBuffer dai_input_try_get_buffer(DaiInput input);
 API DaiImgFrame dai_input_get_img_frame(DaiInput input);
 API DaiImgFrame dai_input_try_get_img_frame(DaiInput input);
+API DaiEncodedFrame dai_input_get_encoded_frame(DaiInput input);
+API DaiEncodedFrame dai_input_try_get_encoded_frame(DaiInput input);
 
 // Host -> device input queue (depthai::InputQueue)
 API DaiInputQueue dai_input_create_input_queue(DaiInput input, unsigned int max_size, bool blocking);
 API void dai_input_queue_delete(DaiInputQueue queue);
 API void dai_input_queue_send(DaiInputQueue queue, DaiDatatype msg);
+API void dai_input_queue_send_buffer(DaiInputQueue queue, DaiBuffer buffer);
+API void dai_input_queue_send_img_frame(DaiInputQueue queue, DaiImgFrame frame);
+// Batched sends: all handles are validated up front, so a null or empty one fails the call before
+// anything is sent. Then the messages are sent in order; a send that throws stops the batch with
+// the error set. Returns the number sent, including on error.
+API size_t dai_input_queue_send_many(DaiInputQueue queue, const DaiDatatype* msgs, size_t count);
+API size_t dai_input_queue_send_buffers(DaiInputQueue queue, const DaiBuffer* buffers, size_t count);
+API size_t dai_input_queue_send_img_frames(DaiInputQueue queue, const DaiImgFrame* frames, size_t count);
 
 // Output send helpers (host node)
 API void dai_output_send_buffer(DaiOutput output, DaiBuffer buffer);
 API void dai_output_send_img_frame(DaiOutput output, DaiImgFrame frame);
+API void dai_output_send_encoded_frame(DaiOutput output, DaiEncodedFrame frame);
 
 // MessageGroup helpers
 API DaiMessageGroup dai_message_group_clone(DaiMessageGroup group);
@@ -422,10 +766,47 @@ API void dai_message_group_release(DaiMessageGroup group);
 API DaiBuffer dai_message_group_get_buffer(DaiMessageGroup group, const char* name);
 API DaiImgFrame dai_message_group_get_img_frame(DaiMessageGroup group, const char* name);
 
+// Index-based MessageGroup access. A layout fixes the member names once; resolving a group then
+// walks its members in a single pass instead of one string lookup + cast per member.
+API DaiGroupLayout dai_group_layout_new(const char* const* names, size_t count);
+API void dai_group_layout_release(DaiGroupLayout layout);
+API size_t dai_group_layout_len(DaiGroupLayout layout);
+// Fills slot `i` for `names[i]` and returns how many members were found. `out_types[i]` receives
+// the `DatatypeEnum` value, or -1 when the member is missing. `out_handles` (may be NULL) receives
+// a new `DaiImgFrame` for ImgFrame members, a `DaiBuffer` for other Buffer messages, NULL
+// otherwise. `out_info` (may be NULL) receives frame metadata; for plain buffers only data, size,
+// sequence number and timestamps are set. Borrowed `data` pointers stay valid while `group` lives.
+API size_t dai_message_group_resolve(DaiMessageGroup group,
+                                     DaiGroupLayout layout,
+                                     int* out_types,
+                                     void** out_handles,
+                                     DaiImgFrameInfo* out_info,
+                                     size_t capacity);
+
 // Buffer helpers
 API DaiBuffer dai_buffer_new(size_t size);
 API void dai_buffer_release(DaiBuffer buffer);
 API void dai_buffer_set_data(DaiBuffer buffer, const void* data, size_t len);
+API void* dai_buffer_get_data(DaiBuffer buffer);
+API size_t dai_buffer_get_size(DaiBuffer buffer);
+API size_t dai_buffer_get_capacity(DaiBuffer buffer);
+// Changes the payload length in place; stays allocation-free while `len <= capacity`.
+API bool dai_buffer_resize(DaiBuffer buffer, size_t len);
+
+// Buffer pools
+//
+// Acquired messages come with `capacity` bytes preallocated. Callers write straight into the
+// data span (`dai_buffer_get_data` / `dai_frame_get_data`), send the message and release their
+// handle; the message returns to the pool once DepthAI drops its last reference. At most
+// `max_free` idle messages are retained. A pool serves either Buffers or ImgFrames. Recycled
+// messages come back with default metadata (sequence number, timestamps and, for ImgFrames,
+// size, type, layout and camera settings); only the payload bytes are left as they were.
+API DaiBufferPool dai_buffer_pool_new(size_t capacity, size_t max_free, bool img_frames);
+API void dai_buffer_pool_release(DaiBufferPool pool);
+API DaiBuffer dai_buffer_pool_acquire(DaiBufferPool pool);
+API DaiImgFrame dai_buffer_pool_acquire_frame(DaiBufferPool pool);
+API size_t dai_buffer_pool_get_allocated(DaiBufferPool pool);
+API size_t dai_buffer_pool_get_available(DaiBufferPool pool);
 
 // Low-level frame operations
 API void* dai_frame_get_data(DaiImgFrame frame);
@@ -433,6 +814,27 @@ API int dai_frame_get_width(DaiImgFrame frame);
 API int dai_frame_get_height(DaiImgFrame frame);
 API int dai_frame_get_type(DaiImgFrame frame);
 API size_t dai_frame_get_size(DaiImgFrame frame);
+API bool dai_frame_get_info(DaiImgFrame frame, DaiImgFrameInfo* out);
+// Host-side frame setup (pooled frames): sets size and type and resizes the payload in place.
+API bool dai_frame_set_format(DaiImgFrame frame, int width, int height, int type, size_t data_len);
+API void dai_frame_set_sequence_num(DaiImgFrame frame, int64_t seq);
+// Stamps the frame with the current host steady-clock time.
+API void dai_frame_set_timestamp_now(DaiImgFrame frame);
+// Restores stride, plane offsets, sequence number, timestamps and instance number from `info`
+// (e.g. a recorded `dai_frame_get_info` result). Call after `dai_frame_set_format`; the
+// data, size, dimension and type fields of `info` are ignored.
+API bool dai_frame_set_info(DaiImgFrame frame, const DaiImgFrameInfo* info);
+
+// Host-side pixel conversion (SSSE3 on x86, NEON on ARM, scalar elsewhere). Output is tightly
+// packed `dst_type` pixels; `dst_type` / `type` use `dai::ImgFrame::Type` values. Supported:
+//   RGB888i/BGR888i/RGB888p/BGR888p/GRAY8/RAW8/NV12/NV21/YUV420p -> RGB888i or BGR888i
+//   GRAY8/RAW8/NV12/NV21/YUV420p -> GRAY8 (luma), RAW16 -> RAW16 (stride removed)
+// The convert calls return the number of bytes written, or 0 with an error set.
+API size_t dai_image_converted_size(int width, int height, int dst_type);
+API size_t dai_image_convert(const DaiImgFrameInfo* src, int dst_type, void* dst, size_t dst_capacity);
+API size_t dai_frame_convert(DaiImgFrame frame, int dst_type, void* dst, size_t dst_capacity);
+// Swaps the first and third byte of `pixels` packed 3-byte pixels (RGB <-> BGR) in place.
+API void dai_image_swap_rb_inplace(void* data, size_t pixels);
 API void dai_frame_release(DaiImgFrame frame);
 
 // EncodedFrame accessors
@@ -448,14 +850,35 @@ API int dai_encoded_frame_get_quality(DaiEncodedFrame frame);
 API int dai_encoded_frame_get_bitrate(DaiEncodedFrame frame);
 API bool dai_encoded_frame_get_lossless(DaiEncodedFrame frame);
 API int dai_encoded_frame_get_instance_num(DaiEncodedFrame frame);
+API int64_t dai_encoded_frame_get_sequence_num(DaiEncodedFrame frame);
+// Host-synced steady-clock / device-clock timestamps in nanoseconds.
+API int64_t dai_encoded_frame_get_timestamp_ns(DaiEncodedFrame frame);
+API int64_t dai_encoded_frame_get_timestamp_device_ns(DaiEncodedFrame frame);
 API void dai_encoded_frame_release(DaiEncodedFrame frame);
+// Builds an EncodedFrame holding a copy of `len` bytes at `data` (e.g. a recorded bitstream).
+API DaiEncodedFrame dai_encoded_frame_create(const void* data, size_t len, const DaiEncodedFrameInfo* info);
+API void dai_encoded_frame_set_timestamp_now(DaiEncodedFrame frame);
 
 // Low-level utility functions
 API int dai_device_get_connected_camera_sockets(DaiDevice device, int* sockets, int max_count);
 API const char* dai_camera_socket_name(int socket);
 
 // Error handling
+//
+// Error state is per thread: a failing call only updates the calling thread's message and code.
+// Expected conditions (e.g. a queue read timing out) only set a code and leave the message empty,
+// so `dai_get_last_error()` keeps returning NULL for them.
+enum DaiErrorCode {
+    DAI_OK = 0,
+    DAI_ERROR_UNKNOWN = 1,
+    DAI_ERROR_NULL_ARGUMENT = 2,
+    DAI_ERROR_INVALID_ARGUMENT = 3,
+    DAI_ERROR_NOT_FOUND = 4,
+    DAI_ERROR_TIMEOUT = 5,
+    DAI_ERROR_EXCEPTION = 6,
+};
 API const char* dai_get_last_error();
+API int dai_get_last_error_code();
 API void dai_clear_last_error();
 
 #ifdef __cplusplus
@@ -6,8 +6,8 @@ use depthai::{Pipeline, RerunHostNode, RerunHostNodeConfig, RerunViewer, RerunWe
 fn main() -> Result<()> {
     let pipeline = Pipeline::new().build()?;
     let camera = pipeline.create_with::<CameraNode, _>(CameraBoardSocket::CamA)?;
-    // Important: the default frame_type is "native" (often NV12), which the RerunHostNode
-    // intentionally ignores. Request an explicit RGB output so it can be logged.
+    // The default frame_type is "native" (often NV12), which the RerunHostNode converts to RGB on
+    // the host. Requesting RGB directly skips that conversion at the cost of XLink bandwidth.
     let out = camera.request_output(CameraOutputConfig {
         frame_type: Some(ImageFrameType::RGB888i),
         ..CameraOutputConfig::new((640, 400))
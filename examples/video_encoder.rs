@@ -1,9 +1,8 @@
-use std::fs::File;
-use std::io::Write;
 use std::time::Duration;
 
 use depthai::camera::{CameraNode, CameraOutputConfig};
 use depthai::common::{CameraBoardSocket, ImageFrameType, ResizeMode};
+use depthai::muxer::{SegmentMuxerOptions, SegmentedMuxer};
 use depthai::{Device, Pipeline, Result, VideoEncoderNode, VideoEncoderProfile};
 
 fn main() -> Result<()> {
@@ -44,19 +43,19 @@ fn main() -> Result<()> {
     // Start the pipeline
     pipeline.start()?;
 
-    // Dump a short sample to disk
-    let mut f = File::create("out.h264").unwrap();
+    // Mux a short sample into fragmented MP4 segments (frames are written without copying)
+    let mut muxer = SegmentedMuxer::new("recording", "cam_a", SegmentMuxerOptions::default())?;
 
     for i in 0..120 {
         if let Some(frame) = q.blocking_next(Some(Duration::from_secs(2)))? {
-            let bytes = frame.bytes();
-            f.write_all(&bytes).unwrap();
             println!("encoded frame {i}: {}", frame.describe());
+            muxer.push(frame)?;
         } else {
             println!("timeout waiting for encoded frame {i}");
         }
     }
+    muxer.finish()?;
 
-    println!("Wrote out.h264 (raw bitstream)");
+    println!("Wrote {:?} ({:?})", muxer.monitor().segments(), muxer.stats());
     Ok(())
 }
@@ -4,17 +4,16 @@ use std::time::Duration;
 use depthai::camera::{CameraNode, CameraOutputConfig};
 use depthai::common::{CameraBoardSocket, ImageFrameType, ResizeMode};
 use depthai::{
-    Device, Pipeline, RerunHostNode, RerunHostNodeConfig, RerunViewer, RerunWebConfig,
+    Device, Pipeline, RerunHostNode, RerunHostNodeConfig, RerunLogMode, RerunViewer, RerunWebConfig,
     VideoEncoderNode, VideoEncoderProfile,
 };
 
-use rerun as rr;
-
 fn main() -> Result<(), Box<dyn Error>> {
     // This example streams a live H.265 (HEVC) video stream to Rerun's web viewer.
     //
-    // - We use `RerunHostNode` to host the web viewer + gRPC proxy (headless-friendly).
-    // - We then connect a `rerun::RecordingStream` to that proxy and log a `VideoStream`.
+    // `RerunHostNode` in `EncodedVideo` mode hosts the web viewer + gRPC proxy (headless-friendly)
+    // and forwards the encoder's access units as `VideoStream` samples. Nothing is decoded on the
+    // host, so only the compressed stream crosses the network.
 
     // Device (single connection)
     let device = Device::new()?;
@@ -22,10 +21,11 @@ fn main() -> Result<(), Box<dyn Error>> {
     // Pipeline bound to that device
     let pipeline = Pipeline::new().with_device(&device).build()?;
 
-    // Start the web viewer server + gRPC server inside the pipeline (host-side).
     // For remote dev/SSH, port-forward 9090 (web) and 9876 (gRPC proxy).
-    let _web = pipeline.create_with::<RerunHostNode, _>(RerunHostNodeConfig {
-        app_id: "depthai_h265_server".to_string(),
+    let host = pipeline.create_with::<RerunHostNode, _>(RerunHostNodeConfig {
+        app_id: "depthai_h265".to_string(),
+        entity_path: "video".to_string(),
+        mode: RerunLogMode::EncodedVideo,
         viewer: RerunViewer::Web(RerunWebConfig {
             // In remote/SSH setups, auto-opening a browser is rarely desirable.
             open_browser: false,
@@ -34,9 +34,6 @@ fn main() -> Result<(), Box<dyn Error>> {
         ..Default::default()
     })?;
 
-    // Connect a recording stream to the gRPC /proxy endpoint exposed by the host node.
-    let rec = rr::RecordingStreamBuilder::new("depthai_h265").connect_grpc()?;
-
     // Camera -> NV12 frames
     let cam = pipeline.create_with::<CameraNode, _>(CameraBoardSocket::CamA)?;
 
@@ -58,15 +55,9 @@ fn main() -> Result<(), Box<dyn Error>> {
     // Pick a sensible preset for the requested FPS.
     enc.set_default_profile_preset(fps, VideoEncoderProfile::H265Main);
 
-    // Link camera output into encoder input (port name is "in")
+    // Link camera output into encoder input (port name is "in"), and the bitstream into rerun.
     nv12.link(&enc.input()?)?;
-
-    // Create an EncodedFrame output queue.
-    let q = enc.out()?.create_encoded_frame_queue(8, true)?;
-
-    // Log the codec once per entity.
-    // Samples are then appended over time on the "frame" timeline.
-    rec.log_static("video", &rr::VideoStream::new(rr::components::VideoCodec::H265))?;
+    enc.out()?.link(&host.input("in")?)?;
 
     // Start the pipeline
     pipeline.start()?;
@@ -74,20 +65,7 @@ fn main() -> Result<(), Box<dyn Error>> {
     eprintln!("Streaming H.265 to Rerun (press Ctrl-C to stop)...");
     eprintln!("If the web viewer can't fetch data, make sure the gRPC /proxy port (default 9876) is reachable from your browser (e.g. port-forward it if you're remote).");
 
-    let mut frame_nr: i64 = 0;
-
     loop {
-        if let Some(frame) = q.blocking_next(Some(Duration::from_millis(500)))? {
-            rec.set_time_sequence("frame", frame_nr);
-            frame_nr += 1;
-
-            // `VideoSample` takes ownership of the bytes.
-            let bytes = frame.bytes();
-            rec.log(
-                "video",
-                &rr::VideoStream::update_fields()
-                    .with_sample(rr::components::VideoSample::from(bytes)),
-            )?;
-        }
+        std::thread::sleep(Duration::from_secs(1));
     }
 }
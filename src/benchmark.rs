@@ -0,0 +1,122 @@
+use std::ffi::CStr;
+use std::time::Duration;
+
+use autocxx::c_int;
+use depthai_sys::depthai;
+
+use crate::error::{clear_error_flag, last_error, take_error_if_any, DepthaiError, Result};
+use crate::queue::Datatype;
+
+/// Replays the first message it receives on `input` through `out`, at a fixed rate.
+///
+/// Mirrors C++: `dai::node::BenchmarkOut`. Runs on device unless [`Self::set_run_on_host`] is set,
+/// so pairing a device-side `BenchmarkOut` with a host-side [`BenchmarkInNode`] measures XLink.
+#[crate::native_node_wrapper(native = "dai::node::BenchmarkOut", inputs(input), outputs(out))]
+pub struct BenchmarkOutNode {
+    node: crate::pipeline::Node,
+}
+
+impl BenchmarkOutNode {
+    /// Number of messages to send; `-1` (the default) sends indefinitely.
+    pub fn set_num_messages_to_send(&self, num: i32) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_out_set_num_messages_to_send(self.node.handle(), c_int(num)) };
+    }
+
+    /// Output rate in messages per second.
+    pub fn set_fps(&self, fps: f32) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_out_set_fps(self.node.handle(), fps) };
+    }
+
+    pub fn set_run_on_host(&self, run_on_host: bool) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_out_set_run_on_host(self.node.handle(), run_on_host) };
+    }
+}
+
+/// Consumes messages on `input` and emits a `BenchmarkReport` on `report` every N messages.
+///
+/// Mirrors C++: `dai::node::BenchmarkIn`. Latency is measured against the message timestamp, so
+/// it includes transport when the producer runs on device.
+#[crate::native_node_wrapper(native = "dai::node::BenchmarkIn", inputs(input), outputs(report, passthrough))]
+pub struct BenchmarkInNode {
+    node: crate::pipeline::Node,
+}
+
+impl BenchmarkInNode {
+    pub fn send_report_every_n_messages(&self, num: u32) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_in_send_report_every_n_messages(self.node.handle(), num) };
+    }
+
+    pub fn set_run_on_host(&self, run_on_host: bool) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_in_set_run_on_host(self.node.handle(), run_on_host) };
+    }
+
+    pub fn log_reports_as_warnings(&self, log_as_warnings: bool) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_in_log_reports_as_warnings(self.node.handle(), log_as_warnings) };
+    }
+
+    /// Fill [`BenchmarkReport::latencies`] with one entry per message.
+    pub fn measure_individual_latencies(&self, measure: bool) {
+        clear_error_flag();
+        unsafe { depthai::dai_benchmark_in_measure_individual_latencies(self.node.handle(), measure) };
+    }
+}
+
+/// Report emitted by [`BenchmarkInNode`]. Times are in seconds, as in DepthAI.
+#[derive(Debug, Clone, Default, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct BenchmarkReport {
+    pub fps: f32,
+    pub time_total: f32,
+    pub num_messages_received: u64,
+    pub average_latency: f32,
+    /// Per-message latencies; empty unless individual latencies are measured.
+    #[serde(default)]
+    pub latencies: Vec<f32>,
+}
+
+impl BenchmarkReport {
+    pub fn average_latency(&self) -> Duration {
+        Duration::from_secs_f32(self.average_latency.max(0.0))
+    }
+
+    /// Latency at quantile `q` (`0.0..=1.0`) over the individual latencies, if measured.
+    pub fn latency_percentile(&self, q: f64) -> Option<Duration> {
+        if self.latencies.is_empty() {
+            return None;
+        }
+        let mut sorted = self.latencies.clone();
+        sorted.sort_by(f32::total_cmp);
+        let idx = ((q.clamp(0.0, 1.0) * (sorted.len() - 1) as f64).round()) as usize;
+        Some(Duration::from_secs_f32(sorted[idx].max(0.0)))
+    }
+}
+
+impl Datatype {
+    pub fn as_benchmark_report(&self) -> Result<Option<BenchmarkReport>> {
+        clear_error_flag();
+        let ptr = unsafe { depthai::dai_datatype_benchmark_report_json(self.handle()) };
+        if ptr.is_null() {
+            return take_error_if_any("failed to read BenchmarkReport").map_or(Ok(None), Err);
+        }
+        let s = unsafe { CStr::from_ptr(ptr).to_string_lossy().into_owned() };
+        unsafe { depthai::dai_free_cstring(ptr) };
+        serde_json::from_str(&s)
+            .map(Some)
+            .map_err(|e| DepthaiError::new(format!("invalid BenchmarkReport JSON from depthai-core: {e}")))
+    }
+}
+
+/// DepthAI-Core version the native library was built against (e.g. `"3.2.1"`).
+pub fn depthai_core_version() -> Result<String> {
+    clear_error_flag();
+    let ptr = depthai::dai_build_version();
+    if ptr.is_null() {
+        return Err(last_error("failed to read DepthAI-Core version"));
+    }
+    Ok(unsafe { CStr::from_ptr(ptr) }.to_string_lossy().into_owned())
+}
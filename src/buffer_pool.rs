@@ -0,0 +1,267 @@
+use depthai_sys::{depthai, DaiBufferPool};
+
+use crate::camera::{ImageFrame, ImageFrameInfo};
+use crate::common::ImageFrameType;
+use crate::error::{clear_error_flag, last_error, Result};
+use crate::frame_bytes::FrameBytes;
+use crate::host_node::Buffer;
+
+struct PoolHandle {
+    handle: DaiBufferPool,
+}
+
+// The native pool is internally synchronized.
+unsafe impl Send for PoolHandle {}
+unsafe impl Sync for PoolHandle {}
+
+impl Drop for PoolHandle {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_buffer_pool_release(self.handle) };
+            self.handle = std::ptr::null_mut();
+        }
+    }
+}
+
+impl PoolHandle {
+    fn new(capacity: usize, max_free: usize, img_frames: bool) -> Result<Self> {
+        clear_error_flag();
+        let handle = depthai::dai_buffer_pool_new(capacity, max_free, img_frames);
+        if handle.is_null() {
+            Err(last_error("failed to create buffer pool"))
+        } else {
+            Ok(Self { handle })
+        }
+    }
+
+    fn allocated(&self) -> usize {
+        unsafe { depthai::dai_buffer_pool_get_allocated(self.handle) }
+    }
+
+    fn available(&self) -> usize {
+        unsafe { depthai::dai_buffer_pool_get_available(self.handle) }
+    }
+}
+
+/// Pool of [`Buffer`] messages with `capacity` preallocated bytes each.
+///
+/// Fill acquired buffers in place through [`PooledBuffer::data_mut`], then send the
+/// [`PooledBuffer::into_buffer`] result and drop it. The native message returns to the pool once DepthAI releases its last reference, so
+/// steady-state host-to-device streaming neither allocates nor copies per message. Recycled
+/// buffers come back with their sequence number and timestamps reset; payload bytes are not
+/// cleared.
+pub struct BufferPool {
+    inner: PoolHandle,
+}
+
+impl BufferPool {
+    /// Creates a pool; at most `max_free` idle buffers are kept for reuse.
+    pub fn new(capacity: usize, max_free: usize) -> Result<Self> {
+        Ok(Self {
+            inner: PoolHandle::new(capacity, max_free, false)?,
+        })
+    }
+
+    /// Returns a recycled buffer (or a new one when the pool is empty) sized to the pool capacity.
+    pub fn acquire(&self) -> Result<PooledBuffer> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_buffer_pool_acquire(self.inner.handle) };
+        if handle.is_null() {
+            Err(last_error("failed to acquire pooled buffer"))
+        } else {
+            Ok(PooledBuffer {
+                buffer: Buffer::from_handle(handle),
+            })
+        }
+    }
+
+    /// Buffers currently owned by the pool, idle or in flight.
+    pub fn allocated(&self) -> usize {
+        self.inner.allocated()
+    }
+
+    /// Idle buffers ready to be acquired without allocating.
+    pub fn available(&self) -> usize {
+        self.inner.available()
+    }
+}
+
+/// Pool of [`ImageFrame`] messages with `capacity` preallocated payload bytes each.
+///
+/// Call [`PooledFrame::set_format`] on acquired frames before filling them. Recycled frames come
+/// back with default metadata, so size, type, sequence number and timestamps never carry over
+/// from an earlier send.
+pub struct FramePool {
+    inner: PoolHandle,
+}
+
+impl FramePool {
+    /// Creates a pool; at most `max_free` idle frames are kept for reuse.
+    pub fn new(capacity: usize, max_free: usize) -> Result<Self> {
+        Ok(Self {
+            inner: PoolHandle::new(capacity, max_free, true)?,
+        })
+    }
+
+    pub fn acquire(&self) -> Result<PooledFrame> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_buffer_pool_acquire_frame(self.inner.handle) };
+        if handle.is_null() {
+            Err(last_error("failed to acquire pooled frame"))
+        } else {
+            Ok(PooledFrame {
+                frame: ImageFrame::from_handle(handle),
+            })
+        }
+    }
+
+    pub fn allocated(&self) -> usize {
+        self.inner.allocated()
+    }
+
+    pub fn available(&self) -> usize {
+        self.inner.available()
+    }
+}
+
+/// A pooled [`Buffer`] that has not been sent yet.
+///
+/// The pool only hands out messages nothing else references, so this is the one place the payload
+/// is writable. [`Self::into_buffer`] gives up the writable view and returns a plain [`Buffer`] to
+/// send; a message that is queued, in flight or shared with other consumers is never written.
+pub struct PooledBuffer {
+    buffer: Buffer,
+}
+
+impl PooledBuffer {
+    /// Current payload length in bytes.
+    pub fn len(&self) -> usize {
+        self.buffer.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.buffer.is_empty()
+    }
+
+    /// Bytes the payload can grow to without reallocating.
+    pub fn capacity(&self) -> usize {
+        self.buffer.capacity()
+    }
+
+    /// Changes the payload length in place (allocation-free up to [`Self::capacity`]).
+    pub fn resize(&mut self, len: usize) -> Result<()> {
+        self.buffer.resize(len)
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        self.buffer.as_bytes()
+    }
+
+    /// Writable view of the payload.
+    pub fn data_mut(&mut self) -> &mut [u8] {
+        let len = self.buffer.len();
+        let ptr = unsafe { depthai::dai_buffer_get_data(self.buffer.handle()) };
+        if len == 0 || ptr.is_null() {
+            return &mut [];
+        }
+        // SAFETY: the pool only returns unreferenced messages and `self` is the sole handle until
+        // `into_buffer` consumes it.
+        unsafe { std::slice::from_raw_parts_mut(ptr as *mut u8, len) }
+    }
+
+    /// Ends writing; the returned buffer can be sent and shared.
+    pub fn into_buffer(self) -> Buffer {
+        self.buffer
+    }
+}
+
+impl From<PooledBuffer> for Buffer {
+    fn from(buffer: PooledBuffer) -> Self {
+        buffer.into_buffer()
+    }
+}
+
+/// A pooled [`ImageFrame`] that has not been sent yet.
+///
+/// Like [`PooledBuffer`], the writable payload lives here only; [`Self::into_frame`] ends writing
+/// and returns the frame to send.
+pub struct PooledFrame {
+    frame: ImageFrame,
+}
+
+impl PooledFrame {
+    pub fn width(&self) -> u32 {
+        self.frame.width()
+    }
+
+    pub fn height(&self) -> u32 {
+        self.frame.height()
+    }
+
+    pub fn format(&self) -> Option<ImageFrameType> {
+        self.frame.format()
+    }
+
+    pub fn byte_len(&self) -> usize {
+        self.frame.byte_len()
+    }
+
+    pub fn describe(&self) -> String {
+        self.frame.describe()
+    }
+
+    pub fn info(&self) -> Result<ImageFrameInfo> {
+        self.frame.info()
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        self.frame.as_bytes()
+    }
+
+    /// Writable view of the payload; call [`Self::set_format`] first to size it.
+    pub fn data_mut(&mut self) -> &mut [u8] {
+        let len = self.frame.byte_len();
+        let ptr = unsafe { depthai::dai_frame_get_data(self.frame.handle()) };
+        if len == 0 || ptr.is_null() {
+            return &mut [];
+        }
+        // SAFETY: the pool only returns unreferenced frames and `self` is the sole handle until
+        // `into_frame` consumes it.
+        unsafe { std::slice::from_raw_parts_mut(ptr as *mut u8, len) }
+    }
+
+    /// Sets size and type and resizes the payload to `data_len` bytes; allocation-free as long as
+    /// `data_len` fits the pool capacity.
+    pub fn set_format(&mut self, width: u32, height: u32, format: ImageFrameType, data_len: usize) -> Result<()> {
+        self.frame.set_format(width, height, format, data_len)
+    }
+
+    pub fn set_sequence_num(&mut self, seq: i64) {
+        self.frame.set_sequence_num(seq);
+    }
+
+    /// Stamps the frame with the current host time.
+    pub fn set_timestamp_now(&mut self) {
+        self.frame.set_timestamp_now();
+    }
+
+    pub(crate) fn set_raw_info(&mut self, raw: &depthai_sys::DaiImgFrameInfo) -> Result<()> {
+        self.frame.set_raw_info(raw)
+    }
+
+    /// Ends writing; the returned frame can be sent and shared.
+    pub fn into_frame(self) -> ImageFrame {
+        self.frame
+    }
+
+    /// See [`ImageFrame::into_bytes`].
+    pub fn into_bytes(self) -> FrameBytes {
+        self.frame.into_bytes()
+    }
+}
+
+impl From<PooledFrame> for ImageFrame {
+    fn from(frame: PooledFrame) -> Self {
+        frame.into_frame()
+    }
+}
@@ -6,8 +6,10 @@ use depthai_sys::{depthai, DaiCameraNode, DaiDataQueue, DaiImgFrame, DaiNode};
 
 pub use crate::common::{CameraBoardSocket, CameraSensorType, ImageFrameType, ResizeMode};
 use crate::error::{Result, clear_error_flag, last_error, take_error_if_any};
+use crate::frame_bytes::FrameBytes;
 use crate::pipeline::device_node::CreateInPipelineWith;
 use crate::pipeline::{Pipeline, PipelineInner};
+use crate::pool_sizing::PoolSizing;
 use crate::output::Output as NodeOutput;
 
 #[crate::native_node_wrapper(
@@ -32,6 +34,29 @@ pub struct ImageFrame {
     handle: DaiImgFrame,
 }
 
+/// Per-frame metadata fetched in a single native call (see [`ImageFrame::info`]).
+#[derive(Debug, Clone, Copy)]
+pub struct ImageFrameInfo {
+    pub width: u32,
+    pub height: u32,
+    pub format: Option<ImageFrameType>,
+    pub byte_len: usize,
+    /// Bytes per row of the first plane.
+    pub stride: u32,
+    pub bytes_per_pixel: u32,
+    /// Byte offsets of up to three planes within the frame data.
+    pub plane_offsets: [u32; 3],
+    pub sequence_num: i64,
+    /// Host-synced steady-clock timestamp.
+    pub timestamp: Duration,
+    /// Device-clock timestamp.
+    pub timestamp_device: Duration,
+    pub instance_num: u32,
+    pub exposure: Duration,
+    pub sensitivity: i32,
+    pub lens_position: i32,
+}
+
 #[derive(Debug, Clone, Default)]
 pub struct CameraBuildConfig {
     pub board_socket: CameraBoardSocket,
@@ -297,6 +322,16 @@ impl CameraNode {
         Ok(())
     }
 
+    /// Sets the outputs pool to the size [`PoolSizing`] recommends for this node, if it has one.
+    /// Returns the applied size.
+    pub fn apply_pool_sizing(&self, sizing: &PoolSizing) -> Result<Option<i32>> {
+        let Some(rec) = sizing.matching(self.node.id()?.into(), &self.node.name()?) else {
+            return Ok(None);
+        };
+        self.set_outputs_num_frames_pool(rec.frames_pool)?;
+        Ok(Some(rec.frames_pool))
+    }
+
     pub fn set_outputs_max_size_pool(&self, size: i32) -> Result<()> {
         clear_error_flag();
         unsafe { depthai::dai_camera_set_outputs_max_size_pool(self.node.handle() as DaiCameraNode, c_int(size)) };
@@ -390,6 +425,11 @@ impl OutputQueue {
         self.handle
     }
 
+    /// Overwrite counters, if this queue was created with [`crate::Output::create_latest_queue`].
+    pub fn conflation_stats(&self) -> Option<crate::queue::ConflationStats> {
+        crate::queue::conflation_stats(self.handle)
+    }
+
     pub fn blocking_next(&self, timeout: Option<Duration>) -> Result<Option<ImageFrame>> {
         clear_error_flag();
         let timeout_ms = timeout.map(|d| d.as_millis() as i32).unwrap_or(-1);
@@ -418,6 +458,47 @@ impl OutputQueue {
             Ok(Some(ImageFrame { handle: frame }))
         }
     }
+
+    /// Pops up to `max` queued frames in a single native call.
+    pub fn try_drain(&self, max: usize) -> Result<Vec<ImageFrame>> {
+        Ok(self.drain_raw(max, false)?.into_iter().map(|(frame, _)| frame).collect())
+    }
+
+    /// Like [`Self::try_drain`], also returning each frame's metadata from the same call.
+    pub fn try_drain_with_info(&self, max: usize) -> Result<Vec<(ImageFrame, ImageFrameInfo)>> {
+        Ok(self
+            .drain_raw(max, true)?
+            .into_iter()
+            .map(|(frame, info)| (frame, ImageFrame::convert_info(&info)))
+            .collect())
+    }
+
+    fn drain_raw(&self, max: usize, with_info: bool) -> Result<Vec<(ImageFrame, depthai_sys::DaiImgFrameInfo)>> {
+        if max == 0 {
+            return Ok(Vec::new());
+        }
+        clear_error_flag();
+        let mut handles: Vec<DaiImgFrame> = vec![std::ptr::null_mut(); max];
+        let mut infos = if with_info {
+            vec![depthai_sys::DaiImgFrameInfo::default(); max]
+        } else {
+            Vec::new()
+        };
+        let info_ptr = if with_info { infos.as_mut_ptr() } else { std::ptr::null_mut() };
+        let count = unsafe { depthai::dai_queue_try_drain_frames(self.handle, handles.as_mut_ptr(), info_ptr, max) };
+        let count = count.min(max);
+        // Take ownership of every returned handle before reporting a possible error.
+        let frames: Vec<_> = handles
+            .into_iter()
+            .take(count)
+            .enumerate()
+            .map(|(i, h)| (ImageFrame::from_handle(h), infos.get(i).copied().unwrap_or_default()))
+            .collect();
+        if let Some(err) = take_error_if_any("failed to drain frames") {
+            return Err(err);
+        }
+        Ok(frames)
+    }
 }
 
 impl Drop for ImageFrame {
@@ -469,12 +550,120 @@ impl ImageFrame {
         unsafe { std::slice::from_raw_parts(data_ptr as *const u8, len).to_vec() }
     }
 
+    /// Borrows the frame payload without copying.
+    pub fn as_bytes(&self) -> &[u8] {
+        let len = self.byte_len();
+        if len == 0 {
+            return &[];
+        }
+        let data_ptr = unsafe { depthai::dai_frame_get_data(self.handle) };
+        if data_ptr.is_null() {
+            return &[];
+        }
+        unsafe { std::slice::from_raw_parts(data_ptr as *const u8, len) }
+    }
+
+    /// Sets size and type of a host-built frame and resizes its payload to `data_len` bytes.
+    ///
+    /// For pooled frames this is allocation-free as long as `data_len` fits the pool capacity.
+    /// Received frames share their payload with other consumers, so this is only public through
+    /// [`crate::PooledFrame::set_format`].
+    pub(crate) fn set_format(&mut self, width: u32, height: u32, format: ImageFrameType, data_len: usize) -> Result<()> {
+        clear_error_flag();
+        let ok = unsafe {
+            depthai::dai_frame_set_format(
+                self.handle,
+                c_int(width as i32),
+                c_int(height as i32),
+                c_int(format as i32),
+                data_len,
+            )
+        };
+        if ok {
+            Ok(())
+        } else {
+            Err(last_error("failed to set frame format"))
+        }
+    }
+
+    pub(crate) fn set_sequence_num(&mut self, seq: i64) {
+        unsafe { depthai::dai_frame_set_sequence_num(self.handle, seq) };
+    }
+
+    /// Stamps the frame with the current host time.
+    pub(crate) fn set_timestamp_now(&mut self) {
+        unsafe { depthai::dai_frame_set_timestamp_now(self.handle) };
+    }
+
+    /// Restores layout, sequence number, timestamps and instance number from recorded metadata.
+    pub(crate) fn set_raw_info(&mut self, raw: &depthai_sys::DaiImgFrameInfo) -> Result<()> {
+        clear_error_flag();
+        if unsafe { depthai::dai_frame_set_info(self.handle, raw) } {
+            Ok(())
+        } else {
+            Err(last_error("failed to set frame info"))
+        }
+    }
+
+    /// Converts the frame into an owned, reference-counted payload without copying.
+    ///
+    /// The native frame is released once the returned [`FrameBytes`] and all its clones are dropped.
+    pub fn into_bytes(self) -> FrameBytes {
+        let data = self.as_bytes();
+        let (ptr, len) = (data.as_ptr(), data.len());
+        // SAFETY: the payload is owned by the frame, which moves into the returned value.
+        unsafe { FrameBytes::from_owner(self, ptr, len) }
+    }
+
+    /// Fetches all frame metadata in one native call.
+    ///
+    /// Prefer this over the individual getters when several fields are needed per frame.
+    pub fn info(&self) -> Result<ImageFrameInfo> {
+        Ok(Self::convert_info(&self.raw_info()?))
+    }
+
+    pub(crate) fn raw_info(&self) -> Result<depthai_sys::DaiImgFrameInfo> {
+        clear_error_flag();
+        let mut raw = depthai_sys::DaiImgFrameInfo::default();
+        let ok = unsafe { depthai::dai_frame_get_info(self.handle, &mut raw) };
+        if ok {
+            Ok(raw)
+        } else {
+            Err(last_error("failed to query frame info"))
+        }
+    }
+
+    pub(crate) fn convert_info(raw: &depthai_sys::DaiImgFrameInfo) -> ImageFrameInfo {
+        let nanos = |ns: i64| Duration::from_nanos(ns.max(0) as u64);
+        ImageFrameInfo {
+            width: raw.width.max(0) as u32,
+            height: raw.height.max(0) as u32,
+            format: ImageFrameType::from_raw(raw.type_),
+            byte_len: if raw.data.is_null() { 0 } else { raw.size },
+            stride: raw.stride,
+            bytes_per_pixel: raw.bytes_per_pixel,
+            plane_offsets: raw.plane_offsets,
+            sequence_num: raw.sequence_num,
+            timestamp: nanos(raw.timestamp_ns),
+            timestamp_device: nanos(raw.timestamp_device_ns),
+            instance_num: raw.instance_num.max(0) as u32,
+            exposure: Duration::from_micros(raw.exposure_us.max(0) as u64),
+            sensitivity: raw.sensitivity,
+            lens_position: raw.lens_position,
+        }
+    }
+
     pub fn describe(&self) -> String {
-        let fmt = self
-            .format()
-            .map(|f| format!("{f:?}"))
-            .unwrap_or_else(|| "unknown".into());
-        format!("{}x{} {}", self.width(), self.height(), fmt)
+        match self.info() {
+            Ok(info) => {
+                let fmt = info
+                    .format
+                    .map(|f| format!("{f:?}"))
+                    .unwrap_or_else(|| "unknown".into());
+                format!("{}x{} {}", info.width, info.height, fmt)
+            }
+            Err(_) => "invalid frame".into(),
+        }
     }
 }
 
@@ -0,0 +1,340 @@
+//! Host-side projection of depth frames into point clouds.
+//!
+//! [`CameraIntrinsics`] are parsed once from the pipeline calibration (or built by hand) and a
+//! [`DepthProjector`] turns them into ray tables, so projecting a frame is a multiply per
+//! coordinate with no per-frame calibration lookups. The work runs in the C++ wrapper, split
+//! across a persistent worker pool, and writes straight into caller-owned buffers that are reused
+//! between frames.
+//!
+//! ```no_run
+//! # use depthai::camera::CameraBoardSocket;
+//! # use depthai::{Pipeline, Result};
+//! # use depthai::depth_projection::{CameraIntrinsics, DepthProjector, ProjectionOptions};
+//! # use depthai::pointcloud::PointCloudSoa;
+//! # fn run(pipeline: &Pipeline, rgbd: &depthai::rgbd::RgbdData) -> Result<()> {
+//! let intrinsics = CameraIntrinsics::from_pipeline(pipeline, CameraBoardSocket::CamA, 640, 400)?;
+//! let projector = DepthProjector::new(&intrinsics, false, 0)?;
+//! let mut cloud = PointCloudSoa::default();
+//! projector.project_rgbd(rgbd, &ProjectionOptions::default(), &mut cloud)?;
+//! # Ok(())
+//! # }
+//! ```
+
+use depthai_sys::{depthai, DaiDepthProjector};
+use serde_json::Value;
+
+use crate::camera::ImageFrame;
+use crate::common::CameraBoardSocket;
+use crate::error::{clear_error_flag, last_error, take_error_if_any, DepthaiError, Result};
+use crate::pipeline::Pipeline;
+use crate::pointcloud::{Point3fRGBA, PointCloudSoa};
+use crate::rgbd::RgbdData;
+
+/// Pinhole intrinsics plus OpenCV-ordered distortion coefficients for one image size.
+#[derive(Clone, Debug, PartialEq)]
+pub struct CameraIntrinsics {
+    pub fx: f32,
+    pub fy: f32,
+    pub cx: f32,
+    pub cy: f32,
+    pub width: u32,
+    pub height: u32,
+    /// `k1, k2, p1, p2, k3, k4, k5, k6, s1, s2, s3, s4, tx, ty` (trailing entries may be omitted).
+    pub distortion: Vec<f32>,
+}
+
+impl CameraIntrinsics {
+    /// Reads the intrinsics of `socket` from calibration JSON (as returned by
+    /// [`Pipeline::calibration_data_json`]) and scales them to `width` x `height`.
+    pub fn from_calibration_json(calibration: &Value, socket: CameraBoardSocket, width: u32, height: u32) -> Result<Self> {
+        let id = socket as i64;
+        let camera = match calibration.get("cameraData") {
+            Some(Value::Array(entries)) => entries.iter().find_map(|entry| match entry.as_array()?.as_slice() {
+                [key, info] if key.as_i64() == Some(id) => Some(info),
+                _ => None,
+            }),
+            Some(Value::Object(map)) => map.get(&id.to_string()),
+            _ => None,
+        }
+        .ok_or_else(|| DepthaiError::new(format!("calibration has no camera data for {socket:?}")))?;
+
+        let matrix = camera
+            .get("intrinsicMatrix")
+            .and_then(Value::as_array)
+            .filter(|rows| rows.len() >= 2)
+            .ok_or_else(|| DepthaiError::new(format!("calibration for {socket:?} has no intrinsic matrix")))?;
+        let at = |r: usize, c: usize| matrix[r].get(c).and_then(Value::as_f64).unwrap_or(0.0) as f32;
+        let dim = |key: &str| camera.get(key).and_then(Value::as_u64).unwrap_or(0) as u32;
+        let distortion = camera
+            .get("distortionCoeff")
+            .and_then(Value::as_array)
+            .map(|c| c.iter().map(|v| v.as_f64().unwrap_or(0.0) as f32).collect())
+            .unwrap_or_default();
+
+        let native = Self {
+            fx: at(0, 0),
+            fy: at(1, 1),
+            cx: at(0, 2),
+            cy: at(1, 2),
+            width: dim("width"),
+            height: dim("height"),
+            distortion,
+        };
+        if native.fx == 0.0 || native.fy == 0.0 || native.width == 0 || native.height == 0 {
+            return Err(DepthaiError::new(format!("calibration for {socket:?} is incomplete")));
+        }
+        Ok(native.scaled_to(width, height))
+    }
+
+    /// Fetches the pipeline calibration and reads `socket` from it; see [`Self::from_calibration_json`].
+    pub fn from_pipeline(pipeline: &Pipeline, socket: CameraBoardSocket, width: u32, height: u32) -> Result<Self> {
+        let calibration = pipeline
+            .calibration_data_json()?
+            .ok_or_else(|| DepthaiError::new("pipeline has no calibration data"))?;
+        Self::from_calibration_json(&calibration, socket, width, height)
+    }
+
+    /// Intrinsics for the same camera at another output size.
+    ///
+    /// A different aspect ratio is treated like the device's default resize: scaled to cover the
+    /// output and center-cropped.
+    pub fn scaled_to(&self, width: u32, height: u32) -> Self {
+        if width == self.width && height == self.height {
+            return self.clone();
+        }
+        let (sw, sh) = (width as f32 / self.width as f32, height as f32 / self.height as f32);
+        let mut out = self.clone();
+        out.width = width;
+        out.height = height;
+        if sw == sh {
+            out.fx *= sw;
+            out.fy *= sh;
+            out.cx *= sw;
+            out.cy *= sh;
+            return out;
+        }
+        let scale = sw.max(sh);
+        out.fx *= scale;
+        out.fy *= scale;
+        out.cx = self.cx * scale - (self.width as f32 * scale - width as f32) / 2.0;
+        out.cy = self.cy * scale - (self.height as f32 * scale - height as f32) / 2.0;
+        out
+    }
+
+    pub(crate) fn to_raw(&self) -> depthai_sys::DaiCameraIntrinsics {
+        let mut raw = depthai_sys::DaiCameraIntrinsics {
+            fx: self.fx,
+            fy: self.fy,
+            cx: self.cx,
+            cy: self.cy,
+            width: self.width as i32,
+            height: self.height as i32,
+            ..Default::default()
+        };
+        let count = self.distortion.len().min(raw.distortion.len());
+        raw.distortion[..count].copy_from_slice(&self.distortion[..count]);
+        raw.distortion_count = count as i32;
+        raw
+    }
+}
+
+/// How depth pixels are turned into points.
+#[derive(Clone, Copy, Debug)]
+pub struct ProjectionOptions {
+    /// Output units per depth unit; the default turns millimetre depth into metres.
+    pub depth_scale: f32,
+    /// Keep every Nth pixel on both image axes. `0` and `1` keep all pixels.
+    pub decimation: u32,
+    /// Inclusive z range to keep, in output units.
+    pub z_range: Option<(f32, f32)>,
+    /// Drop pixels without depth (or outside `z_range`) instead of emitting `(0, 0, 0)` for them.
+    pub skip_invalid: bool,
+    /// Sample colors from the RGB frame when one is given.
+    pub colors: bool,
+}
+
+impl Default for ProjectionOptions {
+    fn default() -> Self {
+        Self {
+            depth_scale: 0.001,
+            decimation: 1,
+            z_range: None,
+            skip_invalid: true,
+            colors: true,
+        }
+    }
+}
+
+impl ProjectionOptions {
+    fn to_raw(&self) -> depthai_sys::DaiProjectionOptions {
+        let (z_min, z_max) = self.z_range.unwrap_or((f32::NEG_INFINITY, f32::INFINITY));
+        depthai_sys::DaiProjectionOptions {
+            depth_scale: self.depth_scale,
+            decimation: self.decimation.max(1),
+            z_min,
+            z_max,
+            skip_invalid: self.skip_invalid,
+        }
+    }
+}
+
+/// Projects RAW16 depth frames of one resolution into point clouds.
+///
+/// Safe to share between threads; concurrent calls on one projector are serialized.
+pub struct DepthProjector {
+    handle: DaiDepthProjector,
+    width: u32,
+    height: u32,
+}
+
+unsafe impl Send for DepthProjector {}
+unsafe impl Sync for DepthProjector {}
+
+impl Drop for DepthProjector {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_depth_projector_release(self.handle) };
+            self.handle = std::ptr::null_mut();
+        }
+    }
+}
+
+impl DepthProjector {
+    /// Builds the ray tables for `intrinsics`.
+    ///
+    /// With `undistort` the lens distortion is inverted into a per-pixel table; leave it off for
+    /// rectified stereo depth. `threads == 0` uses every hardware thread.
+    pub fn new(intrinsics: &CameraIntrinsics, undistort: bool, threads: u32) -> Result<Self> {
+        clear_error_flag();
+        let raw = intrinsics.to_raw();
+        let handle = unsafe { depthai::dai_depth_projector_new(&raw, undistort, threads) };
+        if handle.is_null() {
+            return Err(last_error("failed to create depth projector"));
+        }
+        Ok(Self {
+            handle,
+            width: intrinsics.width,
+            height: intrinsics.height,
+        })
+    }
+
+    /// Depth resolution this projector expects.
+    pub fn size(&self) -> (u32, u32) {
+        (self.width, self.height)
+    }
+
+    /// Points produced per frame when nothing is skipped.
+    pub fn grid_size(&self, decimation: u32) -> usize {
+        unsafe { depthai::dai_depth_projector_grid_size(self.handle, decimation.max(1)) }.into()
+    }
+
+    /// Projects `depth` into `out`, reusing its allocations. Colors come from `rgb` when given
+    /// (sampled onto the depth grid); otherwise `rgba` is left empty. Returns the number of points.
+    pub fn project_into(
+        &self,
+        depth: &ImageFrame,
+        rgb: Option<&ImageFrame>,
+        options: &ProjectionOptions,
+        out: &mut PointCloudSoa,
+    ) -> Result<usize> {
+        let depth_info = depth.raw_info()?;
+        let rgb_info = match rgb {
+            Some(frame) if options.colors => Some(frame.raw_info()?),
+            _ => None,
+        };
+        let capacity = self.grid_size(options.decimation);
+        out.x.clear();
+        out.y.clear();
+        out.z.clear();
+        out.rgba.clear();
+        out.x.reserve(capacity);
+        out.y.reserve(capacity);
+        out.z.reserve(capacity);
+        let rgba_ptr = if rgb_info.is_some() {
+            out.rgba.reserve(capacity);
+            out.rgba.as_mut_ptr()
+        } else {
+            std::ptr::null_mut()
+        };
+        let raw_options = options.to_raw();
+
+        clear_error_flag();
+        let written = unsafe {
+            depthai::dai_depth_projector_project_soa(
+                self.handle,
+                &depth_info,
+                rgb_info.as_ref().map_or(std::ptr::null(), |info| info as *const _),
+                &raw_options,
+                out.x.as_mut_ptr(),
+                out.y.as_mut_ptr(),
+                out.z.as_mut_ptr(),
+                rgba_ptr,
+                capacity,
+            )
+        };
+        if written == 0 {
+            if let Some(err) = take_error_if_any("failed to project depth frame") {
+                return Err(err);
+            }
+        }
+        let written = written.min(capacity);
+        // SAFETY: the wrapper initialized the first `written` elements of every non-null plane.
+        unsafe {
+            out.x.set_len(written);
+            out.y.set_len(written);
+            out.z.set_len(written);
+            if rgb_info.is_some() {
+                out.rgba.set_len(written);
+            }
+        }
+        Ok(written)
+    }
+
+    /// Like [`Self::project_into`], writing [`Point3fRGBA`] records. Colors are all zero when no
+    /// RGB frame is given.
+    pub fn project_points_into(
+        &self,
+        depth: &ImageFrame,
+        rgb: Option<&ImageFrame>,
+        options: &ProjectionOptions,
+        out: &mut Vec<Point3fRGBA>,
+    ) -> Result<usize> {
+        let depth_info = depth.raw_info()?;
+        let rgb_info = match rgb {
+            Some(frame) if options.colors => Some(frame.raw_info()?),
+            _ => None,
+        };
+        let capacity = self.grid_size(options.decimation);
+        out.clear();
+        out.reserve(capacity);
+        let raw_options = options.to_raw();
+
+        clear_error_flag();
+        let written = unsafe {
+            depthai::dai_depth_projector_project_points(
+                self.handle,
+                &depth_info,
+                rgb_info.as_ref().map_or(std::ptr::null(), |info| info as *const _),
+                &raw_options,
+                out.as_mut_ptr().cast(),
+                capacity,
+            )
+        };
+        if written == 0 {
+            if let Some(err) = take_error_if_any("failed to project depth frame") {
+                return Err(err);
+            }
+        }
+        let written = written.min(capacity);
+        // SAFETY: `Point3fRGBA` mirrors `DaiPoint3fRGBA` and the first `written` records were filled.
+        unsafe { out.set_len(written) };
+        Ok(written)
+    }
+
+    /// Projects the depth of an RGBD message, colored by its aligned RGB frame.
+    pub fn project_rgbd(&self, rgbd: &RgbdData, options: &ProjectionOptions, out: &mut PointCloudSoa) -> Result<usize> {
+        let depth = rgbd.depth_frame()?;
+        let rgb = if options.colors { Some(rgbd.rgb_frame()?) } else { None };
+        self.project_into(&depth, rgb.as_ref(), options, out)
+    }
+}
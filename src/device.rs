@@ -1,9 +1,10 @@
 use autocxx::c_int;
 use depthai_sys::{depthai, DaiDevice};
-use std::os::raw::c_int as RawInt;
+use std::ffi::{CStr, CString};
+use std::os::raw::{c_char, c_int as RawInt};
 
 use crate::common::CameraBoardSocket;
-use crate::error::{Result, clear_error_flag, last_error, take_error_if_any};
+use crate::error::{DepthaiError, ErrorCode, Result, clear_error_flag, last_error, take_error_if_any};
 
 const MAX_SOCKETS: usize = 16;
 
@@ -19,6 +20,26 @@ pub enum DevicePlatform {
     Rvc4 = 2,
 }
 
+/// A connected device as reported by [`Device::list`].
+#[derive(Debug, Clone, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+pub struct DeviceInfo {
+    /// Device id (MXID on RVC2).
+    pub device_id: String,
+    /// IP address for network devices, USB path otherwise.
+    pub name: String,
+    /// XLink state, e.g. `"unbooted"`, `"booted"`, `"bootloader"`.
+    pub state: String,
+    /// XLink protocol, e.g. `"usb"`, `"tcp_ip"`.
+    pub protocol: String,
+}
+
+/// Takes ownership of a wrapper-allocated C string.
+fn take_cstring(ptr: *mut c_char) -> String {
+    let s = unsafe { CStr::from_ptr(ptr) }.to_string_lossy().into_owned();
+    unsafe { depthai::dai_free_cstring(ptr) };
+    s
+}
+
 impl Device {
     pub(crate) fn from_handle(handle: DaiDevice) -> Self {
         Self { handle }
@@ -34,6 +55,86 @@ impl Device {
         }
     }
 
+    /// Enumerates devices visible over XLink, booted or not.
+    pub fn list() -> Result<Vec<DeviceInfo>> {
+        clear_error_flag();
+        let ptr = depthai::dai_device_list_json();
+        if ptr.is_null() {
+            return Err(last_error("failed to enumerate DepthAI devices"));
+        }
+        let s = take_cstring(ptr);
+        serde_json::from_str(&s)
+            .map_err(|e| DepthaiError::new(format!("invalid device list JSON from depthai-core: {e}")))
+    }
+
+    /// Opens a specific device by device id (MXID), IP address or USB path.
+    ///
+    /// Unlike [`Device::new`], this never returns the shared default device and does not
+    /// serialize with other opens, so several devices can be opened from different threads.
+    pub fn open(id: &str) -> Result<Self> {
+        clear_error_flag();
+        let id_c = CString::new(id).map_err(|_| DepthaiError::new("device id contains NUL"))?;
+        let handle = unsafe { depthai::dai_device_open(id_c.as_ptr()) };
+        if handle.is_null() {
+            Err(last_error(&format!("failed to open DepthAI device {id}")))
+        } else {
+            Ok(Self { handle })
+        }
+    }
+
+    /// Opens all `ids` concurrently; total boot time is that of the slowest device.
+    ///
+    /// Returns one result per id, in order.
+    pub fn open_many<S: AsRef<str>>(ids: &[S]) -> Result<Vec<Result<Self>>> {
+        clear_error_flag();
+        let ids_c = ids
+            .iter()
+            .map(|id| CString::new(id.as_ref()).map_err(|_| DepthaiError::new("device id contains NUL")))
+            .collect::<Result<Vec<_>>>()?;
+        let ptrs: Vec<*const c_char> = ids_c.iter().map(|c| c.as_ptr()).collect();
+        let mut handles: Vec<DaiDevice> = vec![std::ptr::null_mut(); ids.len()];
+        let mut errors: Vec<*mut c_char> = vec![std::ptr::null_mut(); ids.len()];
+        let mut codes = vec![0i32; ids.len()];
+        unsafe {
+            depthai::dai_device_open_many(
+                ptrs.as_ptr(),
+                ptrs.len(),
+                handles.as_mut_ptr(),
+                errors.as_mut_ptr(),
+                codes.as_mut_ptr(),
+            )
+        };
+        if let Some(err) = take_error_if_any("failed to open DepthAI devices") {
+            return Err(err);
+        }
+        Ok(handles
+            .into_iter()
+            .zip(errors)
+            .zip(codes)
+            .zip(ids)
+            .map(|(((handle, error), code), id)| {
+                if !handle.is_null() {
+                    Ok(Self { handle })
+                } else {
+                    let reason = if error.is_null() { "unknown error".to_string() } else { take_cstring(error) };
+                    let code = ErrorCode::from_raw(code).unwrap_or(ErrorCode::Unknown);
+                    Err(DepthaiError::with_code(format!("failed to open DepthAI device {}: {reason}", id.as_ref()), code))
+                }
+            })
+            .collect())
+    }
+
+    /// Device id (MXID on RVC2) of this connection.
+    pub fn device_id(&self) -> Result<String> {
+        clear_error_flag();
+        let ptr = unsafe { depthai::dai_device_get_device_id(self.handle) };
+        if ptr.is_null() {
+            Err(last_error("failed to get device id"))
+        } else {
+            Ok(take_cstring(ptr))
+        }
+    }
+
     /// Create another handle to the same underlying device connection.
     ///
     /// This mirrors DepthAI's C++ usage where the device is commonly shared via `std::shared_ptr`.
@@ -5,6 +5,7 @@ use autocxx::c_int;
 use depthai_sys::{depthai, DaiDataQueue, DaiEncodedFrame};
 
 use crate::error::{clear_error_flag, last_error, take_error_if_any, Result};
+use crate::frame_bytes::FrameBytes;
 
 #[repr(i32)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -23,6 +24,22 @@ impl EncodedFrameProfile {
             _ => None,
         }
     }
+
+    /// Whether an access unit of this profile can be decoded on its own: always for JPEG, and
+    /// for H.264/H.265 when its Annex-B payload holds an IDR (H.264) or IRAP (H.265) slice.
+    pub fn is_keyframe_payload(self, data: &[u8]) -> bool {
+        match self {
+            Self::Jpeg => true,
+            Self::Avc => annexb_nal_headers(data).any(|h| h & 0x1f == 5),
+            // BLA_W_LP..CRA_NUT; 22 and 23 are reserved IRAP types.
+            Self::Hevc => annexb_nal_headers(data).any(|h| (16..=21).contains(&((h >> 1) & 0x3f))),
+        }
+    }
+}
+
+/// First header byte of every NAL unit behind a 3- or 4-byte Annex-B start code.
+fn annexb_nal_headers(data: &[u8]) -> impl Iterator<Item = u8> + '_ {
+    data.windows(4).filter(|w| w[..3] == [0, 0, 1]).map(|w| w[3])
 }
 
 #[repr(i32)]
@@ -64,6 +81,28 @@ impl EncodedFrame {
         Self { handle }
     }
 
+    /// Builds a frame holding a copy of `data` with the metadata in `info` (e.g. a recorded
+    /// bitstream being replayed).
+    pub(crate) fn from_parts(data: &[u8], info: &depthai_sys::DaiEncodedFrameInfo) -> Result<Self> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_encoded_frame_create(data.as_ptr().cast(), data.len(), info) };
+        if handle.is_null() {
+            Err(last_error("failed to create encoded frame"))
+        } else {
+            Ok(Self::from_handle(handle))
+        }
+    }
+
+    pub(crate) fn handle(&self) -> DaiEncodedFrame {
+        self.handle
+    }
+
+    /// Stamps the frame with the current host time.
+    pub fn set_timestamp_now(&mut self) {
+        clear_error_flag();
+        unsafe { depthai::dai_encoded_frame_set_timestamp_now(self.handle) };
+    }
+
     pub fn width(&self) -> u32 {
         let raw: i32 = unsafe { depthai::dai_encoded_frame_get_width(self.handle) }.into();
         raw as u32
@@ -84,6 +123,17 @@ impl EncodedFrame {
         EncodedFrameType::from_raw(raw)
     }
 
+    /// Whether this frame starts a decodable picture. Trusts an `I`/`P`/`B` frame type and falls
+    /// back to the NAL unit types for `Unknown`, which some firmware reports for IDR frames.
+    pub fn is_keyframe(&self) -> bool {
+        match (self.profile(), self.frame_type()) {
+            (None, _) => false,
+            (Some(EncodedFrameProfile::Jpeg), _) | (_, Some(EncodedFrameType::I)) => true,
+            (_, Some(EncodedFrameType::P | EncodedFrameType::B)) => false,
+            (Some(profile), _) => profile.is_keyframe_payload(self.as_bytes()),
+        }
+    }
+
     pub fn quality(&self) -> u32 {
         let raw: i32 = unsafe { depthai::dai_encoded_frame_get_quality(self.handle) }.into();
         raw as u32
@@ -103,6 +153,27 @@ impl EncodedFrame {
         raw as u32
     }
 
+    pub fn sequence_num(&self) -> i64 {
+        unsafe { depthai::dai_encoded_frame_get_sequence_num(self.handle) }
+    }
+
+    /// Host-synced capture timestamp.
+    pub fn timestamp(&self) -> Duration {
+        Duration::from_nanos(self.timestamp_ns().max(0) as u64)
+    }
+
+    pub fn timestamp_device(&self) -> Duration {
+        Duration::from_nanos(self.timestamp_device_ns().max(0) as u64)
+    }
+
+    pub(crate) fn timestamp_ns(&self) -> i64 {
+        unsafe { depthai::dai_encoded_frame_get_timestamp_ns(self.handle) }
+    }
+
+    pub(crate) fn timestamp_device_ns(&self) -> i64 {
+        unsafe { depthai::dai_encoded_frame_get_timestamp_device_ns(self.handle) }
+    }
+
     pub fn data_len(&self) -> usize {
         unsafe { depthai::dai_encoded_frame_get_data_size(self.handle) }
     }
@@ -113,13 +184,18 @@ impl EncodedFrame {
     /// actual frame sub-slice within the internal buffer. When those fields are usable,
     /// this returns exactly that range; otherwise it returns the full buffer.
     pub fn bytes(&self) -> Vec<u8> {
+        self.as_bytes().to_vec()
+    }
+
+    /// Borrows the encoded bytes without copying (same range as [`Self::bytes`]).
+    pub fn as_bytes(&self) -> &[u8] {
         let len = self.data_len();
         if len == 0 {
-            return Vec::new();
+            return &[];
         }
         let ptr = unsafe { depthai::dai_encoded_frame_get_data(self.handle) };
         if ptr.is_null() {
-            return Vec::new();
+            return &[];
         }
 
         let all = unsafe { std::slice::from_raw_parts(ptr as *const u8, len) };
@@ -128,12 +204,20 @@ impl EncodedFrame {
         let size = unsafe { depthai::dai_encoded_frame_get_frame_size(self.handle) } as usize;
 
         if size > 0 && offset <= all.len() && offset.saturating_add(size) <= all.len() {
-            all[offset..offset + size].to_vec()
+            &all[offset..offset + size]
         } else {
-            all.to_vec()
+            all
         }
     }
 
+    /// Converts the frame into an owned, reference-counted payload without copying.
+    pub fn into_bytes(self) -> FrameBytes {
+        let data = self.as_bytes();
+        let (ptr, len) = (data.as_ptr(), data.len());
+        // SAFETY: the payload is owned by the frame, which moves into the returned value.
+        unsafe { FrameBytes::from_owner(self, ptr, len) }
+    }
+
     pub fn describe(&self) -> String {
         let prof = self.profile().map(|p| format!("{p:?}")).unwrap_or_else(|| "unknown".into());
         let ty = self
@@ -191,6 +275,21 @@ impl EncodedFrameQueue {
         }
     }
 
+    /// Pops up to `max` queued encoded frames in a single native call.
+    pub fn try_drain(&self, max: usize) -> Result<Vec<EncodedFrame>> {
+        if max == 0 {
+            return Ok(Vec::new());
+        }
+        clear_error_flag();
+        let mut handles: Vec<DaiEncodedFrame> = vec![ptr::null_mut(); max];
+        let count = unsafe { depthai::dai_queue_try_drain_encoded_frames(self.handle, handles.as_mut_ptr(), max) };
+        let frames: Vec<_> = handles.into_iter().take(count.min(max)).map(EncodedFrame::from_handle).collect();
+        if let Some(err) = take_error_if_any("failed to drain encoded frames") {
+            return Err(err);
+        }
+        Ok(frames)
+    }
+
     pub(crate) fn handle(&self) -> DaiDataQueue {
         self.handle
     }
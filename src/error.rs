@@ -3,12 +3,53 @@ use std::fmt;
 
 use depthai_sys::depthai;
 
+/// Category of a failure reported by the native wrapper (mirrors `DaiErrorCode` in `wrapper.h`).
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum ErrorCode {
+    /// Unclassified failure, including errors raised on the Rust side.
+    Unknown,
+    NullArgument,
+    InvalidArgument,
+    NotFound,
+    Timeout,
+    /// A DepthAI call threw an exception.
+    Exception,
+}
+
+impl ErrorCode {
+    pub(crate) fn from_raw(raw: i32) -> Option<Self> {
+        match raw {
+            0 => None,
+            2 => Some(Self::NullArgument),
+            3 => Some(Self::InvalidArgument),
+            4 => Some(Self::NotFound),
+            5 => Some(Self::Timeout),
+            6 => Some(Self::Exception),
+            _ => Some(Self::Unknown),
+        }
+    }
+}
+
 #[derive(Debug, Clone)]
-pub struct DepthaiError(pub(crate) String);
+pub struct DepthaiError(pub(crate) String, pub(crate) ErrorCode, pub(crate) Option<usize>);
 
 impl DepthaiError {
     pub(crate) fn new(msg: impl Into<String>) -> Self {
-        Self(msg.into())
+        Self(msg.into(), ErrorCode::Unknown, None)
+    }
+
+    pub(crate) fn with_code(msg: impl Into<String>, code: ErrorCode) -> Self {
+        Self(msg.into(), code, None)
+    }
+
+    /// Category of the failure.
+    pub fn code(&self) -> ErrorCode {
+        self.1
+    }
+
+    /// For a failed batch send, how many items went out before the failure. Those stay sent.
+    pub fn partial_sent(&self) -> Option<usize> {
+        self.2
     }
 }
 
@@ -27,30 +68,61 @@ pub(crate) fn clear_error_flag() {
 }
 
 pub(crate) fn last_error(context: &str) -> DepthaiError {
-    match take_error_message() {
-        Some(msg) if !msg.is_empty() => DepthaiError::new(msg),
-        _ => DepthaiError::new(context),
+    match take_error() {
+        Some((msg, code)) if !msg.is_empty() => DepthaiError::with_code(msg, code),
+        Some((_, code)) => DepthaiError::with_code(context, code),
+        None => DepthaiError::new(context),
     }
 }
 
 pub(crate) fn take_error_if_any(context: &str) -> Option<DepthaiError> {
-    take_error_message().map(|msg| {
+    take_error().map(|(msg, code)| {
         if msg.is_empty() {
-            DepthaiError::new(context)
+            DepthaiError::with_code(context, code)
         } else {
-            DepthaiError::new(msg)
+            DepthaiError::with_code(msg, code)
         }
     })
 }
 
-fn take_error_message() -> Option<String> {
+/// Result of a batch call that reports how many items it sent: `Ok(sent)`, or the thread's
+/// pending error carrying `sent` as [`DepthaiError::partial_sent`].
+pub(crate) fn batch_result(sent: usize, context: &str) -> Result<usize> {
+    match take_error_if_any(context) {
+        Some(mut err) => {
+            err.2 = Some(sent);
+            Err(err)
+        }
+        None => Ok(sent),
+    }
+}
+
+/// Error code of the calling thread's last native failure, without touching the message.
+pub(crate) fn last_error_code() -> Option<ErrorCode> {
+    let raw: ::std::os::raw::c_int = depthai::dai_get_last_error_code().into();
+    ErrorCode::from_raw(raw)
+}
+
+fn take_error() -> Option<(String, ErrorCode)> {
+    // Checking the code first keeps the common "nothing failed" / "timed out" paths off the
+    // string accessor entirely. A timeout is not an error, but it is consumed here like one so it
+    // cannot leak into the status of the thread's next call.
+    let code = match last_error_code() {
+        None => return None,
+        Some(ErrorCode::Timeout) => {
+            depthai::dai_clear_last_error();
+            return None;
+        }
+        Some(code) => code,
+    };
     unsafe {
         let err_ptr = depthai::dai_get_last_error();
         if err_ptr.is_null() {
+            depthai::dai_clear_last_error();
             return None;
         }
         let msg = CStr::from_ptr(err_ptr).to_string_lossy().into_owned();
         depthai::dai_clear_last_error();
-        Some(msg)
+        Some((msg, code))
     }
 }
@@ -0,0 +1,118 @@
+use std::fmt;
+use std::ops::{Deref, RangeBounds};
+use std::sync::Arc;
+
+/// Keeps a native message alive for as long as any [`FrameBytes`] refers to its payload.
+struct NativeOwner<T>(T);
+
+// SAFETY: only constructed by this crate around `ImageFrame` / `EncodedFrame`. After a message is
+// received its payload is never mutated, and releasing the underlying `std::shared_ptr` handle
+// is thread-safe, so the owner can be shared and dropped from any thread.
+unsafe impl<T> Send for NativeOwner<T> {}
+unsafe impl<T> Sync for NativeOwner<T> {}
+
+/// Owned, reference-counted frame payload that borrows the native buffer without copying.
+///
+/// Cloning and slicing only bump a reference count; the native message is released when the
+/// last `FrameBytes` referring to it is dropped. Unlike the frame types it is created from,
+/// `FrameBytes` is `Send + Sync`, so payloads can be handed to network or logging threads.
+#[derive(Clone)]
+pub struct FrameBytes {
+    owner: Option<Arc<dyn Send + Sync>>,
+    ptr: *const u8,
+    len: usize,
+}
+
+// SAFETY: `ptr` points into memory kept alive and immutable by `owner`.
+unsafe impl Send for FrameBytes {}
+unsafe impl Sync for FrameBytes {}
+
+impl FrameBytes {
+    /// Wraps `len` bytes at `ptr`, owned by `owner`.
+    ///
+    /// # Safety
+    /// `ptr..ptr + len` must stay valid and unmodified for as long as `owner` is alive.
+    pub(crate) unsafe fn from_owner<T: 'static>(owner: T, ptr: *const u8, len: usize) -> Self {
+        if ptr.is_null() || len == 0 {
+            return Self::empty();
+        }
+        Self {
+            owner: Some(Arc::new(NativeOwner(owner))),
+            ptr,
+            len,
+        }
+    }
+
+    pub fn empty() -> Self {
+        Self {
+            owner: None,
+            ptr: std::ptr::NonNull::<u8>::dangling().as_ptr(),
+            len: 0,
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn as_slice(&self) -> &[u8] {
+        unsafe { std::slice::from_raw_parts(self.ptr, self.len) }
+    }
+
+    /// Returns a sub-range sharing the same native buffer.
+    ///
+    /// Panics if the range is out of bounds, like slice indexing.
+    pub fn slice(&self, range: impl RangeBounds<usize>) -> Self {
+        use std::ops::Bound;
+        let start = match range.start_bound() {
+            Bound::Included(&s) => s,
+            Bound::Excluded(&s) => s + 1,
+            Bound::Unbounded => 0,
+        };
+        let end = match range.end_bound() {
+            Bound::Included(&e) => e + 1,
+            Bound::Excluded(&e) => e,
+            Bound::Unbounded => self.len,
+        };
+        assert!(start <= end && end <= self.len, "FrameBytes::slice out of bounds: {start}..{end} of {}", self.len);
+        if start == end {
+            return Self::empty();
+        }
+        Self {
+            owner: self.owner.clone(),
+            ptr: unsafe { self.ptr.add(start) },
+            len: end - start,
+        }
+    }
+}
+
+impl Default for FrameBytes {
+    fn default() -> Self {
+        Self::empty()
+    }
+}
+
+impl Deref for FrameBytes {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        self.as_slice()
+    }
+}
+
+impl AsRef<[u8]> for FrameBytes {
+    fn as_ref(&self) -> &[u8] {
+        self.as_slice()
+    }
+}
+
+impl fmt::Debug for FrameBytes {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("FrameBytes").field("len", &self.len).finish()
+    }
+}
+
@@ -3,12 +3,13 @@ use std::panic::{catch_unwind, AssertUnwindSafe};
 use std::ptr;
 use std::sync::{Arc, Mutex};
 
-use depthai_sys::{depthai, DaiBuffer, DaiMessageGroup, DaiNode};
+use depthai_sys::{depthai, DaiBuffer, DaiGroupLayout, DaiMessageGroup, DaiNode};
 
-use crate::camera::ImageFrame;
+use crate::camera::{ImageFrame, ImageFrameInfo};
 use crate::error::{clear_error_flag, last_error, take_error_if_any, Result};
 use crate::output::{Input, Output};
 use crate::pipeline::{Node, Pipeline, PipelineInner};
+use crate::queue::DatatypeEnum;
 
 pub trait HostNodeImpl: Send + 'static {
     fn process_group(&mut self, group: &MessageGroup) -> Option<Buffer>;
@@ -125,6 +126,131 @@ impl MessageGroup {
             Ok(Some(ImageFrame::from_handle(handle)))
         }
     }
+
+    /// Resolves every member named in `layout` in one native call.
+    ///
+    /// Slot `i` holds the member for `layout.names()[i]`, or `None` when the group lacks it.
+    /// Cheaper than repeated [`Self::get_frame`] calls for synced multi-input nodes.
+    pub fn resolve(&self, layout: &MessageGroupLayout) -> Result<Vec<Option<GroupMember>>> {
+        let n = layout.len();
+        clear_error_flag();
+        let mut types = vec![-1i32; n];
+        let mut handles: Vec<*mut autocxx::c_void> = vec![ptr::null_mut(); n];
+        let mut infos = vec![depthai_sys::DaiImgFrameInfo::default(); n];
+        unsafe {
+            depthai::dai_message_group_resolve(
+                self.handle,
+                layout.handle,
+                types.as_mut_ptr(),
+                handles.as_mut_ptr(),
+                infos.as_mut_ptr(),
+                n,
+            )
+        };
+        // Take ownership of every returned handle before reporting a possible error.
+        let members: Vec<_> = (0..n)
+            .map(|i| {
+                if types[i] < 0 {
+                    return None;
+                }
+                let kind = DatatypeEnum::from_raw(types[i]);
+                let handle = handles[i];
+                Some(if handle.is_null() {
+                    GroupMember::Other(kind)
+                } else if matches!(kind, Some(DatatypeEnum::ImgFrame)) {
+                    GroupMember::Frame(ImageFrame::from_handle(handle), ImageFrame::convert_info(&infos[i]))
+                } else {
+                    GroupMember::Buffer(Buffer::from_handle(handle))
+                })
+            })
+            .collect();
+        match take_error_if_any("failed to resolve message group") {
+            Some(err) => Err(err),
+            None => Ok(members),
+        }
+    }
+}
+
+/// Fixed set of member names that [`MessageGroup::resolve`] looks up by index.
+///
+/// Build one per host node (typically alongside its inputs) and reuse it for every group.
+pub struct MessageGroupLayout {
+    handle: DaiGroupLayout,
+    names: Vec<String>,
+}
+
+// The native layout is immutable after creation.
+unsafe impl Send for MessageGroupLayout {}
+unsafe impl Sync for MessageGroupLayout {}
+
+impl Drop for MessageGroupLayout {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_group_layout_release(self.handle) };
+            self.handle = ptr::null_mut();
+        }
+    }
+}
+
+impl MessageGroupLayout {
+    pub fn new<S: AsRef<str>>(names: &[S]) -> Result<Self> {
+        clear_error_flag();
+        let names_c = names
+            .iter()
+            .map(|n| CString::new(n.as_ref()).map_err(|_| last_error("invalid message name")))
+            .collect::<Result<Vec<_>>>()?;
+        let ptrs: Vec<_> = names_c.iter().map(|n| n.as_ptr()).collect();
+        let handle = unsafe { depthai::dai_group_layout_new(ptrs.as_ptr(), ptrs.len()) };
+        if handle.is_null() {
+            Err(last_error("failed to create message group layout"))
+        } else {
+            Ok(Self {
+                handle,
+                names: names.iter().map(|n| n.as_ref().to_owned()).collect(),
+            })
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.names.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.names.is_empty()
+    }
+
+    pub fn names(&self) -> &[String] {
+        &self.names
+    }
+
+    /// Slot of `name` in the vectors returned by [`MessageGroup::resolve`].
+    pub fn index_of(&self, name: &str) -> Option<usize> {
+        self.names.iter().position(|n| n == name)
+    }
+}
+
+/// One resolved [`MessageGroup`] member.
+pub enum GroupMember {
+    Frame(ImageFrame, ImageFrameInfo),
+    Buffer(Buffer),
+    /// Present, but not a `Buffer`-derived message.
+    Other(Option<DatatypeEnum>),
+}
+
+impl GroupMember {
+    pub fn as_frame(&self) -> Option<&ImageFrame> {
+        match self {
+            Self::Frame(frame, _) => Some(frame),
+            _ => None,
+        }
+    }
+
+    pub fn into_frame(self) -> Option<ImageFrame> {
+        match self {
+            Self::Frame(frame, _) => Some(frame),
+            _ => None,
+        }
+    }
 }
 
 pub struct Buffer {
@@ -156,12 +282,14 @@ impl Buffer {
     }
 
     pub fn from_bytes(data: &[u8]) -> Result<Self> {
-        let buffer = Self::new(data.len())?;
+        let mut buffer = Self::new(data.len())?;
         buffer.set_data(data)?;
         Ok(buffer)
     }
 
-    pub fn set_data(&self, data: &[u8]) -> Result<()> {
+    /// Replaces the payload. This may reallocate it, hence `&mut self`: no slice from
+    /// [`Self::as_bytes`] can be alive across the call.
+    pub fn set_data(&mut self, data: &[u8]) -> Result<()> {
         clear_error_flag();
         unsafe { depthai::dai_buffer_set_data(self.handle, data.as_ptr() as *const _, data.len()) };
         if let Some(err) = take_error_if_any("failed to set buffer data") {
@@ -171,6 +299,40 @@ impl Buffer {
         }
     }
 
+    /// Current payload length in bytes.
+    pub fn len(&self) -> usize {
+        unsafe { depthai::dai_buffer_get_size(self.handle) }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Bytes the payload can grow to without reallocating.
+    pub fn capacity(&self) -> usize {
+        unsafe { depthai::dai_buffer_get_capacity(self.handle) }
+    }
+
+    /// Changes the payload length in place (allocation-free up to [`Self::capacity`]). Public only
+    /// through [`crate::PooledBuffer::resize`].
+    pub(crate) fn resize(&mut self, len: usize) -> Result<()> {
+        clear_error_flag();
+        if unsafe { depthai::dai_buffer_resize(self.handle, len) } {
+            Ok(())
+        } else {
+            Err(last_error("failed to resize buffer"))
+        }
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        let len = self.len();
+        let ptr = unsafe { depthai::dai_buffer_get_data(self.handle) };
+        if len == 0 || ptr.is_null() {
+            return &[];
+        }
+        unsafe { std::slice::from_raw_parts(ptr as *const u8, len) }
+    }
+
     pub(crate) fn handle(&self) -> DaiBuffer {
         self.handle
     }
@@ -209,6 +371,128 @@ struct HostNodeState<T: HostNodeImpl> {
     inner: Mutex<T>,
 }
 
+/// Worker settings for [`Pipeline::create_parallel_host_node`].
+#[derive(Debug, Clone, Copy)]
+pub struct HostNodeWorkers {
+    /// Threads running `process_group`; each owns a clone of the node.
+    pub workers: usize,
+    /// Groups queued, running or awaiting in-order send before the node stops taking input.
+    /// `0` means twice `workers`.
+    pub max_in_flight: usize,
+}
+
+impl Default for HostNodeWorkers {
+    fn default() -> Self {
+        Self {
+            workers: std::thread::available_parallelism().map(|n| n.get()).unwrap_or(1),
+            max_in_flight: 0,
+        }
+    }
+}
+
+pub(crate) fn create_parallel_host_node<T: HostNodeImpl + Clone>(
+    pipeline: &Pipeline,
+    node: T,
+    config: HostNodeWorkers,
+) -> Result<HostNode> {
+    clear_error_flag();
+    let workers = config.workers.max(1);
+    let max_in_flight = if config.max_in_flight == 0 { workers * 2 } else { config.max_in_flight };
+    let state = Box::new(ParallelHostNodeState {
+        instances: (0..workers).map(|_| Mutex::new(node.clone())).collect(),
+    });
+    let ctx = Box::into_raw(state) as *mut c_void;
+    let handle = unsafe {
+        depthai::dai_pipeline_create_host_node_parallel(
+            pipeline.handle(),
+            ctx as *mut _,
+            Some(parallel_hostnode_process::<T>),
+            Some(parallel_hostnode_on_start::<T>),
+            Some(parallel_hostnode_on_stop::<T>),
+            Some(parallel_hostnode_drop::<T>),
+            workers,
+            max_in_flight,
+        )
+    };
+    if handle.is_null() {
+        unsafe { drop(Box::from_raw(ctx as *mut ParallelHostNodeState<T>)) };
+        Err(last_error("failed to create parallel host node"))
+    } else {
+        Ok(HostNode::from_handle(pipeline.inner_arc(), handle))
+    }
+}
+
+/// One node instance per worker; every worker finds an idle one, so the locks never contend.
+struct ParallelHostNodeState<T: HostNodeImpl> {
+    instances: Vec<Mutex<T>>,
+}
+
+impl<T: HostNodeImpl> ParallelHostNodeState<T> {
+    fn with_idle<R>(&self, f: impl FnOnce(&mut T) -> R) -> R {
+        for instance in &self.instances {
+            if let Ok(mut guard) = instance.try_lock() {
+                return f(&mut guard);
+            }
+        }
+        let mut guard = match self.instances[0].lock() {
+            Ok(g) => g,
+            Err(e) => e.into_inner(),
+        };
+        f(&mut guard)
+    }
+
+    fn for_each(&self, mut f: impl FnMut(&mut T)) {
+        for instance in &self.instances {
+            let mut guard = match instance.lock() {
+                Ok(g) => g,
+                Err(e) => e.into_inner(),
+            };
+            f(&mut guard);
+        }
+    }
+}
+
+unsafe extern "C" fn parallel_hostnode_process<T: HostNodeImpl>(ctx: *mut c_void, group: DaiMessageGroup) -> DaiBuffer {
+    if ctx.is_null() || group.is_null() {
+        return ptr::null_mut();
+    }
+    let state = unsafe { &*(ctx as *mut ParallelHostNodeState<T>) };
+    let group = MessageGroup::from_handle(group);
+    let result = state.with_idle(|node| catch_unwind(AssertUnwindSafe(|| node.process_group(&group))));
+    match result {
+        Ok(Some(buffer)) => buffer.into_raw(),
+        Ok(None) => ptr::null_mut(),
+        Err(_) => ptr::null_mut(),
+    }
+}
+
+unsafe extern "C" fn parallel_hostnode_on_start<T: HostNodeImpl>(ctx: *mut c_void) {
+    if ctx.is_null() {
+        return;
+    }
+    let state = unsafe { &*(ctx as *mut ParallelHostNodeState<T>) };
+    state.for_each(|node| {
+        let _ = catch_unwind(AssertUnwindSafe(|| node.on_start()));
+    });
+}
+
+unsafe extern "C" fn parallel_hostnode_on_stop<T: HostNodeImpl>(ctx: *mut c_void) {
+    if ctx.is_null() {
+        return;
+    }
+    let state = unsafe { &*(ctx as *mut ParallelHostNodeState<T>) };
+    state.for_each(|node| {
+        let _ = catch_unwind(AssertUnwindSafe(|| node.on_stop()));
+    });
+}
+
+unsafe extern "C" fn parallel_hostnode_drop<T: HostNodeImpl>(ctx: *mut c_void) {
+    if ctx.is_null() {
+        return;
+    }
+    unsafe { drop(Box::from_raw(ctx as *mut ParallelHostNodeState<T>)) };
+}
+
 unsafe extern "C" fn hostnode_process<T: HostNodeImpl>(ctx: *mut c_void, group: DaiMessageGroup) -> DaiBuffer {
     if ctx.is_null() || group.is_null() {
         return ptr::null_mut();
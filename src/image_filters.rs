@@ -0,0 +1,71 @@
+use autocxx::c_int;
+use depthai_sys::depthai;
+
+use crate::error::{clear_error_flag, last_error, DepthaiError, Result};
+
+/// Filter chains selectable with [`ImageFiltersNode::set_default_profile_preset`].
+///
+/// Mirrors C++: `dai::node::ImageFiltersPresetMode`.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ImageFiltersPresetMode {
+    TofLowRange = 0,
+    TofMidRange = 1,
+    TofHighRange = 2,
+}
+
+/// Post-processes RAW16 depth or disparity frames (0 = invalid) with a speckle, median, spatial
+/// and temporal filter chain; other frame types pass through unchanged.
+///
+/// Mirrors C++: `dai::node::ImageFilters`. Builds without OpenCV run a dependency-free host
+/// implementation of the same filters.
+#[crate::native_node_wrapper(native = "dai::node::ImageFilters", inputs(input, inputConfig), outputs(output))]
+pub struct ImageFiltersNode {
+    node: crate::pipeline::Node,
+}
+
+impl ImageFiltersNode {
+    /// Replaces the filter chain with the preset for `mode`.
+    ///
+    /// Mirrors C++: `ImageFilters::setDefaultProfilePreset(mode)`.
+    pub fn set_default_profile_preset(&self, mode: ImageFiltersPresetMode) {
+        clear_error_flag();
+        unsafe { depthai::dai_image_filters_set_default_profile_preset(self.node.handle(), c_int(mode as i32)) };
+    }
+
+    /// Mirrors C++: `ImageFilters::setRunOnHost(bool)`.
+    pub fn set_run_on_host(&self, run_on_host: bool) {
+        clear_error_flag();
+        unsafe { depthai::dai_image_filters_set_run_on_host(self.node.handle(), run_on_host) };
+    }
+}
+
+/// `k`x`k` median (`k` = 3, 5 or 7) of tightly packed `width`x`height` depth pixels, replicating
+/// edge pixels. This is the kernel the host [`ImageFiltersNode`] runs for its median stage.
+pub fn median_filter_depth(src: &[u16], width: usize, height: usize, k: u32, dst: &mut [u16]) -> Result<()> {
+    let len = width * height;
+    if src.len() < len || dst.len() < len {
+        return Err(DepthaiError::new(format!(
+            "median filter needs {len} pixels, got {} in and {} out",
+            src.len(),
+            dst.len()
+        )));
+    }
+    clear_error_flag();
+    let ok = unsafe {
+        depthai::dai_depth_median(
+            src.as_ptr() as *const _,
+            width,
+            dst.as_mut_ptr() as *mut _,
+            width,
+            width,
+            height,
+            c_int(k as i32),
+        )
+    };
+    if ok {
+        Ok(())
+    } else {
+        Err(last_error("failed to median filter depth"))
+    }
+}
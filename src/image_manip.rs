@@ -1,9 +1,11 @@
 use autocxx::c_int;
-use depthai_sys::{depthai, DaiBuffer};
+use depthai_sys::{depthai, DaiBuffer, DaiManipTemplate};
 
+use crate::camera::ImageFrame;
 use crate::common::ImageFrameType;
-use crate::error::{clear_error_flag, last_error, take_error_if_any, Result};
+use crate::error::{batch_result, clear_error_flag, last_error, take_error_if_any, Result};
 use crate::host_node::Buffer;
+use crate::queue::InputQueue;
 
 /// Resize mode for `ImageManipConfig::set_output_size`.
 ///
@@ -87,6 +89,18 @@ impl ImageManipConfig {
         self.buffer
     }
 
+    /// The config inside a generic `Buffer` message, e.g. one read back from a host input;
+    /// `None` if the buffer holds another message type.
+    pub fn from_buffer(buffer: Buffer) -> Result<Option<Self>> {
+        clear_error_flag();
+        let is_config = unsafe { depthai::dai_buffer_is_image_manip_config(buffer.handle()) };
+        if let Some(err) = take_error_if_any("failed to check buffer type") {
+            Err(err)
+        } else {
+            Ok(is_config.then_some(Self { buffer }))
+        }
+    }
+
     pub(crate) fn from_handle(handle: DaiBuffer) -> Self {
         Self {
             buffer: Buffer::from_handle(handle),
@@ -295,6 +309,208 @@ impl ImageManipConfig {
     }
 }
 
+/// Region of interest patched into an [`ImageManipTemplate`] instance.
+///
+/// `x`/`y` are the top-left corner for [`ManipOp::RoiCrop`] and the center for
+/// [`ManipOp::RoiCropRotated`]; units follow the op's `normalized` flag.
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct ManipRoi {
+    pub x: f32,
+    pub y: f32,
+    pub width: f32,
+    pub height: f32,
+    pub angle_deg: f32,
+}
+
+impl ManipRoi {
+    pub fn rect(x: f32, y: f32, width: f32, height: f32) -> Self {
+        Self {
+            x,
+            y,
+            width,
+            height,
+            angle_deg: 0.0,
+        }
+    }
+
+    fn to_raw(self) -> depthai_sys::DaiManipRoi {
+        depthai_sys::DaiManipRoi {
+            x: self.x,
+            y: self.y,
+            width: self.width,
+            height: self.height,
+            angle_deg: self.angle_deg,
+        }
+    }
+}
+
+/// One step of an [`ImageManipTemplate`] chain.
+///
+/// The fixed ops mirror the `ImageManipConfig::add_*` methods; the `Roi*` ops are slots filled
+/// from the [`ManipRoi`] of each instance.
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub enum ManipOp {
+    CropXywh { x: u32, y: u32, w: u32, h: u32 },
+    CropRect { x: f32, y: f32, w: f32, h: f32, normalized: bool },
+    CropRotatedRect { cx: f32, cy: f32, w: f32, h: f32, angle_deg: f32, normalized: bool },
+    Scale { x: f32, y: f32 },
+    RotateDeg(f32),
+    /// Rotation around a normalized center point.
+    RotateDegCenter { angle_deg: f32, center_x: f32, center_y: f32 },
+    FlipHorizontal,
+    FlipVertical,
+    Affine([f32; 4]),
+    Perspective([f32; 9]),
+    FourPoints { src: [(f32, f32); 4], dst: [(f32, f32); 4], normalized: bool },
+    /// Crop to the instance ROI rectangle.
+    RoiCrop { normalized: bool },
+    /// Crop to the instance ROI as a rotated rectangle.
+    RoiCropRotated { normalized: bool },
+    /// Rotate by the instance ROI angle.
+    RoiRotate,
+}
+
+impl ManipOp {
+    fn to_raw(self) -> depthai_sys::DaiManipOp {
+        use depthai_sys::{
+            DAI_MANIP_OP_AFFINE, DAI_MANIP_OP_CROP_RECT, DAI_MANIP_OP_CROP_ROTATED_RECT, DAI_MANIP_OP_CROP_XYWH,
+            DAI_MANIP_OP_FLIP_HORIZONTAL, DAI_MANIP_OP_FLIP_VERTICAL, DAI_MANIP_OP_FOUR_POINTS, DAI_MANIP_OP_PERSPECTIVE,
+            DAI_MANIP_OP_ROI_CROP, DAI_MANIP_OP_ROI_CROP_ROTATED, DAI_MANIP_OP_ROI_ROTATE, DAI_MANIP_OP_ROTATE,
+            DAI_MANIP_OP_ROTATE_CENTER, DAI_MANIP_OP_SCALE,
+        };
+        let mut op = depthai_sys::DaiManipOp::default();
+        let mut set = |kind: i32, normalized: bool, params: &[f32]| {
+            op.kind = kind;
+            op.normalized = normalized;
+            op.params[..params.len()].copy_from_slice(params);
+        };
+        match self {
+            ManipOp::CropXywh { x, y, w, h } => {
+                set(DAI_MANIP_OP_CROP_XYWH, false, &[x as f32, y as f32, w as f32, h as f32])
+            }
+            ManipOp::CropRect { x, y, w, h, normalized } => set(DAI_MANIP_OP_CROP_RECT, normalized, &[x, y, w, h]),
+            ManipOp::CropRotatedRect {
+                cx,
+                cy,
+                w,
+                h,
+                angle_deg,
+                normalized,
+            } => set(DAI_MANIP_OP_CROP_ROTATED_RECT, normalized, &[cx, cy, w, h, angle_deg]),
+            ManipOp::Scale { x, y } => set(DAI_MANIP_OP_SCALE, false, &[x, y]),
+            ManipOp::RotateDeg(angle) => set(DAI_MANIP_OP_ROTATE, false, &[angle]),
+            ManipOp::RotateDegCenter {
+                angle_deg,
+                center_x,
+                center_y,
+            } => set(DAI_MANIP_OP_ROTATE_CENTER, true, &[angle_deg, center_x, center_y]),
+            ManipOp::FlipHorizontal => set(DAI_MANIP_OP_FLIP_HORIZONTAL, false, &[]),
+            ManipOp::FlipVertical => set(DAI_MANIP_OP_FLIP_VERTICAL, false, &[]),
+            ManipOp::Affine(m) => set(DAI_MANIP_OP_AFFINE, false, &m),
+            ManipOp::Perspective(m) => set(DAI_MANIP_OP_PERSPECTIVE, false, &m),
+            ManipOp::FourPoints { src, dst, normalized } => {
+                let mut p = [0.0f32; 16];
+                for (i, (x, y)) in src.iter().chain(dst.iter()).enumerate() {
+                    p[2 * i] = *x;
+                    p[2 * i + 1] = *y;
+                }
+                set(DAI_MANIP_OP_FOUR_POINTS, normalized, &p)
+            }
+            ManipOp::RoiCrop { normalized } => set(DAI_MANIP_OP_ROI_CROP, normalized, &[]),
+            ManipOp::RoiCropRotated { normalized } => set(DAI_MANIP_OP_ROI_CROP_ROTATED, normalized, &[]),
+            ManipOp::RoiRotate => set(DAI_MANIP_OP_ROI_ROTATE, false, &[]),
+        }
+        op
+    }
+}
+
+/// Reusable `ImageManipConfig` recipe for per-frame ROI crops.
+///
+/// The op chain and output settings are captured once; [`Self::instantiate`] and
+/// [`Self::send_rois`] hand out recycled configs with only the ROI values patched in, so a crop
+/// costs one FFI call instead of building a config op by op each frame.
+pub struct ImageManipTemplate {
+    handle: DaiManipTemplate,
+}
+
+unsafe impl Send for ImageManipTemplate {}
+unsafe impl Sync for ImageManipTemplate {}
+
+impl Drop for ImageManipTemplate {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_manip_template_release(self.handle) };
+            self.handle = std::ptr::null_mut();
+        }
+    }
+}
+
+impl ImageManipTemplate {
+    /// `settings` supplies output size, resize mode, colormap, frame type etc. (its own ops are
+    /// ignored). Up to `max_idle` configs are kept for reuse once DepthAI releases them.
+    pub fn new(settings: Option<&ImageManipConfig>, ops: &[ManipOp], max_idle: usize) -> Result<Self> {
+        let raw: Vec<depthai_sys::DaiManipOp> = ops.iter().map(|op| op.to_raw()).collect();
+        let settings = settings.map_or(std::ptr::null_mut(), |cfg| cfg.handle());
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_manip_template_new(settings, raw.as_ptr(), raw.len(), max_idle) };
+        if handle.is_null() {
+            Err(last_error("failed to create ImageManip template"))
+        } else {
+            Ok(Self { handle })
+        }
+    }
+
+    /// Config for a single ROI.
+    pub fn instantiate(&self, roi: &ManipRoi) -> Result<ImageManipConfig> {
+        clear_error_flag();
+        let raw = roi.to_raw();
+        let handle = unsafe { depthai::dai_manip_template_instantiate(self.handle, &raw) };
+        if handle.is_null() {
+            Err(last_error("failed to instantiate ImageManip template"))
+        } else {
+            Ok(ImageManipConfig::from_handle(handle))
+        }
+    }
+
+    /// Sends one config per ROI to `config_queue` in a single call.
+    ///
+    /// With `image` the frame is sent to its queue first and the first config consumes it; every
+    /// further config reuses that image. Without it all configs crop the image the node already
+    /// holds. The ImageManip config input must be set to wait for messages. Returns the number of
+    /// configs sent. If a send fails partway, the error's
+    /// [`crate::DepthaiError::partial_sent`] counts the configs that went out, so the caller
+    /// knows which ROIs the node will still produce; the next batch should start with a fresh
+    /// image.
+    pub fn send_rois(
+        &self,
+        config_queue: &InputQueue,
+        image: Option<(&InputQueue, &ImageFrame)>,
+        rois: &[ManipRoi],
+    ) -> Result<usize> {
+        let raw: Vec<depthai_sys::DaiManipRoi> = rois.iter().map(|roi| roi.to_raw()).collect();
+        let (image_queue, frame) = image.map_or((std::ptr::null_mut(), std::ptr::null_mut()), |(q, f)| {
+            (q.handle(), f.handle())
+        });
+        clear_error_flag();
+        let sent = unsafe {
+            depthai::dai_manip_template_send_rois(
+                self.handle,
+                config_queue.handle(),
+                image_queue,
+                frame,
+                raw.as_ptr(),
+                raw.len(),
+            )
+        };
+        batch_result(sent, "failed to send ImageManip ROIs")
+    }
+
+    /// Configs allocated by this template, in flight or idle.
+    pub fn allocated(&self) -> usize {
+        unsafe { depthai::dai_manip_template_get_allocated(self.handle) }.into()
+    }
+}
+
 #[allow(non_snake_case)]
 #[crate::native_node_wrapper(native = "dai::node::ImageManip", inputs(inputConfig, inputImage), outputs(out))]
 pub struct ImageManipNode {
@@ -388,6 +388,9 @@
 //! # }
 //! ```
 //!
+//! [`DepthaiError::code`] classifies the failure (see [`ErrorCode`]). Native error state is kept
+//! per thread, so errors raised on callback or host-node threads never leak into other threads.
+//!
 //! ### Pipeline introspection
 //!
 //! Query pipeline structure and connections:
@@ -496,49 +499,79 @@ pub use depthai_macros::depthai_composite;
 pub use depthai_macros::depthai_host_node;
 pub use depthai_macros::depthai_threaded_host_node;
 
+pub mod benchmark;
+pub mod buffer_pool;
 pub mod camera;
 pub mod common;
+pub mod depth_projection;
 pub mod device;
 pub mod error;
+pub mod frame_bytes;
+pub mod frame_ring;
 pub mod host_node;
 pub mod encoded_frame;
 pub mod image_align;
+pub mod image_filters;
 pub mod image_manip;
+pub mod link_tuning;
+pub mod muxer;
 pub mod threaded_host_node;
 #[cfg(feature = "rerun")]
 pub mod rerun_host_node;
 pub mod output;
 pub mod pipeline;
+pub mod pixel_convert;
 pub mod pointcloud;
+pub mod pool_sizing;
 pub mod queue;
+pub mod queue_stream;
+pub mod remap;
+pub mod replay;
 pub mod rgbd;
 pub mod stereo_depth;
 pub mod video_encoder;
 
-pub use error::{DepthaiError, Result};
+pub use error::{DepthaiError, ErrorCode, Result};
 pub use pipeline::{CreateInPipeline, CreateInPipelineWith, DeviceNode, DeviceNodeWithParams};
 
-pub use device::Device;
+pub use device::{Device, DeviceInfo};
 pub use device::DevicePlatform;
-pub use pipeline::Pipeline;
+pub use pipeline::{HostNodeStats, LatencyHistogram, Pipeline, PipelineStats, PoolOccupancy, QueueStats};
+pub use pipeline::{GraphConnection, GraphNode, GraphPort, PipelineGraph};
 
 pub use output::{Output, Input};
-pub use pointcloud::{Point3fRGBA, PointCloudData};
-pub use queue::{Datatype, DatatypeEnum, InputQueue, MessageQueue, QueueCallbackHandle};
+pub use pointcloud::{Point3fRGBA, PointCloudData, PointCloudSoa, PointCloudSoaOptions};
+pub use depth_projection::{CameraIntrinsics, DepthProjector, ProjectionOptions};
+pub use remap::{cached_remap_tables, calibration_hash, create_remap_node, Rectification, RemapTable};
+pub use pixel_convert::{convert_pixels, converted_len, swap_rb_in_place, PixelLayout};
+pub use queue_stream::MessageStream;
+pub use queue::{wait_any, ConflationStats, Datatype, DatatypeEnum, InputQueue, MessageQueue, QueueCallbackHandle, QueueWaitSet, WaitableQueue};
 pub use image_manip::{
     Backend as ImageManipBackend,
     Colormap,
     ImageManipConfig,
     ImageManipNode,
     ImageManipResizeMode,
+    ImageManipTemplate,
+    ManipOp,
+    ManipRoi,
     PerformanceMode as ImageManipPerformanceMode,
 };
 pub use image_align::ImageAlignNode;
+pub use image_filters::{median_filter_depth, ImageFiltersNode, ImageFiltersPresetMode};
+pub use frame_bytes::FrameBytes;
+pub use frame_ring::{create_frame_ring_sink, FrameRingReader, FrameRingWriter, RingFrame, RingFrameMeta, RingPayloadKind};
+pub use replay::{create_frame_recorder_sink, create_replay_node, FrameRecorder, RecordedFrame, Recording, ReplayControl, ReplayOptions, ReplayRate, ReplaySeek, ReplaySource};
 pub use encoded_frame::{EncodedFrame, EncodedFrameProfile, EncodedFrameQueue, EncodedFrameType};
 pub use rgbd::{DepthUnit, RgbdData, RgbdNode};
 pub use stereo_depth::{PresetMode as StereoPresetMode, StereoDepthNode};
 pub use video_encoder::{VideoEncoderNode, VideoEncoderProfile, VideoEncoderRateControlMode};
-pub use host_node::{HostNode, HostNodeImpl, MessageGroup, Buffer};
+pub use host_node::{GroupMember, HostNode, HostNodeImpl, HostNodeWorkers, MessageGroup, MessageGroupLayout, Buffer};
+pub use benchmark::{depthai_core_version, BenchmarkInNode, BenchmarkOutNode, BenchmarkReport};
+pub use buffer_pool::{BufferPool, FramePool, PooledBuffer, PooledFrame};
+pub use link_tuning::{LinkProbe, LinkTuning, LinkTuningOptions, TuningObjective};
+pub use pool_sizing::{PoolRecommendation, PoolSizing, PoolSizingOptions};
+pub use muxer::{create_segmented_recorder_sink, MuxContainer, MuxMonitor, MuxStats, SegmentMuxerOptions, SegmentedMuxer};
 pub use threaded_host_node::{ThreadedHostNode, ThreadedHostNodeImpl, ThreadedHostNodeContext};
 #[cfg(feature = "rerun")]
-pub use rerun_host_node::{RerunHostNode, RerunHostNodeConfig, RerunViewer, RerunWebConfig, create_rerun_host_node};
+pub use rerun_host_node::{RerunHostNode, RerunHostNodeConfig, RerunLogMode, RerunViewer, RerunWebConfig, create_rerun_host_node};
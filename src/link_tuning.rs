@@ -0,0 +1,277 @@
+use std::path::{Path, PathBuf};
+use std::time::{Duration, Instant};
+
+use crate::benchmark::{depthai_core_version, BenchmarkInNode, BenchmarkOutNode, BenchmarkReport};
+use crate::device::Device;
+use crate::error::{DepthaiError, Result};
+use crate::host_node::Buffer;
+use crate::pipeline::Pipeline;
+
+/// What [`LinkTuning::calibrate`] optimizes for.
+#[derive(Debug, Clone, Copy, PartialEq, serde::Serialize, serde::Deserialize)]
+pub enum TuningObjective {
+    /// Lowest p99 latency at the expected message rate.
+    MinLatency,
+    /// Highest saturated throughput.
+    MaxThroughput,
+    /// Highest saturated throughput among chunk sizes whose p99 latency at the expected message
+    /// rate stays within the bound; falls back to [`Self::MinLatency`] if none does.
+    TargetLatency(Duration),
+}
+
+#[derive(Debug, Clone)]
+pub struct LinkTuningOptions {
+    pub objective: TuningObjective,
+    /// Representative message size, e.g. one NV12 frame of the main stream.
+    pub message_bytes: usize,
+    /// Expected message rate of that stream.
+    pub message_rate: f32,
+    /// Candidate XLink chunk sizes in bytes; `0` disables chunking.
+    pub chunk_sizes: Vec<i32>,
+    /// Measurement window per probe, after one discarded warm-up report.
+    pub probe_duration: Duration,
+    /// Reuse a previous result stored here when it matches the device and options, and store
+    /// fresh results here.
+    pub cache_path: Option<PathBuf>,
+}
+
+impl Default for LinkTuningOptions {
+    fn default() -> Self {
+        Self {
+            objective: TuningObjective::MinLatency,
+            message_bytes: 1280 * 720 * 3 / 2,
+            message_rate: 30.0,
+            chunk_sizes: vec![0, 16 << 10, 64 << 10, 256 << 10, 1 << 20],
+            probe_duration: Duration::from_secs(1),
+            cache_path: None,
+        }
+    }
+}
+
+/// Measurement for one candidate chunk size. Latencies are in seconds.
+#[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct LinkProbe {
+    pub chunk_size: i32,
+    /// Achieved rate when paced at the expected message rate.
+    pub paced_fps: Option<f32>,
+    pub latency_mean: Option<f32>,
+    pub latency_p99: Option<f32>,
+    /// Achieved rate when sending as fast as the link allows.
+    pub saturated_fps: Option<f32>,
+    pub throughput_mib_s: Option<f64>,
+}
+
+/// Link settings chosen by [`LinkTuning::calibrate`], serializable for later runs.
+#[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct LinkTuning {
+    /// Identifies the device, DepthAI-Core version and options the values were measured for;
+    /// cached results with a different key are ignored.
+    pub key: String,
+    pub xlink_chunk_size: i32,
+    /// Suggested `max_size` for device-to-host output queues of the probed stream.
+    pub queue_depth: u32,
+    /// Suggested frame pool size for the node producing the probed stream.
+    pub frames_pool: i32,
+    pub probes: Vec<LinkProbe>,
+}
+
+impl LinkTuning {
+    /// Probes the link to `device` with `BenchmarkOut` (device) -> `BenchmarkIn` (host) pipelines,
+    /// one per candidate chunk size, and picks the settings that best meet the objective.
+    ///
+    /// Each probe builds, starts and stops its own pipeline on `device`, so call this before
+    /// building the application pipeline. With `cache_path` set, a matching cached result is
+    /// returned without probing.
+    pub fn calibrate(device: &Device, options: &LinkTuningOptions) -> Result<Self> {
+        if options.chunk_sizes.is_empty() || options.message_bytes == 0 || options.message_rate <= 0.0 {
+            return Err(DepthaiError::new(
+                "link tuning needs at least one chunk size, a message size and a message rate",
+            ));
+        }
+        let key = tuning_key(device, options)?;
+        if let Some(path) = &options.cache_path {
+            if let Ok(cached) = Self::load(path) {
+                if cached.key == key {
+                    return Ok(cached);
+                }
+            }
+        }
+
+        let (paced, saturated) = match options.objective {
+            TuningObjective::MinLatency => (true, false),
+            TuningObjective::MaxThroughput => (false, true),
+            TuningObjective::TargetLatency(_) => (true, true),
+        };
+        let mut probes = Vec::with_capacity(options.chunk_sizes.len());
+        for &chunk_size in &options.chunk_sizes {
+            let mut probe = LinkProbe {
+                chunk_size,
+                paced_fps: None,
+                latency_mean: None,
+                latency_p99: None,
+                saturated_fps: None,
+                throughput_mib_s: None,
+            };
+            if paced {
+                let report = run_probe(device, options, chunk_size, Some(options.message_rate))?;
+                probe.paced_fps = Some(report.fps);
+                probe.latency_mean = Some(report.average_latency);
+                probe.latency_p99 = report.latency_percentile(0.99).map(|d| d.as_secs_f32());
+            }
+            if saturated {
+                let report = run_probe(device, options, chunk_size, None)?;
+                probe.saturated_fps = Some(report.fps);
+                probe.throughput_mib_s =
+                    Some(report.fps as f64 * options.message_bytes as f64 / (1 << 20) as f64);
+            }
+            probes.push(probe);
+        }
+
+        let best = options.objective.pick(&probes)
+            .ok_or_else(|| DepthaiError::new("link tuning produced no usable measurement"))?;
+        // Messages in flight over the link at the expected rate; pools and queues need that many
+        // slots plus headroom so neither side stalls while a transfer completes.
+        let latency = best.latency_p99.or(best.latency_mean).unwrap_or(0.0);
+        let in_flight = (latency * options.message_rate).ceil().max(0.0) as u32;
+        let tuning = Self {
+            key,
+            xlink_chunk_size: best.chunk_size,
+            queue_depth: (in_flight + 2).clamp(2, 16),
+            frames_pool: (in_flight + 3).clamp(3, 16) as i32,
+            probes,
+        };
+        if let Some(path) = &options.cache_path {
+            tuning.save(path)?;
+        }
+        Ok(tuning)
+    }
+
+    pub fn load(path: impl AsRef<Path>) -> Result<Self> {
+        let path = path.as_ref();
+        let s = std::fs::read_to_string(path)
+            .map_err(|e| DepthaiError::new(format!("failed to read link tuning {}: {e}", path.display())))?;
+        serde_json::from_str(&s)
+            .map_err(|e| DepthaiError::new(format!("invalid link tuning {}: {e}", path.display())))
+    }
+
+    pub fn save(&self, path: impl AsRef<Path>) -> Result<()> {
+        let path = path.as_ref();
+        let s = serde_json::to_string_pretty(self)
+            .map_err(|e| DepthaiError::new(format!("failed to serialize link tuning: {e}")))?;
+        std::fs::write(path, s)
+            .map_err(|e| DepthaiError::new(format!("failed to write link tuning {}: {e}", path.display())))
+    }
+}
+
+/// Keyed on the device id rather than the platform alone: two devices of the same platform on
+/// different links (USB and PoE, or different USB ports and hubs) need their own tuning.
+fn tuning_key(device: &Device, options: &LinkTuningOptions) -> Result<String> {
+    Ok(format!(
+        "{}/{:?}/{}/{}B@{}Hz/{:?}/{:?}",
+        device.device_id()?,
+        device.platform()?,
+        depthai_core_version()?,
+        options.message_bytes,
+        options.message_rate,
+        options.objective,
+        options.chunk_sizes,
+    ))
+}
+
+impl TuningObjective {
+    /// The probe that best meets this objective, ignoring probes that lack the needed measurement.
+    /// Latency comparisons use p99 and fall back to the mean.
+    pub fn pick(self, probes: &[LinkProbe]) -> Option<&LinkProbe> {
+        let by_latency = |p: &&LinkProbe| p.latency_p99.or(p.latency_mean);
+        let min_latency = || {
+            probes
+                .iter()
+                .filter(|p| by_latency(p).is_some())
+                .min_by(|a, b| by_latency(a).unwrap().total_cmp(&by_latency(b).unwrap()))
+        };
+        let max_throughput = |within: &dyn Fn(&LinkProbe) -> bool| {
+            probes
+                .iter()
+                .filter(|p| p.saturated_fps.is_some() && within(p))
+                .max_by(|a, b| a.saturated_fps.unwrap().total_cmp(&b.saturated_fps.unwrap()))
+        };
+        match self {
+            TuningObjective::MinLatency => min_latency(),
+            TuningObjective::MaxThroughput => max_throughput(&|_| true),
+            TuningObjective::TargetLatency(bound) => {
+                let bound = bound.as_secs_f32();
+                max_throughput(&|p| by_latency(&p).is_some_and(|l| l <= bound)).or_else(min_latency)
+            }
+        }
+    }
+}
+
+/// Byte rate the saturated probe is paced for: 10 Gbit/s, above every XLink transport (USB 3.2
+/// Gen 2, 10 GbE), so `BenchmarkOut` is never the bottleneck and the link sets the achieved rate.
+const SATURATION_BYTES_PER_SEC: f64 = 1.25e9;
+
+/// `BenchmarkOut` rate for the saturated probe; never below the expected message rate.
+fn saturation_fps(options: &LinkTuningOptions) -> f32 {
+    ((SATURATION_BYTES_PER_SEC / options.message_bytes.max(1) as f64) as f32).max(options.message_rate)
+}
+
+/// Runs one probe pipeline; `fps = None` saturates the link.
+fn run_probe(device: &Device, options: &LinkTuningOptions, chunk_size: i32, fps: Option<f32>) -> Result<BenchmarkReport> {
+    let pipeline = Pipeline::new().with_device(device).xlink_chunk_size(chunk_size).build()?;
+    let out = pipeline.create::<BenchmarkOutNode>()?;
+    out.set_run_on_host(false);
+    out.set_fps(fps.unwrap_or_else(|| saturation_fps(options)));
+    let input = pipeline.create::<BenchmarkInNode>()?;
+    input.set_run_on_host(true);
+    let rate = fps.unwrap_or(options.message_rate);
+    input.send_report_every_n_messages((rate * options.probe_duration.as_secs_f32() / 4.0).max(5.0) as u32);
+    input.measure_individual_latencies(true);
+    out.out()?.link(&input.input()?)?;
+
+    let feed = out.input()?.create_input_queue(1, true)?;
+    let reports = input.report()?.create_message_queue(16, false)?;
+    pipeline.start()?;
+    feed.send_buffer(&Buffer::from_bytes(&vec![0; options.message_bytes])?)?;
+
+    // First report covers link start-up; aggregate the ones after it.
+    let mut merged: Option<BenchmarkReport> = None;
+    let mut warmed_up = false;
+    let mut measure_start = Instant::now();
+    let mut last_report = measure_start;
+    let mut deadline = Instant::now() + options.probe_duration * 4;
+    while Instant::now() < deadline {
+        let Some(msg) = reports.get(Some(Duration::from_millis(200)))? else {
+            continue;
+        };
+        let Some(report) = msg.as_benchmark_report()? else {
+            continue;
+        };
+        if !warmed_up {
+            warmed_up = true;
+            measure_start = Instant::now();
+            deadline = measure_start + options.probe_duration;
+            continue;
+        }
+        last_report = Instant::now();
+        match merged.as_mut() {
+            None => merged = Some(report),
+            Some(m) => {
+                let total = (m.num_messages_received + report.num_messages_received).max(1) as f32;
+                m.average_latency = (m.average_latency * m.num_messages_received as f32
+                    + report.average_latency * report.num_messages_received as f32)
+                    / total;
+                m.num_messages_received += report.num_messages_received;
+                m.latencies.extend(report.latencies);
+            }
+        }
+    }
+    pipeline.stop()?;
+    let mut merged =
+        merged.ok_or_else(|| DepthaiError::new(format!("no benchmark report for chunk size {chunk_size}")))?;
+    // Rate over the span the merged reports cover, not up to the deadline: the wait after the
+    // last report would otherwise count as time with no messages.
+    let elapsed = (last_report - measure_start).as_secs_f32();
+    merged.time_total = elapsed;
+    merged.fps = merged.num_messages_received as f32 / elapsed.max(f32::EPSILON);
+    Ok(merged)
+}
@@ -0,0 +1,894 @@
+//! Segmented fragmented-MP4 / Matroska recording of `VideoEncoder` output.
+//!
+//! [`SegmentedMuxer`] packs H.264, H.265 and MJPEG [`EncodedFrame`]s into self-contained segment
+//! files (`<prefix>-00000.mp4`, ...), each starting at a keyframe. Samples are buffered as the
+//! frames themselves and written as one fragment (MP4 `moof`+`mdat`) or cluster (MKV) with a
+//! single vectored write: headers and NAL length prefixes come from a small side buffer, the
+//! payload is gathered straight from the frames' `frameOffset`/`frameSize` slices. Nothing is
+//! written between fragments, so keeping `fragment_duration` around a second keeps syscalls to a
+//! handful per stream per second.
+
+use std::fs::File;
+use std::io::{self, IoSlice, Write};
+use std::path::PathBuf;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::Duration;
+
+use crate::encoded_frame::{EncodedFrame, EncodedFrameProfile};
+use crate::error::{DepthaiError, Result};
+use crate::output::{Input, Output};
+use crate::pipeline::Pipeline;
+use crate::threaded_host_node::{ThreadedHostNode, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+/// MP4 media timescale (ticks per second).
+const MP4_TIMESCALE: i128 = 90_000;
+/// Matroska `TimestampScale`: block timestamps are in milliseconds.
+const MKV_TIMESTAMP_SCALE: i64 = 1_000_000;
+/// Matroska block timestamps are 16-bit offsets from their cluster.
+const MKV_MAX_CLUSTER_SPAN: Duration = Duration::from_secs(30);
+/// Sample duration assumed for the last sample of a recording (30 fps).
+const DEFAULT_SAMPLE_NS: i64 = 33_333_333;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum MuxContainer {
+    /// Fragmented MP4 (`ftyp`+`moov`, then `moof`+`mdat` fragments).
+    FragmentedMp4,
+    /// Matroska with unknown-size segment and clusters, playable while being written.
+    Matroska,
+}
+
+impl MuxContainer {
+    fn extension(self) -> &'static str {
+        match self {
+            Self::FragmentedMp4 => "mp4",
+            Self::Matroska => "mkv",
+        }
+    }
+}
+
+#[derive(Debug, Clone)]
+pub struct SegmentMuxerOptions {
+    pub container: MuxContainer,
+    /// A new segment starts at the first keyframe after this much recorded time.
+    pub segment_duration: Duration,
+    /// Longest span of samples buffered before a fragment / cluster is written.
+    pub fragment_duration: Duration,
+    /// Buffered payload bytes that force a write regardless of `fragment_duration`.
+    pub batch_bytes: usize,
+}
+
+impl Default for SegmentMuxerOptions {
+    fn default() -> Self {
+        Self {
+            container: MuxContainer::FragmentedMp4,
+            segment_duration: Duration::from_secs(60),
+            fragment_duration: Duration::from_secs(1),
+            batch_bytes: 4 << 20,
+        }
+    }
+}
+
+/// Counters of a [`SegmentedMuxer`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct MuxStats {
+    pub frames: u64,
+    /// Bytes written, container overhead included.
+    pub bytes: u64,
+    /// `write`/`writev` calls issued.
+    pub write_calls: u64,
+    pub segments: u64,
+    /// Frames dropped before the first keyframe with parameter sets, or with no usable payload.
+    pub dropped: u64,
+}
+
+#[derive(Default)]
+struct MuxShared {
+    frames: AtomicU64,
+    bytes: AtomicU64,
+    write_calls: AtomicU64,
+    segments: AtomicU64,
+    dropped: AtomicU64,
+    paths: Mutex<Vec<PathBuf>>,
+}
+
+/// Read-only view of a muxer's counters and segment list, usable after the muxer moved into a
+/// sink node.
+#[derive(Clone)]
+pub struct MuxMonitor {
+    shared: Arc<MuxShared>,
+}
+
+impl MuxMonitor {
+    pub fn stats(&self) -> MuxStats {
+        let s = &self.shared;
+        MuxStats {
+            frames: s.frames.load(Ordering::Relaxed),
+            bytes: s.bytes.load(Ordering::Relaxed),
+            write_calls: s.write_calls.load(Ordering::Relaxed),
+            segments: s.segments.load(Ordering::Relaxed),
+            dropped: s.dropped.load(Ordering::Relaxed),
+        }
+    }
+
+    /// Segment files created so far, oldest first; the last one may still be open.
+    pub fn segments(&self) -> Vec<PathBuf> {
+        self.shared.paths.lock().unwrap_or_else(|e| e.into_inner()).clone()
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum Codec {
+    Avc,
+    Hevc,
+    Jpeg,
+}
+
+struct Sample {
+    frame: EncodedFrame,
+    /// NAL unit ranges (without start codes) for AVC/HEVC, the whole payload for JPEG.
+    nals: Vec<(usize, usize)>,
+    /// Stored size: NALs with 4-byte length prefixes, or the JPEG as-is.
+    size: usize,
+    prefixed: bool,
+    ts_ns: i64,
+    key: bool,
+}
+
+struct Segment {
+    file: File,
+    codec: Codec,
+    config: Vec<u8>,
+    width: u32,
+    height: u32,
+    base_ns: i64,
+    sequence: u32,
+}
+
+/// One piece of a vectored write: bytes of the side buffer or a slice of a pending frame.
+enum Piece {
+    Side(usize, usize),
+    Frame(usize, usize, usize),
+}
+
+/// Muxes one encoded stream into rotating segment files.
+pub struct SegmentedMuxer {
+    dir: PathBuf,
+    prefix: String,
+    options: SegmentMuxerOptions,
+    segment: Option<Segment>,
+    next_index: u32,
+    pending: Vec<Sample>,
+    pending_bytes: usize,
+    last_ts_ns: Option<i64>,
+    last_duration_ns: i64,
+    side: Vec<u8>,
+    pieces: Vec<Piece>,
+    shared: Arc<MuxShared>,
+}
+
+impl SegmentedMuxer {
+    /// Writes segments named `<prefix>-NNNNN.<ext>` into `dir` (created if missing).
+    pub fn new(dir: impl Into<PathBuf>, prefix: &str, options: SegmentMuxerOptions) -> Result<Self> {
+        let dir = dir.into();
+        std::fs::create_dir_all(&dir)
+            .map_err(|e| DepthaiError::new(format!("failed to create recording directory {}: {e}", dir.display())))?;
+        let mut options = options;
+        if options.container == MuxContainer::Matroska {
+            options.fragment_duration = options.fragment_duration.min(MKV_MAX_CLUSTER_SPAN);
+        }
+        Ok(Self {
+            dir,
+            prefix: prefix.to_string(),
+            options,
+            segment: None,
+            next_index: 0,
+            pending: Vec::new(),
+            pending_bytes: 0,
+            last_ts_ns: None,
+            last_duration_ns: DEFAULT_SAMPLE_NS,
+            side: Vec::new(),
+            pieces: Vec::new(),
+            shared: Arc::default(),
+        })
+    }
+
+    pub fn monitor(&self) -> MuxMonitor {
+        MuxMonitor {
+            shared: Arc::clone(&self.shared),
+        }
+    }
+
+    pub fn stats(&self) -> MuxStats {
+        self.monitor().stats()
+    }
+
+    /// Queues `frame`; writes a fragment or rotates the segment when due.
+    ///
+    /// Frames are assumed to arrive in decode order with presentation timestamps equal to decode
+    /// timestamps (no B-frames, DepthAI's default).
+    pub fn push(&mut self, frame: EncodedFrame) -> Result<()> {
+        let codec = match frame.profile() {
+            Some(EncodedFrameProfile::Avc) => Codec::Avc,
+            Some(EncodedFrameProfile::Hevc) => Codec::Hevc,
+            Some(EncodedFrameProfile::Jpeg) => Codec::Jpeg,
+            None => {
+                self.drop_frame();
+                return Ok(());
+            }
+        };
+        let data = frame.as_bytes();
+        if data.is_empty() {
+            self.drop_frame();
+            return Ok(());
+        }
+        let key = frame.is_keyframe();
+        let nals = match codec {
+            Codec::Jpeg => vec![(0, data.len())],
+            _ => annexb_nals(data, codec),
+        };
+        let size = match codec {
+            Codec::Jpeg => data.len(),
+            _ => nals.iter().map(|&(_, len)| 4 + len).sum(),
+        };
+        // Keep timestamps strictly increasing so sample durations stay positive.
+        let mut ts_ns = frame.timestamp_ns();
+        if let Some(last) = self.last_ts_ns {
+            ts_ns = ts_ns.max(last + 1);
+        }
+
+        if key {
+            let (width, height) = (frame.width(), frame.height());
+            if let Some(config) = codec_config(codec, data, &nals) {
+                let rotate = match &self.segment {
+                    None => true,
+                    Some(seg) => {
+                        seg.codec != codec
+                            || seg.config != config
+                            || (seg.width, seg.height) != (width, height)
+                            || ts_ns - seg.base_ns >= self.options.segment_duration.as_nanos() as i64
+                    }
+                };
+                if rotate {
+                    self.write_pending(false, Some(ts_ns))?;
+                    self.segment = None;
+                    self.open_segment(codec, config, width, height, ts_ns)?;
+                }
+            }
+        }
+        if self.segment.as_ref().is_none_or(|seg| seg.codec != codec) {
+            self.drop_frame();
+            return Ok(());
+        }
+
+        self.last_ts_ns = Some(ts_ns);
+        self.pending_bytes += size;
+        self.pending.push(Sample {
+            frame,
+            nals,
+            size,
+            prefixed: codec != Codec::Jpeg,
+            ts_ns,
+            key,
+        });
+        let span = ts_ns - self.pending[0].ts_ns;
+        if self.pending_bytes >= self.options.batch_bytes || span >= self.options.fragment_duration.as_nanos() as i64 {
+            // The newest sample stays queued: its duration is only known once the next one arrives.
+            self.write_pending(true, None)?;
+        }
+        Ok(())
+    }
+
+    /// Writes everything still queued and closes the current segment.
+    pub fn finish(&mut self) -> Result<()> {
+        let result = self.write_pending(false, None);
+        if let Some(seg) = self.segment.take() {
+            seg.file.sync_data().ok();
+        }
+        result
+    }
+
+    fn drop_frame(&self) {
+        self.shared.dropped.fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn open_segment(&mut self, codec: Codec, config: Vec<u8>, width: u32, height: u32, base_ns: i64) -> Result<()> {
+        let path = self.dir.join(format!(
+            "{}-{:05}.{}",
+            self.prefix,
+            self.next_index,
+            self.options.container.extension()
+        ));
+        let mut file = File::create(&path)
+            .map_err(|e| DepthaiError::new(format!("failed to create segment {}: {e}", path.display())))?;
+        let mut init = Vec::with_capacity(1024);
+        match self.options.container {
+            MuxContainer::FragmentedMp4 => mp4_init(&mut init, codec, &config, width, height),
+            MuxContainer::Matroska => mkv_init(&mut init, codec, &config, width, height),
+        }
+        file.write_all(&init)
+            .map_err(|e| DepthaiError::new(format!("failed to write segment {}: {e}", path.display())))?;
+        self.shared.write_calls.fetch_add(1, Ordering::Relaxed);
+        self.shared.bytes.fetch_add(init.len() as u64, Ordering::Relaxed);
+        self.shared.segments.fetch_add(1, Ordering::Relaxed);
+        self.shared.paths.lock().unwrap_or_else(|e| e.into_inner()).push(path);
+        self.next_index += 1;
+        self.segment = Some(Segment {
+            file,
+            codec,
+            config,
+            width,
+            height,
+            base_ns,
+            sequence: 0,
+        });
+        Ok(())
+    }
+
+    /// Writes the queued samples as one fragment / cluster, keeping the newest one queued when
+    /// `keep_last` is set. `next_ts_ns` gives the duration of the last written sample.
+    fn write_pending(&mut self, keep_last: bool, next_ts_ns: Option<i64>) -> Result<()> {
+        let count = if keep_last { self.pending.len().saturating_sub(1) } else { self.pending.len() };
+        let Some(seg) = self.segment.as_mut() else {
+            return Ok(());
+        };
+        if count == 0 {
+            return Ok(());
+        }
+        let samples = &self.pending[..count];
+        let end_ns = match (self.pending.get(count), next_ts_ns) {
+            (Some(next), _) => next.ts_ns,
+            (None, Some(ts)) => ts,
+            (None, None) => samples[count - 1].ts_ns + self.last_duration_ns,
+        };
+        if count > 1 {
+            self.last_duration_ns = (samples[count - 1].ts_ns - samples[0].ts_ns) / (count as i64 - 1);
+        }
+
+        self.side.clear();
+        self.pieces.clear();
+        match self.options.container {
+            MuxContainer::FragmentedMp4 => {
+                seg.sequence += 1;
+                mp4_fragment(&mut self.side, &mut self.pieces, seg, samples, end_ns);
+            }
+            MuxContainer::Matroska => mkv_cluster(&mut self.side, &mut self.pieces, seg, samples),
+        }
+
+        let side = &self.side;
+        let mut slices: Vec<IoSlice<'_>> = self
+            .pieces
+            .iter()
+            .map(|piece| match *piece {
+                Piece::Side(start, end) => IoSlice::new(&side[start..end]),
+                Piece::Frame(i, start, end) => IoSlice::new(&samples[i].frame.as_bytes()[start..end]),
+            })
+            .collect();
+        let total: usize = slices.iter().map(|s| s.len()).sum();
+        let calls = write_all_vectored(&mut seg.file, &mut slices)
+            .map_err(|e| DepthaiError::new(format!("failed to write recording segment: {e}")))?;
+        drop(slices);
+
+        self.shared.write_calls.fetch_add(calls, Ordering::Relaxed);
+        self.shared.bytes.fetch_add(total as u64, Ordering::Relaxed);
+        self.shared.frames.fetch_add(count as u64, Ordering::Relaxed);
+        self.pending_bytes -= self.pending[..count].iter().map(|s| s.size).sum::<usize>();
+        self.pending.drain(..count);
+        Ok(())
+    }
+}
+
+impl Drop for SegmentedMuxer {
+    fn drop(&mut self) {
+        let _ = self.finish();
+    }
+}
+
+/// `write_vectored` until every slice is written; returns the number of calls.
+fn write_all_vectored(file: &mut File, mut slices: &mut [IoSlice<'_>]) -> io::Result<u64> {
+    let mut calls = 0;
+    IoSlice::advance_slices(&mut slices, 0);
+    while !slices.is_empty() {
+        let n = match file.write_vectored(slices) {
+            Ok(0) => return Err(io::ErrorKind::WriteZero.into()),
+            Ok(n) => n,
+            Err(e) if e.kind() == io::ErrorKind::Interrupted => continue,
+            Err(e) => return Err(e),
+        };
+        calls += 1;
+        IoSlice::advance_slices(&mut slices, n);
+    }
+    Ok(calls)
+}
+
+fn nal_type(codec: Codec, header: u8) -> u8 {
+    match codec {
+        Codec::Hevc => (header >> 1) & 0x3f,
+        _ => header & 0x1f,
+    }
+}
+
+fn is_aud(codec: Codec, header: u8) -> bool {
+    match codec {
+        Codec::Avc => nal_type(codec, header) == 9,
+        Codec::Hevc => nal_type(codec, header) == 35,
+        Codec::Jpeg => false,
+    }
+}
+
+/// Splits an Annex-B access unit into NAL ranges, dropping access unit delimiters.
+fn annexb_nals(data: &[u8], codec: Codec) -> Vec<(usize, usize)> {
+    let mut starts = Vec::new();
+    let mut i = 0;
+    while i + 2 < data.len() {
+        if data[i + 2] > 1 {
+            i += 3;
+        } else if data[i + 2] == 1 && data[i + 1] == 0 && data[i] == 0 {
+            starts.push(i + 3);
+            i += 3;
+        } else {
+            i += 1;
+        }
+    }
+    if starts.is_empty() {
+        return vec![(0, data.len())];
+    }
+    let mut nals = Vec::with_capacity(starts.len());
+    for (k, &begin) in starts.iter().enumerate() {
+        let mut end = starts.get(k + 1).map_or(data.len(), |&next| next - 3);
+        // Trailing zero bytes belong to the next start code (a NAL never ends in 0x00).
+        while end > begin && data[end - 1] == 0 {
+            end -= 1;
+        }
+        if end > begin && !is_aud(codec, data[begin]) {
+            nals.push((begin, end - begin));
+        }
+    }
+    nals
+}
+
+/// Removes emulation prevention bytes from the first `max` bytes of a NAL payload.
+fn unescape(src: &[u8], max: usize) -> Vec<u8> {
+    let mut out = Vec::with_capacity(max.min(src.len()));
+    let mut zeros = 0;
+    for &b in src {
+        if out.len() >= max {
+            break;
+        }
+        if zeros >= 2 && b == 3 {
+            zeros = 0;
+            continue;
+        }
+        zeros = if b == 0 { zeros + 1 } else { 0 };
+        out.push(b);
+    }
+    out
+}
+
+/// Decoder configuration record (`avcC` / `hvcC` body) from a keyframe's parameter sets; empty
+/// for JPEG. `None` when the keyframe carries no parameter sets.
+fn codec_config(codec: Codec, data: &[u8], nals: &[(usize, usize)]) -> Option<Vec<u8>> {
+    let find = |ty: u8| {
+        nals.iter()
+            .map(|&(start, len)| &data[start..start + len])
+            .find(|nal| nal_type(codec, nal[0]) == ty)
+    };
+    match codec {
+        Codec::Jpeg => Some(Vec::new()),
+        Codec::Avc => {
+            let (sps, pps) = (find(7)?, find(8)?);
+            if sps.len() < 4 {
+                return None;
+            }
+            let mut out = vec![1, sps[1], sps[2], sps[3], 0xff, 0xe1];
+            out.extend_from_slice(&(sps.len() as u16).to_be_bytes());
+            out.extend_from_slice(sps);
+            out.push(1);
+            out.extend_from_slice(&(pps.len() as u16).to_be_bytes());
+            out.extend_from_slice(pps);
+            if matches!(sps[1], 100 | 110 | 122 | 144) {
+                // High-profile extension; DepthAI encodes 8-bit 4:2:0.
+                out.extend_from_slice(&[0xfd, 0xf8, 0xf8, 0x00]);
+            }
+            Some(out)
+        }
+        Codec::Hevc => {
+            let (vps, sps, pps) = (find(32)?, find(33)?, find(34)?);
+            let rbsp = unescape(sps.get(2..)?, 16);
+            if rbsp.len() < 13 {
+                return None;
+            }
+            let sub_layers = ((rbsp[0] >> 1) & 0x07) + 1;
+            let nested = rbsp[0] & 0x01;
+            let mut out = vec![1];
+            // general_profile_space/tier/idc, compatibility flags, constraint flags, level.
+            out.extend_from_slice(&rbsp[1..13]);
+            // min_spatial_segmentation, parallelism, 4:2:0, 8-bit luma/chroma, avg frame rate.
+            out.extend_from_slice(&[0xf0, 0x00, 0xfc, 0xfd, 0xf8, 0xf8, 0x00, 0x00]);
+            out.push((sub_layers << 3) | (nested << 2) | 0x03);
+            out.push(3);
+            for (ty, nal) in [(32u8, vps), (33, sps), (34, pps)] {
+                out.push(0x80 | ty);
+                out.extend_from_slice(&1u16.to_be_bytes());
+                out.extend_from_slice(&(nal.len() as u16).to_be_bytes());
+                out.extend_from_slice(nal);
+            }
+            Some(out)
+        }
+    }
+}
+
+fn put16(out: &mut Vec<u8>, v: u16) {
+    out.extend_from_slice(&v.to_be_bytes());
+}
+
+fn put32(out: &mut Vec<u8>, v: u32) {
+    out.extend_from_slice(&v.to_be_bytes());
+}
+
+fn begin_box(out: &mut Vec<u8>, kind: &[u8; 4]) -> usize {
+    let at = out.len();
+    out.extend_from_slice(&[0; 4]);
+    out.extend_from_slice(kind);
+    at
+}
+
+fn begin_full_box(out: &mut Vec<u8>, kind: &[u8; 4], version: u8, flags: u32) -> usize {
+    let at = begin_box(out, kind);
+    out.push(version);
+    out.extend_from_slice(&flags.to_be_bytes()[1..]);
+    at
+}
+
+fn end_box(out: &mut Vec<u8>, at: usize) {
+    let size = (out.len() - at) as u32;
+    out[at..at + 4].copy_from_slice(&size.to_be_bytes());
+}
+
+fn put_matrix(out: &mut Vec<u8>) {
+    for v in [0x0001_0000u32, 0, 0, 0, 0x0001_0000, 0, 0, 0, 0x4000_0000] {
+        put32(out, v);
+    }
+}
+
+fn mp4_init(out: &mut Vec<u8>, codec: Codec, config: &[u8], width: u32, height: u32) {
+    let ftyp = begin_box(out, b"ftyp");
+    out.extend_from_slice(b"isom");
+    put32(out, 0x200);
+    out.extend_from_slice(b"isomiso6mp41");
+    end_box(out, ftyp);
+
+    let moov = begin_box(out, b"moov");
+    let mvhd = begin_full_box(out, b"mvhd", 0, 0);
+    put32(out, 0);
+    put32(out, 0);
+    put32(out, 1000);
+    put32(out, 0);
+    put32(out, 0x0001_0000);
+    put16(out, 0x0100);
+    out.extend_from_slice(&[0; 10]);
+    put_matrix(out);
+    out.extend_from_slice(&[0; 24]);
+    put32(out, 2);
+    end_box(out, mvhd);
+
+    let trak = begin_box(out, b"trak");
+    let tkhd = begin_full_box(out, b"tkhd", 0, 3);
+    put32(out, 0);
+    put32(out, 0);
+    put32(out, 1);
+    put32(out, 0);
+    put32(out, 0);
+    out.extend_from_slice(&[0; 16]);
+    put_matrix(out);
+    put32(out, width << 16);
+    put32(out, height << 16);
+    end_box(out, tkhd);
+
+    let mdia = begin_box(out, b"mdia");
+    let mdhd = begin_full_box(out, b"mdhd", 0, 0);
+    put32(out, 0);
+    put32(out, 0);
+    put32(out, MP4_TIMESCALE as u32);
+    put32(out, 0);
+    put16(out, 0x55c4);
+    put16(out, 0);
+    end_box(out, mdhd);
+    let hdlr = begin_full_box(out, b"hdlr", 0, 0);
+    put32(out, 0);
+    out.extend_from_slice(b"vide");
+    out.extend_from_slice(&[0; 12]);
+    out.extend_from_slice(b"VideoHandler\0");
+    end_box(out, hdlr);
+
+    let minf = begin_box(out, b"minf");
+    let vmhd = begin_full_box(out, b"vmhd", 0, 1);
+    out.extend_from_slice(&[0; 8]);
+    end_box(out, vmhd);
+    let dinf = begin_box(out, b"dinf");
+    let dref = begin_full_box(out, b"dref", 0, 0);
+    put32(out, 1);
+    let url = begin_full_box(out, b"url ", 0, 1);
+    end_box(out, url);
+    end_box(out, dref);
+    end_box(out, dinf);
+
+    let stbl = begin_box(out, b"stbl");
+    let stsd = begin_full_box(out, b"stsd", 0, 0);
+    put32(out, 1);
+    let fourcc = match codec {
+        // avc3/hev1 allow the in-band parameter sets DepthAI repeats at every keyframe.
+        Codec::Avc => b"avc3",
+        Codec::Hevc => b"hev1",
+        Codec::Jpeg => b"mp4v",
+    };
+    let entry = begin_box(out, fourcc);
+    out.extend_from_slice(&[0; 6]);
+    put16(out, 1);
+    out.extend_from_slice(&[0; 16]);
+    put16(out, width as u16);
+    put16(out, height as u16);
+    put32(out, 0x0048_0000);
+    put32(out, 0x0048_0000);
+    put32(out, 0);
+    put16(out, 1);
+    out.extend_from_slice(&[0; 32]);
+    put16(out, 0x0018);
+    put16(out, 0xffff);
+    match codec {
+        Codec::Avc | Codec::Hevc => {
+            let cfg = begin_box(out, if codec == Codec::Avc { b"avcC" } else { b"hvcC" });
+            out.extend_from_slice(config);
+            end_box(out, cfg);
+        }
+        Codec::Jpeg => {
+            let esds = begin_full_box(out, b"esds", 0, 0);
+            // ES_Descriptor { ES_ID 1, DecoderConfig { JPEG (0x6c), visual stream }, SLConfig }
+            out.extend_from_slice(&[0x03, 21, 0x00, 0x01, 0x00, 0x04, 13, 0x6c, 0x11]);
+            out.extend_from_slice(&[0; 11]);
+            out.extend_from_slice(&[0x06, 1, 0x02]);
+            end_box(out, esds);
+        }
+    }
+    end_box(out, entry);
+    end_box(out, stsd);
+    for kind in [b"stts", b"stsc", b"stco"] {
+        let b = begin_full_box(out, kind, 0, 0);
+        put32(out, 0);
+        end_box(out, b);
+    }
+    let stsz = begin_full_box(out, b"stsz", 0, 0);
+    put32(out, 0);
+    put32(out, 0);
+    end_box(out, stsz);
+    end_box(out, stbl);
+    end_box(out, minf);
+    end_box(out, mdia);
+    end_box(out, trak);
+
+    let mvex = begin_box(out, b"mvex");
+    let trex = begin_full_box(out, b"trex", 0, 0);
+    for v in [1, 1, 0, 0, 0] {
+        put32(out, v);
+    }
+    end_box(out, trex);
+    end_box(out, mvex);
+    end_box(out, moov);
+}
+
+fn mp4_ticks(ns: i64) -> u64 {
+    (ns.max(0) as i128 * MP4_TIMESCALE / 1_000_000_000) as u64
+}
+
+/// Appends the pieces of one `moof`+`mdat` fragment ending at `end_ns`.
+fn mp4_fragment(side: &mut Vec<u8>, pieces: &mut Vec<Piece>, seg: &Segment, samples: &[Sample], end_ns: i64) {
+    let ticks: Vec<u64> = samples
+        .iter()
+        .map(|s| s.ts_ns)
+        .chain(std::iter::once(end_ns))
+        .map(|ts| mp4_ticks(ts - seg.base_ns))
+        .collect();
+    let payload: usize = samples.iter().map(|s| s.size).sum();
+    let large = payload + 8 > u32::MAX as usize;
+
+    let moof = begin_box(side, b"moof");
+    let mfhd = begin_full_box(side, b"mfhd", 0, 0);
+    put32(side, seg.sequence);
+    end_box(side, mfhd);
+    let traf = begin_box(side, b"traf");
+    // default-base-is-moof: data offsets are relative to this moof.
+    let tfhd = begin_full_box(side, b"tfhd", 0, 0x02_0000);
+    put32(side, 1);
+    end_box(side, tfhd);
+    let tfdt = begin_full_box(side, b"tfdt", 1, 0);
+    side.extend_from_slice(&ticks[0].to_be_bytes());
+    end_box(side, tfdt);
+    // data-offset, sample-duration, sample-size and sample-flags present.
+    let trun = begin_full_box(side, b"trun", 0, 0x00_0701);
+    put32(side, samples.len() as u32);
+    let data_offset_at = side.len();
+    put32(side, 0);
+    for (i, s) in samples.iter().enumerate() {
+        put32(side, ticks[i + 1].saturating_sub(ticks[i]).max(1) as u32);
+        put32(side, s.size as u32);
+        put32(side, if s.key { 0x0200_0000 } else { 0x0101_0000 });
+    }
+    end_box(side, trun);
+    end_box(side, traf);
+    end_box(side, moof);
+
+    let mdat_header = if large { 16 } else { 8 };
+    let data_offset = (side.len() - moof + mdat_header) as u32;
+    side[data_offset_at..data_offset_at + 4].copy_from_slice(&data_offset.to_be_bytes());
+    if large {
+        put32(side, 1);
+        side.extend_from_slice(b"mdat");
+        side.extend_from_slice(&((payload + 16) as u64).to_be_bytes());
+    } else {
+        put32(side, (payload + 8) as u32);
+        side.extend_from_slice(b"mdat");
+    }
+    push_payload(side, pieces, 0, samples, 0);
+}
+
+/// Appends the payload pieces of `samples` (referenced as pending samples `first..`): JPEGs
+/// as-is, NALs behind 4-byte length prefixes. `side_from` is where unreferenced side bytes start.
+fn push_payload(side: &mut Vec<u8>, pieces: &mut Vec<Piece>, mut side_from: usize, samples: &[Sample], first: usize) {
+    for (i, s) in samples.iter().enumerate() {
+        for &(start, len) in &s.nals {
+            if s.prefixed {
+                put32(side, len as u32);
+            }
+            if side_from < side.len() {
+                pieces.push(Piece::Side(side_from, side.len()));
+                side_from = side.len();
+            }
+            pieces.push(Piece::Frame(first + i, start, start + len));
+        }
+    }
+    if side_from < side.len() {
+        pieces.push(Piece::Side(side_from, side.len()));
+    }
+}
+
+fn ebml_id(out: &mut Vec<u8>, id: u32) {
+    let bytes = id.to_be_bytes();
+    let skip = bytes.iter().take_while(|&&b| b == 0).count();
+    out.extend_from_slice(&bytes[skip..]);
+}
+
+fn ebml_size(out: &mut Vec<u8>, size: u64) {
+    let mut len = 1;
+    while len < 8 && size >= (1u64 << (7 * len)) - 1 {
+        len += 1;
+    }
+    let v = size | (1u64 << (7 * len));
+    out.extend_from_slice(&v.to_be_bytes()[8 - len..]);
+}
+
+fn ebml_bytes(out: &mut Vec<u8>, id: u32, body: &[u8]) {
+    ebml_id(out, id);
+    ebml_size(out, body.len() as u64);
+    out.extend_from_slice(body);
+}
+
+fn ebml_uint(out: &mut Vec<u8>, id: u32, v: u64) {
+    let bytes = v.to_be_bytes();
+    let skip = bytes.iter().take_while(|&&b| b == 0).count().min(7);
+    ebml_bytes(out, id, &bytes[skip..]);
+}
+
+fn ebml_master(out: &mut Vec<u8>, id: u32, f: impl FnOnce(&mut Vec<u8>)) {
+    let mut body = Vec::new();
+    f(&mut body);
+    ebml_bytes(out, id, &body);
+}
+
+fn mkv_init(out: &mut Vec<u8>, codec: Codec, config: &[u8], width: u32, height: u32) {
+    ebml_master(out, 0x1a45_dfa3, |h| {
+        ebml_uint(h, 0x4286, 1);
+        ebml_uint(h, 0x42f7, 1);
+        ebml_uint(h, 0x42f2, 4);
+        ebml_uint(h, 0x42f3, 8);
+        ebml_bytes(h, 0x4282, b"matroska");
+        ebml_uint(h, 0x4287, 4);
+        ebml_uint(h, 0x4285, 2);
+    });
+    // Segment of unknown size: the file can be played (and cut) while it is still growing.
+    ebml_id(out, 0x1853_8067);
+    out.extend_from_slice(&[0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff]);
+    ebml_master(out, 0x1549_a966, |info| {
+        ebml_uint(info, 0x2a_d7b1, MKV_TIMESTAMP_SCALE as u64);
+        ebml_bytes(info, 0x4d80, b"depthai-rs");
+        ebml_bytes(info, 0x5741, b"depthai-rs");
+    });
+    ebml_master(out, 0x1654_ae6b, |tracks| {
+        ebml_master(tracks, 0xae, |track| {
+            ebml_uint(track, 0xd7, 1);
+            ebml_uint(track, 0x73c5, 1);
+            ebml_uint(track, 0x83, 1);
+            ebml_uint(track, 0x9c, 0);
+            let codec_id: &[u8] = match codec {
+                Codec::Avc => b"V_MPEG4/ISO/AVC",
+                Codec::Hevc => b"V_MPEGH/ISO/HEVC",
+                Codec::Jpeg => b"V_MJPEG",
+            };
+            ebml_bytes(track, 0x86, codec_id);
+            if !config.is_empty() {
+                ebml_bytes(track, 0x63a2, config);
+            }
+            ebml_master(track, 0xe0, |video| {
+                ebml_uint(video, 0xb0, width as u64);
+                ebml_uint(video, 0xba, height as u64);
+            });
+        });
+    });
+}
+
+/// Appends the pieces of one cluster holding `samples` as SimpleBlocks.
+fn mkv_cluster(side: &mut Vec<u8>, pieces: &mut Vec<Piece>, seg: &Segment, samples: &[Sample]) {
+    let ms = |ts: i64| (ts - seg.base_ns).max(0) / MKV_TIMESTAMP_SCALE;
+    let cluster_ms = ms(samples[0].ts_ns);
+    let mut timestamp = Vec::new();
+    ebml_uint(&mut timestamp, 0xe7, cluster_ms as u64);
+
+    let mut blocks = Vec::with_capacity(samples.len());
+    let mut body = timestamp.len();
+    for s in samples {
+        let mut header = Vec::with_capacity(16);
+        ebml_id(&mut header, 0xa3);
+        ebml_size(&mut header, 4 + s.size as u64);
+        header.push(0x81);
+        let rel = (ms(s.ts_ns) - cluster_ms).clamp(0, i16::MAX as i64) as i16;
+        header.extend_from_slice(&rel.to_be_bytes());
+        header.push(if s.key { 0x80 } else { 0x00 });
+        body += header.len() + s.size;
+        blocks.push(header);
+    }
+
+    ebml_id(side, 0x1f43_b675);
+    ebml_size(side, body as u64);
+    side.extend_from_slice(&timestamp);
+    let mut side_from = 0;
+    for (i, s) in samples.iter().enumerate() {
+        side.extend_from_slice(&blocks[i]);
+        push_payload(side, pieces, side_from, std::slice::from_ref(s), i);
+        side_from = side.len();
+    }
+}
+
+struct MuxerSink {
+    input: Input,
+    muxer: SegmentedMuxer,
+}
+
+impl ThreadedHostNodeImpl for MuxerSink {
+    fn run(&mut self, ctx: &ThreadedHostNodeContext) {
+        while ctx.is_running() {
+            match self.input.get_encoded_frame() {
+                Ok(frame) => {
+                    if self.muxer.push(frame).is_err() {
+                        break;
+                    }
+                }
+                Err(_) => break,
+            }
+        }
+        let _ = self.muxer.finish();
+    }
+}
+
+/// Creates a threaded host node that muxes every `EncodedFrame` from `output` into `muxer`.
+///
+/// Take a [`SegmentedMuxer::monitor`] first to follow its progress.
+pub fn create_segmented_recorder_sink(
+    pipeline: &Pipeline,
+    output: &Output,
+    muxer: SegmentedMuxer,
+) -> Result<ThreadedHostNode> {
+    pipeline.create_threaded_host_node(|node| {
+        let input = node.create_input(Some("in"))?;
+        output.link(&input)?;
+        Ok(MuxerSink { input, muxer })
+    })
+}
@@ -5,7 +5,7 @@ use autocxx::c_uint;
 use depthai_sys::{depthai, DaiOutput, DaiInput};
 
 use crate::camera::{ImageFrame, OutputQueue};
-use crate::encoded_frame::EncodedFrameQueue;
+use crate::encoded_frame::{EncodedFrame, EncodedFrameQueue};
 use crate::error::{clear_error_flag, last_error, Result};
 use crate::host_node::Buffer;
 use crate::pipeline::{Node, PipelineInner};
@@ -92,6 +92,34 @@ impl Output {
         }
     }
 
+    /// Create a latest-only frame queue for consumers that only want the newest frame.
+    ///
+    /// The queue holds one slot that every arrival replaces, so stale frames are dropped natively
+    /// without creating handles; [`OutputQueue::conflation_stats`] reports how many were overwritten.
+    pub fn create_latest_queue(&self) -> Result<OutputQueue> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_output_create_latest_queue(self.handle) };
+        if handle.is_null() {
+            Err(last_error("failed to create latest-only output queue"))
+        } else {
+            Ok(OutputQueue::from_handle(handle))
+        }
+    }
+
+    /// Latest-only variant of [`Self::create_message_queue`].
+    ///
+    /// Callbacks added with [`MessageQueue::add_callback`] run on their own thread and only see
+    /// the newest message, so a slow callback skips stale messages instead of stalling DepthAI.
+    pub fn create_latest_message_queue(&self) -> Result<MessageQueue> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_output_create_latest_queue(self.handle) };
+        if handle.is_null() {
+            Err(last_error("failed to create latest-only message queue"))
+        } else {
+            Ok(MessageQueue::from_handle(handle))
+        }
+    }
+
     /// Create an output queue that yields `EncodedFrame` messages.
     ///
     /// This is primarily used with `VideoEncoderNode::out()`.
@@ -124,6 +152,16 @@ impl Output {
             Ok(())
         }
     }
+
+    pub fn send_encoded_frame(&self, frame: &EncodedFrame) -> Result<()> {
+        clear_error_flag();
+        unsafe { depthai::dai_output_send_encoded_frame(self.handle, frame.handle()) };
+        if let Some(err) = crate::error::take_error_if_any("failed to send encoded frame") {
+            Err(err)
+        } else {
+            Ok(())
+        }
+    }
 }
 
 impl Input {
@@ -179,6 +217,30 @@ impl Input {
         }
     }
 
+    pub fn get_encoded_frame(&self) -> Result<EncodedFrame> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_input_get_encoded_frame(self.handle) };
+        if handle.is_null() {
+            Err(last_error("failed to get encoded frame from input"))
+        } else {
+            Ok(EncodedFrame::from_handle(handle))
+        }
+    }
+
+    pub fn try_get_encoded_frame(&self) -> Result<Option<EncodedFrame>> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_input_try_get_encoded_frame(self.handle) };
+        if handle.is_null() {
+            if let Some(err) = crate::error::take_error_if_any("failed to poll encoded frame from input") {
+                Err(err)
+            } else {
+                Ok(None)
+            }
+        } else {
+            Ok(Some(EncodedFrame::from_handle(handle)))
+        }
+    }
+
     /// Create a host→device input queue (DepthAI-Core `InputQueue`).
     ///
     /// This is the canonical way to send messages into a pipeline input from the host.
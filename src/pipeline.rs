@@ -1,13 +1,16 @@
 pub mod device_node;
+pub mod graph;
 pub mod node;
 
 use autocxx::c_int;
 use depthai_sys::{depthai, DaiPipeline};
 pub use device_node::{CreateInPipeline, CreateInPipelineWith, DeviceNode, DeviceNodeWithParams};
+pub use graph::{GraphConnection, GraphNode, GraphPort, PipelineGraph};
 pub use node::Node;
 
 use std::collections::HashMap;
-use std::sync::Arc;
+use std::sync::{Arc, OnceLock};
+use std::time::Duration;
 use std::{
     ffi::{CStr, CString},
     path::{Path, PathBuf},
@@ -16,8 +19,9 @@ use std::{
 use crate::{
     camera::{CameraBoardSocket, CameraNode},
     device::Device,
-    error::{clear_error_flag, last_error, DepthaiError, Result},
-    host_node::{create_host_node, HostNode, HostNodeImpl},
+    error::{clear_error_flag, last_error, DepthaiError, ErrorCode, Result},
+    link_tuning::{LinkTuning, LinkTuningOptions},
+    host_node::{create_host_node, create_parallel_host_node, HostNode, HostNodeImpl, HostNodeWorkers},
     threaded_host_node::{create_threaded_host_node, ThreadedHostNode, ThreadedHostNodeImpl},
 };
 
@@ -74,6 +78,175 @@ pub struct PipelineConnectionInfo {
     pub input_name: String,
 }
 
+/// Fixed-bucket latency histogram in microseconds.
+///
+/// Bucket 0 counts values below 2 us; bucket `i >= 1` counts `[2^i, 2^(i+1))` us and the last
+/// bucket is open-ended.
+#[derive(Debug, Clone, Default, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+pub struct LatencyHistogram {
+    pub count: u64,
+    pub sum_us: u64,
+    pub max_us: u64,
+    pub buckets: Vec<u64>,
+}
+
+impl LatencyHistogram {
+    pub fn mean(&self) -> Option<Duration> {
+        (self.count > 0).then(|| Duration::from_micros(self.sum_us / self.count))
+    }
+
+    pub fn max(&self) -> Duration {
+        Duration::from_micros(self.max_us)
+    }
+
+    /// Upper bound of the bucket holding the `q`-quantile (`0.0..=1.0`), capped at the maximum.
+    pub fn percentile(&self, q: f64) -> Option<Duration> {
+        if self.count == 0 {
+            return None;
+        }
+        let rank = ((q.clamp(0.0, 1.0) * self.count as f64).ceil() as u64).max(1);
+        let mut seen = 0u64;
+        for (i, &n) in self.buckets.iter().enumerate() {
+            seen += n;
+            if seen >= rank {
+                let upper = if i + 1 >= self.buckets.len() { u64::MAX } else { 2u64 << i };
+                return Some(Duration::from_micros(upper.min(self.max_us)));
+            }
+        }
+        Some(self.max())
+    }
+}
+
+/// Counters for one output queue created while telemetry was enabled.
+#[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct QueueStats {
+    pub name: String,
+    pub blocking: bool,
+    pub closed: bool,
+    /// Messages currently queued.
+    pub depth: u64,
+    pub max_size: u64,
+    pub messages: u64,
+    /// Messages evicted because a non-blocking queue was full.
+    pub dropped: u64,
+    pub depth_high_water: u64,
+    /// Steady-clock time of the first / last message, in microseconds.
+    pub first_us: i64,
+    pub last_us: i64,
+    /// Host arrival time minus the message timestamp (device clock synced to host).
+    pub latency: LatencyHistogram,
+    /// Time spent in callbacks registered with [`crate::MessageQueue::add_callback`].
+    pub callback: LatencyHistogram,
+    /// Id and type name of the node whose output feeds this queue.
+    #[serde(default)]
+    pub node_id: i64,
+    #[serde(default)]
+    pub node_name: String,
+    #[serde(default)]
+    pub output: String,
+    /// Frame rate requested for the producing camera output and the sensor rate behind it, when
+    /// both are known from how the camera was built and its outputs requested. An output slower
+    /// than its sensor skips sequence numbers by design.
+    #[serde(default)]
+    pub output_fps: Option<f32>,
+    #[serde(default)]
+    pub sensor_fps: Option<f32>,
+    /// Frame pool occupancy of the producing output.
+    #[serde(default)]
+    pub pool: PoolOccupancy,
+}
+
+/// Producer frame pool usage reconstructed from message timestamps at one output queue.
+///
+/// A frame holds a pool slot from capture until it has crossed the link, so the occupancy at a
+/// frame's capture is that frame plus every earlier frame that had not yet reached the host. This
+/// counts the slots used by the path to this queue; device-side consumers that hold frames longer
+/// need extra slots on top.
+#[derive(Debug, Clone, Default, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+pub struct PoolOccupancy {
+    /// Timestamped messages measured.
+    pub samples: u64,
+    /// Occupancy at the latest message.
+    pub in_flight: u64,
+    pub in_flight_sum: u64,
+    pub in_flight_high_water: u64,
+    /// Sequence numbers skipped by the producer: frames it numbered but never delivered. On camera
+    /// and encoder outputs that is usually a stall on an exhausted pool, but it also counts frames
+    /// skipped on purpose; see [`crate::PoolSizing::from_stats`].
+    pub sequence_gaps: u64,
+    /// Separate runs of skipped sequence numbers.
+    pub gap_events: u64,
+}
+
+impl PoolOccupancy {
+    pub fn mean_in_flight(&self) -> Option<f64> {
+        (self.samples > 0).then(|| self.in_flight_sum as f64 / self.samples as f64)
+    }
+}
+
+impl QueueStats {
+    /// Average message rate between the first and last message.
+    pub fn rate_hz(&self) -> f64 {
+        let span = self.last_us - self.first_us;
+        if self.messages < 2 || span <= 0 {
+            return 0.0;
+        }
+        (self.messages - 1) as f64 * 1e6 / span as f64
+    }
+}
+
+/// Counters for one Rust host node created while telemetry was enabled.
+#[derive(Debug, Clone, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+pub struct HostNodeStats {
+    pub name: String,
+    pub node_id: i64,
+    pub groups: u64,
+    /// Time spent in [`HostNodeImpl::process_group`].
+    pub process: LatencyHistogram,
+    /// Groups a parallel node lost because processing or sending the result failed.
+    #[serde(default)]
+    pub errors: u64,
+    /// Reason for the most recent of those failures; empty if there was none.
+    #[serde(default)]
+    pub last_error: String,
+}
+
+/// Snapshot of the opt-in telemetry layer.
+///
+/// Telemetry is process-wide and off by default. Enable it with [`PipelineStats::set_enabled`]
+/// before creating the queues and host nodes to observe; recording costs a few relaxed atomic
+/// updates per message.
+#[derive(Debug, Clone, Default, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct PipelineStats {
+    pub enabled: bool,
+    pub timestamp_us: i64,
+    pub queues: Vec<QueueStats>,
+    pub host_nodes: Vec<HostNodeStats>,
+}
+
+impl PipelineStats {
+    pub fn set_enabled(enabled: bool) {
+        depthai::dai_telemetry_set_enabled(enabled);
+    }
+
+    pub fn is_enabled() -> bool {
+        depthai::dai_telemetry_is_enabled()
+    }
+
+    /// Zeroes all counters and histograms; tracked queues and nodes stay registered.
+    pub fn reset() {
+        depthai::dai_telemetry_reset();
+    }
+
+    pub fn snapshot() -> Result<Self> {
+        clear_error_flag();
+        let ptr = depthai::dai_telemetry_snapshot_json();
+        let s = take_owned_json_string(ptr, "failed to get telemetry snapshot")?;
+        serde_json::from_str(&s)
+            .map_err(|e| DepthaiError::new(format!("invalid telemetry JSON from depthai-core: {e}")))
+    }
+}
+
 fn take_owned_json_string(ptr: *mut std::ffi::c_char, context: &str) -> Result<String> {
     if ptr.is_null() {
         return Err(last_error(context));
@@ -90,6 +263,7 @@ fn parse_json_value(s: &str) -> Result<serde_json::Value> {
 
 pub(crate) struct PipelineInner {
     handle: DaiPipeline,
+    link_tuning: OnceLock<LinkTuning>,
 }
 
 unsafe impl Send for PipelineInner {}
@@ -140,6 +314,9 @@ pub struct PipelineBuilder {
 
     holistic_record_json: Option<serde_json::Value>,
     holistic_replay_path: Option<PathBuf>,
+
+    link_tuning: Option<LinkTuning>,
+    autotune_link: Option<LinkTuningOptions>,
 }
 
 impl PipelineBuilder {
@@ -177,6 +354,24 @@ impl PipelineBuilder {
         self
     }
 
+    /// Apply previously calibrated link settings (see [`LinkTuning::calibrate`]).
+    ///
+    /// The chunk size overrides [`Self::xlink_chunk_size`]; the suggested queue depth and frame
+    /// pool size stay available through [`Pipeline::link_tuning`].
+    pub fn link_tuning(mut self, tuning: LinkTuning) -> Self {
+        self.link_tuning = Some(tuning);
+        self
+    }
+
+    /// Calibrate the link during [`Self::build`] and apply the result.
+    ///
+    /// Requires [`Self::with_device`]: short probe pipelines run on that device before the
+    /// pipeline is created. Set [`LinkTuningOptions::cache_path`] to skip probing on later runs.
+    pub fn autotune_link(mut self, options: LinkTuningOptions) -> Self {
+        self.autotune_link = Some(options);
+        self
+    }
+
     pub fn sipp_buffer_size(mut self, size_bytes: i32) -> Self {
         self.sipp_buffer_size = Some(size_bytes);
         self
@@ -231,7 +426,15 @@ impl PipelineBuilder {
     ///
     /// Note: this does **not** call [`Pipeline::build`] (DepthAI graph compilation). It only
     /// constructs and configures the pipeline object.
-    pub fn build(self) -> Result<Pipeline> {
+    pub fn build(mut self) -> Result<Pipeline> {
+        if let Some(options) = self.autotune_link.take() {
+            let device = self
+                .device
+                .as_ref()
+                .ok_or_else(|| DepthaiError::new("autotune_link requires with_device"))?;
+            self.link_tuning = Some(LinkTuning::calibrate(device, &options)?);
+        }
+
         let pipeline = if let Some(device) = &self.device {
             Pipeline::create_with_device(device)?
         } else if let Some(create_implicit_device) = self.create_implicit_device {
@@ -240,7 +443,7 @@ impl PipelineBuilder {
             Pipeline::try_new()?
         };
 
-        if let Some(v) = self.xlink_chunk_size {
+        if let Some(v) = self.link_tuning.as_ref().map(|t| t.xlink_chunk_size).or(self.xlink_chunk_size) {
             pipeline.set_xlink_chunk_size(v)?;
         }
         if let Some(v) = self.sipp_buffer_size {
@@ -275,6 +478,9 @@ impl PipelineBuilder {
         if let Some(path) = self.holistic_replay_path {
             pipeline.enable_holistic_replay(path)?;
         }
+        if let Some(tuning) = self.link_tuning {
+            let _ = pipeline.inner.link_tuning.set(tuning);
+        }
 
         Ok(pipeline)
     }
@@ -301,7 +507,7 @@ impl Pipeline {
             Err(last_error("failed to create pipeline"))
         } else {
             Ok(Self {
-                inner: Arc::new(PipelineInner { handle }),
+                inner: Arc::new(PipelineInner { handle, link_tuning: OnceLock::new() }),
             })
         }
     }
@@ -319,7 +525,7 @@ impl Pipeline {
             Err(last_error("failed to create pipeline"))
         } else {
             Ok(Self {
-                inner: Arc::new(PipelineInner { handle }),
+                inner: Arc::new(PipelineInner { handle, link_tuning: OnceLock::new() }),
             })
         }
     }
@@ -346,7 +552,7 @@ impl Pipeline {
             Err(last_error("failed to create pipeline with device"))
         } else {
             Ok(Self {
-                inner: Arc::new(PipelineInner { handle }),
+                inner: Arc::new(PipelineInner { handle, link_tuning: OnceLock::new() }),
             })
         }
     }
@@ -398,6 +604,16 @@ impl Pipeline {
         create_host_node(self, node)
     }
 
+    /// Create a host node whose groups are processed concurrently by `config.workers` clones of
+    /// `node`. Outputs are still sent in input order.
+    pub fn create_parallel_host_node<T: HostNodeImpl + Clone>(
+        &self,
+        node: T,
+        config: HostNodeWorkers,
+    ) -> Result<HostNode> {
+        create_parallel_host_node(self, node, config)
+    }
+
     /// Create a custom threaded host node implemented in Rust.
     pub fn create_threaded_host_node<T: ThreadedHostNodeImpl, F>(&self, init: F) -> Result<ThreadedHostNode>
     where
@@ -434,6 +650,37 @@ impl Pipeline {
         }
     }
 
+    /// Starts several pipelines concurrently, typically one per device of a multi-camera rig.
+    ///
+    /// Building and uploading each pipeline runs on its own thread, so start-up takes as long
+    /// as the slowest device. Returns one result per pipeline, in order.
+    pub fn start_all(pipelines: &[&Pipeline]) -> Result<Vec<Result<()>>> {
+        clear_error_flag();
+        let mut handles: Vec<DaiPipeline> = pipelines.iter().map(|p| p.inner.handle).collect();
+        let mut errors: Vec<*mut std::ffi::c_char> = vec![std::ptr::null_mut(); pipelines.len()];
+        let mut codes = vec![0i32; pipelines.len()];
+        unsafe {
+            depthai::dai_pipeline_start_many(handles.as_mut_ptr(), handles.len(), errors.as_mut_ptr(), codes.as_mut_ptr())
+        };
+        if let Some(err) = crate::error::take_error_if_any("failed to start pipelines") {
+            return Err(err);
+        }
+        Ok(errors
+            .into_iter()
+            .zip(codes)
+            .map(|(error, code)| {
+                if error.is_null() {
+                    Ok(())
+                } else {
+                    let reason = unsafe { CStr::from_ptr(error) }.to_string_lossy().into_owned();
+                    unsafe { depthai::dai_free_cstring(error) };
+                    let code = ErrorCode::from_raw(code).unwrap_or(ErrorCode::Unknown);
+                    Err(DepthaiError::with_code(format!("failed to start pipeline: {reason}"), code))
+                }
+            })
+            .collect())
+    }
+
     /// Returns whether the pipeline is currently running.
     ///
     /// Mirrors C++: `pipeline.isRunning()`.
@@ -540,6 +787,12 @@ impl Pipeline {
         }
     }
 
+    /// Link settings applied through [`PipelineBuilder::link_tuning`] or
+    /// [`PipelineBuilder::autotune_link`], if any.
+    pub fn link_tuning(&self) -> Option<&LinkTuning> {
+        self.inner.link_tuning.get()
+    }
+
     /// Configure SIPP internal memory pool size (bytes).
     pub fn set_sipp_buffer_size(&self, size_bytes: i32) -> Result<()> {
         clear_error_flag();
@@ -704,6 +957,30 @@ impl Pipeline {
         Ok(out)
     }
 
+    /// Version of the graph's structure: changes whenever nodes, ports or connections change,
+    /// whichever call made the change (including node `build` helpers that create and link
+    /// nodes internally).
+    ///
+    /// Versions increase monotonically and are never shared between pipelines. Polling walks
+    /// the graph to hash it but copies nothing.
+    pub fn graph_version(&self) -> u64 {
+        unsafe { depthai::dai_pipeline_graph_version(self.inner.handle) }
+    }
+
+    /// Flat snapshot of nodes, ports and connections without JSON round-trips.
+    ///
+    /// With `known_version` set to the [`PipelineGraph::version`] of a previous snapshot, returns
+    /// `Ok(None)` when the graph has not changed since. The graph is still walked to hash it (see
+    /// [`Self::graph_version`]); only building and copying the snapshot tables is skipped.
+    pub fn graph_snapshot(&self, known_version: Option<u64>) -> Result<Option<PipelineGraph>> {
+        clear_error_flag();
+        let handle = unsafe { depthai::dai_pipeline_graph_snapshot(self.inner.handle, known_version.unwrap_or(0)) };
+        if handle.is_null() {
+            return crate::error::take_error_if_any("failed to snapshot pipeline graph").map_or(Ok(None), Err);
+        }
+        Ok(Some(unsafe { PipelineGraph::from_raw(handle) }))
+    }
+
     /// Returns whether calibration data has been set on the pipeline.
     ///
     /// Mirrors C++: `pipeline.isCalibrationDataAvailable()`.
@@ -861,6 +1138,10 @@ impl Pipeline {
     }
 
     /// Enable holistic replay from a recording path.
+    ///
+    /// DepthAI replays holistic recordings at the recorded pace without seeking. For throughput
+    /// runs or seeking, record with [`crate::replay::FrameRecorder`] and replay through
+    /// [`crate::replay::create_replay_node`] instead.
     pub fn enable_holistic_replay(&self, path_to_recording: impl AsRef<Path>) -> Result<()> {
         clear_error_flag();
         let path = path_to_recording.as_ref();
@@ -0,0 +1,175 @@
+use depthai_sys::depthai;
+use depthai_sys::{DaiGraphConnection, DaiGraphNode, DaiGraphPort, DaiGraphSnapshot, DaiStrRef};
+
+/// Flat, immutable copy of a pipeline graph taken at one [`PipelineGraph::version`].
+///
+/// Nodes, ports and connections are contiguous arrays owned by the native snapshot; every name is
+/// a slice of one shared string pool, so walking the graph does not allocate.
+///
+/// Obtained from [`crate::Pipeline::graph_snapshot`].
+pub struct PipelineGraph {
+    handle: DaiGraphSnapshot,
+    nodes: &'static [DaiGraphNode],
+    ports: &'static [DaiGraphPort],
+    connections: &'static [DaiGraphConnection],
+    strings: &'static [u8],
+}
+
+unsafe impl Send for PipelineGraph {}
+unsafe impl Sync for PipelineGraph {}
+
+impl PipelineGraph {
+    /// Takes ownership of a non-null snapshot handle.
+    pub(crate) unsafe fn from_raw(handle: DaiGraphSnapshot) -> Self {
+        // Safety: the arrays live as long as the handle, which is released only in `Drop`; the
+        // `'static` slices never escape with a lifetime longer than `&self`.
+        unsafe fn slice<'a, T>(ptr: *const T, len: usize) -> &'a [T] {
+            if ptr.is_null() || len == 0 {
+                &[]
+            } else {
+                unsafe { std::slice::from_raw_parts(ptr, len) }
+            }
+        }
+        let (mut n, mut p, mut c, mut s) = (0usize, 0usize, 0usize, 0usize);
+        unsafe {
+            let nodes = slice(depthai::dai_graph_snapshot_nodes(handle, &mut n), n);
+            let ports = slice(depthai::dai_graph_snapshot_ports(handle, &mut p), p);
+            let connections = slice(depthai::dai_graph_snapshot_connections(handle, &mut c), c);
+            let strings = slice(depthai::dai_graph_snapshot_strings(handle, &mut s).cast::<u8>(), s);
+            Self {
+                handle,
+                nodes,
+                ports,
+                connections,
+                strings,
+            }
+        }
+    }
+
+    /// Graph version this snapshot was taken at; pass it back to
+    /// [`crate::Pipeline::graph_snapshot`] to skip unchanged graphs.
+    pub fn version(&self) -> u64 {
+        unsafe { depthai::dai_graph_snapshot_version(self.handle) }
+    }
+
+    pub fn node_count(&self) -> usize {
+        self.nodes.len()
+    }
+
+    pub fn nodes(&self) -> impl ExactSizeIterator<Item = GraphNode<'_>> + '_ {
+        self.nodes.iter().map(move |n| GraphNode { graph: self, raw: n })
+    }
+
+    pub fn node(&self, id: i32) -> Option<GraphNode<'_>> {
+        self.nodes().find(|n| n.id() == id)
+    }
+
+    /// All ports of all nodes; each node's ports are contiguous, outputs first.
+    pub fn ports(&self) -> impl ExactSizeIterator<Item = GraphPort<'_>> + '_ {
+        self.ports.iter().map(move |p| self.port(p))
+    }
+
+    pub fn connections(&self) -> impl ExactSizeIterator<Item = GraphConnection<'_>> + '_ {
+        self.connections.iter().map(move |c| GraphConnection {
+            output_id: c.output_id,
+            output_group: self.str(c.output_group),
+            output_name: self.str(c.output_name),
+            input_id: c.input_id,
+            input_group: self.str(c.input_group),
+            input_name: self.str(c.input_name),
+        })
+    }
+
+    fn port(&self, p: &DaiGraphPort) -> GraphPort<'_> {
+        GraphPort {
+            node_id: p.node_id,
+            is_output: p.is_output != 0,
+            group: self.str(p.group),
+            name: self.str(p.name),
+        }
+    }
+
+    fn str(&self, r: DaiStrRef) -> &str {
+        let start = r.offset as usize;
+        self.strings
+            .get(start..start + r.len as usize)
+            .and_then(|b| std::str::from_utf8(b).ok())
+            .unwrap_or("")
+    }
+}
+
+impl Drop for PipelineGraph {
+    fn drop(&mut self) {
+        unsafe { depthai::dai_graph_snapshot_release(self.handle) };
+    }
+}
+
+impl std::fmt::Debug for PipelineGraph {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("PipelineGraph")
+            .field("version", &self.version())
+            .field("nodes", &self.nodes.len())
+            .field("ports", &self.ports.len())
+            .field("connections", &self.connections.len())
+            .finish()
+    }
+}
+
+/// Node entry of a [`PipelineGraph`].
+#[derive(Clone, Copy)]
+pub struct GraphNode<'a> {
+    graph: &'a PipelineGraph,
+    raw: &'a DaiGraphNode,
+}
+
+impl<'a> GraphNode<'a> {
+    pub fn id(&self) -> i32 {
+        self.raw.id
+    }
+
+    /// DepthAI node type name (e.g. `"Camera"`).
+    pub fn name(&self) -> &'a str {
+        self.graph.str(self.raw.name)
+    }
+
+    pub fn alias(&self) -> &'a str {
+        self.graph.str(self.raw.alias)
+    }
+
+    pub fn ports(&self) -> impl ExactSizeIterator<Item = GraphPort<'a>> + 'a {
+        let graph = self.graph;
+        let start = self.raw.first_port as usize;
+        let end = (start + self.raw.port_count as usize).min(graph.ports.len());
+        graph.ports[start.min(end)..end].iter().map(move |p| graph.port(p))
+    }
+}
+
+impl std::fmt::Debug for GraphNode<'_> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("GraphNode")
+            .field("id", &self.id())
+            .field("name", &self.name())
+            .field("alias", &self.alias())
+            .finish()
+    }
+}
+
+/// Port entry of a [`PipelineGraph`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct GraphPort<'a> {
+    pub node_id: i32,
+    pub is_output: bool,
+    pub group: &'a str,
+    pub name: &'a str,
+}
+
+/// Connection entry of a [`PipelineGraph`]; same shape as [`crate::pipeline::PipelineConnectionInfo`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct GraphConnection<'a> {
+    pub output_id: i32,
+    pub output_group: &'a str,
+    pub output_name: &'a str,
+    pub input_id: i32,
+    pub input_group: &'a str,
+    pub input_name: &'a str,
+}
@@ -0,0 +1,110 @@
+use depthai_sys::depthai;
+
+use crate::camera::{ImageFrame, ImageFrameInfo};
+use crate::common::ImageFrameType;
+use crate::error::{clear_error_flag, last_error, DepthaiError, Result};
+
+/// Byte layout of raw pixels passed to [`convert_pixels`].
+#[derive(Debug, Clone, Copy)]
+pub struct PixelLayout {
+    pub width: u32,
+    pub height: u32,
+    pub format: ImageFrameType,
+    /// Bytes per row of the first plane; `0` means tightly packed.
+    pub stride: u32,
+    /// Byte offsets of up to three planes; `0` for planes after the first means "right after
+    /// the previous plane".
+    pub plane_offsets: [u32; 3],
+}
+
+impl PixelLayout {
+    pub fn packed(width: u32, height: u32, format: ImageFrameType) -> Self {
+        Self {
+            width,
+            height,
+            format,
+            stride: 0,
+            plane_offsets: [0; 3],
+        }
+    }
+
+    /// Layout of a received frame, or `None` when its format is unknown.
+    pub fn from_info(info: &ImageFrameInfo) -> Option<Self> {
+        Some(Self {
+            width: info.width,
+            height: info.height,
+            format: info.format?,
+            stride: info.stride,
+            plane_offsets: info.plane_offsets,
+        })
+    }
+}
+
+/// Size of a tightly packed image in `format`, or `None` if `format` is not a conversion target
+/// (`RGB888i`, `BGR888i`, `GRAY8`, `RAW16`).
+pub fn converted_len(width: u32, height: u32, format: ImageFrameType) -> Option<usize> {
+    let len = depthai::dai_image_converted_size(
+        autocxx::c_int(width as i32),
+        autocxx::c_int(height as i32),
+        autocxx::c_int(format as i32),
+    );
+    (len > 0).then_some(len)
+}
+
+/// Converts `src` into tightly packed `dst_format` pixels using the native SIMD kernels.
+///
+/// Handles NV12/NV21/YUV420p, planar and interleaved RGB/BGR and GRAY8 to RGB888i/BGR888i,
+/// YUV and gray to GRAY8, and RAW16 (e.g. depth) to packed RAW16. Returns the bytes written.
+pub fn convert_pixels(src: &[u8], layout: &PixelLayout, dst_format: ImageFrameType, dst: &mut [u8]) -> Result<usize> {
+    clear_error_flag();
+    let info = depthai_sys::DaiImgFrameInfo {
+        data: src.as_ptr() as *const _,
+        size: src.len(),
+        width: layout.width as i32,
+        height: layout.height as i32,
+        type_: layout.format as i32,
+        stride: layout.stride,
+        plane_offsets: layout.plane_offsets,
+        ..Default::default()
+    };
+    let written =
+        unsafe { depthai::dai_image_convert(&info, dst_format as i32, dst.as_mut_ptr() as *mut _, dst.len()) };
+    if written == 0 {
+        Err(last_error("failed to convert pixels"))
+    } else {
+        Ok(written)
+    }
+}
+
+/// Swaps RGB888i and BGR888i in place; trailing bytes that do not form a full pixel are kept.
+pub fn swap_rb_in_place(data: &mut [u8]) {
+    if data.len() < 3 {
+        return;
+    }
+    unsafe { depthai::dai_image_swap_rb_inplace(data.as_mut_ptr() as *mut _, data.len() / 3) };
+}
+
+impl ImageFrame {
+    /// Converts this frame into `dst`, honouring its stride and plane offsets. See [`convert_pixels`].
+    pub fn convert_into(&self, format: ImageFrameType, dst: &mut [u8]) -> Result<usize> {
+        clear_error_flag();
+        let written = unsafe {
+            depthai::dai_frame_convert(self.handle(), autocxx::c_int(format as i32), dst.as_mut_ptr() as *mut _, dst.len())
+        };
+        if written == 0 {
+            Err(last_error("failed to convert frame"))
+        } else {
+            Ok(written)
+        }
+    }
+
+    /// Returns this frame's pixels converted to `format` in a new buffer.
+    pub fn to_format(&self, format: ImageFrameType) -> Result<Vec<u8>> {
+        let len = converted_len(self.width(), self.height(), format)
+            .ok_or_else(|| DepthaiError::new(format!("unsupported conversion target: {format:?}")))?;
+        let mut out = vec![0u8; len];
+        let written = self.convert_into(format, &mut out)?;
+        out.truncate(written);
+        Ok(out)
+    }
+}
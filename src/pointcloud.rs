@@ -18,6 +18,51 @@ pub struct Point3fRGBA {
     pub a: u8,
 }
 
+/// Filtering applied while converting a point cloud to structure-of-arrays form.
+#[derive(Clone, Copy, Debug)]
+pub struct PointCloudSoaOptions {
+    /// Keep every Nth point (on both image axes for organized clouds). `0` and `1` keep all points.
+    pub decimation: u32,
+    /// Inclusive z range to keep, in the cloud's units.
+    pub z_range: Option<(f32, f32)>,
+    /// Drop points with `z == 0` (no depth).
+    pub skip_invalid: bool,
+    /// Fill the packed color plane.
+    pub colors: bool,
+}
+
+impl Default for PointCloudSoaOptions {
+    fn default() -> Self {
+        Self {
+            decimation: 1,
+            z_range: None,
+            skip_invalid: true,
+            colors: true,
+        }
+    }
+}
+
+/// Point cloud split into separate coordinate and color planes.
+///
+/// Colors are packed like [`rgba32_from_rgba`]. When colors are disabled `rgba` stays empty.
+#[derive(Clone, Debug, Default)]
+pub struct PointCloudSoa {
+    pub x: Vec<f32>,
+    pub y: Vec<f32>,
+    pub z: Vec<f32>,
+    pub rgba: Vec<u32>,
+}
+
+impl PointCloudSoa {
+    pub fn len(&self) -> usize {
+        self.x.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.x.is_empty()
+    }
+}
+
 pub struct PointCloudData {
     handle: DaiPointCloud,
 }
@@ -46,6 +91,10 @@ impl PointCloudData {
         raw.max(0) as u32
     }
 
+    /// Points of the cloud.
+    ///
+    /// For colored clouds this borrows the message buffer directly (see [`Self::is_zero_copy`]);
+    /// otherwise it points at a wrapper-side copy produced once when the message was pulled.
     pub fn points(&self) -> &[Point3fRGBA] {
         let len: usize = unsafe { depthai::dai_pointcloud_get_points_rgba_len(self.handle) }.into();
         if len == 0 {
@@ -55,8 +104,84 @@ impl PointCloudData {
         if ptr.is_null() {
             return &[];
         }
+        debug_assert_eq!(self.stride(), std::mem::size_of::<Point3fRGBA>());
         unsafe { std::slice::from_raw_parts(ptr as *const Point3fRGBA, len) }
     }
+
+    /// Byte distance between consecutive points in [`Self::points`].
+    pub fn stride(&self) -> usize {
+        unsafe { depthai::dai_pointcloud_get_points_rgba_stride(self.handle) }.into()
+    }
+
+    /// Returns `true` when [`Self::points`] borrows the `PointCloudData` buffer without copying.
+    pub fn is_zero_copy(&self) -> bool {
+        unsafe { depthai::dai_pointcloud_is_zero_copy(self.handle) }
+    }
+
+    /// Converts the cloud to structure-of-arrays form, filtering in the same pass.
+    pub fn to_soa(&self, options: &PointCloudSoaOptions) -> PointCloudSoa {
+        let mut out = PointCloudSoa::default();
+        self.fill_soa(options, &mut out);
+        out
+    }
+
+    /// Like [`Self::to_soa`], but reuses the allocations in `out`. Returns the number of points kept.
+    pub fn fill_soa(&self, options: &PointCloudSoaOptions, out: &mut PointCloudSoa) -> usize {
+        out.x.clear();
+        out.y.clear();
+        out.z.clear();
+        out.rgba.clear();
+
+        let len: usize = unsafe { depthai::dai_pointcloud_get_points_rgba_len(self.handle) }.into();
+        let step = options.decimation.max(1) as usize;
+        let (width, height) = (self.width() as usize, self.height() as usize);
+        let capacity = if width > 0 && height > 0 && width * height == len {
+            width.div_ceil(step) * height.div_ceil(step)
+        } else {
+            len.div_ceil(step)
+        };
+        if capacity == 0 {
+            return 0;
+        }
+
+        out.x.reserve(capacity);
+        out.y.reserve(capacity);
+        out.z.reserve(capacity);
+        let rgba_ptr = if options.colors {
+            out.rgba.reserve(capacity);
+            out.rgba.as_mut_ptr()
+        } else {
+            std::ptr::null_mut()
+        };
+        let (z_min, z_max) = options.z_range.unwrap_or((f32::NEG_INFINITY, f32::INFINITY));
+
+        let written: usize = unsafe {
+            depthai::dai_pointcloud_fill_soa(
+                self.handle,
+                out.x.as_mut_ptr(),
+                out.y.as_mut_ptr(),
+                out.z.as_mut_ptr(),
+                rgba_ptr,
+                capacity,
+                options.decimation,
+                z_min,
+                z_max,
+                options.skip_invalid,
+            )
+        }
+        .into();
+        let written = written.min(capacity);
+        // SAFETY: the wrapper initialized the first `written` elements of every non-null plane.
+        unsafe {
+            out.x.set_len(written);
+            out.y.set_len(written);
+            out.z.set_len(written);
+            if options.colors {
+                out.rgba.set_len(written);
+            }
+        }
+        written
+    }
 }
 
 impl OutputQueue {
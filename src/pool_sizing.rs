@@ -0,0 +1,169 @@
+use std::collections::BTreeMap;
+use std::path::Path;
+use std::time::Duration;
+
+use crate::error::{DepthaiError, Result};
+use crate::pipeline::{PipelineStats, QueueStats};
+
+/// How [`PoolSizing`] turns observed occupancy into pool sizes.
+#[derive(Debug, Clone)]
+pub struct PoolSizingOptions {
+    /// Time to let the pipeline settle (auto-exposure, encoder rate control, queue fill) before
+    /// measuring; counters are reset at its end.
+    pub warmup: Duration,
+    /// Measurement window after the warmup.
+    pub window: Duration,
+    /// Slots added on top of the observed peak.
+    pub headroom: u32,
+    pub min_frames: i32,
+    pub max_frames: i32,
+}
+
+impl Default for PoolSizingOptions {
+    fn default() -> Self {
+        Self {
+            warmup: Duration::from_secs(2),
+            window: Duration::from_secs(5),
+            headroom: 1,
+            min_frames: 2,
+            max_frames: 16,
+        }
+    }
+}
+
+/// Suggested frame pool size for one producing node.
+#[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct PoolRecommendation {
+    pub node_id: i64,
+    /// DepthAI node type name, e.g. `"Camera"` or `"VideoEncoder"`.
+    pub node_name: String,
+    /// Outputs the measurement covers.
+    pub outputs: Vec<String>,
+    pub peak_in_flight: u64,
+    pub mean_in_flight: f32,
+    /// Skipped sequence numbers not explained by an output running slower than its sensor.
+    pub sequence_gaps: u64,
+    /// Frames per output pool (Camera `outputs` pool, VideoEncoder frame pool).
+    pub frames_pool: i32,
+    /// The producer skipped frames during the window. Its peak was capped by the current pool, so
+    /// the value is a step up rather than a fit; apply it and measure again.
+    pub stalled: bool,
+}
+
+/// Pool sizes derived from the telemetry layer's occupancy estimates, serializable so a warmup
+/// run on one SKU can size the pools of later runs.
+///
+/// Frame pools are part of the device configuration and cannot change once the pipeline runs, so
+/// sizing is a two-step process: run with generous pools and telemetry enabled, call
+/// [`PoolSizing::observe`], then apply the result (e.g. [`crate::camera::CameraNode::apply_pool_sizing`])
+/// while building the next pipeline. Recommendations are keyed by node id, which is stable as long
+/// as the pipeline is built in the same order.
+#[derive(Debug, Clone, Default, PartialEq, serde::Serialize, serde::Deserialize)]
+pub struct PoolSizing {
+    pub recommendations: Vec<PoolRecommendation>,
+}
+
+impl PoolSizing {
+    /// Waits out the warmup, resets telemetry, waits for the window and sizes pools from the
+    /// snapshot. Blocks the calling thread for `warmup + window`.
+    ///
+    /// Telemetry must have been enabled before the output queues were created.
+    pub fn observe(options: &PoolSizingOptions) -> Result<Self> {
+        if !PipelineStats::is_enabled() {
+            return Err(DepthaiError::new("pool sizing needs telemetry enabled before queues are created"));
+        }
+        std::thread::sleep(options.warmup);
+        PipelineStats::reset();
+        std::thread::sleep(options.window);
+        Ok(Self::from_stats(&PipelineStats::snapshot()?, options))
+    }
+
+    /// Sizes one pool per producing node from the queues tracked in `stats`.
+    ///
+    /// A producer that skipped sequence numbers is marked [`PoolRecommendation::stalled`], except
+    /// for the frames a camera output drops by design when it was requested at a lower fps than
+    /// the sensor runs at. Other skips are still counted as stalls although they are not:
+    /// - the ISP dropping frames under load or while switching modes, which numbers frames it
+    ///   never outputs;
+    /// - VideoEncoder outputs carry the sequence numbers of the camera frames they encode, so
+    ///   frames decimated or dropped before the encoder (a lower output fps, a full non-blocking
+    ///   input) count as encoder gaps.
+    pub fn from_stats(stats: &PipelineStats, options: &PoolSizingOptions) -> Self {
+        let mut by_node: BTreeMap<i64, PoolRecommendation> = BTreeMap::new();
+        let mut samples: BTreeMap<i64, (u64, u64)> = BTreeMap::new();
+        for q in stats.queues.iter().filter(|q| q.node_id >= 0 && q.pool.samples > 0) {
+            let rec = by_node.entry(q.node_id).or_insert_with(|| PoolRecommendation {
+                node_id: q.node_id,
+                node_name: q.node_name.clone(),
+                outputs: Vec::new(),
+                peak_in_flight: 0,
+                mean_in_flight: 0.0,
+                sequence_gaps: 0,
+                frames_pool: 0,
+                stalled: false,
+            });
+            if !rec.outputs.contains(&q.output) {
+                rec.outputs.push(q.output.clone());
+            }
+            rec.peak_in_flight = rec.peak_in_flight.max(q.pool.in_flight_high_water);
+            // Several queues on one output see the same gaps; count them once.
+            rec.sequence_gaps = rec.sequence_gaps.max(unexplained_gaps(q));
+            let (n, sum) = samples.entry(q.node_id).or_default();
+            *n += q.pool.samples;
+            *sum += q.pool.in_flight_sum;
+        }
+        let recommendations = by_node
+            .into_values()
+            .map(|mut rec| {
+                let (n, sum) = samples[&rec.node_id];
+                rec.mean_in_flight = (sum as f64 / n as f64) as f32;
+                rec.stalled = rec.sequence_gaps > 0;
+                let frames = rec.peak_in_flight + options.headroom as u64 + rec.stalled as u64;
+                rec.frames_pool = (frames.min(i32::MAX as u64) as i32).clamp(options.min_frames, options.max_frames);
+                rec
+            })
+            .collect();
+        Self { recommendations }
+    }
+
+    pub fn for_node(&self, node_id: i64) -> Option<&PoolRecommendation> {
+        self.recommendations.iter().find(|r| r.node_id == node_id)
+    }
+
+    /// Recommendation for `node_id` if it was measured on a node of type `node_name`.
+    pub(crate) fn matching(&self, node_id: i64, node_name: &str) -> Option<&PoolRecommendation> {
+        self.for_node(node_id).filter(|r| r.node_name == node_name)
+    }
+
+    pub fn load(path: impl AsRef<Path>) -> Result<Self> {
+        let path = path.as_ref();
+        let s = std::fs::read_to_string(path)
+            .map_err(|e| DepthaiError::new(format!("failed to read pool sizing {}: {e}", path.display())))?;
+        serde_json::from_str(&s)
+            .map_err(|e| DepthaiError::new(format!("invalid pool sizing {}: {e}", path.display())))
+    }
+
+    pub fn save(&self, path: impl AsRef<Path>) -> Result<()> {
+        let path = path.as_ref();
+        let s = serde_json::to_string_pretty(self)
+            .map_err(|e| DepthaiError::new(format!("failed to serialize pool sizing: {e}")))?;
+        std::fs::write(path, s)
+            .map_err(|e| DepthaiError::new(format!("failed to write pool sizing {}: {e}", path.display())))
+    }
+}
+
+/// Sequence gaps at `q` beyond those its camera output skips by running slower than the sensor.
+fn unexplained_gaps(q: &QueueStats) -> u64 {
+    let gaps = q.pool.sequence_gaps;
+    let (Some(output), Some(sensor)) = (q.output_fps, q.sensor_fps) else {
+        return gaps;
+    };
+    if !(output > 0.0 && sensor > output) {
+        return gaps;
+    }
+    // Each delivered frame follows `sensor / output - 1` skipped ones on average; a fractional
+    // ratio alternates between its floor and ceiling, so allow one interval of slack.
+    let skipped_per_frame = f64::from(sensor) / f64::from(output) - 1.0;
+    let expected = (skipped_per_frame * (q.pool.samples + 1) as f64).ceil() as u64;
+    gaps.saturating_sub(expected)
+}
@@ -6,9 +6,9 @@ use std::time::Duration;
 use autocxx::{c_int, c_uint, c_void as autocxx_c_void};
 use depthai_sys::{depthai, DaiDataQueue, DaiDatatype, DaiInputQueue};
 
-use crate::camera::{ImageFrame};
-use crate::encoded_frame::EncodedFrame;
-use crate::error::{clear_error_flag, last_error, take_error_if_any, Result};
+use crate::camera::{ImageFrame, OutputQueue};
+use crate::encoded_frame::{EncodedFrame, EncodedFrameQueue};
+use crate::error::{batch_result, clear_error_flag, last_error, take_error_if_any, DepthaiError, Result};
 use crate::host_node::{Buffer, MessageGroup};
 use crate::pointcloud::PointCloudData;
 use crate::rgbd::RgbdData;
@@ -239,6 +239,30 @@ impl Datatype {
     }
 }
 
+/// Counters of a latest-only queue (see [`crate::Output::create_latest_queue`]).
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ConflationStats {
+    /// Messages that arrived on the queue.
+    pub received: u64,
+    /// Arrivals that replaced a message nobody had read yet. Messages delivered to a callback
+    /// count as read.
+    pub overwritten: u64,
+    /// Messages a callback skipped because a newer one arrived while it was busy.
+    pub coalesced: u64,
+}
+
+/// `None` for queues that are not latest-only.
+pub(crate) fn conflation_stats(handle: DaiDataQueue) -> Option<ConflationStats> {
+    clear_error_flag();
+    let mut raw = depthai_sys::DaiConflationStats::default();
+    let ok = unsafe { depthai::dai_queue_get_conflation_stats(handle, &mut raw) };
+    ok.then_some(ConflationStats {
+        received: raw.received,
+        overwritten: raw.overwritten,
+        coalesced: raw.coalesced,
+    })
+}
+
 struct MessageQueueInner {
     handle: DaiDataQueue,
 }
@@ -514,6 +538,26 @@ impl MessageQueue {
         }
     }
 
+    /// Sends `msgs` in order in one FFI call.
+    ///
+    /// `None` blocks on every message, `Some(Duration::ZERO)` try-sends each one and any other
+    /// timeout is a single deadline for the whole batch. Returns how many messages the queue
+    /// accepted; running out of time is not an error, just a short count. On failure the error's
+    /// [`DepthaiError::partial_sent`] counts the messages before the failing one, which stay sent.
+    pub fn send_many(&self, msgs: &[Datatype], timeout: Option<Duration>) -> Result<usize> {
+        let handles: Vec<DaiDatatype> = msgs.iter().map(Datatype::handle).collect();
+        clear_error_flag();
+        let sent = unsafe {
+            depthai::dai_queue_send_many(self.handle(), handles.as_ptr(), handles.len(), timeout_to_ms(timeout))
+        };
+        batch_result(sent, "failed to send messages to queue")
+    }
+
+    /// Overwrite and coalescing counters, if this is a latest-only queue.
+    pub fn conflation_stats(&self) -> Option<ConflationStats> {
+        conflation_stats(self.handle())
+    }
+
     pub fn add_callback<F>(&self, callback: F) -> Result<QueueCallbackHandle>
     where
         F: FnMut(&str, Datatype) + Send + 'static,
@@ -612,6 +656,10 @@ impl InputQueue {
         Self { handle }
     }
 
+    pub(crate) fn handle(&self) -> DaiInputQueue {
+        self.handle
+    }
+
     pub fn send(&self, msg: &Datatype) -> Result<()> {
         clear_error_flag();
         unsafe { depthai::dai_input_queue_send(self.handle, msg.handle()) };
@@ -621,4 +669,166 @@ impl InputQueue {
             Ok(())
         }
     }
+
+    pub fn send_buffer(&self, buffer: &Buffer) -> Result<()> {
+        clear_error_flag();
+        unsafe { depthai::dai_input_queue_send_buffer(self.handle, buffer.handle()) };
+        if let Some(err) = take_error_if_any("failed to send buffer") {
+            Err(err)
+        } else {
+            Ok(())
+        }
+    }
+
+    pub fn send_frame(&self, frame: &ImageFrame) -> Result<()> {
+        clear_error_flag();
+        unsafe { depthai::dai_input_queue_send_img_frame(self.handle, frame.handle()) };
+        if let Some(err) = take_error_if_any("failed to send frame") {
+            Err(err)
+        } else {
+            Ok(())
+        }
+    }
+
+    /// Sends `msgs` in order in one FFI call.
+    ///
+    /// Returns `msgs.len()` on success. On failure the error's [`DepthaiError::partial_sent`]
+    /// counts the messages before the failing one, which stay sent.
+    pub fn send_many(&self, msgs: &[Datatype]) -> Result<usize> {
+        let handles: Vec<DaiDatatype> = msgs.iter().map(Datatype::handle).collect();
+        clear_error_flag();
+        let sent = unsafe { depthai::dai_input_queue_send_many(self.handle, handles.as_ptr(), handles.len()) };
+        batch_result(sent, "failed to send messages")
+    }
+
+    /// Batched [`Self::send_buffer`]; the result reads like [`Self::send_many`]'s.
+    pub fn send_buffers(&self, buffers: &[Buffer]) -> Result<usize> {
+        let handles: Vec<_> = buffers.iter().map(Buffer::handle).collect();
+        clear_error_flag();
+        let sent = unsafe { depthai::dai_input_queue_send_buffers(self.handle, handles.as_ptr(), handles.len()) };
+        batch_result(sent, "failed to send buffers")
+    }
+
+    /// Batched [`Self::send_frame`]; the result reads like [`Self::send_many`]'s.
+    pub fn send_frames(&self, frames: &[ImageFrame]) -> Result<usize> {
+        let handles: Vec<_> = frames.iter().map(ImageFrame::handle).collect();
+        clear_error_flag();
+        let sent = unsafe { depthai::dai_input_queue_send_img_frames(self.handle, handles.as_ptr(), handles.len()) };
+        batch_result(sent, "failed to send frames")
+    }
+}
+
+/// Queues that can take part in a [`QueueWaitSet`].
+pub trait WaitableQueue {
+    #[doc(hidden)]
+    fn wait_handle(&self) -> DaiDataQueue;
+}
+
+impl WaitableQueue for MessageQueue {
+    fn wait_handle(&self) -> DaiDataQueue {
+        self.handle()
+    }
+}
+
+impl WaitableQueue for OutputQueue {
+    fn wait_handle(&self) -> DaiDataQueue {
+        self.handle()
+    }
+}
+
+impl WaitableQueue for EncodedFrameQueue {
+    fn wait_handle(&self) -> DaiDataQueue {
+        self.handle()
+    }
+}
+
+fn timeout_to_ms(timeout: Option<Duration>) -> i32 {
+    timeout.map(|d| d.as_millis().min(i32::MAX as u128) as i32).unwrap_or(-1)
+}
+
+fn ready_indices(ready: &[bool]) -> Vec<usize> {
+    ready.iter().enumerate().filter(|(_, r)| **r).map(|(i, _)| i).collect()
+}
+
+/// Waits on several queues at once, replacing one polling thread per queue with a single loop.
+///
+/// Wake-up callbacks are registered once when the set is created; waiting never consumes
+/// messages, it only reports which queues have one (or were closed).
+pub struct QueueWaitSet {
+    handle: depthai_sys::DaiQueueWaitSet,
+    len: usize,
+}
+
+unsafe impl Send for QueueWaitSet {}
+unsafe impl Sync for QueueWaitSet {}
+
+impl Drop for QueueWaitSet {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_queue_waitset_release(self.handle) };
+            self.handle = std::ptr::null_mut();
+        }
+    }
+}
+
+impl QueueWaitSet {
+    pub fn new(queues: &[&dyn WaitableQueue]) -> Result<Self> {
+        clear_error_flag();
+        let handles: Vec<DaiDataQueue> = queues.iter().map(|q| q.wait_handle()).collect();
+        let handle = unsafe { depthai::dai_queue_waitset_new(handles.as_ptr(), handles.len()) };
+        if handle.is_null() {
+            Err(last_error("failed to create queue wait set"))
+        } else {
+            Ok(Self {
+                handle,
+                len: handles.len(),
+            })
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Blocks until at least one queue is ready and returns the ready indices (in the order the
+    /// queues were passed to [`Self::new`]). Returns an empty vector on timeout.
+    pub fn wait(&self, timeout: Option<Duration>) -> Result<Vec<usize>> {
+        let mut ready = vec![false; self.len];
+        self.wait_into(timeout, &mut ready)?;
+        Ok(ready_indices(&ready))
+    }
+
+    /// Allocation-free variant of [`Self::wait`]: fills one flag per queue and returns the
+    /// number of ready queues. `ready` must hold at least [`Self::len`] entries.
+    pub fn wait_into(&self, timeout: Option<Duration>, ready: &mut [bool]) -> Result<usize> {
+        if ready.len() < self.len {
+            return Err(DepthaiError::new("ready buffer is shorter than the wait set"));
+        }
+        clear_error_flag();
+        let n = unsafe { depthai::dai_queue_waitset_wait(self.handle, timeout_to_ms(timeout), ready.as_mut_ptr()) };
+        if n < 0 {
+            Err(last_error("failed to wait on queues"))
+        } else {
+            Ok(n as usize)
+        }
+    }
+}
+
+/// One-shot form of [`QueueWaitSet::wait`]; cheap when a queue already has a message.
+pub fn wait_any(queues: &[&dyn WaitableQueue], timeout: Option<Duration>) -> Result<Vec<usize>> {
+    clear_error_flag();
+    let handles: Vec<DaiDataQueue> = queues.iter().map(|q| q.wait_handle()).collect();
+    let mut ready = vec![false; handles.len()];
+    let n = unsafe {
+        depthai::dai_queue_wait_any(handles.as_ptr(), handles.len(), timeout_to_ms(timeout), ready.as_mut_ptr())
+    };
+    if n < 0 {
+        Err(last_error("failed to wait on queues"))
+    } else {
+        Ok(ready_indices(&ready))
+    }
 }
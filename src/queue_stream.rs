@@ -0,0 +1,177 @@
+use std::ffi::c_void as std_c_void;
+use std::future::poll_fn;
+#[cfg(feature = "async")]
+use std::pin::Pin;
+use std::sync::{Arc, Mutex};
+use std::task::{Context, Poll, Waker};
+
+use autocxx::{c_int, c_void as autocxx_c_void};
+use depthai_sys::{depthai, DaiDataQueue};
+
+use crate::camera::ImageFrame;
+use crate::encoded_frame::EncodedFrame;
+use crate::error::{clear_error_flag, last_error, take_error_if_any, Result};
+use crate::queue::{Datatype, MessageQueue};
+
+struct WakeSlot {
+    waker: Mutex<Option<Waker>>,
+}
+
+impl WakeSlot {
+    fn register(&self, waker: &Waker) {
+        let mut slot = self.waker.lock().unwrap_or_else(|e| e.into_inner());
+        match slot.as_ref() {
+            Some(w) if w.will_wake(waker) => {}
+            _ => *slot = Some(waker.clone()),
+        }
+    }
+}
+
+unsafe extern "C" fn wake_trampoline(ctx: *mut std_c_void) {
+    if ctx.is_null() {
+        return;
+    }
+    let slot = unsafe { &*(ctx as *const WakeSlot) };
+    let waker = slot.waker.lock().unwrap_or_else(|e| e.into_inner()).take();
+    if let Some(w) = waker {
+        w.wake();
+    }
+}
+
+unsafe extern "C" fn wake_drop(ctx: *mut std_c_void) {
+    if ctx.is_null() {
+        return;
+    }
+    unsafe { drop(Arc::from_raw(ctx as *const WakeSlot)) };
+}
+
+/// Async stream of messages from a [`MessageQueue`], driven by a wake-only native callback.
+///
+/// No thread is parked per queue: the callback only wakes the polling task, which then pulls
+/// the message with a non-blocking get. Any number of streams can share a small runtime.
+/// With the `async` feature this implements `futures_core::Stream`; otherwise use [`Self::next`].
+pub struct MessageStream<T> {
+    queue: MessageQueue,
+    slot: Arc<WakeSlot>,
+    callback_id: i32,
+    poll_one: fn(DaiDataQueue) -> Result<Option<T>>,
+}
+
+impl<T> Drop for MessageStream<T> {
+    fn drop(&mut self) {
+        clear_error_flag();
+        let _ = unsafe { depthai::dai_queue_remove_callback(self.queue.handle(), c_int(self.callback_id)) };
+    }
+}
+
+impl<T> MessageStream<T> {
+    fn new(queue: &MessageQueue, poll_one: fn(DaiDataQueue) -> Result<Option<T>>) -> Result<Self> {
+        clear_error_flag();
+        let slot = Arc::new(WakeSlot {
+            waker: Mutex::new(None),
+        });
+        let ctx = Arc::into_raw(slot.clone()) as *mut std_c_void;
+        let id = unsafe {
+            depthai::dai_queue_add_wake_callback(
+                queue.handle(),
+                ctx as *mut autocxx_c_void,
+                wake_trampoline as usize,
+                wake_drop as usize,
+            )
+        };
+        let id: i32 = id.0;
+        if id < 0 {
+            unsafe { drop(Arc::from_raw(ctx as *const WakeSlot)) };
+            return Err(last_error("failed to register queue wake callback"));
+        }
+        Ok(Self {
+            queue: queue.clone(),
+            slot,
+            callback_id: id,
+            poll_one,
+        })
+    }
+
+    /// Polls for the next message; `Ready(None)` once the queue is closed and drained.
+    pub fn poll_next_message(&mut self, cx: &mut Context<'_>) -> Poll<Option<Result<T>>> {
+        let handle = self.queue.handle();
+        // Register first so a message arriving between the check and the return is not lost. The
+        // native side only fires the wake once the message is visible, so an empty poll here
+        // means nothing has arrived yet.
+        self.slot.register(cx.waker());
+        loop {
+            match (self.poll_one)(handle) {
+                Ok(Some(msg)) => return Poll::Ready(Some(Ok(msg))),
+                // Typed polls drop messages of other types; keep going while more are queued.
+                Ok(None) if unsafe { depthai::dai_queue_has(handle) } => continue,
+                Ok(None) => break,
+                Err(err) => return Poll::Ready(Some(Err(err))),
+            }
+        }
+        if unsafe { depthai::dai_queue_is_closed(handle) } {
+            return Poll::Ready(None);
+        }
+        Poll::Pending
+    }
+
+    /// Waits for the next message; `None` once the queue is closed and drained.
+    pub async fn next(&mut self) -> Option<Result<T>> {
+        poll_fn(|cx| self.poll_next_message(cx)).await
+    }
+}
+
+#[cfg(feature = "async")]
+impl<T> futures_core::Stream for MessageStream<T> {
+    type Item = Result<T>;
+
+    fn poll_next(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Option<Self::Item>> {
+        self.get_mut().poll_next_message(cx)
+    }
+}
+
+fn try_get_datatype(handle: DaiDataQueue) -> Result<Option<Datatype>> {
+    clear_error_flag();
+    let msg = unsafe { depthai::dai_queue_try_get(handle) };
+    if msg.is_null() {
+        take_error_if_any("failed to poll queue message").map_or(Ok(None), Err)
+    } else {
+        Ok(Some(Datatype::from_handle(msg)))
+    }
+}
+
+fn try_get_frame(handle: DaiDataQueue) -> Result<Option<ImageFrame>> {
+    clear_error_flag();
+    let frame = unsafe { depthai::dai_queue_try_get_frame(handle) };
+    if frame.is_null() {
+        take_error_if_any("failed to poll frame").map_or(Ok(None), Err)
+    } else {
+        Ok(Some(ImageFrame::from_handle(frame)))
+    }
+}
+
+fn try_get_encoded_frame(handle: DaiDataQueue) -> Result<Option<EncodedFrame>> {
+    clear_error_flag();
+    let frame = unsafe { depthai::dai_queue_try_get_encoded_frame(handle) };
+    if frame.is_null() {
+        take_error_if_any("failed to poll encoded frame").map_or(Ok(None), Err)
+    } else {
+        Ok(Some(EncodedFrame::from_handle(frame)))
+    }
+}
+
+impl MessageQueue {
+    /// Async stream of every message on this queue.
+    pub fn stream(&self) -> Result<MessageStream<Datatype>> {
+        MessageStream::new(self, try_get_datatype)
+    }
+
+    /// Async stream of `ImgFrame` messages; messages of other types are skipped.
+    pub fn frame_stream(&self) -> Result<MessageStream<ImageFrame>> {
+        MessageStream::new(self, try_get_frame)
+    }
+
+    /// Async stream of `EncodedFrame` messages; messages of other types are skipped.
+    pub fn encoded_frame_stream(&self) -> Result<MessageStream<EncodedFrame>> {
+        MessageStream::new(self, try_get_encoded_frame)
+    }
+}
@@ -0,0 +1,243 @@
+//! Shared undistortion / rectification remap tables for host-side image processing.
+//!
+//! A [`RemapTable`] holds fixed-point lookup maps (integer source coordinates plus 1/32-pixel
+//! fractions) built once from the camera calibration. Tables live in a process-wide cache keyed
+//! by board socket, source and output resolution, a calibration hash and the rectification
+//! parameters, so every host node that undistorts the same stream shares one set of maps instead
+//! of rebuilding them; concurrent requests for a missing table build it once. Remapping runs in
+//! the C++ wrapper over row bands on a shared worker pool, or on the caller's thread while the
+//! pool is busy with another remap.
+//!
+//! [`create_remap_node`] wraps a table in a threaded host node that undistorts every frame of
+//! an output, which covers host-side ImageAlign / ImageManip undistortion without per-node setup.
+
+use std::sync::Arc;
+
+use depthai_sys::{depthai, DaiRemapTable};
+use serde_json::Value;
+
+use crate::buffer_pool::FramePool;
+use crate::camera::ImageFrame;
+use crate::common::{CameraBoardSocket, ImageFrameType};
+use crate::depth_projection::CameraIntrinsics;
+use crate::error::{clear_error_flag, last_error, DepthaiError, Result};
+use crate::output::{Input, Output};
+use crate::pipeline::Pipeline;
+use crate::threaded_host_node::{ThreadedHostNode, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+/// Stable 64-bit hash of calibration JSON, used as part of the remap cache key.
+///
+/// FNV-1a over the serialized form, so equal calibrations hash equally across runs.
+pub fn calibration_hash(calibration: &Value) -> u64 {
+    calibration
+        .to_string()
+        .bytes()
+        .fold(0xcbf2_9ce4_8422_2325u64, |h, b| (h ^ b as u64).wrapping_mul(0x0000_0100_0000_01b3))
+}
+
+/// Stereo-style rectification applied on top of undistortion.
+#[derive(Clone, Debug, PartialEq)]
+pub struct Rectification {
+    /// Row-major rotation from the camera into the rectified frame (`R` of `cv::stereoRectify`).
+    pub rotation: [f32; 9],
+    /// Intrinsics and size of the rectified output image.
+    pub target: CameraIntrinsics,
+}
+
+/// Fixed-point remap maps for one camera, shared through the process-wide cache.
+pub struct RemapTable {
+    handle: DaiRemapTable,
+    cache_hit: bool,
+    width: u32,
+    height: u32,
+    source: (u32, u32),
+}
+
+unsafe impl Send for RemapTable {}
+unsafe impl Sync for RemapTable {}
+
+impl Drop for RemapTable {
+    fn drop(&mut self) {
+        if !self.handle.is_null() {
+            unsafe { depthai::dai_remap_table_release(self.handle) };
+            self.handle = std::ptr::null_mut();
+        }
+    }
+}
+
+impl RemapTable {
+    /// Returns the cached table for these parameters, building it on first use.
+    ///
+    /// `camera` describes the source image. Without `rectification` the output is the
+    /// undistorted image with the same intrinsics and size.
+    pub fn get(
+        socket: CameraBoardSocket,
+        calibration_hash: u64,
+        camera: &CameraIntrinsics,
+        rectification: Option<&Rectification>,
+    ) -> Result<Self> {
+        let raw_camera = camera.to_raw();
+        let raw_target = rectification.map(|r| r.target.to_raw());
+        let mut cache_hit = false;
+        clear_error_flag();
+        let handle = unsafe {
+            depthai::dai_remap_table_get(
+                socket as i32,
+                calibration_hash,
+                &raw_camera,
+                rectification.map_or(std::ptr::null(), |r| r.rotation.as_ptr()),
+                raw_target.as_ref().map_or(std::ptr::null(), |t| t as *const _),
+                &mut cache_hit,
+            )
+        };
+        if handle.is_null() {
+            return Err(last_error("failed to get remap table"));
+        }
+        let (mut width, mut height) = (0u32, 0u32);
+        unsafe { depthai::dai_remap_table_get_size(handle, &mut width, &mut height) };
+        Ok(Self {
+            handle,
+            cache_hit,
+            width,
+            height,
+            source: (camera.width, camera.height),
+        })
+    }
+
+    /// Undistortion table for `socket` at `width` x `height`, parsed from the pipeline calibration.
+    pub fn for_camera(
+        pipeline: &Pipeline,
+        socket: CameraBoardSocket,
+        width: u32,
+        height: u32,
+        rectification: Option<&Rectification>,
+    ) -> Result<Self> {
+        let calibration = pipeline
+            .calibration_data_json()?
+            .ok_or_else(|| DepthaiError::new("pipeline has no calibration data"))?;
+        let camera = CameraIntrinsics::from_calibration_json(&calibration, socket, width, height)?;
+        Self::get(socket, calibration_hash(&calibration), &camera, rectification)
+    }
+
+    /// Whether this handle reused a table that was already alive or being built by another caller.
+    pub fn cache_hit(&self) -> bool {
+        self.cache_hit
+    }
+
+    /// Output size.
+    pub fn size(&self) -> (u32, u32) {
+        (self.width, self.height)
+    }
+
+    /// Source image size the table expects.
+    pub fn source_size(&self) -> (u32, u32) {
+        self.source
+    }
+
+    /// Remaps `frame` (GRAY8 / RAW8, RAW16 or RGB888i / BGR888i) into `out` as tightly packed
+    /// pixels of the same type. `nearest` skips interpolation, which depth frames need.
+    pub fn remap_into(&self, frame: &ImageFrame, nearest: bool, out: &mut Vec<u8>) -> Result<usize> {
+        let info = frame.raw_info()?;
+        let len = self.output_len(frame_bpp(info.type_)?);
+        out.resize(len, 0);
+        self.apply(&info, nearest, out)
+    }
+
+    fn output_len(&self, bpp: usize) -> usize {
+        self.width as usize * self.height as usize * bpp
+    }
+
+    fn apply(&self, info: &depthai_sys::DaiImgFrameInfo, nearest: bool, out: &mut [u8]) -> Result<usize> {
+        clear_error_flag();
+        let written = unsafe { depthai::dai_remap_apply(self.handle, info, out.as_mut_ptr().cast(), out.len(), nearest) };
+        if written == 0 {
+            Err(last_error("failed to remap frame"))
+        } else {
+            Ok(written)
+        }
+    }
+}
+
+/// Remap tables currently alive in the process-wide cache.
+pub fn cached_remap_tables() -> usize {
+    depthai::dai_remap_cache_size().into()
+}
+
+fn frame_bpp(frame_type: i32) -> Result<usize> {
+    match ImageFrameType::from_raw(frame_type) {
+        Some(ImageFrameType::GRAY8 | ImageFrameType::RAW8) => Ok(1),
+        Some(ImageFrameType::RAW16) => Ok(2),
+        Some(ImageFrameType::RGB888i | ImageFrameType::BGR888i) => Ok(3),
+        _ => Err(DepthaiError::new(format!("remap does not support frame type {frame_type}"))),
+    }
+}
+
+struct RemapNode {
+    input: Input,
+    output: Output,
+    table: Arc<RemapTable>,
+    pool: FramePool,
+}
+
+impl RemapNode {
+    fn process(&mut self, frame: &ImageFrame) -> Result<()> {
+        let info = frame.raw_info()?;
+        let bpp = frame_bpp(info.type_)?;
+        let format = ImageFrameType::from_raw(info.type_)
+            .ok_or_else(|| DepthaiError::new(format!("unknown frame type {}", info.type_)))?;
+        let len = self.table.output_len(bpp);
+        let mut out = self.pool.acquire()?;
+        out.set_format(self.table.width, self.table.height, format, len)?;
+        // Interpolating depth would invent values across object edges.
+        self.table.apply(&info, format == ImageFrameType::RAW16, out.data_mut())?;
+        out.set_raw_info(&depthai_sys::DaiImgFrameInfo {
+            stride: self.table.width * bpp as u32,
+            plane_offsets: [0; 3],
+            ..info
+        })?;
+        self.output.send_frame(&out.into_frame())
+    }
+}
+
+impl ThreadedHostNodeImpl for RemapNode {
+    fn run(&mut self, ctx: &ThreadedHostNodeContext) {
+        while ctx.is_running() {
+            // Input reads fail once the pipeline stops and closes the queue.
+            let Ok(frame) = self.input.get_frame() else {
+                break;
+            };
+            // Unsupported or mismatched frames are dropped; keep going.
+            let _ = self.process(&frame);
+        }
+    }
+}
+
+/// Creates a threaded host node that remaps every frame of `output` through `table` and sends
+/// the result on its `out` output.
+///
+/// Output frames come from a pool of `pool_frames` frames and keep the source metadata; RAW16
+/// frames are sampled nearest so depth values are never blended.
+pub fn create_remap_node(
+    pipeline: &Pipeline,
+    output: &Output,
+    table: Arc<RemapTable>,
+    pool_frames: usize,
+) -> Result<(ThreadedHostNode, Output)> {
+    let mut out = None;
+    let node = pipeline.create_threaded_host_node(|node| {
+        let input = node.create_input(Some("in"))?;
+        output.link(&input)?;
+        let remapped = node.create_output(Some("out"))?;
+        out = Some(remapped.clone());
+        // Sized for the widest supported pixel (3 bytes); narrower frames reuse the same pool.
+        let pool = FramePool::new(table.output_len(3), pool_frames.max(1))?;
+        Ok(RemapNode {
+            input,
+            output: remapped,
+            table,
+            pool,
+        })
+    })?;
+    let out = out.ok_or_else(|| DepthaiError::new("remap node has no output"))?;
+    Ok((node, out))
+}
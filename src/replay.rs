@@ -0,0 +1,813 @@
+//! Frame recordings that replay from a memory map, unthrottled or at an N-times clock, with seek.
+//!
+//! [`FrameRecorder`] appends `ImgFrame` / `EncodedFrame` payloads and their metadata from one or
+//! more pipeline outputs to a flat file and closes it with a timestamp index and a stream table.
+//! [`Recording`] maps such a file (rebuilding both by a linear scan if the recorder never
+//! finished) and
+//! [`create_replay_node`] feeds it back into a pipeline from a threaded host node: as fast as
+//! downstream backpressure allows, or paced by the recorded timestamps scaled by a speed factor.
+//! The returned [`ReplayControl`] seeks by frame index or timestamp and changes the rate while
+//! the pipeline runs.
+
+use std::collections::BTreeSet;
+use std::fs::File;
+use std::io::{BufWriter, Write};
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::{Duration, Instant};
+
+use memmap2::Mmap;
+
+use crate::buffer_pool::FramePool;
+use crate::camera::ImageFrame;
+use crate::common::ImageFrameType;
+use crate::encoded_frame::{EncodedFrame, EncodedFrameProfile, EncodedFrameType};
+use crate::error::{DepthaiError, Result};
+use crate::frame_ring::{RingFrameMeta, RingPayloadKind};
+use crate::host_node::Buffer;
+use crate::output::{Input, Output};
+use crate::pipeline::Pipeline;
+use crate::threaded_host_node::{ThreadedHostNode, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+const FILE_MAGIC: u64 = u64::from_le_bytes(*b"DAIREC01");
+const INDEX_MAGIC: u64 = u64::from_le_bytes(*b"DAIRIDX2");
+const RECORD_TAG: u32 = u32::from_le_bytes(*b"FRM1");
+const VERSION: u32 = 1;
+const FILE_HEADER_SIZE: usize = 64;
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct RecordHeader {
+    tag: u32,
+    stream: u32,
+    meta: RingFrameMeta,
+}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct IndexEntry {
+    offset: u64,
+    clock_ns: i64,
+    stream: u32,
+    _reserved: u32,
+}
+
+/// Last bytes of a finished recording, after the index and the stream table (`stream_count`
+/// `u32` ids, padded to 8 bytes).
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct Footer {
+    index_offset: u64,
+    count: u64,
+    stream_count: u64,
+    max_image_len: u64,
+    magic: u64,
+}
+
+const RECORD_HEADER_SIZE: usize = std::mem::size_of::<RecordHeader>();
+const FOOTER_SIZE: usize = std::mem::size_of::<Footer>();
+
+/// Records are padded so every header (and the index) stays 8-byte aligned in the map.
+fn padded(len: usize) -> usize {
+    len.next_multiple_of(8)
+}
+
+fn as_bytes<T: Copy>(value: &T) -> &[u8] {
+    // Safety: only used on the padding-free `repr(C)` records above.
+    unsafe { std::slice::from_raw_parts((value as *const T).cast::<u8>(), std::mem::size_of::<T>()) }
+}
+
+/// Replay clock of a record: the host-synced capture timestamp, or the publish time for payloads
+/// recorded without one.
+fn clock_ns(meta: &RingFrameMeta) -> i64 {
+    if meta.timestamp_ns != 0 {
+        meta.timestamp_ns
+    } else {
+        meta.publish_unix_ns as i64
+    }
+}
+
+fn recording_error(context: &str, path: &Path, e: std::io::Error) -> DepthaiError {
+    DepthaiError::new(format!("{context} {}: {e}", path.display()))
+}
+
+struct RecorderInner {
+    file: BufWriter<File>,
+    path: PathBuf,
+    offset: u64,
+    index: Vec<IndexEntry>,
+    streams: BTreeSet<u32>,
+    max_image_len: usize,
+    finished: bool,
+}
+
+impl RecorderInner {
+    fn record(&mut self, stream: u32, mut meta: RingFrameMeta, data: &[u8]) -> Result<usize> {
+        if self.finished {
+            return Err(DepthaiError::new("frame recorder is already finished"));
+        }
+        meta.len = data.len() as u64;
+        if meta.publish_unix_ns == 0 {
+            meta.publish_unix_ns = std::time::SystemTime::now()
+                .duration_since(std::time::UNIX_EPOCH)
+                .map_or(0, |d| d.as_nanos() as u64);
+        }
+        let header = RecordHeader {
+            tag: RECORD_TAG,
+            stream,
+            meta,
+        };
+        let pad = padded(data.len()) - data.len();
+        let written = self
+            .file
+            .write_all(as_bytes(&header))
+            .and_then(|_| self.file.write_all(data))
+            .and_then(|_| self.file.write_all(&[0u8; 8][..pad]));
+        if let Err(e) = written {
+            // A partial record would desync the index; stop here and let readers scan up to it.
+            self.finished = true;
+            return Err(recording_error("failed to write recording", &self.path, e));
+        }
+        self.index.push(IndexEntry {
+            offset: self.offset,
+            clock_ns: clock_ns(&meta),
+            stream,
+            _reserved: 0,
+        });
+        self.streams.insert(stream);
+        if meta.kind() == Some(RingPayloadKind::Image) {
+            self.max_image_len = self.max_image_len.max(data.len());
+        }
+        self.offset += (RECORD_HEADER_SIZE + data.len() + pad) as u64;
+        Ok(self.index.len() - 1)
+    }
+
+    fn finish(&mut self) -> Result<()> {
+        if self.finished {
+            return Ok(());
+        }
+        self.finished = true;
+        let footer = Footer {
+            index_offset: self.offset,
+            count: self.index.len() as u64,
+            stream_count: self.streams.len() as u64,
+            max_image_len: self.max_image_len as u64,
+            magic: INDEX_MAGIC,
+        };
+        let table: Vec<u8> = self.streams.iter().flat_map(|s| s.to_le_bytes()).collect();
+        let pad = padded(table.len()) - table.len();
+        let path = &self.path;
+        let file = &mut self.file;
+        self.index
+            .iter()
+            .try_for_each(|entry| file.write_all(as_bytes(entry)))
+            .and_then(|_| file.write_all(&table))
+            .and_then(|_| file.write_all(&[0u8; 8][..pad]))
+            .and_then(|_| file.write_all(as_bytes(&footer)))
+            .and_then(|_| file.flush())
+            .map_err(|e| recording_error("failed to finish recording", path, e))
+    }
+}
+
+/// Appends frames to a recording file; clones share the same file.
+///
+/// Records from different streams are interleaved in arrival order. The file is readable while
+/// it is being written (without the index) and gets its index on [`Self::finish`] or drop.
+#[derive(Clone)]
+pub struct FrameRecorder {
+    inner: Arc<Mutex<RecorderInner>>,
+}
+
+impl FrameRecorder {
+    /// Creates (or truncates) a recording at `path`.
+    pub fn create(path: impl Into<PathBuf>) -> Result<Self> {
+        let path = path.into();
+        let file = File::create(&path).map_err(|e| recording_error("failed to create recording", &path, e))?;
+        let mut file = BufWriter::with_capacity(1 << 20, file);
+        let mut header = [0u8; FILE_HEADER_SIZE];
+        header[..8].copy_from_slice(&FILE_MAGIC.to_le_bytes());
+        header[8..12].copy_from_slice(&VERSION.to_le_bytes());
+        file.write_all(&header)
+            .map_err(|e| recording_error("failed to write recording", &path, e))?;
+        Ok(Self {
+            inner: Arc::new(Mutex::new(RecorderInner {
+                file,
+                path,
+                offset: FILE_HEADER_SIZE as u64,
+                index: Vec::new(),
+                streams: BTreeSet::new(),
+                max_image_len: 0,
+                finished: false,
+            })),
+        })
+    }
+
+    fn lock(&self) -> std::sync::MutexGuard<'_, RecorderInner> {
+        self.inner.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Records processed so far.
+    pub fn len(&self) -> usize {
+        self.lock().index.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Appends `data` with `meta` to `stream`; returns the record index.
+    pub fn record(&self, stream: u32, meta: RingFrameMeta, data: &[u8]) -> Result<usize> {
+        self.lock().record(stream, meta, data)
+    }
+
+    pub fn record_frame(&self, stream: u32, frame: &ImageFrame) -> Result<usize> {
+        self.record(stream, RingFrameMeta::of_frame(frame)?, frame.as_bytes())
+    }
+
+    pub fn record_encoded(&self, stream: u32, frame: &EncodedFrame) -> Result<usize> {
+        self.record(stream, RingFrameMeta::of_encoded(frame), frame.as_bytes())
+    }
+
+    /// Writes the index and flushes; later records are rejected.
+    pub fn finish(&self) -> Result<()> {
+        self.lock().finish()
+    }
+}
+
+impl Drop for RecorderInner {
+    fn drop(&mut self) {
+        let _ = self.finish();
+    }
+}
+
+struct RecorderSink {
+    input: Input,
+    recorder: FrameRecorder,
+    stream: u32,
+    kind: RingPayloadKind,
+}
+
+impl ThreadedHostNodeImpl for RecorderSink {
+    fn run(&mut self, ctx: &ThreadedHostNodeContext) {
+        while ctx.is_running() {
+            let recorded = match self.kind {
+                RingPayloadKind::Encoded => match self.input.get_encoded_frame() {
+                    Ok(frame) => self.recorder.record_encoded(self.stream, &frame),
+                    Err(_) => break,
+                },
+                _ => match self.input.get_frame() {
+                    Ok(frame) => self.recorder.record_frame(self.stream, &frame),
+                    Err(_) => break,
+                },
+            };
+            if recorded.is_err() {
+                break;
+            }
+        }
+    }
+}
+
+/// Creates a threaded host node that records every message from `output` as `stream`.
+///
+/// `kind` selects how messages are read, as for [`crate::frame_ring::create_frame_ring_sink`].
+pub fn create_frame_recorder_sink(
+    pipeline: &Pipeline,
+    output: &Output,
+    recorder: &FrameRecorder,
+    stream: u32,
+    kind: RingPayloadKind,
+) -> Result<ThreadedHostNode> {
+    let recorder = recorder.clone();
+    pipeline.create_threaded_host_node(|node| {
+        let input = node.create_input(Some("in"))?;
+        output.link(&input)?;
+        Ok(RecorderSink {
+            input,
+            recorder,
+            stream,
+            kind,
+        })
+    })
+}
+
+/// A memory-mapped recording written by [`FrameRecorder`].
+pub struct Recording {
+    map: Mmap,
+    /// Index entries, either inside the map (finished recordings) or rebuilt by scanning.
+    index_at: Option<usize>,
+    scanned: Vec<IndexEntry>,
+    len: usize,
+    streams: Vec<u32>,
+    max_image_len: usize,
+}
+
+/// One record borrowed from a [`Recording`] map.
+#[derive(Debug, Clone, Copy)]
+pub struct RecordedFrame<'a> {
+    pub index: usize,
+    pub stream: u32,
+    pub meta: RingFrameMeta,
+    pub data: &'a [u8],
+}
+
+impl RecordedFrame<'_> {
+    /// Recorded timestamp used for pacing and seeking.
+    pub fn timestamp(&self) -> Duration {
+        Duration::from_nanos(clock_ns(&self.meta).max(0) as u64)
+    }
+}
+
+/// Position to seek a replay to.
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub enum ReplaySeek {
+    /// Record index across all streams.
+    Index(usize),
+    /// First record at or after this recorded timestamp (as in `ImageFrameInfo::timestamp`).
+    Timestamp(Duration),
+    /// First record at or after this offset from the start of the recording.
+    Offset(Duration),
+}
+
+impl Recording {
+    pub fn open(path: impl AsRef<Path>) -> Result<Self> {
+        let path = path.as_ref();
+        let file = File::open(path).map_err(|e| recording_error("failed to open recording", path, e))?;
+        let map = unsafe { Mmap::map(&file) }.map_err(|e| recording_error("failed to map recording", path, e))?;
+        if map.len() < FILE_HEADER_SIZE
+            || map[..8] != FILE_MAGIC.to_le_bytes()
+            || map[8..12] != VERSION.to_le_bytes()
+        {
+            return Err(DepthaiError::new(format!("{} is not a frame recording", path.display())));
+        }
+        #[cfg(unix)]
+        let _ = map.advise(memmap2::Advice::Sequential);
+
+        let mut recording = Self {
+            map,
+            index_at: None,
+            scanned: Vec::new(),
+            len: 0,
+            streams: Vec::new(),
+            max_image_len: 0,
+        };
+        if !recording.read_footer() {
+            recording.scan();
+        }
+        Ok(recording)
+    }
+
+    /// Takes the index, stream table and largest image size from the footer of a finished
+    /// recording, without touching the records.
+    fn read_footer(&mut self) -> bool {
+        let len = self.map.len();
+        if len < FILE_HEADER_SIZE + FOOTER_SIZE {
+            return false;
+        }
+        let footer: Footer = unsafe { std::ptr::read_unaligned(self.map[len - FOOTER_SIZE..].as_ptr().cast()) };
+        let at = footer.index_offset as usize;
+        let count = footer.count as usize;
+        let stream_count = footer.stream_count as usize;
+        let table_at = count.checked_mul(std::mem::size_of::<IndexEntry>()).and_then(|n| n.checked_add(at));
+        let table_end = table_at.and_then(|t| stream_count.checked_mul(4).map(|n| t + padded(n)));
+        let valid = footer.magic == INDEX_MAGIC
+            && at >= FILE_HEADER_SIZE
+            && at % 8 == 0
+            && table_end == Some(len - FOOTER_SIZE);
+        let Some(table_at) = table_at.filter(|_| valid) else {
+            return false;
+        };
+        self.streams = self.map[table_at..table_at + stream_count * 4]
+            .chunks_exact(4)
+            .map(|b| u32::from_le_bytes([b[0], b[1], b[2], b[3]]))
+            .collect();
+        self.index_at = Some(at);
+        self.len = count;
+        self.max_image_len = footer.max_image_len as usize;
+        true
+    }
+
+    /// Rebuilds the index and stream table of an unfinished recording by walking its records,
+    /// stopping at a truncated tail.
+    fn scan(&mut self) {
+        let mut entries = Vec::new();
+        let mut streams = BTreeSet::new();
+        let mut max_image_len = 0;
+        let mut offset = FILE_HEADER_SIZE;
+        while offset + RECORD_HEADER_SIZE <= self.map.len() {
+            let header = self.header_at(offset);
+            let end = offset + RECORD_HEADER_SIZE + padded(header.meta.len as usize);
+            if header.tag != RECORD_TAG || end > self.map.len() {
+                break;
+            }
+            entries.push(IndexEntry {
+                offset: offset as u64,
+                clock_ns: clock_ns(&header.meta),
+                stream: header.stream,
+                _reserved: 0,
+            });
+            streams.insert(header.stream);
+            if header.meta.kind() == Some(RingPayloadKind::Image) {
+                max_image_len = max_image_len.max(header.meta.len as usize);
+            }
+            offset = end;
+        }
+        self.len = entries.len();
+        self.scanned = entries;
+        self.streams = streams.into_iter().collect();
+        self.max_image_len = max_image_len;
+    }
+
+    fn entry(&self, i: usize) -> IndexEntry {
+        match self.index_at {
+            Some(at) => unsafe {
+                std::ptr::read_unaligned(self.map.as_ptr().add(at + i * std::mem::size_of::<IndexEntry>()).cast())
+            },
+            None => self.scanned[i],
+        }
+    }
+
+    fn header_at(&self, offset: usize) -> RecordHeader {
+        unsafe { std::ptr::read_unaligned(self.map.as_ptr().add(offset).cast()) }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Stream ids present in the recording, ascending.
+    pub fn streams(&self) -> &[u32] {
+        &self.streams
+    }
+
+    /// Largest image payload, used to size replay frame pools.
+    pub fn max_image_len(&self) -> usize {
+        self.max_image_len
+    }
+
+    pub fn get(&self, index: usize) -> Option<RecordedFrame<'_>> {
+        if index >= self.len {
+            return None;
+        }
+        let entry = self.entry(index);
+        let offset = entry.offset as usize;
+        if offset.checked_add(RECORD_HEADER_SIZE)? > self.map.len() {
+            return None;
+        }
+        let header = self.header_at(offset);
+        let start = offset + RECORD_HEADER_SIZE;
+        let data = self.map.get(start..start + header.meta.len as usize)?;
+        Some(RecordedFrame {
+            index,
+            stream: header.stream,
+            meta: header.meta,
+            data,
+        })
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = RecordedFrame<'_>> + '_ {
+        (0..self.len).filter_map(move |i| self.get(i))
+    }
+
+    /// Timestamp of the first record.
+    pub fn start_timestamp(&self) -> Option<Duration> {
+        (self.len > 0).then(|| Duration::from_nanos(self.entry(0).clock_ns.max(0) as u64))
+    }
+
+    /// Span between the first and last record timestamps.
+    pub fn duration(&self) -> Duration {
+        if self.len == 0 {
+            return Duration::ZERO;
+        }
+        let span = self.entry(self.len - 1).clock_ns - self.entry(0).clock_ns;
+        Duration::from_nanos(span.max(0) as u64)
+    }
+
+    /// Record index `seek` resolves to; `len()` when it lies past the end.
+    ///
+    /// Timestamp seeks binary-search the index, so they assume timestamps are non-decreasing in
+    /// record order (true for recordings of one device clock).
+    pub fn resolve(&self, seek: ReplaySeek) -> usize {
+        let target = match seek {
+            ReplaySeek::Index(i) => return i.min(self.len),
+            ReplaySeek::Timestamp(ts) => ts.as_nanos() as i64,
+            ReplaySeek::Offset(offset) => match self.start_timestamp() {
+                Some(start) => (start + offset).as_nanos() as i64,
+                None => return 0,
+            },
+        };
+        let (mut lo, mut hi) = (0usize, self.len);
+        while lo < hi {
+            let mid = lo + (hi - lo) / 2;
+            if self.entry(mid).clock_ns < target {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        lo
+    }
+}
+
+/// How fast a replay node emits records.
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub enum ReplayRate {
+    /// As fast as downstream queues accept messages.
+    Unthrottled,
+    /// Paced by recorded timestamps; `Speed(1.0)` is real time, `Speed(4.0)` four times faster.
+    Speed(f64),
+}
+
+#[derive(Debug, Clone, Copy)]
+pub struct ReplayOptions {
+    pub rate: ReplayRate,
+    /// Restart from the first record after the last one.
+    pub looping: bool,
+    pub start: Option<ReplaySeek>,
+    /// Stamp replayed frames with the current host time instead of the recorded timestamps.
+    pub restamp: bool,
+    /// Idle frames kept by the replay frame pool.
+    pub pool_frames: usize,
+}
+
+impl Default for ReplayOptions {
+    fn default() -> Self {
+        Self {
+            rate: ReplayRate::Speed(1.0),
+            looping: false,
+            start: None,
+            restamp: false,
+            pool_frames: 8,
+        }
+    }
+}
+
+struct ReplayShared {
+    seek: Mutex<Option<ReplaySeek>>,
+    seek_pending: AtomicBool,
+    /// `f64` bits of the speed; 0 means unthrottled.
+    speed: AtomicU64,
+    position: AtomicUsize,
+    finished: AtomicBool,
+    emit_errors: AtomicU64,
+    last_emit_error: Mutex<Option<DepthaiError>>,
+}
+
+/// Runtime control of a replay node; clones control the same node.
+#[derive(Clone)]
+pub struct ReplayControl {
+    shared: Arc<ReplayShared>,
+}
+
+impl ReplayControl {
+    fn new(options: &ReplayOptions) -> Self {
+        let control = Self {
+            shared: Arc::new(ReplayShared {
+                seek: Mutex::new(None),
+                seek_pending: AtomicBool::new(false),
+                speed: AtomicU64::new(0),
+                position: AtomicUsize::new(0),
+                finished: AtomicBool::new(false),
+                emit_errors: AtomicU64::new(0),
+                last_emit_error: Mutex::new(None),
+            }),
+        };
+        control.set_rate(options.rate);
+        if let Some(seek) = options.start {
+            control.seek(seek);
+        }
+        control
+    }
+
+    /// Continues from `seek`; takes effect before the next record is emitted.
+    pub fn seek(&self, seek: ReplaySeek) {
+        *self.shared.seek.lock().unwrap_or_else(|e| e.into_inner()) = Some(seek);
+        self.shared.seek_pending.store(true, Ordering::Release);
+    }
+
+    pub fn set_rate(&self, rate: ReplayRate) {
+        let speed = match rate {
+            ReplayRate::Speed(s) if s.is_finite() && s > 0.0 => s,
+            _ => 0.0,
+        };
+        self.shared.speed.store(speed.to_bits(), Ordering::Relaxed);
+    }
+
+    pub fn rate(&self) -> ReplayRate {
+        match f64::from_bits(self.shared.speed.load(Ordering::Relaxed)) {
+            s if s > 0.0 => ReplayRate::Speed(s),
+            _ => ReplayRate::Unthrottled,
+        }
+    }
+
+    /// Index of the next record to emit.
+    pub fn position(&self) -> usize {
+        self.shared.position.load(Ordering::Relaxed)
+    }
+
+    /// Whether a non-looping replay has emitted its last record (a seek restarts it).
+    pub fn is_finished(&self) -> bool {
+        self.shared.finished.load(Ordering::Acquire)
+    }
+
+    /// Records that could not be re-sent (then skipped), e.g. encoded records with an unknown
+    /// profile or sends rejected by an output.
+    pub fn emit_errors(&self) -> u64 {
+        self.shared.emit_errors.load(Ordering::Relaxed)
+    }
+
+    /// The most recent of [`Self::emit_errors`].
+    pub fn last_emit_error(&self) -> Option<DepthaiError> {
+        self.shared.last_emit_error.lock().unwrap_or_else(|e| e.into_inner()).clone()
+    }
+
+    fn record_emit_error(&self, err: DepthaiError) {
+        self.shared.emit_errors.fetch_add(1, Ordering::Relaxed);
+        *self.shared.last_emit_error.lock().unwrap_or_else(|e| e.into_inner()) = Some(err);
+    }
+
+    fn take_seek(&self) -> Option<ReplaySeek> {
+        if !self.shared.seek_pending.swap(false, Ordering::Acquire) {
+            return None;
+        }
+        self.shared.seek.lock().unwrap_or_else(|e| e.into_inner()).take()
+    }
+}
+
+struct ReplayNode {
+    recording: Arc<Recording>,
+    outputs: Vec<(u32, Output)>,
+    pool: Option<FramePool>,
+    control: ReplayControl,
+    looping: bool,
+    restamp: bool,
+}
+
+/// Longest single sleep while pacing, so seeks and stops are picked up promptly.
+const PACE_SLICE: Duration = Duration::from_millis(5);
+
+impl ReplayNode {
+    fn emit(&self, frame: &RecordedFrame<'_>) -> Result<()> {
+        let Some((_, output)) = self.outputs.iter().find(|(s, _)| *s == frame.stream) else {
+            return Ok(());
+        };
+        let meta = &frame.meta;
+        match (meta.kind(), ImageFrameType::from_raw(meta.format), &self.pool) {
+            (Some(RingPayloadKind::Image), Some(format), Some(pool)) => {
+                let mut img = pool.acquire()?;
+                img.set_format(meta.width, meta.height, format, frame.data.len())?;
+                img.data_mut().copy_from_slice(frame.data);
+                let info = depthai_sys::DaiImgFrameInfo {
+                    stride: meta.stride,
+                    plane_offsets: meta.plane_offsets,
+                    sequence_num: meta.sequence_num,
+                    timestamp_ns: meta.timestamp_ns,
+                    timestamp_device_ns: meta.timestamp_device_ns,
+                    instance_num: meta.instance_num as i32,
+                    ..Default::default()
+                };
+                img.set_raw_info(&info)?;
+                if self.restamp {
+                    img.set_timestamp_now();
+                }
+                output.send_frame(&img.into_frame())
+            }
+            (Some(RingPayloadKind::Encoded), _, _) => {
+                let profile = EncodedFrameProfile::from_raw(meta.format).ok_or_else(|| {
+                    DepthaiError::new(format!("record {} has unknown encoded profile {}", frame.index, meta.format))
+                })?;
+                let info = depthai_sys::DaiEncodedFrameInfo {
+                    width: meta.width as i32,
+                    height: meta.height as i32,
+                    profile: profile as i32,
+                    frame_type: EncodedFrameType::from_raw(meta.frame_type).unwrap_or(EncodedFrameType::Unknown) as i32,
+                    instance_num: meta.instance_num,
+                    sequence_num: meta.sequence_num,
+                    timestamp_ns: meta.timestamp_ns,
+                    timestamp_device_ns: meta.timestamp_device_ns,
+                };
+                let mut encoded = EncodedFrame::from_parts(frame.data, &info)?;
+                if self.restamp {
+                    encoded.set_timestamp_now();
+                }
+                output.send_encoded_frame(&encoded)
+            }
+            // Raw payloads (and images without a known format) go out as plain buffers.
+            _ => output.send_buffer(&Buffer::from_bytes(frame.data)?),
+        }
+    }
+}
+
+impl ThreadedHostNodeImpl for ReplayNode {
+    fn run(&mut self, ctx: &ThreadedHostNodeContext) {
+        let recording = Arc::clone(&self.recording);
+        let control = self.control.clone();
+        let mut pos = 0usize;
+        // Wall time and recorded clock of the record that last (re)started pacing.
+        let mut anchor: Option<(Instant, i64, f64)> = None;
+        'replay: while ctx.is_running() {
+            if let Some(seek) = control.take_seek() {
+                pos = recording.resolve(seek);
+                anchor = None;
+                control.shared.finished.store(false, Ordering::Release);
+            }
+            control.shared.position.store(pos, Ordering::Relaxed);
+            let Some(frame) = recording.get(pos) else {
+                if self.looping && !recording.is_empty() {
+                    pos = 0;
+                    anchor = None;
+                } else {
+                    control.shared.finished.store(true, Ordering::Release);
+                    std::thread::sleep(PACE_SLICE);
+                }
+                continue;
+            };
+
+            if let ReplayRate::Speed(speed) = control.rate() {
+                let clock = clock_ns(&frame.meta);
+                match anchor {
+                    Some((_, _, s)) if s != speed => anchor = None,
+                    _ => {}
+                }
+                let (wall, start, _) = *anchor.get_or_insert((Instant::now(), clock, speed));
+                let due = wall + Duration::from_nanos((((clock - start).max(0)) as f64 / speed) as u64);
+                loop {
+                    let now = Instant::now();
+                    if now >= due {
+                        break;
+                    }
+                    if !ctx.is_running() || control.shared.seek_pending.load(Ordering::Acquire) {
+                        continue 'replay;
+                    }
+                    std::thread::sleep((due - now).min(PACE_SLICE));
+                }
+            } else {
+                anchor = None;
+            }
+
+            // Sends block on full blocking queues, which is what bounds unthrottled replay.
+            if let Err(err) = self.emit(&frame) {
+                if !ctx.is_running() {
+                    break;
+                }
+                control.record_emit_error(err);
+            }
+            pos += 1;
+        }
+    }
+}
+
+/// A replay node plus its per-stream outputs.
+pub struct ReplaySource {
+    node: ThreadedHostNode,
+    outputs: Vec<(u32, Output)>,
+    control: ReplayControl,
+}
+
+impl ReplaySource {
+    pub fn node(&self) -> &ThreadedHostNode {
+        &self.node
+    }
+
+    /// Output replaying `stream` (named `stream<id>` on the node).
+    pub fn output(&self, stream: u32) -> Option<&Output> {
+        self.outputs.iter().find(|(s, _)| *s == stream).map(|(_, o)| o)
+    }
+
+    pub fn control(&self) -> &ReplayControl {
+        &self.control
+    }
+}
+
+/// Creates a threaded host node that replays `recording` with one output per recorded stream.
+///
+/// Image records are re-sent as `ImgFrame`s from a frame pool (the only copy is from the map
+/// into the pooled frame), encoded records as `EncodedFrame`s with their recorded profile, frame
+/// type, sequence number and timestamps, and raw records as `Buffer`s. Records that fail to
+/// send are skipped and counted in [`ReplayControl::emit_errors`].
+pub fn create_replay_node(pipeline: &Pipeline, recording: Arc<Recording>, options: ReplayOptions) -> Result<ReplaySource> {
+    let control = ReplayControl::new(&options);
+    let mut outputs = Vec::new();
+    let node = pipeline.create_threaded_host_node(|node| {
+        for &stream in recording.streams() {
+            outputs.push((stream, node.create_output(Some(&format!("stream{stream}")))?));
+        }
+        let pool = match recording.max_image_len() {
+            0 => None,
+            len => Some(FramePool::new(len, options.pool_frames.max(1))?),
+        };
+        Ok(ReplayNode {
+            recording: Arc::clone(&recording),
+            outputs: outputs.clone(),
+            pool,
+            control: control.clone(),
+            looping: options.looping,
+            restamp: options.restamp,
+        })
+    })?;
+    Ok(ReplaySource { node, outputs, control })
+}
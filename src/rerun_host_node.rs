@@ -1,4 +1,5 @@
 use crate::common::ImageFrameType;
+use crate::encoded_frame::{EncodedFrame, EncodedFrameProfile};
 use crate::error::{DepthaiError, Result};
 use crate::output::Input;
 use crate::threaded_host_node::{ThreadedHostNode, ThreadedHostNodeContext};
@@ -57,11 +58,24 @@ pub enum RerunViewer {
     Native,
 }
 
+/// What the host node expects on its input and how it is logged.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub enum RerunLogMode {
+    /// `ImgFrame`s, converted to RGB / L8 and logged as `rr::Image`.
+    #[default]
+    Image,
+    /// `EncodedFrame`s from a `VideoEncoder`. H.264 / H.265 access units are forwarded as
+    /// `rr::VideoStream` samples without decoding; the viewer decodes them. MJPEG frames are
+    /// logged as `rr::EncodedImage`.
+    EncodedVideo,
+}
+
 pub struct RerunHostNodeConfig {
     pub app_id: String,
     pub entity_path: String,
     pub viewer: RerunViewer,
     pub input_name: String,
+    pub mode: RerunLogMode,
 }
 
 impl Default for RerunHostNodeConfig {
@@ -71,6 +85,7 @@ impl Default for RerunHostNodeConfig {
             entity_path: "camera".to_string(),
             viewer: RerunViewer::Web(RerunWebConfig::default()),
             input_name: "in".to_string(),
+            mode: RerunLogMode::Image,
         }
     }
 }
@@ -84,6 +99,11 @@ struct RerunHostNodeImpl {
     #[cfg(feature = "rerun")]
     _tokio_rt: Option<tokio::runtime::Runtime>,
     entity_path: String,
+    mode: RerunLogMode,
+    /// Stream parameters last announced with `VideoStream::new`; a change starts a new stream.
+    video_stream: Option<(EncodedFrameProfile, u32, u32)>,
+    /// Delta frames are dropped until a keyframe arrives, since the viewer cannot decode them.
+    awaiting_keyframe: bool,
     frame_index: i64,
     logged_frames: u64,
     skipped_frames: u64,
@@ -155,6 +175,9 @@ impl RerunHostNodeImpl {
                     rec,
                     _tokio_rt: Some(rt),
                     entity_path: config.entity_path,
+                    mode: config.mode,
+                    video_stream: None,
+                    awaiting_keyframe: true,
                     frame_index: 0,
                     logged_frames: 0,
                     skipped_frames: 0,
@@ -176,6 +199,9 @@ impl RerunHostNodeImpl {
                     rec,
                     _tokio_rt: None,
                     entity_path: config.entity_path,
+                    mode: config.mode,
+                    video_stream: None,
+                    awaiting_keyframe: true,
                     frame_index: 0,
                     logged_frames: 0,
                     skipped_frames: 0,
@@ -186,6 +212,10 @@ impl RerunHostNodeImpl {
     }
 
     pub fn run(&mut self, ctx: &ThreadedHostNodeContext) {
+        if self.mode == RerunLogMode::EncodedVideo {
+            self.run_encoded(ctx);
+            return;
+        }
         while ctx.is_running() {
             match self.input.get_frame() {
                 Ok(frame) => {
@@ -207,11 +237,88 @@ impl RerunHostNodeImpl {
         );
     }
 
+    fn run_encoded(&mut self, ctx: &ThreadedHostNodeContext) {
+        while ctx.is_running() {
+            match self.input.get_encoded_frame() {
+                Ok(frame) => {
+                    if let Err(e) = self.log_encoded_frame(&frame) {
+                        eprintln!("rerun: failed to process encoded frame: {e}");
+                    }
+                }
+                Err(e) => {
+                    eprintln!("rerun: input.get_encoded_frame() failed; stopping host node: {e}");
+                    break;
+                }
+            }
+        }
+
+        eprintln!(
+            "rerun: host node stopping (logged={} skipped={})",
+            self.logged_frames, self.skipped_frames
+        );
+    }
+
+    fn log_encoded_frame(&mut self, frame: &EncodedFrame) -> Result<()> {
+        let Some(profile) = frame.profile() else {
+            self.skipped_frames += 1;
+            return Ok(());
+        };
+        let bytes = frame.as_bytes();
+        if bytes.is_empty() {
+            self.skipped_frames += 1;
+            return Ok(());
+        }
+
+        if profile == EncodedFrameProfile::Jpeg {
+            self.rec.set_time_sequence("frame", self.frame_index);
+            self.frame_index += 1;
+            self.rec
+                .log(self.entity_path.as_str(), &rr::EncodedImage::from_file_contents(bytes.to_vec()))
+                .map_err(rerun_err)?;
+            self.logged_frames += 1;
+            return Ok(());
+        }
+
+        let stream = (profile, frame.width(), frame.height());
+        if self.video_stream != Some(stream) {
+            let codec = match profile {
+                EncodedFrameProfile::Avc => rr::components::VideoCodec::H264,
+                _ => rr::components::VideoCodec::H265,
+            };
+            self.rec
+                .log_static(self.entity_path.as_str(), &rr::VideoStream::new(codec))
+                .map_err(rerun_err)?;
+            self.video_stream = Some(stream);
+            self.awaiting_keyframe = true;
+        }
+
+        if self.awaiting_keyframe {
+            if !frame.is_keyframe() {
+                self.skipped_frames += 1;
+                return Ok(());
+            }
+            self.awaiting_keyframe = false;
+        }
+
+        // rerun takes ownership of the sample; this is the only copy of the access unit.
+        self.rec.set_time_sequence("frame", self.frame_index);
+        self.frame_index += 1;
+        self.rec
+            .log(
+                self.entity_path.as_str(),
+                &rr::VideoStream::update_fields().with_sample(rr::components::VideoSample::from(bytes.to_vec())),
+            )
+            .map_err(rerun_err)?;
+
+        self.logged_frames += 1;
+        Ok(())
+    }
+
     fn log_frame(&mut self, frame: &crate::camera::ImageFrame) -> Result<()> {
         let w = frame.width();
         let h = frame.height();
         let format = frame.format();
-        let mut bytes = frame.bytes();
+        let mut bytes = frame.as_bytes();
 
         // Helpful sanity check: if the byte length doesn't match the expected format,
         // log a note (rate-limited) and skip to avoid confusing downstream.
@@ -254,23 +361,37 @@ impl RerunHostNodeImpl {
                     );
                     self.last_skip_note = Instant::now();
                 }
-                bytes.truncate(expected);
+                bytes = &bytes[..expected];
             }
         }
 
         let image = match format {
+            // rerun takes ownership of the pixels, so this is the single copy out of the frame.
             Some(ImageFrameType::RGB888i) => {
-                rr::Image::from_rgb24(bytes, [w, h])
+                rr::Image::from_rgb24(bytes.to_vec(), [w, h])
             }
-            Some(ImageFrameType::BGR888i) => {
-                let mut rgb = bytes;
-                for chunk in rgb.chunks_exact_mut(3) {
-                    chunk.swap(0, 2);
+            // Converted natively (SIMD) straight into the buffer handed to rerun, so NV12 can be
+            // streamed from the device and expanded to RGB once on the host.
+            Some(
+                ImageFrameType::BGR888i
+                | ImageFrameType::RGB888p
+                | ImageFrameType::BGR888p
+                | ImageFrameType::NV12
+                | ImageFrameType::NV21
+                | ImageFrameType::YUV420p,
+            ) => match frame.to_format(ImageFrameType::RGB888i) {
+                Ok(rgb) => rr::Image::from_rgb24(rgb, [w, h]),
+                Err(err) => {
+                    self.skipped_frames += 1;
+                    if self.last_skip_note.elapsed() >= Duration::from_secs(2) {
+                        eprintln!("rerun: skipping frame: {}x{} format={:?}: {}", w, h, format, err);
+                        self.last_skip_note = Instant::now();
+                    }
+                    return Ok(());
                 }
-                rr::Image::from_rgb24(rgb, [w, h])
-            }
+            },
             Some(ImageFrameType::GRAY8) => {
-                rr::Image::from_l8(bytes, [w, h])
+                rr::Image::from_l8(bytes.to_vec(), [w, h])
             }
             _ => {
                 self.skipped_frames += 1;
@@ -283,7 +404,7 @@ impl RerunHostNodeImpl {
                         bytes.len()
                     );
                     eprintln!(
-                        "rerun: supported formats for logging are: RGB888i, BGR888i, GRAY8 (hint: set CameraOutputConfig.frame_type=Some(ImageFrameType::RGB888i))"
+                        "rerun: supported formats for logging are: RGB888i, BGR888i, RGB888p, BGR888p, NV12, NV21, YUV420p, GRAY8 (hint: set CameraOutputConfig.frame_type=Some(ImageFrameType::NV12))"
                     );
                     self.last_skip_note = Instant::now();
                 }
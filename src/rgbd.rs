@@ -144,4 +144,19 @@ impl OutputQueue {
             Ok(Some(RgbdData::from_handle(msg)))
         }
     }
+
+    /// Pops up to `max` queued RGBD messages in a single native call.
+    pub fn try_drain_rgbd(&self, max: usize) -> Result<Vec<RgbdData>> {
+        if max == 0 {
+            return Ok(Vec::new());
+        }
+        clear_error_flag();
+        let mut handles: Vec<DaiRGBDData> = vec![std::ptr::null_mut(); max];
+        let count = unsafe { depthai::dai_queue_try_drain_rgbd(self.handle(), handles.as_mut_ptr(), max) };
+        let msgs: Vec<_> = handles.into_iter().take(count.min(max)).map(RgbdData::from_handle).collect();
+        if let Some(err) = take_error_if_any("failed to drain rgbd") {
+            return Err(err);
+        }
+        Ok(msgs)
+    }
 }
@@ -6,6 +6,7 @@ use crate::common::ImageFrameType;
 use crate::encoded_frame::validate_nv12_dimensions;
 use crate::error::{clear_error_flag, take_error_if_any, Result};
 use crate::output::Input;
+use crate::pool_sizing::PoolSizing;
 
 #[repr(i32)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -88,6 +89,19 @@ impl VideoEncoderNode {
         unsafe { depthai::dai_video_encoder_set_num_frames_pool(self.node.handle(), c_int(frames)) };
     }
 
+    /// Sets the frame pool to the size [`PoolSizing`] recommends for this node, if it has one.
+    /// Returns the applied size.
+    pub fn apply_pool_sizing(&self, sizing: &PoolSizing) -> Result<Option<i32>> {
+        let Some(rec) = sizing.matching(self.node.id()?.into(), &self.node.name()?) else {
+            return Ok(None);
+        };
+        self.set_num_frames_pool(rec.frames_pool);
+        if let Some(err) = take_error_if_any("failed to set num frames pool") {
+            return Err(err);
+        }
+        Ok(Some(rec.frames_pool))
+    }
+
     pub fn num_frames_pool(&self) -> Result<i32> {
         clear_error_flag();
         let v = unsafe { depthai::dai_video_encoder_get_num_frames_pool(self.node.handle()) };
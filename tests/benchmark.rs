@@ -0,0 +1,57 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{depthai_core_version, BenchmarkInNode, BenchmarkOutNode, BenchmarkReport, Buffer, Result};
+
+#[test]
+fn report_percentiles_use_individual_latencies() {
+    let report = BenchmarkReport {
+        latencies: vec![0.004, 0.001, 0.003, 0.002, 0.010],
+        ..Default::default()
+    };
+    assert_eq!(report.latency_percentile(0.0), Some(Duration::from_secs_f32(0.001)));
+    assert_eq!(report.latency_percentile(0.5), Some(Duration::from_secs_f32(0.003)));
+    assert_eq!(report.latency_percentile(1.0), Some(Duration::from_secs_f32(0.010)));
+    assert_eq!(BenchmarkReport::default().latency_percentile(0.5), None);
+    let negative = BenchmarkReport {
+        average_latency: -1.0,
+        ..Default::default()
+    };
+    assert_eq!(negative.average_latency(), Duration::ZERO);
+}
+
+#[test]
+fn core_version_is_reported() -> Result<()> {
+    let version = depthai_core_version()?;
+    assert!(version.starts_with(|c: char| c.is_ascii_digit()), "version: {version:?}");
+    Ok(())
+}
+
+#[test]
+fn host_side_benchmark_pair_produces_reports() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let out = pipeline.create::<BenchmarkOutNode>()?;
+    out.set_run_on_host(true);
+    out.set_fps(500.0);
+    let input = pipeline.create::<BenchmarkInNode>()?;
+    input.set_run_on_host(true);
+    input.send_report_every_n_messages(20);
+    input.measure_individual_latencies(true);
+    out.out()?.link(&input.input()?)?;
+
+    let feed = out.input()?.create_input_queue(1, true)?;
+    let reports = input.report()?.create_message_queue(4, false)?;
+    pipeline.start()?;
+    feed.send_buffer(&Buffer::from_bytes(&[0xA5; 256])?)?;
+
+    let msg = reports.get(Some(Duration::from_secs(10)))?.expect("no report within 10 s");
+    pipeline.stop()?;
+    let report = msg.as_benchmark_report()?.expect("report message");
+    assert_eq!(report.num_messages_received, 20);
+    assert_eq!(report.latencies.len(), 20);
+    assert!(report.fps > 0.0);
+    assert!(report.latency_percentile(0.5) <= report.latency_percentile(0.99));
+    Ok(())
+}
@@ -0,0 +1,61 @@
+use std::time::Duration;
+
+use depthai::common::ImageFrameType;
+use depthai::{BufferPool, FramePool, Result};
+
+#[test]
+fn buffers_are_recycled_instead_of_reallocated() -> Result<()> {
+    let pool = BufferPool::new(1024, 2)?;
+    for _ in 0..10 {
+        let mut buffer = pool.acquire()?;
+        assert_eq!(buffer.len(), 1024);
+        buffer.data_mut()[0] = 0xab;
+        buffer.resize(16)?;
+    }
+    assert_eq!(pool.allocated(), 1);
+    assert_eq!(pool.available(), 1);
+
+    // A recycled buffer is handed out at full capacity again.
+    assert_eq!(pool.acquire()?.len(), 1024);
+    Ok(())
+}
+
+#[test]
+fn at_most_max_free_idle_messages_are_kept() -> Result<()> {
+    let pool = BufferPool::new(64, 2)?;
+    let held: Vec<_> = (0..4).map(|_| pool.acquire()).collect::<Result<_>>()?;
+    assert_eq!(pool.allocated(), 4);
+    drop(held);
+    assert_eq!(pool.available(), 2);
+    assert_eq!(pool.allocated(), 2);
+    Ok(())
+}
+
+#[test]
+fn recycled_frames_do_not_keep_previous_metadata() -> Result<()> {
+    let pool = FramePool::new(640 * 400 * 3, 1)?;
+    {
+        let mut frame = pool.acquire()?;
+        frame.set_format(640, 400, ImageFrameType::RGB888i, 640 * 400 * 3)?;
+        frame.set_sequence_num(1234);
+        frame.set_timestamp_now();
+    }
+    let frame = pool.acquire()?;
+    assert_eq!(pool.allocated(), 1, "the same frame should come back");
+    let info = frame.info()?;
+    assert_eq!((info.width, info.height), (0, 0));
+    assert_eq!(info.sequence_num, 0);
+    assert_eq!(info.timestamp, Duration::ZERO);
+    assert_eq!(info.timestamp_device, Duration::ZERO);
+    assert_eq!(info.byte_len, 640 * 400 * 3);
+    Ok(())
+}
+
+#[test]
+fn pools_reject_the_other_message_kind() {
+    // FramePool and BufferPool share one native pool type; make sure each only serves its own.
+    let frames = FramePool::new(16, 1).unwrap();
+    assert!(frames.acquire().is_ok());
+    let buffers = BufferPool::new(16, 1).unwrap();
+    assert!(buffers.acquire().is_ok());
+}
@@ -0,0 +1,89 @@
+#![cfg(not(target_os = "windows"))]
+
+//! Native depth filter kernels against a straightforward per-pixel reference. Widths cover rows
+//! handled entirely by the scalar path (narrower than the window plus one 8-lane block) and rows
+//! whose interior runs on the SSE2/NEON path with scalar borders and tails.
+
+use depthai::{median_filter_depth, Result};
+
+const WIDTHS: [usize; 6] = [1, 5, 8, 14, 23, 67];
+
+/// Small deterministic generator so failures reproduce.
+struct Lcg(u64);
+
+impl Lcg {
+    /// Depth-like values: a share of invalid zeros, values past `0x7fff` (where signed 16-bit
+    /// min/max would differ) and the extremes.
+    fn depth(&mut self, n: usize) -> Vec<u16> {
+        (0..n)
+            .map(|_| {
+                self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+                let v = (self.0 >> 48) as u16;
+                match v % 16 {
+                    0 | 1 => 0,
+                    2 => u16::MAX,
+                    _ => v,
+                }
+            })
+            .collect()
+    }
+}
+
+fn reference_median(src: &[u16], width: usize, height: usize, k: usize) -> Vec<u16> {
+    let r = (k / 2) as isize;
+    let clamp = |v: isize, n: usize| v.clamp(0, n as isize - 1) as usize;
+    let mut out = vec![0; width * height];
+    let mut window = Vec::with_capacity(k * k);
+    for y in 0..height {
+        for x in 0..width {
+            window.clear();
+            for dy in -r..=r {
+                for dx in -r..=r {
+                    window.push(src[clamp(y as isize + dy, height) * width + clamp(x as isize + dx, width)]);
+                }
+            }
+            window.sort_unstable();
+            out[y * width + x] = window[window.len() / 2];
+        }
+    }
+    out
+}
+
+#[test]
+fn medians_match_reference() -> Result<()> {
+    let mut rng = Lcg(1);
+    for k in [3, 5, 7] {
+        for width in WIDTHS {
+            // Enough rows to split into several tiles.
+            let height = 40;
+            let src = rng.depth(width * height);
+            let mut dst = vec![0; width * height];
+            median_filter_depth(&src, width, height, k, &mut dst)?;
+            let expected = reference_median(&src, width, height, k as usize);
+            for (i, (got, want)) in dst.iter().zip(&expected).enumerate() {
+                assert_eq!(got, want, "{k}x{k} width {width} row {} x {}", i / width, i % width);
+            }
+        }
+    }
+    Ok(())
+}
+
+#[test]
+fn single_row_and_column_replicate_edges() -> Result<()> {
+    let src = [10u16, 0, 30, 40, 50, 60, 70, 80, 90, 100];
+    let mut dst = [0u16; 10];
+    median_filter_depth(&src, 10, 1, 3, &mut dst)?;
+    assert_eq!(dst, [10, 10, 30, 40, 50, 60, 70, 80, 90, 100]);
+    median_filter_depth(&src, 1, 10, 5, &mut dst)?;
+    assert_eq!(dst, reference_median(&src, 1, 10, 5).as_slice());
+    Ok(())
+}
+
+#[test]
+fn bad_arguments_are_rejected() {
+    let src = [0u16; 16];
+    let mut dst = [0u16; 16];
+    assert!(median_filter_depth(&src, 4, 4, 4, &mut dst).is_err(), "even window");
+    assert!(median_filter_depth(&src, 4, 4, 9, &mut dst).is_err(), "unsupported window");
+    assert!(median_filter_depth(&src, 5, 4, 3, &mut dst).is_err(), "too few pixels");
+}
@@ -0,0 +1,313 @@
+#![cfg(not(target_os = "windows"))]
+
+use depthai::camera::ImageFrame;
+use depthai::common::{CameraBoardSocket, ImageFrameType};
+use depthai::pointcloud::{rgba32_from_rgba, PointCloudSoa};
+use depthai::{CameraIntrinsics, DepthProjector, FramePool, ProjectionOptions, Result};
+use serde_json::json;
+
+fn pinhole(width: u32, height: u32) -> CameraIntrinsics {
+    CameraIntrinsics {
+        fx: 50.0,
+        fy: 52.0,
+        cx: (width as f32 - 1.0) / 2.0,
+        cy: (height as f32 - 1.0) / 2.0,
+        width,
+        height,
+        distortion: Vec::new(),
+    }
+}
+
+/// Millimetre depth with holes and a spread of values, so ranges and skips hit every row.
+fn depth_values(width: u32, height: u32) -> Vec<u16> {
+    (0..height)
+        .flat_map(|v| (0..width).map(move |u| if (u * 7 + v * 3) % 5 == 0 { 0 } else { (300 + u * 37 + v * 53) as u16 }))
+        .collect()
+}
+
+fn depth_frame(width: u32, height: u32, depth: &[u16]) -> Result<ImageFrame> {
+    let len = depth.len() * 2;
+    let mut frame = FramePool::new(len, 1)?.acquire()?;
+    frame.set_format(width, height, ImageFrameType::RAW16, len)?;
+    for (dst, px) in frame.data_mut().chunks_exact_mut(2).zip(depth) {
+        dst.copy_from_slice(&px.to_le_bytes());
+    }
+    Ok(frame.into_frame())
+}
+
+fn color_frame(width: u32, height: u32, format: ImageFrameType, rgb: impl Fn(u32, u32) -> [u8; 3]) -> Result<ImageFrame> {
+    let len = (width * height * 3) as usize;
+    let mut frame = FramePool::new(len, 1)?.acquire()?;
+    frame.set_format(width, height, format, len)?;
+    for (i, px) in frame.data_mut().chunks_exact_mut(3).enumerate() {
+        let [r, g, b] = rgb(i as u32 % width, i as u32 / width);
+        px.copy_from_slice(&if format == ImageFrameType::BGR888i { [b, g, r] } else { [r, g, b] });
+    }
+    Ok(frame.into_frame())
+}
+
+/// One expected point: the scalar pinhole projection of pixel `(u, v)`.
+#[derive(Debug, PartialEq)]
+struct Expected {
+    u: u32,
+    v: u32,
+    xyz: (f32, f32, f32),
+}
+
+fn reference(k: &CameraIntrinsics, depth: &[u16], options: &ProjectionOptions) -> Vec<Expected> {
+    let step = options.decimation.max(1);
+    let (lo, hi) = options.z_range.unwrap_or((f32::NEG_INFINITY, f32::INFINITY));
+    let mut points = Vec::new();
+    for v in (0..k.height).step_by(step as usize) {
+        for u in (0..k.width).step_by(step as usize) {
+            let raw = depth[(v * k.width + u) as usize];
+            let z = raw as f32 * options.depth_scale;
+            let ok = raw != 0 && z >= lo && z <= hi;
+            if !ok && options.skip_invalid {
+                continue;
+            }
+            let z = if ok { z } else { 0.0 };
+            let (rx, ry) = ((u as f32 - k.cx) / k.fx, (v as f32 - k.cy) / k.fy);
+            points.push(Expected { u, v, xyz: (rx * z, ry * z, z) });
+        }
+    }
+    points
+}
+
+fn project_with(
+    projector: &DepthProjector,
+    depth: &[u16],
+    rgb: Option<&ImageFrame>,
+    options: &ProjectionOptions,
+) -> Result<PointCloudSoa> {
+    let (width, height) = projector.size();
+    let frame = depth_frame(width, height, depth)?;
+    let mut cloud = PointCloudSoa::default();
+    let written = projector.project_into(&frame, rgb, options, &mut cloud)?;
+    assert_eq!((cloud.x.len(), cloud.y.len(), cloud.z.len()), (written, written, written));
+    Ok(cloud)
+}
+
+fn project(
+    k: &CameraIntrinsics,
+    threads: u32,
+    depth: &[u16],
+    rgb: Option<&ImageFrame>,
+    options: &ProjectionOptions,
+) -> Result<PointCloudSoa> {
+    project_with(&DepthProjector::new(k, false, threads)?, depth, rgb, options)
+}
+
+fn assert_matches(cloud: &PointCloudSoa, expected: &[Expected]) {
+    assert_eq!(cloud.len(), expected.len());
+    for (i, e) in expected.iter().enumerate() {
+        assert_eq!((cloud.x[i], cloud.y[i], cloud.z[i]), e.xyz, "point {i} from pixel ({}, {})", e.u, e.v);
+    }
+}
+
+#[test]
+fn dense_rows_match_the_scalar_projection() -> Result<()> {
+    // 67 columns: eight 8-lane blocks plus a scalar tail on every row.
+    let k = pinhole(67, 9);
+    let depth = depth_values(k.width, k.height);
+    let options = ProjectionOptions {
+        skip_invalid: false,
+        colors: false,
+        ..Default::default()
+    };
+    let cloud = project(&k, 2, &depth, None, &options)?;
+    assert_eq!(cloud.len(), 67 * 9, "without skipping every grid point is written");
+    assert!(cloud.rgba.is_empty());
+    assert_matches(&cloud, &reference(&k, &depth, &options));
+    Ok(())
+}
+
+#[test]
+fn decimation_keeps_every_nth_pixel_on_both_axes() -> Result<()> {
+    let k = pinhole(67, 10);
+    let depth = depth_values(k.width, k.height);
+    let projector = DepthProjector::new(&k, false, 3)?;
+    assert_eq!(projector.grid_size(3), 23 * 4);
+    assert_eq!(projector.grid_size(0), 67 * 10);
+    // One projector for every step: its per-tile scratch rows shrink and grow between calls.
+    for decimation in [4, 2, 3, 1, 4] {
+        let options = ProjectionOptions {
+            decimation,
+            skip_invalid: false,
+            colors: false,
+            ..Default::default()
+        };
+        let cloud = project_with(&projector, &depth, None, &options)?;
+        assert_eq!(cloud.len(), projector.grid_size(decimation), "decimation {decimation}");
+        assert_matches(&cloud, &reference(&k, &depth, &options));
+    }
+    Ok(())
+}
+
+#[test]
+fn skipped_pixels_are_compacted_across_tile_bands() -> Result<()> {
+    // 40 rows on four threads split into many bands; holes fall in every one of them.
+    let k = pinhole(35, 40);
+    let depth = depth_values(k.width, k.height);
+    let options = ProjectionOptions {
+        colors: false,
+        ..Default::default()
+    };
+    let expected = reference(&k, &depth, &options);
+    assert!(expected.len() < (35 * 40) * 9 / 10, "the frame needs holes to compact");
+    for threads in [1, 4] {
+        let cloud = project(&k, threads, &depth, None, &options)?;
+        assert_matches(&cloud, &expected);
+    }
+    // Again with decimation, which changes how many output rows each band holds.
+    let options = ProjectionOptions {
+        decimation: 3,
+        ..options
+    };
+    assert_matches(&project(&k, 4, &depth, None, &options)?, &reference(&k, &depth, &options));
+    Ok(())
+}
+
+#[test]
+fn z_range_is_inclusive_and_counts_as_invalid() -> Result<()> {
+    let k = pinhole(64, 8);
+    let depth = depth_values(k.width, k.height);
+    let (lo, hi) = (0.5, 1.5);
+    for skip_invalid in [true, false] {
+        let options = ProjectionOptions {
+            z_range: Some((lo, hi)),
+            skip_invalid,
+            colors: false,
+            ..Default::default()
+        };
+        let cloud = project(&k, 2, &depth, None, &options)?;
+        assert_matches(&cloud, &reference(&k, &depth, &options));
+        assert!(cloud.z.iter().all(|&z| z == 0.0 || (lo..=hi).contains(&z)));
+        assert_eq!(cloud.z.iter().any(|&z| z == 0.0), !skip_invalid);
+    }
+    // A frame with nothing in range projects to an empty cloud rather than an error.
+    let options = ProjectionOptions {
+        z_range: Some((100.0, 200.0)),
+        colors: false,
+        ..Default::default()
+    };
+    assert_eq!(project(&k, 2, &depth, None, &options)?.len(), 0);
+    Ok(())
+}
+
+#[test]
+fn colors_are_sampled_onto_the_depth_grid() -> Result<()> {
+    let k = pinhole(16, 12);
+    let depth = depth_values(k.width, k.height);
+    let rgb = |x: u32, y: u32| [(x * 7) as u8, (y * 9) as u8, (x + y * 3) as u8];
+    let options = ProjectionOptions {
+        decimation: 2,
+        ..Default::default()
+    };
+    let expected = reference(&k, &depth, &options);
+
+    // Twice the depth resolution, then an uneven smaller one; BGR input gives the same colors.
+    for (width, height, format) in [
+        (32, 24, ImageFrameType::RGB888i),
+        (32, 24, ImageFrameType::BGR888i),
+        (10, 7, ImageFrameType::RGB888i),
+    ] {
+        let color = color_frame(width, height, format, rgb)?;
+        let cloud = project(&k, 2, &depth, Some(&color), &options)?;
+        assert_matches(&cloud, &expected);
+        assert_eq!(cloud.rgba.len(), expected.len());
+        for (i, e) in expected.iter().enumerate() {
+            let (x, y) = ((e.u * width / k.width).min(width - 1), (e.v * height / k.height).min(height - 1));
+            let [r, g, b] = rgb(x, y);
+            assert_eq!(cloud.rgba[i], rgba32_from_rgba(r, g, b, 255), "{width}x{height} {format:?}, pixel ({}, {})", e.u, e.v);
+        }
+    }
+
+    // Colors off: the frame is ignored and the color plane stays empty.
+    let color = color_frame(16, 12, ImageFrameType::RGB888i, rgb)?;
+    let options = ProjectionOptions {
+        colors: false,
+        ..options
+    };
+    assert!(project(&k, 2, &depth, Some(&color), &options)?.rgba.is_empty());
+    Ok(())
+}
+
+#[test]
+fn mismatched_depth_frames_are_rejected() -> Result<()> {
+    let projector = DepthProjector::new(&pinhole(16, 12), false, 1)?;
+    let mut cloud = PointCloudSoa::default();
+    let small = depth_frame(8, 6, &depth_values(8, 6))?;
+    assert!(projector.project_into(&small, None, &ProjectionOptions::default(), &mut cloud).is_err());
+    Ok(())
+}
+
+fn calibration() -> serde_json::Value {
+    let camera = |fx: f64, cx: f64| {
+        json!({
+            "width": 1280,
+            "height": 800,
+            "intrinsicMatrix": [[fx, 0.0, cx], [0.0, fx + 2.0, 401.5], [0.0, 0.0, 1.0]],
+            "distortionCoeff": [0.1, -0.2, 0.001, 0.002, 0.05, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0],
+        })
+    };
+    json!({
+        "batchName": "",
+        "cameraData": [[0, camera(1000.0, 640.5)], [1, camera(800.0, 630.25)], [2, camera(802.0, 650.0)]],
+    })
+}
+
+#[test]
+fn intrinsics_are_read_from_calibration_json() -> Result<()> {
+    let calibration = calibration();
+    let left = CameraIntrinsics::from_calibration_json(&calibration, CameraBoardSocket::CamB, 1280, 800)?;
+    assert_eq!((left.fx, left.fy, left.cx, left.cy), (800.0, 802.0, 630.25, 401.5));
+    assert_eq!((left.width, left.height), (1280, 800));
+    assert_eq!(left.distortion.len(), 14);
+    assert_eq!(&left.distortion[..5], &[0.1, -0.2, 0.001, 0.002, 0.05]);
+
+    // Read at another size, the intrinsics are the native ones scaled.
+    let half = CameraIntrinsics::from_calibration_json(&calibration, CameraBoardSocket::CamB, 640, 400)?;
+    assert_eq!(half, left.scaled_to(640, 400));
+
+    // The object form of `cameraData` is accepted as well.
+    let object = json!({"cameraData": {"1": calibration["cameraData"][1][1].clone()}});
+    assert_eq!(CameraIntrinsics::from_calibration_json(&object, CameraBoardSocket::CamB, 1280, 800)?, left);
+
+    assert!(CameraIntrinsics::from_calibration_json(&calibration, CameraBoardSocket::CamD, 1280, 800).is_err());
+    let mut incomplete = calibration.clone();
+    incomplete["cameraData"][1][1]["width"] = json!(0);
+    assert!(CameraIntrinsics::from_calibration_json(&incomplete, CameraBoardSocket::CamB, 1280, 800).is_err());
+    assert!(CameraIntrinsics::from_calibration_json(&json!({}), CameraBoardSocket::CamA, 1280, 800).is_err());
+    Ok(())
+}
+
+#[test]
+fn scaling_to_another_aspect_ratio_crops_the_center() {
+    let native = CameraIntrinsics {
+        fx: 800.0,
+        fy: 802.0,
+        cx: 630.25,
+        cy: 401.5,
+        width: 1280,
+        height: 800,
+        distortion: vec![0.1],
+    };
+    assert_eq!(native.scaled_to(1280, 800), native);
+
+    let half = native.scaled_to(640, 400);
+    assert_eq!((half.fx, half.fy, half.cx, half.cy), (400.0, 401.0, 315.125, 200.75));
+    assert_eq!(half.distortion, native.distortion, "distortion is resolution independent");
+
+    // 16:9 from 16:10: scaled by the width, 20 rows cropped off the top and bottom.
+    let wide = native.scaled_to(640, 360);
+    assert_eq!((wide.width, wide.height), (640, 360));
+    assert_eq!((wide.fx, wide.fy, wide.cx, wide.cy), (400.0, 401.0, 315.125, 180.75));
+
+    // 4:3 from 16:10: scaled by the height, columns cropped at both sides.
+    let narrow = native.scaled_to(400, 300);
+    let scale = 300.0 / 800.0;
+    assert_eq!((narrow.fx, narrow.fy), (800.0 * scale, 802.0 * scale));
+    assert_eq!(narrow.cx, 630.25 * scale - (1280.0 * scale - 400.0) / 2.0);
+    assert_eq!(narrow.cy, 401.5 * scale);
+}
@@ -0,0 +1,69 @@
+#![cfg(not(target_os = "windows"))]
+
+#[cfg(feature = "hit")]
+use depthai::camera::CameraNode;
+#[cfg(feature = "hit")]
+use depthai::common::CameraBoardSocket;
+use depthai::pipeline::Pipeline;
+use depthai::{Device, ErrorCode, Result};
+
+const MISSING: &str = "0000000000000000DEADBEEF";
+
+#[test]
+fn enumeration_works_without_devices() -> Result<()> {
+    for info in Device::list()? {
+        assert!(!info.device_id.is_empty(), "{info:?}");
+        assert!(!info.state.is_empty(), "{info:?}");
+    }
+    assert!(Pipeline::start_all(&[])?.is_empty());
+    Ok(())
+}
+
+#[test]
+fn opening_unknown_ids_fails_per_id() -> Result<()> {
+    let err = Device::open(MISSING).err().expect("no such device");
+    assert!(err.to_string().contains(MISSING), "message names the id: {err}");
+    assert_eq!(err.code(), ErrorCode::NotFound);
+    assert!(Device::open("bad\0id").is_err());
+
+    // Each entry keeps the code of its own failure rather than a generic one.
+    let results = Device::open_many(&[MISSING, "0000000000000000FEEDFACE"])?;
+    assert_eq!(results.len(), 2);
+    let errors: Vec<_> = results.into_iter().map(|r| r.err().expect("no such device")).collect();
+    assert!(errors[0].to_string().contains(MISSING));
+    assert!(errors[1].to_string().contains("FEEDFACE"));
+    assert!(errors.iter().all(|e| e.code() == ErrorCode::NotFound), "{errors:?}");
+    Ok(())
+}
+
+#[cfg(feature = "hit")]
+#[test]
+fn listed_devices_open_by_id() -> Result<()> {
+    let listed = Device::list()?;
+    let ids: Vec<&str> = listed.iter().map(|d| d.device_id.as_str()).collect();
+    assert!(!ids.is_empty(), "hardware tests need a connected device");
+
+    let devices = Device::open_many(&ids)?;
+    for (device, id) in devices.into_iter().zip(&ids) {
+        let device = device?;
+        assert!(device.is_connected());
+        assert_eq!(device.device_id()?, *id);
+    }
+    Ok(())
+}
+
+#[cfg(feature = "hit")]
+#[test]
+fn pipelines_start_together() -> Result<()> {
+    let id = Device::list()?.into_iter().next().expect("hardware tests need a connected device").device_id;
+    let device = Device::open(&id)?;
+    let pipeline = Pipeline::new().with_device(&device).build()?;
+    let camera = pipeline.create_with::<CameraNode, _>(CameraBoardSocket::CamA)?;
+    let _queue = camera.request_full_resolution_output()?.create_queue(1, false)?;
+    let results = Pipeline::start_all(&[&pipeline])?;
+    assert_eq!(results.len(), 1);
+    results.into_iter().next().unwrap()?;
+    assert!(pipeline.is_running()?);
+    pipeline.stop()?;
+    Ok(())
+}
@@ -0,0 +1,34 @@
+use depthai::EncodedFrameProfile;
+
+const AUD_H264: [u8; 6] = [0, 0, 0, 1, 0x09, 0xf0];
+
+#[test]
+fn h264_keyframes_need_an_idr_slice() {
+    let sps_pps_idr = [&AUD_H264[..], &[0, 0, 0, 1, 0x67, 0x42], &[0, 0, 0, 1, 0x68, 0xce], &[0, 0, 1, 0x65, 0x88]].concat();
+    assert!(EncodedFrameProfile::Avc.is_keyframe_payload(&sps_pps_idr));
+
+    let non_idr = [&AUD_H264[..], &[0, 0, 0, 1, 0x41, 0x9a]].concat();
+    assert!(!EncodedFrameProfile::Avc.is_keyframe_payload(&non_idr));
+    // Parameter sets alone do not make a keyframe.
+    assert!(!EncodedFrameProfile::Avc.is_keyframe_payload(&[0, 0, 0, 1, 0x67, 0x42, 0, 0, 1, 0x68, 0xce]));
+    assert!(!EncodedFrameProfile::Avc.is_keyframe_payload(&[]));
+}
+
+#[test]
+fn h265_keyframes_need_an_irap_slice() {
+    // NAL type is bits 1..7 of the first header byte: VPS 32, SPS 33, PPS 34, IDR_W_RADL 19, CRA 21.
+    let header = |ty: u8| [0, 0, 0, 1, ty << 1, 0x01];
+    let idr = [header(32), header(33), header(34), header(19)].concat();
+    assert!(EncodedFrameProfile::Hevc.is_keyframe_payload(&idr));
+    assert!(EncodedFrameProfile::Hevc.is_keyframe_payload(&header(21)));
+    // TRAIL_R and a reserved non-IRAP type.
+    assert!(!EncodedFrameProfile::Hevc.is_keyframe_payload(&header(1)));
+    assert!(!EncodedFrameProfile::Hevc.is_keyframe_payload(&header(22 + 2)));
+    // An H.264 IDR header byte read as H.265 is type 50, not a keyframe.
+    assert!(!EncodedFrameProfile::Hevc.is_keyframe_payload(&[0, 0, 1, 0x65, 0x88]));
+}
+
+#[test]
+fn jpeg_frames_are_always_keyframes() {
+    assert!(EncodedFrameProfile::Jpeg.is_keyframe_payload(&[0xff, 0xd8, 0xff, 0xd9]));
+}
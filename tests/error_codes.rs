@@ -0,0 +1,59 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{ErrorCode, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+#[test]
+fn failures_carry_the_code_their_call_site_reports() -> depthai::Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+
+    let err = node.as_node().output("does_not_exist").err().expect("unknown output");
+    assert_eq!(err.code(), ErrorCode::NotFound);
+    assert!(err.to_string().contains("not found"), "message: {err}");
+
+    let err = node.as_node().output("").err().expect("empty output name");
+    assert_eq!(err.code(), ErrorCode::InvalidArgument);
+    Ok(())
+}
+
+#[test]
+fn timeouts_are_not_errors_and_do_not_leak() -> depthai::Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let queue = node.create_output(Some("out"))?.create_queue(1, false)?;
+
+    assert!(queue.blocking_next(Some(Duration::from_millis(5)))?.is_none());
+    // The next call on this thread starts from a clean status, and its own failure is reported
+    // with its own code rather than the earlier timeout.
+    assert!(node.as_node().id().is_ok());
+    assert!(queue.blocking_next(Some(Duration::from_millis(5)))?.is_none());
+    let err = node.as_node().input("does_not_exist").err().expect("unknown input");
+    assert_eq!(err.code(), ErrorCode::NotFound);
+    Ok(())
+}
+
+#[test]
+fn error_state_is_per_thread() -> depthai::Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let failing = node.as_node().clone();
+
+    let worker = std::thread::spawn(move || {
+        for _ in 0..1000 {
+            assert!(failing.output("does_not_exist").is_err());
+        }
+    });
+    for _ in 0..1000 {
+        node.as_node().id()?;
+    }
+    worker.join().expect("failing thread panicked");
+    Ok(())
+}
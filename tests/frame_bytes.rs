@@ -0,0 +1,62 @@
+use depthai::common::ImageFrameType;
+use depthai::{FrameBytes, FramePool, Result};
+
+fn pattern_bytes(pool: &FramePool, len: usize) -> Result<FrameBytes> {
+    let mut frame = pool.acquire()?;
+    frame.set_format(len as u32, 1, ImageFrameType::GRAY8, len)?;
+    for (i, b) in frame.data_mut().iter_mut().enumerate() {
+        *b = i as u8;
+    }
+    Ok(frame.into_bytes())
+}
+
+#[test]
+fn slices_share_the_native_payload() -> Result<()> {
+    let pool = FramePool::new(256, 1)?;
+    let bytes = pattern_bytes(&pool, 200)?;
+    assert_eq!(bytes.len(), 200);
+
+    let mid = bytes.slice(10..20);
+    assert_eq!(&mid[..], &(10u8..20).collect::<Vec<_>>()[..]);
+    assert_eq!(mid.as_ptr(), bytes[10..].as_ptr(), "slicing must not copy");
+    assert_eq!(bytes.slice(..=4).len(), 5);
+    assert_eq!(bytes.slice(195..).as_slice(), &[195, 196, 197, 198, 199]);
+    assert_eq!(bytes.slice(..).len(), 200);
+    assert!(bytes.slice(7..7).is_empty());
+    // Slices of slices index relative to their own start.
+    assert_eq!(mid.slice(2..4).as_slice(), &[12, 13]);
+    Ok(())
+}
+
+#[test]
+fn payload_returns_to_the_pool_after_the_last_reference() -> Result<()> {
+    let pool = FramePool::new(64, 1)?;
+    let bytes = pattern_bytes(&pool, 64)?;
+    let tail = bytes.slice(32..);
+    drop(bytes);
+    assert_eq!(pool.available(), 0, "a live slice keeps the frame out of the pool");
+
+    let sent = std::thread::spawn(move || tail.iter().map(|&b| b as u32).sum::<u32>())
+        .join()
+        .expect("reader thread panicked");
+    assert_eq!(sent, (32..64).sum::<u32>());
+    assert_eq!(pool.available(), 1);
+    assert_eq!(pool.allocated(), 1);
+    Ok(())
+}
+
+#[test]
+#[should_panic(expected = "out of bounds")]
+fn slicing_past_the_end_panics() {
+    let pool = FramePool::new(16, 1).unwrap();
+    let bytes = pattern_bytes(&pool, 16).unwrap();
+    let _ = bytes.slice(8..17);
+}
+
+#[test]
+fn empty_bytes_are_usable() {
+    let empty = FrameBytes::empty();
+    assert!(empty.is_empty());
+    assert_eq!(empty.as_slice(), &[] as &[u8]);
+    assert!(FrameBytes::default().slice(..).is_empty());
+}
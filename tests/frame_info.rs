@@ -0,0 +1,39 @@
+use depthai::common::ImageFrameType;
+use depthai::{FramePool, Result};
+
+#[test]
+fn one_call_info_matches_the_individual_getters() -> Result<()> {
+    let pool = FramePool::new(640 * 480 * 3, 2)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(640, 480, ImageFrameType::RGB888i, 640 * 480 * 3)?;
+    frame.set_sequence_num(42);
+    frame.set_timestamp_now();
+
+    let info = frame.info()?;
+    assert_eq!((info.width, info.height), (frame.width(), frame.height()));
+    assert_eq!((info.width, info.height), (640, 480));
+    assert_eq!(info.format, frame.format());
+    assert_eq!(info.format, Some(ImageFrameType::RGB888i));
+    assert_eq!(info.byte_len, frame.byte_len());
+    assert_eq!(info.byte_len, 640 * 480 * 3);
+    assert_eq!(info.sequence_num, 42);
+    assert!(!info.timestamp.is_zero(), "set_timestamp_now should stamp the frame");
+    Ok(())
+}
+
+#[test]
+fn info_tracks_format_changes() -> Result<()> {
+    let pool = FramePool::new(1280 * 720 * 3 / 2, 1)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(320, 240, ImageFrameType::GRAY8, 320 * 240)?;
+    let gray = frame.info()?;
+    frame.set_format(1280, 720, ImageFrameType::NV12, 1280 * 720 * 3 / 2)?;
+    let nv12 = frame.info()?;
+
+    assert_eq!((gray.width, gray.height, gray.byte_len), (320, 240, 320 * 240));
+    assert_eq!(gray.format, Some(ImageFrameType::GRAY8));
+    assert_eq!((nv12.width, nv12.height, nv12.byte_len), (1280, 720, 1280 * 720 * 3 / 2));
+    assert_eq!(nv12.format, Some(ImageFrameType::NV12));
+    assert_eq!(frame.describe(), "1280x720 NV12");
+    Ok(())
+}
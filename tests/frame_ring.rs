@@ -0,0 +1,92 @@
+use depthai::{FrameRingReader, FrameRingWriter, RingFrameMeta, RingPayloadKind, Result};
+
+fn ring_path(name: &str) -> std::path::PathBuf {
+    std::env::temp_dir().join(format!("depthai-ring-{name}-{}", std::process::id()))
+}
+
+fn raw_meta(sequence_num: i64) -> RingFrameMeta {
+    RingFrameMeta {
+        kind: RingPayloadKind::Raw as u32,
+        sequence_num,
+        ..Default::default()
+    }
+}
+
+#[test]
+fn payloads_round_trip_in_order() -> Result<()> {
+    let path = ring_path("round-trip");
+    let mut writer = FrameRingWriter::create(&path, 4, 64)?;
+    let mut reader = FrameRingReader::open(&path)?;
+    assert!(reader.try_next().is_none());
+
+    for i in 0..3u8 {
+        let seq = writer.publish(raw_meta(100 + i as i64), &[i; 10])?;
+        assert_eq!(seq, i as u64);
+    }
+    let mut buf = Vec::new();
+    for i in 0..3u8 {
+        let frame = reader.try_next().expect("published message");
+        assert_eq!(frame.seq, i as u64);
+        assert_eq!(frame.kind(), Some(RingPayloadKind::Raw));
+        assert_eq!(frame.meta.sequence_num, 100 + i as i64);
+        assert_eq!((frame.meta.len, frame.len()), (10, 10));
+        assert!(frame.meta.publish_unix_ns > 0);
+        assert!(frame.read_into(&mut buf));
+        assert_eq!(buf, vec![i; 10]);
+    }
+    assert!(reader.try_next().is_none());
+    assert_eq!((reader.published(), reader.missed()), (3, 0));
+
+    // Empty payloads are valid messages too.
+    writer.publish(raw_meta(0), &[])?;
+    let frame = reader.try_next().expect("empty message");
+    assert!(frame.is_empty());
+    assert!(frame.read_into(&mut buf));
+    assert!(buf.is_empty());
+    drop(writer);
+    let _ = std::fs::remove_file(&path);
+    Ok(())
+}
+
+#[test]
+fn lapped_readers_skip_ahead_and_torn_copies_are_rejected() -> Result<()> {
+    let path = ring_path("lapped");
+    let mut writer = FrameRingWriter::create(&path, 2, 16)?;
+    let mut reader = FrameRingReader::open(&path)?;
+
+    for i in 0..5u8 {
+        writer.publish(raw_meta(i as i64), &[i; 4])?;
+    }
+    // Only the last two messages are still in the ring.
+    let mut buf = Vec::new();
+    let frame = reader.try_next().expect("oldest surviving message");
+    assert_eq!(frame.seq, 3);
+    assert!(frame.read_into(&mut buf));
+    assert_eq!(buf, vec![3; 4]);
+    assert_eq!(reader.missed(), 3);
+
+    // The writer laps the slot of a message the reader still holds.
+    let held = reader.try_next().expect("newest message");
+    assert_eq!(held.seq, 4);
+    writer.publish(raw_meta(5), &[5; 4])?;
+    writer.publish(raw_meta(6), &[6; 4])?;
+    buf = vec![0xAA; 3];
+    assert!(!held.read_into(&mut buf), "slot 4 was reused by message 6");
+    assert!(buf.is_empty());
+
+    assert!(writer.publish(raw_meta(7), &[0; 17]).is_err());
+    assert_eq!(reader.oversized(), 1);
+    let _ = std::fs::remove_file(&path);
+    Ok(())
+}
+
+#[test]
+fn non_ring_files_are_rejected() {
+    let path = ring_path("garbage");
+    std::fs::write(&path, vec![0u8; 4096]).unwrap();
+    assert!(FrameRingReader::open(&path).is_err());
+    std::fs::write(&path, b"short").unwrap();
+    assert!(FrameRingReader::open(&path).is_err());
+    let _ = std::fs::remove_file(&path);
+    assert!(FrameRingWriter::create(&path, 1, 16).is_err(), "a ring needs two slots");
+}
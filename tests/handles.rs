@@ -0,0 +1,99 @@
+#![cfg(not(target_os = "windows"))]
+
+//! Message handles are allocated from a per-thread slab; these tests churn them across threads so
+//! slots migrate between thread caches and the global list.
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::mpsc;
+use std::thread;
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, Datatype, DatatypeEnum, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+const SENDERS: u32 = 4;
+const PER_SENDER: u32 = 500;
+
+#[test]
+fn handles_survive_cross_thread_churn() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_message_queue(8, true)?;
+
+    let total = (SENDERS * PER_SENDER) as usize;
+    let received = AtomicUsize::new(0);
+    let checksum = AtomicUsize::new(0);
+    let (drop_tx, drop_rx) = mpsc::channel::<Vec<Datatype>>();
+
+    thread::scope(|s| -> Result<()> {
+        // Handles created on the receiving threads are released here, on a third thread.
+        s.spawn(move || {
+            for batch in drop_rx {
+                drop(batch);
+            }
+        });
+        for sender in 0..SENDERS {
+            let output = output.clone();
+            s.spawn(move || {
+                for i in 0..PER_SENDER {
+                    let buffer = Buffer::from_bytes(&(sender * PER_SENDER + i).to_le_bytes()).unwrap();
+                    output.send_buffer(&buffer).unwrap();
+                }
+            });
+        }
+        let receivers: Vec<_> = (0..2)
+            .map(|_| {
+                let (queue, received, checksum, drop_tx) = (&queue, &received, &checksum, drop_tx.clone());
+                s.spawn(move || -> Result<()> {
+                    while received.load(Ordering::Relaxed) < total {
+                        let Some(msg) = queue.get(Some(Duration::from_millis(50)))? else {
+                            continue;
+                        };
+                        received.fetch_add(1, Ordering::Relaxed);
+                        assert_eq!(msg.datatype()?, Some(DatatypeEnum::Buffer));
+                        let clones = vec![msg.clone_handle()?, msg.clone_handle()?];
+                        let buffer = msg.as_buffer()?.expect("buffer");
+                        let value = u32::from_le_bytes(buffer.as_bytes().try_into().unwrap());
+                        checksum.fetch_add(value as usize, Ordering::Relaxed);
+                        drop_tx.send(clones).unwrap();
+                    }
+                    Ok(())
+                })
+            })
+            .collect();
+        drop(drop_tx);
+        for receiver in receivers {
+            receiver.join().expect("receiver panicked")?;
+        }
+        Ok(())
+    })?;
+
+    assert_eq!(received.into_inner(), total);
+    assert_eq!(checksum.into_inner(), (0..total).sum::<usize>());
+    Ok(())
+}
+
+#[test]
+fn clones_outlive_the_original_and_its_thread() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_message_queue(4, false)?;
+    output.send_buffer(&Buffer::from_bytes(b"slab")?)?;
+    let msg = queue.get(Some(Duration::from_millis(500)))?.expect("message");
+
+    // The thread that created these clones exits (and flushes its slot cache) before they drop.
+    let clones = thread::spawn(move || (0..300).map(|_| msg.clone_handle()).collect::<Result<Vec<_>>>())
+        .join()
+        .expect("clone thread panicked")?;
+    for clone in &clones {
+        assert_eq!(clone.as_buffer()?.expect("buffer").as_bytes(), b"slab");
+    }
+    Ok(())
+}
@@ -0,0 +1,86 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::time::Duration;
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{FramePool, ImageFiltersNode, ImageFiltersPresetMode, InputQueue, MessageQueue, Result};
+
+const W: usize = 64;
+const H: usize = 48;
+
+fn host_filters(pipeline: &Pipeline) -> Result<(InputQueue, MessageQueue)> {
+    let filters = pipeline.create::<ImageFiltersNode>()?;
+    filters.set_run_on_host(true);
+    filters.set_default_profile_preset(ImageFiltersPresetMode::TofLowRange);
+    let feed = filters.input()?.create_input_queue(2, true)?;
+    let out = filters.output()?.create_message_queue(2, true)?;
+    Ok((feed, out))
+}
+
+fn filtered(out: &MessageQueue) -> Result<depthai::camera::ImageFrame> {
+    let msg = out.get(Some(Duration::from_secs(10)))?.expect("no filtered frame within 10 s");
+    Ok(msg.as_frame()?.expect("ImageFilters outputs frames"))
+}
+
+#[test]
+fn depth_outliers_are_removed_and_flat_depth_is_kept() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let (feed, out) = host_filters(&pipeline)?;
+    pipeline.start()?;
+
+    let pool = FramePool::new(W * H * 2, 1)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(W as u32, H as u32, ImageFrameType::RAW16, W * H * 2)?;
+    frame.set_sequence_num(7);
+    let mut depth = vec![1000u16; W * H];
+    let outlier = (H / 2) * W + W / 2;
+    depth[outlier] = 5000;
+    for (dst, px) in frame.data_mut().chunks_exact_mut(2).zip(&depth) {
+        dst.copy_from_slice(&px.to_le_bytes());
+    }
+    feed.send_frame(&frame.into_frame())?;
+
+    let result = filtered(&out)?;
+    pipeline.stop()?;
+    let info = result.info()?;
+    assert_eq!((info.width, info.height), (W as u32, H as u32));
+    assert_eq!(info.format, Some(ImageFrameType::RAW16));
+    assert_eq!(info.sequence_num, 7, "metadata is carried over");
+
+    let row = info.stride.max(W as u32 * 2) as usize;
+    let bytes = result.as_bytes();
+    let px = |i: usize| {
+        let at = (i / W) * row + (i % W) * 2;
+        u16::from_le_bytes([bytes[at], bytes[at + 1]])
+    };
+    assert_ne!(px(outlier), 5000, "a single-pixel spike must not survive the chain");
+    let valid = (0..W * H).filter(|&i| px(i) != 0).count();
+    assert!(valid >= W * H * 95 / 100, "flat depth was invalidated: {valid} of {} valid", W * H);
+    for i in (0..W * H).filter(|&i| px(i) != 0) {
+        assert!((990..=1010).contains(&px(i)), "pixel {i} moved to {}", px(i));
+    }
+    Ok(())
+}
+
+#[test]
+fn non_depth_frames_pass_through_unchanged() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let (feed, out) = host_filters(&pipeline)?;
+    pipeline.start()?;
+
+    let pool = FramePool::new(W * H, 1)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(W as u32, H as u32, ImageFrameType::GRAY8, W * H)?;
+    for (i, b) in frame.data_mut().iter_mut().enumerate() {
+        *b = (i * 31 % 251) as u8;
+    }
+    let expected = frame.as_bytes().to_vec();
+    feed.send_frame(&frame.into_frame())?;
+
+    let result = filtered(&out)?;
+    pipeline.stop()?;
+    assert_eq!(result.info()?.format, Some(ImageFrameType::GRAY8));
+    assert_eq!(result.bytes(), expected);
+    Ok(())
+}
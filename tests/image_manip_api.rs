@@ -1,4 +1,7 @@
-use depthai::{Colormap, ImageManipConfig, ImageManipNode, ImageManipResizeMode, Pipeline, Result};
+use depthai::{
+    Colormap, ImageManipConfig, ImageManipNode, ImageManipResizeMode, ImageManipTemplate, ManipOp, ManipRoi, Pipeline,
+    Result,
+};
 use depthai::common::ImageFrameType;
 
 #[cfg(feature = "hit")]
@@ -36,3 +39,66 @@ fn image_manip_api_smoke() -> Result<()> {
 
     Ok(())
 }
+
+#[test]
+fn manip_op_kinds_mirror_the_wrapper_header() {
+    let header = include_str!(concat!(env!("CARGO_MANIFEST_DIR"), "/depthai-sys/wrapper/wrapper.h"));
+    let body = header.split("enum DaiManipOpKind {").nth(1).expect("DaiManipOpKind in wrapper.h");
+    let kinds: Vec<(&str, i32)> = body
+        .split("};")
+        .next()
+        .unwrap()
+        .lines()
+        .filter_map(|line| {
+            let (name, value) = line.split("//").next()?.split_once('=')?;
+            Some((name.trim(), value.trim().trim_end_matches(',').parse().ok()?))
+        })
+        .collect();
+    let mirrored = [
+        ("DAI_MANIP_OP_CROP_XYWH", depthai_sys::DAI_MANIP_OP_CROP_XYWH),
+        ("DAI_MANIP_OP_CROP_RECT", depthai_sys::DAI_MANIP_OP_CROP_RECT),
+        ("DAI_MANIP_OP_CROP_ROTATED_RECT", depthai_sys::DAI_MANIP_OP_CROP_ROTATED_RECT),
+        ("DAI_MANIP_OP_SCALE", depthai_sys::DAI_MANIP_OP_SCALE),
+        ("DAI_MANIP_OP_ROTATE", depthai_sys::DAI_MANIP_OP_ROTATE),
+        ("DAI_MANIP_OP_ROTATE_CENTER", depthai_sys::DAI_MANIP_OP_ROTATE_CENTER),
+        ("DAI_MANIP_OP_FLIP_HORIZONTAL", depthai_sys::DAI_MANIP_OP_FLIP_HORIZONTAL),
+        ("DAI_MANIP_OP_FLIP_VERTICAL", depthai_sys::DAI_MANIP_OP_FLIP_VERTICAL),
+        ("DAI_MANIP_OP_AFFINE", depthai_sys::DAI_MANIP_OP_AFFINE),
+        ("DAI_MANIP_OP_PERSPECTIVE", depthai_sys::DAI_MANIP_OP_PERSPECTIVE),
+        ("DAI_MANIP_OP_FOUR_POINTS", depthai_sys::DAI_MANIP_OP_FOUR_POINTS),
+        ("DAI_MANIP_OP_ROI_CROP", depthai_sys::DAI_MANIP_OP_ROI_CROP),
+        ("DAI_MANIP_OP_ROI_CROP_ROTATED", depthai_sys::DAI_MANIP_OP_ROI_CROP_ROTATED),
+        ("DAI_MANIP_OP_ROI_ROTATE", depthai_sys::DAI_MANIP_OP_ROI_ROTATE),
+    ];
+    assert_eq!(kinds, mirrored);
+}
+
+#[test]
+fn every_manip_op_is_accepted_by_the_template() -> Result<()> {
+    let corners = [(0.0, 0.0), (1.0, 0.0), (1.0, 1.0), (0.0, 1.0)];
+    let ops = [
+        ManipOp::CropXywh { x: 0, y: 0, w: 32, h: 32 },
+        ManipOp::CropRect { x: 0.1, y: 0.1, w: 0.5, h: 0.5, normalized: true },
+        ManipOp::CropRotatedRect { cx: 0.5, cy: 0.5, w: 0.5, h: 0.5, angle_deg: 10.0, normalized: true },
+        ManipOp::Scale { x: 0.5, y: 0.5 },
+        ManipOp::RotateDeg(15.0),
+        ManipOp::RotateDegCenter { angle_deg: 15.0, center_x: 0.5, center_y: 0.5 },
+        ManipOp::FlipHorizontal,
+        ManipOp::FlipVertical,
+        ManipOp::Affine([1.0, 0.0, 0.0, 1.0]),
+        ManipOp::Perspective([1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0]),
+        ManipOp::FourPoints { src: corners, dst: corners, normalized: true },
+        ManipOp::RoiCrop { normalized: true },
+        ManipOp::RoiCropRotated { normalized: true },
+        ManipOp::RoiRotate,
+    ];
+    // The template validates each kind up front, so a mis-numbered op fails here.
+    for op in ops {
+        let template = ImageManipTemplate::new(None, &[op], 1)?;
+        template.instantiate(&ManipRoi::rect(0.25, 0.25, 0.5, 0.5))?;
+    }
+    let chain = ImageManipTemplate::new(None, &ops, 2)?;
+    chain.instantiate(&ManipRoi::rect(0.0, 0.0, 1.0, 1.0))?;
+    assert_eq!(chain.allocated(), 1);
+    Ok(())
+}
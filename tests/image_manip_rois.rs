@@ -0,0 +1,81 @@
+#![cfg(not(target_os = "windows"))]
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{
+    FramePool, ImageManipConfig, ImageManipTemplate, Input, ManipOp, ManipRoi, Result, ThreadedHostNodeContext,
+    ThreadedHostNodeImpl,
+};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+/// Host inputs standing in for ImageManip's `inputConfig` and `inputImage`.
+fn manip_inputs(pipeline: &Pipeline) -> Result<(Input, Input)> {
+    let mut inputs = None;
+    pipeline.create_threaded_host_node(|node| {
+        inputs = Some((node.create_input(Some("config"))?, node.create_input(Some("image"))?));
+        Ok(Noop)
+    })?;
+    Ok(inputs.expect("inputs created"))
+}
+
+/// `(reusePreviousImage, skipCurrentImage)` of every config waiting on `input`, in arrival order.
+fn config_flags(input: &Input) -> Result<Vec<(bool, bool)>> {
+    let mut flags = Vec::new();
+    while let Some(buffer) = input.try_get_buffer()? {
+        let cfg = ImageManipConfig::from_buffer(buffer)?.expect("ImageManipConfig message");
+        flags.push((cfg.reuse_previous_image()?, cfg.skip_current_image()?));
+    }
+    Ok(flags)
+}
+
+#[test]
+fn send_rois_consumes_the_new_image_once_then_reuses_it() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let (config_in, image_in) = manip_inputs(&pipeline)?;
+    let configs = config_in.create_input_queue(16, true)?;
+    let images = image_in.create_input_queue(4, true)?;
+
+    let template = ImageManipTemplate::new(None, &[ManipOp::RoiCrop { normalized: true }], 4)?;
+    let rois = [
+        ManipRoi::rect(0.0, 0.0, 0.5, 0.5),
+        ManipRoi::rect(0.5, 0.0, 0.5, 0.5),
+        ManipRoi::rect(0.0, 0.5, 0.5, 0.5),
+    ];
+    let pool = FramePool::new(16, 1)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(4, 4, ImageFrameType::GRAY8, 16)?;
+    frame.set_sequence_num(7);
+    let frame = frame.into_frame();
+
+    assert_eq!(template.send_rois(&configs, Some((&images, &frame)), &rois)?, 3);
+    let image = image_in.try_get_frame()?.expect("the frame goes to the image input");
+    assert_eq!(image.sequence_num(), 7);
+    assert!(image_in.try_get_frame()?.is_none(), "one frame per batch");
+    // Only the first config takes the new frame; none of them skips it.
+    assert_eq!(config_flags(&config_in)?, [(false, false), (true, false), (true, false)]);
+
+    // Without an image every config crops the one the node already holds; recycled configs do
+    // not keep the first-config flags of the previous batch.
+    assert_eq!(template.send_rois(&configs, None, &rois[..2])?, 2);
+    assert!(image_in.try_get_frame()?.is_none());
+    assert_eq!(config_flags(&config_in)?, [(true, false), (true, false)]);
+
+    assert_eq!(template.send_rois(&configs, Some((&images, &frame)), &[])?, 0);
+    assert!(image_in.try_get_frame()?.is_none(), "an empty batch sends no frame");
+    Ok(())
+}
+
+#[test]
+fn from_buffer_rejects_other_messages() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let (config_in, _image_in) = manip_inputs(&pipeline)?;
+    let feed = config_in.create_input_queue(2, true)?;
+    feed.send_buffer(&depthai::Buffer::from_bytes(b"not a config")?)?;
+    let buffer = config_in.try_get_buffer()?.expect("buffer message");
+    assert!(ImageManipConfig::from_buffer(buffer)?.is_none());
+    Ok(())
+}
@@ -0,0 +1,71 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::sync::mpsc;
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, ConflationStats, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+#[test]
+fn only_unread_messages_count_as_overwritten() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("latest"))?;
+    let queue = output.create_latest_message_queue()?;
+    let send = |b: u8| output.send_buffer(&Buffer::from_bytes(&[b])?);
+
+    send(1)?;
+    send(2)?;
+    send(3)?;
+    let stats = queue.conflation_stats().expect("latest-only queue");
+    assert_eq!((stats.received, stats.overwritten), (3, 2));
+
+    // Reading empties the slot; the next arrival replaces nothing.
+    let newest = queue.try_get()?.expect("newest message");
+    assert_eq!(newest.as_buffer()?.expect("buffer").as_bytes().to_vec(), vec![3]);
+    send(4)?;
+    send(5)?;
+    let stats = queue.conflation_stats().expect("latest-only queue");
+    assert_eq!((stats.received, stats.overwritten), (5, 3));
+
+    let plain = output.create_message_queue(1, false)?;
+    assert_eq!(plain.conflation_stats(), None);
+    Ok(())
+}
+
+#[test]
+fn callback_deliveries_are_not_overwrites() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("latest_cb"))?;
+    let queue = output.create_latest_message_queue()?;
+    let (tx, rx) = mpsc::channel();
+
+    let handle = queue.add_callback(move |_, msg| {
+        let _ = tx.send(msg.as_buffer().ok().flatten().map(|b| b.as_bytes().to_vec()));
+    })?;
+    for b in 0..4u8 {
+        output.send_buffer(&Buffer::from_bytes(&[b])?)?;
+        // Wait for each delivery so none of them is coalesced away.
+        rx.recv_timeout(Duration::from_secs(5)).expect("callback delivery");
+    }
+    drop(handle);
+    // The slot still holds the last delivered message; replacing it is not an overwrite either.
+    output.send_buffer(&Buffer::from_bytes(&[9])?)?;
+
+    let stats = queue.conflation_stats().expect("latest-only queue");
+    assert_eq!(
+        stats,
+        ConflationStats {
+            received: 5,
+            overwritten: 0,
+            coalesced: 0,
+        }
+    );
+    Ok(())
+}
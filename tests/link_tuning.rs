@@ -0,0 +1,81 @@
+use std::time::Duration;
+
+use depthai::{LinkProbe, LinkTuning, TuningObjective};
+
+fn probe(chunk_size: i32, p99: Option<f32>, mean: Option<f32>, saturated_fps: Option<f32>) -> LinkProbe {
+    LinkProbe {
+        chunk_size,
+        paced_fps: p99.or(mean).map(|_| 30.0),
+        latency_mean: mean,
+        latency_p99: p99,
+        saturated_fps,
+        throughput_mib_s: saturated_fps.map(|fps| fps as f64),
+    }
+}
+
+fn probes() -> Vec<LinkProbe> {
+    vec![
+        probe(0, Some(0.030), Some(0.020), Some(40.0)),
+        probe(16 << 10, Some(0.012), Some(0.010), Some(55.0)),
+        probe(64 << 10, Some(0.018), Some(0.011), Some(90.0)),
+        // Only a mean: still comparable on latency.
+        probe(256 << 10, None, Some(0.011), Some(120.0)),
+        // Paced run failed: never picked by a latency objective.
+        probe(1 << 20, None, None, Some(200.0)),
+    ]
+}
+
+fn picked(objective: TuningObjective, probes: &[LinkProbe]) -> Option<i32> {
+    objective.pick(probes).map(|p| p.chunk_size)
+}
+
+#[test]
+fn min_latency_prefers_p99_and_falls_back_to_the_mean() {
+    assert_eq!(picked(TuningObjective::MinLatency, &probes()), Some(256 << 10));
+    let mut without_mean_only = probes();
+    without_mean_only.remove(3);
+    assert_eq!(picked(TuningObjective::MinLatency, &without_mean_only), Some(16 << 10));
+}
+
+#[test]
+fn max_throughput_ignores_latency() {
+    assert_eq!(picked(TuningObjective::MaxThroughput, &probes()), Some(1 << 20));
+}
+
+#[test]
+fn target_latency_takes_the_fastest_probe_within_the_bound() {
+    let within = |ms| picked(TuningObjective::TargetLatency(Duration::from_millis(ms)), &probes());
+    assert_eq!(within(20), Some(256 << 10));
+    assert_eq!(within(15), Some(256 << 10));
+    let mut strict = probes();
+    strict.remove(3);
+    assert_eq!(picked(TuningObjective::TargetLatency(Duration::from_millis(15)), &strict), Some(16 << 10));
+    // Nothing meets 1 ms: fall back to the lowest latency.
+    assert_eq!(within(1), Some(256 << 10));
+}
+
+#[test]
+fn no_usable_measurement_picks_nothing() {
+    let only_saturated = [probe(0, None, None, Some(10.0))];
+    assert_eq!(picked(TuningObjective::MinLatency, &only_saturated), None);
+    assert_eq!(picked(TuningObjective::TargetLatency(Duration::from_millis(5)), &only_saturated), None);
+    assert_eq!(picked(TuningObjective::MaxThroughput, &[]), None);
+}
+
+#[test]
+fn tuning_round_trips_through_its_cache_file() -> depthai::Result<()> {
+    let tuning = LinkTuning {
+        key: "test/0.0.0".into(),
+        xlink_chunk_size: 64 << 10,
+        queue_depth: 3,
+        frames_pool: 4,
+        probes: probes(),
+    };
+    let path = std::env::temp_dir().join(format!("depthai-link-tuning-{}.json", std::process::id()));
+    tuning.save(&path)?;
+    let loaded = LinkTuning::load(&path);
+    let _ = std::fs::remove_file(&path);
+    assert_eq!(loaded?, tuning);
+    assert!(LinkTuning::load(&path).is_err());
+    Ok(())
+}
@@ -0,0 +1,76 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::time::Duration;
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, FramePool, GroupMember, HostNodeImpl, MessageGroup, MessageGroupLayout, Result};
+
+#[test]
+fn layouts_index_names_in_declaration_order() -> Result<()> {
+    let layout = MessageGroupLayout::new(&["rgb", "depth", "imu"])?;
+    assert_eq!(layout.len(), 3);
+    assert_eq!(layout.names(), ["rgb", "depth", "imu"]);
+    assert_eq!(layout.index_of("depth"), Some(1));
+    assert_eq!(layout.index_of("left"), None);
+    assert!(MessageGroupLayout::new::<&str>(&[])?.is_empty());
+    assert!(MessageGroupLayout::new(&["rgb", ""]).is_err(), "empty names are rejected");
+    Ok(())
+}
+
+/// Resolves a layout listing a missing member between two present ones and reports what it saw
+/// as `[present flags..., seq of "a", seq of "b"]`.
+struct Resolver {
+    layout: MessageGroupLayout,
+}
+
+impl HostNodeImpl for Resolver {
+    fn process_group(&mut self, group: &MessageGroup) -> Option<Buffer> {
+        let members = group.resolve(&self.layout).expect("resolve");
+        let seq = |m: &Option<GroupMember>| match m {
+            Some(GroupMember::Frame(frame, info)) => {
+                assert_eq!(info.sequence_num, frame.info().unwrap().sequence_num);
+                assert_eq!((info.width, info.height), (2, 2));
+                info.sequence_num as u8
+            }
+            _ => u8::MAX,
+        };
+        let report = [
+            members[0].is_some() as u8,
+            members[1].is_some() as u8,
+            members[2].is_some() as u8,
+            seq(&members[2]),
+            seq(&members[0]),
+        ];
+        Some(Buffer::from_bytes(&report).expect("report buffer"))
+    }
+}
+
+#[test]
+fn resolve_returns_every_member_by_slot() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_host_node(Resolver {
+        layout: MessageGroupLayout::new(&["b", "missing", "a"])?,
+    })?;
+    node.run_syncing_on_host()?;
+    let a = node.input("a")?.create_input_queue(4, true)?;
+    let b = node.input("b")?.create_input_queue(4, true)?;
+    let reports = node.out()?.create_message_queue(4, true)?;
+    pipeline.start()?;
+
+    let pool = FramePool::new(4, 4)?;
+    for seq in 0..3 {
+        for (queue, offset) in [(&a, 0), (&b, 100)] {
+            let mut frame = pool.acquire()?;
+            frame.set_format(2, 2, ImageFrameType::GRAY8, 4)?;
+            frame.set_sequence_num(seq + offset);
+            frame.set_timestamp_now();
+            queue.send_frame(&frame.into_frame())?;
+        }
+        let report = reports.get(Some(Duration::from_secs(5)))?.expect("group report");
+        let report = report.as_buffer()?.expect("buffer");
+        assert_eq!(report.as_bytes(), [1, 0, 1, seq as u8, seq as u8 + 100]);
+    }
+    pipeline.stop()?;
+    Ok(())
+}
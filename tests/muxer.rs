@@ -0,0 +1,376 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::sync::Arc;
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{
+    create_replay_node, EncodedFrame, EncodedFrameProfile, EncodedFrameType, FrameRecorder, MuxContainer, Recording,
+    ReplayOptions, ReplayRate, Result, RingFrameMeta, RingPayloadKind, SegmentMuxerOptions, SegmentedMuxer,
+};
+
+const AUD: [u8; 2] = [0x09, 0xf0];
+/// High profile (100), so `avcC` carries the chroma / bit depth extension.
+const SPS: [u8; 6] = [0x67, 0x64, 0x00, 0x1f, 0xac, 0xd9];
+const PPS: [u8; 4] = [0x68, 0xeb, 0xe3, 0xcb];
+const IDR: [u8; 4] = [0x65, 0x88, 0x84, 0x21];
+
+/// One test frame: type, timestamp in ms and the NAL units it should be muxed with.
+struct TestFrame {
+    frame_type: EncodedFrameType,
+    ms: i64,
+    nals: Vec<Vec<u8>>,
+}
+
+impl TestFrame {
+    fn key(ms: i64) -> Self {
+        Self {
+            frame_type: EncodedFrameType::I,
+            ms,
+            nals: vec![SPS.to_vec(), PPS.to_vec(), IDR.to_vec()],
+        }
+    }
+
+    fn delta(ms: i64, len: usize) -> Self {
+        let mut slice = vec![0x9a; len];
+        slice[0] = 0x41;
+        Self {
+            frame_type: EncodedFrameType::P,
+            ms,
+            nals: vec![slice],
+        }
+    }
+
+    /// Whether the access unit carries an IDR slice, whatever type the frame is labelled with.
+    fn is_key(&self) -> bool {
+        self.nals.iter().any(|nal| nal[0] & 0x1f == 5)
+    }
+
+    /// Annex-B access unit as the encoder emits it: an AUD first, 4- and 3-byte start codes and
+    /// a trailing zero byte.
+    fn annexb(&self) -> Vec<u8> {
+        let mut out = [&[0, 0, 0, 1][..], &AUD].concat();
+        for (i, nal) in self.nals.iter().enumerate() {
+            out.extend_from_slice(if i == 1 { &[0, 0, 1] } else { &[0, 0, 0, 1] });
+            out.extend_from_slice(nal);
+        }
+        out.push(0);
+        out
+    }
+
+    /// Stored sample: NALs behind 4-byte length prefixes, AUD dropped.
+    fn sample(&self) -> Vec<u8> {
+        self.nals
+            .iter()
+            .flat_map(|nal| (nal.len() as u32).to_be_bytes().into_iter().chain(nal.iter().copied()))
+            .collect()
+    }
+}
+
+/// A dropped leading P frame, then two segments: four frames split into two fragments, and a
+/// keyframe past `segment_duration`. The 119-byte slice makes a 127-byte SimpleBlock, the first
+/// size that needs a 2-byte EBML length.
+fn stream() -> Vec<TestFrame> {
+    vec![
+        TestFrame::delta(967, 8),
+        TestFrame::key(1000),
+        TestFrame::delta(1033, 4),
+        TestFrame::delta(1066, 4),
+        TestFrame::delta(1099, 119),
+        TestFrame::key(1132),
+    ]
+}
+
+fn options(container: MuxContainer) -> SegmentMuxerOptions {
+    SegmentMuxerOptions {
+        container,
+        segment_duration: Duration::from_millis(100),
+        fragment_duration: Duration::from_millis(60),
+        ..Default::default()
+    }
+}
+
+fn avcc() -> Vec<u8> {
+    [
+        &[1, 0x64, 0x00, 0x1f, 0xff, 0xe1, 0, 6][..],
+        &SPS,
+        &[1, 0, 4],
+        &PPS,
+        &[0xfd, 0xf8, 0xf8, 0x00],
+    ]
+    .concat()
+}
+
+/// Round-trips `frames` through a recording and the replay node to get real `EncodedFrame`s.
+fn encoded_frames(name: &str, frames: &[TestFrame]) -> Result<Vec<EncodedFrame>> {
+    let path = std::env::temp_dir().join(format!("depthai-muxer-{name}-{}.rec", std::process::id()));
+    let recorder = FrameRecorder::create(&path)?;
+    for (i, frame) in frames.iter().enumerate() {
+        let meta = RingFrameMeta {
+            kind: RingPayloadKind::Encoded as u32,
+            width: 320,
+            height: 240,
+            format: EncodedFrameProfile::Avc as i32,
+            frame_type: frame.frame_type as i32,
+            sequence_num: i as i64,
+            timestamp_ns: frame.ms * 1_000_000,
+            ..Default::default()
+        };
+        recorder.record(0, meta, &frame.annexb())?;
+    }
+    recorder.finish()?;
+
+    let pipeline = Pipeline::new_host_only()?;
+    let options = ReplayOptions {
+        rate: ReplayRate::Unthrottled,
+        ..Default::default()
+    };
+    let source = create_replay_node(&pipeline, Arc::new(Recording::open(&path)?), options)?;
+    let queue = source.output(0).expect("stream 0").create_message_queue(frames.len() as u32, true)?;
+    pipeline.start()?;
+    let mut out = Vec::with_capacity(frames.len());
+    while out.len() < frames.len() {
+        let msg = queue.get(Some(Duration::from_secs(10)))?.expect("replayed frame");
+        out.push(msg.as_encoded_frame()?.expect("an EncodedFrame"));
+    }
+    pipeline.stop()?;
+    let _ = std::fs::remove_file(&path);
+    Ok(out)
+}
+
+fn mux(name: &str, container: MuxContainer, frames: &[TestFrame]) -> Result<Vec<Vec<u8>>> {
+    let dir = std::env::temp_dir().join(format!("depthai-muxer-{name}-{}", std::process::id()));
+    let _ = std::fs::remove_dir_all(&dir);
+    let mut muxer = SegmentedMuxer::new(&dir, "cam", options(container))?;
+    for frame in encoded_frames(name, frames)? {
+        muxer.push(frame)?;
+    }
+    muxer.finish()?;
+
+    let stats = muxer.stats();
+    let segments = muxer.monitor().segments();
+    let ext = if container == MuxContainer::Matroska { "mkv" } else { "mp4" };
+    assert_eq!(
+        segments,
+        vec![dir.join(format!("cam-00000.{ext}")), dir.join(format!("cam-00001.{ext}"))]
+    );
+    let files: Vec<Vec<u8>> = segments.iter().map(|p| std::fs::read(p).unwrap()).collect();
+    assert_eq!((stats.frames, stats.segments, stats.dropped), (5, 2, 1));
+    assert_eq!(stats.bytes, files.iter().map(|f| f.len() as u64).sum::<u64>());
+    drop(muxer);
+    let _ = std::fs::remove_dir_all(&dir);
+    Ok(files)
+}
+
+fn be32(data: &[u8], at: usize) -> u32 {
+    u32::from_be_bytes(data[at..at + 4].try_into().unwrap())
+}
+
+/// Splits `data` into `(type, body)` boxes, checking that they tile it exactly.
+fn boxes(data: &[u8]) -> Vec<([u8; 4], &[u8])> {
+    let mut out = Vec::new();
+    let mut at = 0;
+    while at < data.len() {
+        let size = be32(data, at) as usize;
+        assert!(size >= 8 && at + size <= data.len(), "box at {at} overruns its parent");
+        out.push((data[at + 4..at + 8].try_into().unwrap(), &data[at + 8..at + size]));
+        at += size;
+    }
+    out
+}
+
+fn child<'a>(data: &'a [u8], kind: &[u8; 4]) -> &'a [u8] {
+    boxes(data)
+        .into_iter()
+        .find(|(k, _)| k == kind)
+        .map(|(_, body)| body)
+        .unwrap_or_else(|| panic!("no {} box", String::from_utf8_lossy(kind)))
+}
+
+/// Checks one `moof`+`mdat` pair against the frames it should hold.
+fn check_fragment(moof: &[u8], mdat: &[u8], sequence: u32, start_ticks: u64, frames: &[&TestFrame]) {
+    assert_eq!(be32(child(moof, b"mfhd"), 4), sequence);
+    let traf = child(moof, b"traf");
+    let tfdt = child(traf, b"tfdt");
+    assert_eq!(u64::from_be_bytes(tfdt[4..12].try_into().unwrap()), start_ticks);
+    let trun = child(traf, b"trun");
+    assert_eq!(be32(trun, 4) as usize, frames.len());
+    // Offsets are relative to the moof; the payload starts right after the mdat header.
+    assert_eq!(be32(trun, 8) as usize, 8 + moof.len() + 8);
+    for (i, frame) in frames.iter().enumerate() {
+        let entry = 12 + 12 * i;
+        assert_eq!(be32(trun, entry), 2970, "33 ms at 90 kHz");
+        assert_eq!(be32(trun, entry + 4) as usize, frame.sample().len());
+        let flags = if frame.is_key() { 0x0200_0000 } else { 0x0101_0000 };
+        assert_eq!(be32(trun, entry + 8), flags);
+    }
+    let payload: Vec<u8> = frames.iter().flat_map(|f| f.sample()).collect();
+    assert_eq!(mdat, payload.as_slice());
+}
+
+fn check_mp4_init<'a>(file: &'a [u8]) -> Vec<([u8; 4], &'a [u8])> {
+    let top = boxes(file);
+    let moov = child(file, b"moov");
+    let stbl = child(child(child(child(moov, b"trak"), b"mdia"), b"minf"), b"stbl");
+    assert_eq!(be32(child(child(child(moov, b"trak"), b"mdia"), b"mdhd"), 12), 90_000);
+    // stsd: version/flags and entry count; avc3: the 78-byte visual sample entry.
+    let entry = child(&child(stbl, b"stsd")[8..], b"avc3");
+    assert_eq!((&entry[24..26], &entry[26..28]), (&320u16.to_be_bytes()[..], &240u16.to_be_bytes()[..]));
+    assert_eq!(child(&entry[78..], b"avcC"), avcc().as_slice());
+    child(child(moov, b"mvex"), b"trex");
+    top
+}
+
+#[test]
+fn fragmented_mp4_segments_parse_back() -> Result<()> {
+    let frames = stream();
+    let files = mux("mp4", MuxContainer::FragmentedMp4, &frames)?;
+
+    let top = check_mp4_init(&files[0]);
+    let kinds: Vec<&[u8; 4]> = top.iter().map(|(k, _)| k).collect();
+    assert_eq!(kinds, [b"ftyp", b"moov", b"moof", b"mdat", b"moof", b"mdat"]);
+    assert_eq!(&top[0].1[..4], b"isom");
+    // The newest frame waits for its successor, so the 66 ms span flushes frames 1 and 2.
+    check_fragment(top[2].1, top[3].1, 1, 0, &[&frames[1], &frames[2]]);
+    check_fragment(top[4].1, top[5].1, 2, 5940, &[&frames[3], &frames[4]]);
+
+    let top = check_mp4_init(&files[1]);
+    let kinds: Vec<&[u8; 4]> = top.iter().map(|(k, _)| k).collect();
+    assert_eq!(kinds, [b"ftyp", b"moov", b"moof", b"mdat"]);
+    // A new segment restarts its timeline; the last sample gets the previous frame spacing.
+    check_fragment(top[2].1, top[3].1, 1, 0, &[&frames[5]]);
+    Ok(())
+}
+
+/// Reads an EBML variable-length integer, keeping the length marker for element IDs.
+fn vint(data: &[u8], keep_marker: bool) -> (u64, usize, bool) {
+    let len = data[0].leading_zeros() as usize + 1;
+    assert!(len <= 8, "invalid EBML vint {:#x}", data[0]);
+    let mut v = if keep_marker { data[0] as u64 } else { data[0] as u64 & (0xff >> len) };
+    for &b in &data[1..len] {
+        v = (v << 8) | b as u64;
+    }
+    let unknown = !keep_marker && v == (1u64 << (7 * len)) - 1;
+    (v, len, unknown)
+}
+
+/// Splits `data` into `(id, body)` elements; an unknown size runs to the end of `data`.
+fn elements(data: &[u8]) -> Vec<(u32, &[u8])> {
+    let mut out = Vec::new();
+    let mut at = 0;
+    while at < data.len() {
+        let (id, n, _) = vint(&data[at..], true);
+        at += n;
+        let (size, n, unknown) = vint(&data[at..], false);
+        at += n;
+        let end = if unknown { data.len() } else { at + size as usize };
+        assert!(end <= data.len(), "element {id:#x} overruns its parent");
+        out.push((id as u32, &data[at..end]));
+        at = end;
+    }
+    out
+}
+
+fn element(data: &[u8], id: u32) -> &[u8] {
+    elements(data)
+        .into_iter()
+        .find(|&(i, _)| i == id)
+        .map(|(_, body)| body)
+        .unwrap_or_else(|| panic!("no element {id:#x}"))
+}
+
+fn uint(body: &[u8]) -> u64 {
+    body.iter().fold(0, |v, &b| (v << 8) | b as u64)
+}
+
+/// Checks one cluster of a segment starting at `base_ms` against the frames it should hold.
+fn check_cluster(cluster: &[u8], base_ms: i64, start_ms: u64, frames: &[&TestFrame]) {
+    let children = elements(cluster);
+    assert_eq!(children[0].0, 0xe7);
+    assert_eq!(uint(children[0].1), start_ms);
+    let blocks: Vec<&[u8]> = children[1..]
+        .iter()
+        .map(|&(id, body)| {
+            assert_eq!(id, 0xa3, "only SimpleBlocks follow the timestamp");
+            body
+        })
+        .collect();
+    assert_eq!(blocks.len(), frames.len());
+    for (block, frame) in blocks.iter().zip(frames) {
+        assert_eq!(block[0], 0x81, "track 1");
+        let rel = i16::from_be_bytes([block[1], block[2]]) as i64;
+        assert_eq!(rel, frame.ms - base_ms - start_ms as i64);
+        let key = if frame.is_key() { 0x80 } else { 0 };
+        assert_eq!(block[3], key);
+        assert_eq!(&block[4..], frame.sample().as_slice());
+    }
+}
+
+fn check_mkv(file: &[u8]) -> Vec<&[u8]> {
+    let top = elements(file);
+    assert_eq!(top.len(), 2, "EBML header and one segment");
+    let (header, segment) = (top[0], top[1]);
+    assert_eq!((header.0, segment.0), (0x1a45_dfa3, 0x1853_8067));
+    assert_eq!(element(header.1, 0x4282), b"matroska");
+    // The segment size is unknown, so it runs to the end of the file.
+    assert_eq!(segment.1.as_ptr_range().end, file.as_ptr_range().end);
+
+    let children = elements(segment.1);
+    assert_eq!(children[0].0, 0x1549_a966);
+    assert_eq!(uint(element(children[0].1, 0x2a_d7b1)), 1_000_000);
+    assert_eq!(children[1].0, 0x1654_ae6b);
+    let track = element(children[1].1, 0xae);
+    assert_eq!(element(track, 0x86), b"V_MPEG4/ISO/AVC");
+    assert_eq!(element(track, 0x63a2), avcc().as_slice());
+    let video = element(track, 0xe0);
+    assert_eq!((uint(element(video, 0xb0)), uint(element(video, 0xba))), (320, 240));
+    children[2..]
+        .iter()
+        .map(|&(id, body)| {
+            assert_eq!(id, 0x1f43_b675, "clusters follow the tracks");
+            body
+        })
+        .collect()
+}
+
+#[test]
+fn matroska_segments_parse_back() -> Result<()> {
+    let frames = stream();
+    let files = mux("mkv", MuxContainer::Matroska, &frames)?;
+
+    let clusters = check_mkv(&files[0]);
+    assert_eq!(clusters.len(), 2);
+    check_cluster(clusters[0], 1000, 0, &[&frames[1], &frames[2]]);
+    check_cluster(clusters[1], 1000, 66, &[&frames[3], &frames[4]]);
+    // Frame 4's 127-byte SimpleBlock needs the 2-byte size 0x407f (0xff is reserved).
+    let block = [&[0x81, 0x00, 0x21, 0x00][..], &frames[4].sample()].concat();
+    let encoded = [&[0xa3, 0x40, 0x7f][..], &block].concat();
+    assert!(clusters[1].windows(encoded.len()).any(|w| w == encoded.as_slice()));
+
+    let clusters = check_mkv(&files[1]);
+    assert_eq!(clusters.len(), 1);
+    check_cluster(clusters[0], 1132, 0, &[&frames[5]]);
+    Ok(())
+}
+
+#[test]
+fn idr_frames_typed_unknown_open_segments() -> Result<()> {
+    // Some firmware reports IDR frames as `Unknown`; the muxer must fall back to the NAL types.
+    let frames: Vec<TestFrame> = stream()
+        .into_iter()
+        .map(|frame| match frame.frame_type {
+            EncodedFrameType::I => TestFrame {
+                frame_type: EncodedFrameType::Unknown,
+                ..frame
+            },
+            _ => frame,
+        })
+        .collect();
+    let files = mux("unknown-idr", MuxContainer::FragmentedMp4, &frames)?;
+
+    let top = check_mp4_init(&files[0]);
+    check_fragment(top[2].1, top[3].1, 1, 0, &[&frames[1], &frames[2]]);
+    let top = check_mp4_init(&files[1]);
+    check_fragment(top[2].1, top[3].1, 1, 0, &[&frames[5]]);
+    Ok(())
+}
@@ -0,0 +1,70 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Arc;
+use std::thread;
+use std::time::Duration;
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, FramePool, HostNodeImpl, HostNodeWorkers, MessageGroup, Result};
+
+/// Takes longer for even sequence numbers so later groups finish first, and tracks how many
+/// groups are processed at once.
+#[derive(Clone)]
+struct Uneven {
+    running: Arc<AtomicUsize>,
+    peak: Arc<AtomicUsize>,
+}
+
+impl HostNodeImpl for Uneven {
+    fn process_group(&mut self, group: &MessageGroup) -> Option<Buffer> {
+        let now = self.running.fetch_add(1, Ordering::SeqCst) + 1;
+        self.peak.fetch_max(now, Ordering::SeqCst);
+        let seq = group.get_frame("in").expect("get").expect("frame").info().unwrap().sequence_num;
+        thread::sleep(Duration::from_millis(if seq % 2 == 0 { 30 } else { 1 }));
+        self.running.fetch_sub(1, Ordering::SeqCst);
+        Some(Buffer::from_bytes(&(seq as u32).to_le_bytes()).expect("result buffer"))
+    }
+}
+
+#[test]
+fn parallel_workers_send_results_in_input_order() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let peak = Arc::new(AtomicUsize::new(0));
+    let node = pipeline.create_parallel_host_node(
+        Uneven {
+            running: Arc::new(AtomicUsize::new(0)),
+            peak: peak.clone(),
+        },
+        HostNodeWorkers {
+            workers: 4,
+            max_in_flight: 8,
+        },
+    )?;
+    node.run_syncing_on_host()?;
+    let input = node.input("in")?.create_input_queue(32, true)?;
+    let results = node.out()?.create_message_queue(32, true)?;
+    pipeline.start()?;
+
+    let pool = FramePool::new(4, 32)?;
+    let count = 24u32;
+    for seq in 0..count {
+        let mut frame = pool.acquire()?;
+        frame.set_format(2, 2, ImageFrameType::GRAY8, 4)?;
+        frame.set_sequence_num(seq as i64);
+        frame.set_timestamp_now();
+        input.send_frame(&frame.into_frame())?;
+    }
+    for expected in 0..count {
+        let msg = results.get(Some(Duration::from_secs(5)))?.expect("result");
+        let seq = u32::from_le_bytes(msg.as_buffer()?.expect("buffer").as_bytes().try_into().unwrap());
+        assert_eq!(seq, expected, "results must keep input order");
+    }
+    pipeline.stop()?;
+
+    let peak = peak.load(Ordering::SeqCst);
+    assert!(peak > 1, "groups should overlap across workers (peak {peak})");
+    assert!(peak <= 4, "no more than `workers` groups run at once (peak {peak})");
+    Ok(())
+}
@@ -0,0 +1,58 @@
+#![cfg(not(target_os = "windows"))]
+
+use depthai::pipeline::Pipeline;
+use depthai::{Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+#[test]
+fn version_follows_every_structural_change() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let empty = pipeline.graph_version();
+    assert_eq!(pipeline.graph_version(), empty, "polling alone must not move the version");
+
+    let producer = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let consumer = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let with_nodes = pipeline.graph_version();
+    assert!(with_nodes > empty);
+
+    // Ports are added by the node itself, not by a pipeline-level call; they still count.
+    let out = producer.create_output(Some("out"))?;
+    let input = consumer.create_input(Some("in"))?;
+    let with_ports = pipeline.graph_version();
+    assert!(with_ports > with_nodes);
+
+    out.link(&input)?;
+    let linked = pipeline.graph_version();
+    assert!(linked > with_ports);
+    let graph = pipeline.graph_snapshot(None)?.expect("first snapshot");
+    assert_eq!(graph.version(), linked);
+    assert_eq!(graph.connections().len(), 1);
+    assert!(pipeline.graph_snapshot(Some(linked))?.is_none(), "unchanged graph is skipped");
+
+    pipeline.remove_node(consumer.as_node())?;
+    let removed = pipeline.graph_version();
+    assert!(removed > linked);
+    let graph = pipeline.graph_snapshot(Some(linked))?.expect("graph changed");
+    assert_eq!(graph.version(), removed);
+    assert!(graph.node(consumer.as_node().id()?).is_none());
+    Ok(())
+}
+
+#[test]
+fn versions_are_per_pipeline() -> Result<()> {
+    let a = Pipeline::new_host_only()?;
+    let b = Pipeline::new_host_only()?;
+    let a_version = a.graph_version();
+    let b_version = b.graph_version();
+    assert_ne!(a_version, b_version);
+
+    b.create_threaded_host_node(|_| Ok(Noop))?;
+    assert_ne!(b.graph_version(), b_version);
+    assert_eq!(a.graph_version(), a_version, "a change in another pipeline leaves this one alone");
+    assert!(a.graph_snapshot(Some(a_version))?.is_none());
+    Ok(())
+}
@@ -0,0 +1,181 @@
+#![cfg(not(target_os = "windows"))]
+
+//! Native pixel kernels against straightforward per-pixel references. Widths are chosen to cover
+//! whole SIMD blocks, row tails and padded strides.
+//!
+//! The kernels are plain C++ with no Rust-side state, so they are also the target to run under
+//! sanitizers, e.g. `RUSTFLAGS=-Zsanitizer=address cargo +nightly test --test pixel_convert`.
+
+use depthai::common::ImageFrameType;
+use depthai::{convert_pixels, converted_len, swap_rb_in_place, PixelLayout, Result};
+
+const WIDTHS: [u32; 6] = [1, 2, 15, 16, 38, 67];
+
+/// Small deterministic generator so failures reproduce.
+struct Lcg(u64);
+
+impl Lcg {
+    fn bytes(&mut self, n: usize) -> Vec<u8> {
+        (0..n)
+            .map(|_| {
+                self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+                (self.0 >> 56) as u8
+            })
+            .collect()
+    }
+}
+
+fn clamp(v: i32) -> u8 {
+    v.clamp(0, 255) as u8
+}
+
+/// BT.601 limited range in Q6, as documented for the native kernels.
+fn yuv_to_rgb(y: u8, u: u8, v: u8) -> [u8; 3] {
+    let yy = 74 * (y as i32 - 16);
+    let (uu, vv) = (u as i32 - 128, v as i32 - 128);
+    [
+        clamp((yy + 102 * vv + 32) >> 6),
+        clamp((yy - 25 * uu - 52 * vv + 32) >> 6),
+        clamp((yy + 129 * uu + 32) >> 6),
+    ]
+}
+
+fn convert(src: &[u8], layout: &PixelLayout, format: ImageFrameType) -> Result<Vec<u8>> {
+    let len = converted_len(layout.width, layout.height, format).expect("conversion target");
+    let mut dst = vec![0u8; len];
+    assert_eq!(convert_pixels(src, layout, format, &mut dst)?, len);
+    Ok(dst)
+}
+
+#[test]
+fn converted_len_covers_only_targets() {
+    assert_eq!(converted_len(4, 3, ImageFrameType::RGB888i), Some(36));
+    assert_eq!(converted_len(4, 3, ImageFrameType::BGR888i), Some(36));
+    assert_eq!(converted_len(4, 3, ImageFrameType::GRAY8), Some(12));
+    assert_eq!(converted_len(4, 3, ImageFrameType::RAW16), Some(24));
+    assert_eq!(converted_len(4, 3, ImageFrameType::NV12), None);
+    assert_eq!(converted_len(0, 3, ImageFrameType::RGB888i), None);
+}
+
+#[test]
+fn interleaved_swaps_match_reference_with_padded_strides() -> Result<()> {
+    let mut rng = Lcg(1);
+    for width in WIDTHS {
+        let (height, stride) = (3u32, width * 3 + 5);
+        let src = rng.bytes((stride * height) as usize);
+        let layout = PixelLayout {
+            stride,
+            ..PixelLayout::packed(width, height, ImageFrameType::BGR888i)
+        };
+        let rgb = convert(&src, &layout, ImageFrameType::RGB888i)?;
+        let same = convert(&src, &layout, ImageFrameType::BGR888i)?;
+        for row in 0..height as usize {
+            for x in 0..width as usize {
+                let s = &src[row * stride as usize + 3 * x..][..3];
+                let o = (row * width as usize + x) * 3;
+                assert_eq!(rgb[o..o + 3], [s[2], s[1], s[0]], "width {width} row {row} x {x}");
+                assert_eq!(same[o..o + 3], *s);
+            }
+        }
+    }
+    Ok(())
+}
+
+#[test]
+fn swap_rb_in_place_keeps_trailing_bytes() {
+    let mut rng = Lcg(2);
+    for pixels in WIDTHS.map(|w| w as usize) {
+        let original = rng.bytes(pixels * 3 + 2);
+        let mut data = original.clone();
+        swap_rb_in_place(&mut data);
+        for (out, src) in data.chunks_exact(3).zip(original.chunks_exact(3)) {
+            assert_eq!(out, [src[2], src[1], src[0]]);
+        }
+        assert_eq!(data[pixels * 3..], original[pixels * 3..]);
+        swap_rb_in_place(&mut data);
+        assert_eq!(data, original, "swapping twice is the identity");
+    }
+}
+
+#[test]
+fn planar_and_gray_interleave_match_reference() -> Result<()> {
+    let mut rng = Lcg(3);
+    for width in WIDTHS {
+        let height = 2u32;
+        let (w, h) = (width as usize, height as usize);
+        let planar = rng.bytes(w * h * 3);
+        let rgb = convert(&planar, &PixelLayout::packed(width, height, ImageFrameType::RGB888p), ImageFrameType::RGB888i)?;
+        let bgr = convert(&planar, &PixelLayout::packed(width, height, ImageFrameType::RGB888p), ImageFrameType::BGR888i)?;
+        let gray = convert(&planar[..w * h], &PixelLayout::packed(width, height, ImageFrameType::GRAY8), ImageFrameType::RGB888i)?;
+        for i in 0..w * h {
+            let (r, g, b) = (planar[i], planar[w * h + i], planar[2 * w * h + i]);
+            assert_eq!(rgb[3 * i..3 * i + 3], [r, g, b], "width {width} pixel {i}");
+            assert_eq!(bgr[3 * i..3 * i + 3], [b, g, r]);
+            assert_eq!(gray[3 * i..3 * i + 3], [r, r, r]);
+        }
+    }
+    Ok(())
+}
+
+#[test]
+fn yuv420_formats_match_reference() -> Result<()> {
+    let mut rng = Lcg(4);
+    for width in WIDTHS.into_iter().filter(|w| w % 2 == 0) {
+        let height = 4u32;
+        let (w, h, stride) = (width as usize, height as usize, width as usize + 16);
+        let (cw, ch) = (w / 2, h / 2);
+        let y = rng.bytes(stride * h);
+        let u = rng.bytes(cw * ch);
+        let v = rng.bytes(cw * ch);
+
+        // NV12 / NV21 share the luma stride for their interleaved chroma plane.
+        let mut nv12 = y.clone();
+        let mut nv21 = y.clone();
+        for row in 0..ch {
+            let mut uv = vec![0u8; stride];
+            let mut vu = vec![0u8; stride];
+            for x in 0..cw {
+                (uv[2 * x], uv[2 * x + 1]) = (u[row * cw + x], v[row * cw + x]);
+                (vu[2 * x], vu[2 * x + 1]) = (v[row * cw + x], u[row * cw + x]);
+            }
+            nv12.extend_from_slice(&uv);
+            nv21.extend_from_slice(&vu);
+        }
+        let packed_y: Vec<u8> = (0..h).flat_map(|row| y[row * stride..][..w].to_vec()).collect();
+        let yuv420p = [packed_y.clone(), u.clone(), v.clone()].concat();
+
+        let padded = |format| PixelLayout {
+            stride: stride as u32,
+            ..PixelLayout::packed(width, height, format)
+        };
+        let outputs = [
+            convert(&nv12, &padded(ImageFrameType::NV12), ImageFrameType::RGB888i)?,
+            convert(&nv21, &padded(ImageFrameType::NV21), ImageFrameType::RGB888i)?,
+            convert(&yuv420p, &PixelLayout::packed(width, height, ImageFrameType::YUV420p), ImageFrameType::RGB888i)?,
+        ];
+        let bgr = convert(&nv12, &padded(ImageFrameType::NV12), ImageFrameType::BGR888i)?;
+        for row in 0..h {
+            for x in 0..w {
+                let c = (row / 2) * cw + x / 2;
+                let expected = yuv_to_rgb(y[row * stride + x], u[c], v[c]);
+                let o = (row * w + x) * 3;
+                for out in &outputs {
+                    assert_eq!(out[o..o + 3], expected, "width {width} row {row} x {x}");
+                }
+                assert_eq!(bgr[o..o + 3], [expected[2], expected[1], expected[0]]);
+            }
+        }
+        assert_eq!(convert(&nv12, &padded(ImageFrameType::NV12), ImageFrameType::GRAY8)?, packed_y);
+    }
+    Ok(())
+}
+
+#[test]
+fn short_buffers_are_rejected() {
+    let layout = PixelLayout::packed(16, 2, ImageFrameType::NV12);
+    let mut dst = vec![0u8; 16 * 2 * 3];
+    // Luma only: the chroma plane is missing.
+    assert!(convert_pixels(&[0u8; 32], &layout, ImageFrameType::RGB888i, &mut dst).is_err());
+    assert!(convert_pixels(&[0u8; 48], &layout, ImageFrameType::RGB888i, &mut dst[..10]).is_err());
+    assert!(convert_pixels(&[0u8; 48], &layout, ImageFrameType::NV12, &mut dst).is_err());
+}
@@ -0,0 +1,87 @@
+#![cfg(feature = "hit")]
+
+//! Hardware Integration Tests for `PointCloudData` access.
+//!
+//! These tests need a stereo device and are disabled by default.
+
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::pointcloud::rgba32_from_rgba;
+use depthai::{PointCloudData, PointCloudSoaOptions, Result, RgbdNode, StereoPresetMode};
+
+/// Starts an autocreated RGBD pipeline and returns its first point cloud.
+fn first_pointcloud() -> Result<(Pipeline, PointCloudData)> {
+    let pipeline = Pipeline::new().build()?;
+    let rgbd = pipeline.create::<RgbdNode>()?;
+    rgbd.build_ex(true, StereoPresetMode::Default, (640, 400), Some(15.0))?;
+    let queue = rgbd.as_node().output("pcl")?.create_queue(2, false)?;
+    pipeline.start()?;
+    for _ in 0..50 {
+        if let Some(pcl) = queue.blocking_next_pointcloud(Some(Duration::from_millis(200)))? {
+            return Ok((pipeline, pcl));
+        }
+    }
+    panic!("no point cloud received");
+}
+
+#[test]
+fn colored_cloud_is_borrowed_in_place() -> Result<()> {
+    let (_pipeline, pcl) = first_pointcloud()?;
+
+    assert!(pcl.is_zero_copy(), "RGBD clouds are colored and should not be copied");
+    assert_eq!(pcl.stride(), std::mem::size_of::<depthai::Point3fRGBA>());
+    let points = pcl.points();
+    assert_eq!(points.len(), (pcl.width() * pcl.height()) as usize);
+    // The slice stays valid and stable for the lifetime of the message.
+    assert_eq!(pcl.points().as_ptr(), points.as_ptr());
+    Ok(())
+}
+
+#[test]
+fn soa_matches_a_reference_decimation_of_the_points() -> Result<()> {
+    let (_pipeline, pcl) = first_pointcloud()?;
+    let (width, height) = (pcl.width() as usize, pcl.height() as usize);
+    let points = pcl.points();
+    let valid: Vec<f32> = points.iter().map(|p| p.z).filter(|&z| z > 0.0).collect();
+    assert!(!valid.is_empty(), "need some depth to compare");
+    let mut sorted = valid.clone();
+    sorted.sort_by(f32::total_cmp);
+    let z_range = (sorted[sorted.len() / 4], sorted[sorted.len() * 3 / 4]);
+
+    for decimation in [1u32, 2, 3] {
+        let options = PointCloudSoaOptions {
+            decimation,
+            z_range: Some(z_range),
+            skip_invalid: true,
+            colors: true,
+        };
+        let soa = pcl.to_soa(&options);
+
+        let step = decimation as usize;
+        let expected: Vec<_> = (0..height)
+            .step_by(step)
+            .flat_map(|row| (0..width).step_by(step).map(move |col| row * width + col))
+            .map(|i| points[i])
+            .filter(|p| p.z != 0.0 && p.z >= z_range.0 && p.z <= z_range.1)
+            .collect();
+
+        assert_eq!(soa.len(), expected.len(), "decimation {decimation}");
+        assert_eq!(soa.rgba.len(), expected.len());
+        for (i, p) in expected.iter().enumerate() {
+            assert_eq!((soa.x[i], soa.y[i], soa.z[i]), (p.x, p.y, p.z));
+            assert_eq!(soa.rgba[i], rgba32_from_rgba(p.r, p.g, p.b, p.a));
+        }
+    }
+
+    // Without colors the color plane stays empty; reusing buffers gives the same result.
+    let options = PointCloudSoaOptions {
+        colors: false,
+        ..Default::default()
+    };
+    let mut reused = pcl.to_soa(&PointCloudSoaOptions::default());
+    let kept = pcl.fill_soa(&options, &mut reused);
+    assert_eq!(kept, valid.len());
+    assert!(reused.rgba.is_empty());
+    Ok(())
+}
@@ -0,0 +1,78 @@
+#![cfg(not(target_os = "windows"))]
+
+use depthai::{LatencyHistogram, PipelineStats, PoolOccupancy, PoolSizing, PoolSizingOptions, QueueStats};
+
+/// A camera output queue that measured `samples` frames with a peak of 3 in flight.
+fn camera_queue(output: &str, samples: u64, sequence_gaps: u64, rates: Option<(f32, f32)>) -> QueueStats {
+    QueueStats {
+        name: format!("{output}_queue"),
+        blocking: false,
+        closed: false,
+        depth: 0,
+        max_size: 4,
+        messages: samples,
+        dropped: 0,
+        depth_high_water: 1,
+        first_us: 0,
+        last_us: 0,
+        latency: LatencyHistogram::default(),
+        callback: LatencyHistogram::default(),
+        node_id: 0,
+        node_name: "Camera".into(),
+        output: output.into(),
+        output_fps: rates.map(|r| r.0),
+        sensor_fps: rates.map(|r| r.1),
+        pool: PoolOccupancy {
+            samples,
+            in_flight: 2,
+            in_flight_sum: 2 * samples,
+            in_flight_high_water: 3,
+            sequence_gaps,
+            gap_events: sequence_gaps.min(samples),
+        },
+    }
+}
+
+fn size(queue: QueueStats) -> (bool, u64, i32) {
+    let stats = PipelineStats {
+        queues: vec![queue],
+        ..Default::default()
+    };
+    let sizing = PoolSizing::from_stats(&stats, &PoolSizingOptions::default());
+    let rec = sizing.for_node(0).expect("camera measured");
+    (rec.stalled, rec.sequence_gaps, rec.frames_pool)
+}
+
+#[test]
+fn decimated_outputs_are_not_stalls() {
+    // 10 fps out of a 30 fps sensor: two sequence numbers skipped before every delivered frame.
+    assert_eq!(size(camera_queue("video", 50, 100, Some((10.0, 30.0)))), (false, 0, 4));
+    // 12 of 30 alternates between one and two skipped frames.
+    assert_eq!(size(camera_queue("video", 60, 91, Some((12.0, 30.0)))), (false, 0, 4));
+}
+
+#[test]
+fn gaps_beyond_the_frame_rate_are_stalls() {
+    // Five frames past the decimation are a stall, and the pool gets a slot past the headroom.
+    assert_eq!(size(camera_queue("video", 50, 107, Some((10.0, 30.0)))), (true, 5, 5));
+    // Outputs at sensor rate, or with unknown rates, keep every gap.
+    assert_eq!(size(camera_queue("video", 50, 3, Some((30.0, 30.0)))), (true, 3, 5));
+    assert_eq!(size(camera_queue("video", 50, 100, None)), (true, 100, 5));
+    assert_eq!(size(camera_queue("video", 50, 0, None)), (false, 0, 4));
+}
+
+#[test]
+fn rates_are_optional_in_snapshots() {
+    let mut queue = camera_queue("preview", 1, 0, None);
+    let mut json = serde_json::to_value(&queue).expect("queue stats serialize");
+    let fields = json.as_object_mut().expect("queue stats object");
+    fields.remove("output_fps");
+    fields.remove("sensor_fps");
+    let parsed: QueueStats = serde_json::from_value(json).expect("snapshot without rates");
+    assert_eq!(parsed, queue);
+
+    queue.output_fps = Some(15.0);
+    queue.sensor_fps = Some(30.0);
+    let json = serde_json::to_string(&queue).expect("queue stats serialize");
+    assert_eq!(serde_json::from_str::<QueueStats>(&json).expect("round trip"), queue);
+}
@@ -0,0 +1,65 @@
+#![cfg(not(target_os = "windows"))]
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, FramePool, Output, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+fn send_frames(output: &Output, pool: &FramePool, seqs: std::ops::Range<i64>) -> Result<()> {
+    for seq in seqs {
+        let mut frame = pool.acquire()?;
+        frame.set_format(4, 2, ImageFrameType::GRAY8, 8)?;
+        frame.set_sequence_num(seq);
+        output.send_frame(&frame.into_frame())?;
+    }
+    Ok(())
+}
+
+#[test]
+fn drains_return_frames_in_order_up_to_max() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_queue(16, false)?;
+    let pool = FramePool::new(8, 16)?;
+
+    assert!(queue.try_drain(8)?.is_empty());
+    send_frames(&output, &pool, 0..10)?;
+
+    let first = queue.try_drain(4)?;
+    let seqs: Vec<_> = first.iter().map(|f| f.info().unwrap().sequence_num).collect();
+    assert_eq!(seqs, [0, 1, 2, 3]);
+
+    let rest = queue.try_drain_with_info(32)?;
+    assert_eq!(rest.len(), 6);
+    for (i, (frame, info)) in rest.iter().enumerate() {
+        assert_eq!(info.sequence_num, 4 + i as i64);
+        let own = frame.info()?;
+        assert_eq!((info.sequence_num, info.byte_len, info.stride), (own.sequence_num, own.byte_len, own.stride));
+        assert_eq!((info.width, info.height, info.format), (4, 2, Some(ImageFrameType::GRAY8)));
+    }
+    assert!(queue.try_drain(8)?.is_empty());
+    assert!(queue.try_drain(0)?.is_empty());
+    Ok(())
+}
+
+#[test]
+fn drains_skip_messages_of_another_type() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_queue(16, false)?;
+    let pool = FramePool::new(8, 16)?;
+
+    send_frames(&output, &pool, 0..2)?;
+    output.send_buffer(&Buffer::from_bytes(b"not a frame")?)?;
+    send_frames(&output, &pool, 2..4)?;
+
+    let seqs: Vec<_> = queue.try_drain(8)?.iter().map(|f| f.info().unwrap().sequence_num).collect();
+    assert_eq!(seqs, [0, 1, 2, 3]);
+    Ok(())
+}
@@ -0,0 +1,99 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::thread;
+use std::time::{Duration, Instant};
+
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, Datatype, ErrorCode, MessageQueue, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+/// `count` one-byte messages `0..count`, taken off a scratch queue so they are plain `Datatype`s.
+fn messages(pipeline: &Pipeline, count: u8) -> Result<Vec<Datatype>> {
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let out = node.create_output(Some("out"))?;
+    let queue = out.create_message_queue(count as u32, true)?;
+    for i in 0..count {
+        out.send_buffer(&Buffer::from_bytes(&[i])?)?;
+    }
+    (0..count).map(|_| Ok(queue.try_get()?.expect("queued message"))).collect()
+}
+
+fn payloads(queue: &MessageQueue) -> Result<Vec<u8>> {
+    let mut seen = Vec::new();
+    while let Some(msg) = queue.try_get()? {
+        seen.push(msg.as_buffer()?.expect("buffer message").as_bytes()[0]);
+    }
+    Ok(seen)
+}
+
+#[test]
+fn message_queue_batches_stop_at_a_full_queue() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let msgs = messages(&pipeline, 5)?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let queue = node.create_output(Some("q"))?.create_message_queue(2, true)?;
+
+    // Try-sends stop at the first rejected message; that is a short count, not an error.
+    assert_eq!(queue.send_many(&msgs, Some(Duration::ZERO))?, 2);
+    // Three blocked messages share one 30 ms deadline; per-message deadlines would take 90 ms.
+    let start = Instant::now();
+    assert_eq!(queue.send_many(&msgs[2..], Some(Duration::from_millis(30)))?, 0);
+    let elapsed = start.elapsed();
+    assert!(elapsed < Duration::from_millis(55), "one deadline for the whole batch, took {elapsed:?}");
+    assert_eq!(payloads(&queue)?, [0, 1]);
+
+    assert_eq!(queue.send_many(&[], None)?, 0);
+    Ok(())
+}
+
+#[test]
+fn message_queue_batches_report_what_was_sent_before_a_failure() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let msgs = messages(&pipeline, 3)?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let queue = node.create_output(Some("q"))?.create_message_queue(2, true)?;
+
+    // The third blocking send waits for room until the queue is closed under it.
+    let closer = queue.clone();
+    let close = thread::spawn(move || {
+        thread::sleep(Duration::from_millis(50));
+        closer.close().expect("close queue");
+    });
+    let err = queue.send_many(&msgs, None).expect_err("closed queue fails the send");
+    close.join().expect("closing thread panicked");
+    assert_eq!(err.partial_sent(), Some(2), "the first two messages went out before the failure");
+    assert_eq!(err.code(), ErrorCode::Exception);
+
+    // On a closed queue the first send already fails, so nothing goes out.
+    let err = queue.send_many(&msgs, Some(Duration::ZERO)).expect_err("closed queue");
+    assert_eq!(err.partial_sent(), Some(0));
+    Ok(())
+}
+
+#[test]
+fn input_queue_batches_arrive_in_order() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let msgs = messages(&pipeline, 3)?;
+    let mut input = None;
+    pipeline.create_threaded_host_node(|node| {
+        input = Some(node.create_input(Some("in"))?);
+        Ok(Noop)
+    })?;
+    let input = input.expect("input created");
+    let feed = input.create_input_queue(8, true)?;
+
+    assert_eq!(feed.send_many(&msgs)?, 3);
+    let buffers = [Buffer::from_bytes(&[10])?, Buffer::from_bytes(&[11])?];
+    assert_eq!(feed.send_buffers(&buffers)?, 2);
+
+    let mut seen = Vec::new();
+    while let Some(buffer) = input.try_get_buffer()? {
+        seen.push(buffer.as_bytes()[0]);
+    }
+    assert_eq!(seen, [0, 1, 2, 10, 11]);
+    Ok(())
+}
@@ -0,0 +1,105 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::future::Future;
+use std::pin::pin;
+use std::sync::Arc;
+use std::task::{Context, Poll, Wake, Waker};
+use std::thread::{self, Thread};
+use std::time::Duration;
+
+use depthai::common::ImageFrameType;
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, FramePool, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+/// Minimal executor: parks the test thread until the stream's waker fires.
+struct ThreadWaker(Thread);
+
+impl Wake for ThreadWaker {
+    fn wake(self: Arc<Self>) {
+        self.0.unpark();
+    }
+}
+
+fn block_on<F: Future>(future: F) -> F::Output {
+    let waker = Waker::from(Arc::new(ThreadWaker(thread::current())));
+    let mut cx = Context::from_waker(&waker);
+    let mut future = pin!(future);
+    loop {
+        if let Poll::Ready(out) = future.as_mut().poll(&mut cx) {
+            return out;
+        }
+        // No timeout: a lost wake-up hangs the test instead of being papered over.
+        thread::park();
+    }
+}
+
+#[test]
+fn stream_yields_messages_sent_from_another_thread() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_message_queue(4, true)?;
+    let mut stream = queue.stream()?;
+
+    let sender = thread::spawn(move || {
+        for i in 0u8..20 {
+            thread::sleep(Duration::from_millis(1));
+            output.send_buffer(&Buffer::from_bytes(&[i]).unwrap()).unwrap();
+        }
+    });
+    for i in 0u8..20 {
+        let msg = block_on(stream.next()).expect("stream ended early")?;
+        assert_eq!(msg.as_buffer()?.expect("buffer").as_bytes(), [i]);
+    }
+    sender.join().expect("sender panicked");
+
+    queue.close()?;
+    assert!(block_on(stream.next()).is_none(), "closed and drained queue ends the stream");
+    Ok(())
+}
+
+#[test]
+fn stream_wakes_for_a_single_message() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_message_queue(4, true)?;
+    let mut stream = queue.stream()?;
+
+    // The stream is already pending when the only message arrives, so nothing after it could
+    // make up for a wake-up that found the queue empty.
+    let sender = thread::spawn(move || {
+        thread::sleep(Duration::from_millis(50));
+        output.send_buffer(&Buffer::from_bytes(b"only").unwrap()).unwrap();
+    });
+    let msg = block_on(stream.next()).expect("stream ended early")?;
+    assert_eq!(msg.as_buffer()?.expect("buffer").as_bytes(), b"only");
+    sender.join().expect("sender panicked");
+    Ok(())
+}
+
+#[test]
+fn frame_stream_skips_other_messages() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let output = node.create_output(Some("out"))?;
+    let queue = output.create_message_queue(8, false)?;
+    let mut frames = queue.frame_stream()?;
+
+    let pool = FramePool::new(4, 2)?;
+    output.send_buffer(&Buffer::from_bytes(b"skip")?)?;
+    let mut frame = pool.acquire()?;
+    frame.set_format(2, 2, ImageFrameType::GRAY8, 4)?;
+    frame.set_sequence_num(42);
+    output.send_frame(&frame.into_frame())?;
+
+    let got = block_on(frames.next()).expect("frame")?;
+    assert_eq!(got.info()?.sequence_num, 42);
+    assert_eq!(queue.size()?, 0, "the buffer was consumed and dropped");
+    Ok(())
+}
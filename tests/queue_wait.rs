@@ -0,0 +1,68 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::thread;
+use std::time::{Duration, Instant};
+
+use depthai::pipeline::Pipeline;
+use depthai::{wait_any, Buffer, QueueWaitSet, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+#[test]
+fn wait_any_reports_only_ready_queues() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let a = node.create_output(Some("a"))?;
+    let b = node.create_output(Some("b"))?;
+    let qa = a.create_message_queue(4, false)?;
+    let qb = b.create_message_queue(4, false)?;
+
+    assert!(wait_any(&[&qa, &qb], Some(Duration::from_millis(10)))?.is_empty());
+
+    b.send_buffer(&Buffer::from_bytes(b"b")?)?;
+    assert_eq!(wait_any(&[&qa, &qb], Some(Duration::ZERO))?, [1]);
+    a.send_buffer(&Buffer::from_bytes(b"a")?)?;
+    assert_eq!(wait_any(&[&qa, &qb], None)?, [0, 1]);
+
+    // Waiting does not consume anything.
+    assert_eq!(qa.size()?, 1);
+    assert_eq!(qb.size()?, 1);
+    Ok(())
+}
+
+#[test]
+fn wait_set_wakes_on_send_from_another_thread() -> Result<()> {
+    let pipeline = Pipeline::new_host_only()?;
+    let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+    let a = node.create_output(Some("a"))?;
+    let b = node.create_output(Some("b"))?;
+    let qa = a.create_message_queue(4, false)?;
+    let qb = b.create_message_queue(4, false)?;
+    let set = QueueWaitSet::new(&[&qa, &qb])?;
+    assert_eq!(set.len(), 2);
+
+    let start = Instant::now();
+    let sender = thread::spawn(move || {
+        thread::sleep(Duration::from_millis(50));
+        a.send_buffer(&Buffer::from_bytes(b"late").unwrap()).unwrap();
+    });
+    assert_eq!(set.wait(Some(Duration::from_secs(5)))?, [0]);
+    assert!(start.elapsed() < Duration::from_secs(5), "woke by the send, not the timeout");
+    sender.join().expect("sender panicked");
+
+    // Still ready until the message is taken; then the set times out again.
+    let mut ready = [false; 2];
+    assert_eq!(set.wait_into(Some(Duration::ZERO), &mut ready)?, 1);
+    assert_eq!(ready, [true, false]);
+    assert!(qa.try_get()?.is_some());
+    assert!(set.wait(Some(Duration::from_millis(10)))?.is_empty());
+    assert!(set.wait_into(None, &mut [false; 1]).is_err());
+
+    // A closed queue counts as ready so loops can notice it.
+    qb.close()?;
+    assert_eq!(set.wait(Some(Duration::from_secs(1)))?, [1]);
+    Ok(())
+}
@@ -0,0 +1,91 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::sync::{Arc, Barrier};
+
+use depthai::common::CameraBoardSocket;
+use depthai::{calibration_hash, CameraIntrinsics, RemapTable, Result};
+use serde_json::json;
+
+fn camera(distortion: Vec<f32>) -> CameraIntrinsics {
+    CameraIntrinsics {
+        fx: 100.0,
+        fy: 100.0,
+        cx: 31.5,
+        cy: 23.5,
+        width: 64,
+        height: 48,
+        distortion,
+    }
+}
+
+#[test]
+fn calibration_hash_is_stable() {
+    let calibration = json!({
+        "batchName": "",
+        "cameraData": [[0, {"width": 1280, "height": 800, "distortionCoeff": [0.1, -0.2, 0.0]}]],
+    });
+    // Pinned: the hash keys caches across runs, so it must not change between releases.
+    assert_eq!(calibration_hash(&calibration), 0x4e9d_1eeb_eabb_ca3b);
+    assert_eq!(calibration_hash(&json!({})), 0x08f4_4b07_b590_1a25);
+
+    let reordered = json!({
+        "cameraData": [[0, {"distortionCoeff": [0.1, -0.2, 0.0], "height": 800, "width": 1280}]],
+        "batchName": "",
+    });
+    assert_eq!(calibration_hash(&reordered), calibration_hash(&calibration));
+    let changed = json!({
+        "batchName": "",
+        "cameraData": [[0, {"width": 1280, "height": 800, "distortionCoeff": [0.1, -0.25, 0.0]}]],
+    });
+    assert_ne!(calibration_hash(&changed), calibration_hash(&calibration));
+}
+
+#[test]
+fn tables_are_keyed_by_the_coefficients_they_use() -> Result<()> {
+    let socket = CameraBoardSocket::CamA;
+    let mut full = vec![0.0f32; 14];
+    full[0] = 0.05;
+    let first = RemapTable::get(socket, 0x5eed_0001, &camera(full.clone()), None)?;
+    assert!(!first.cache_hit());
+    assert_eq!((first.size(), first.source_size()), ((64, 48), (64, 48)));
+
+    // tauX / tauY are not used by the maps, so they do not make a new table.
+    let mut tilted = full.clone();
+    tilted[12] = 0.3;
+    tilted[13] = -0.3;
+    assert!(RemapTable::get(socket, 0x5eed_0001, &camera(tilted), None)?.cache_hit());
+    // Twelve coefficients and fourteen with zero tilt describe the same maps.
+    assert!(RemapTable::get(socket, 0x5eed_0001, &camera(full[..12].to_vec()), None)?.cache_hit());
+
+    let mut other = full.clone();
+    other[0] = 0.06;
+    assert!(!RemapTable::get(socket, 0x5eed_0001, &camera(other), None)?.cache_hit());
+    assert!(!RemapTable::get(socket, 0x5eed_0002, &camera(full.clone()), None)?.cache_hit());
+
+    // Entries are weak: once every handle is gone the table is built again.
+    drop(first);
+    assert!(!RemapTable::get(socket, 0x5eed_0001, &camera(full), None)?.cache_hit());
+    Ok(())
+}
+
+#[test]
+fn concurrent_requests_build_a_table_once() -> Result<()> {
+    let threads = 8;
+    let barrier = Arc::new(Barrier::new(threads));
+    let workers: Vec<_> = (0..threads)
+        .map(|_| {
+            let barrier = Arc::clone(&barrier);
+            std::thread::spawn(move || {
+                barrier.wait();
+                RemapTable::get(CameraBoardSocket::CamB, 0x5eed_0003, &camera(vec![0.1, -0.05]), None)
+            })
+        })
+        .collect();
+    let tables = workers
+        .into_iter()
+        .map(|w| w.join().expect("remap thread panicked"))
+        .collect::<Result<Vec<_>>>()?;
+    let built = tables.iter().filter(|t| !t.cache_hit()).count();
+    assert_eq!(built, 1, "one thread builds, the others wait for its table");
+    Ok(())
+}
@@ -0,0 +1,137 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::sync::Arc;
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{
+    create_replay_node, EncodedFrameProfile, EncodedFrameType, FrameRecorder, Recording, ReplayOptions, ReplayRate,
+    ReplaySeek, Result, RingFrameMeta, RingPayloadKind,
+};
+
+fn recording_path(name: &str) -> std::path::PathBuf {
+    std::env::temp_dir().join(format!("depthai-replay-{name}-{}.rec", std::process::id()))
+}
+
+fn meta(kind: RingPayloadKind, timestamp_ms: i64) -> RingFrameMeta {
+    RingFrameMeta {
+        kind: kind as u32,
+        timestamp_ns: timestamp_ms * 1_000_000,
+        ..Default::default()
+    }
+}
+
+/// Two streams: images of 16 bytes on stream 0 every 10 ms, raw payloads on stream 5 in between.
+fn record(path: &std::path::Path) -> Result<()> {
+    let recorder = FrameRecorder::create(path)?;
+    for i in 0..5i64 {
+        recorder.record(0, meta(RingPayloadKind::Image, 1000 + 10 * i), &[i as u8; 16])?;
+        recorder.record(5, meta(RingPayloadKind::Raw, 1005 + 10 * i), &[0xEE; 3])?;
+    }
+    recorder.finish()
+}
+
+fn check_layout(recording: &Recording) {
+    assert_eq!(recording.len(), 10);
+    assert_eq!(recording.streams(), &[0, 5]);
+    assert_eq!(recording.max_image_len(), 16);
+    assert_eq!(recording.start_timestamp(), Some(Duration::from_millis(1000)));
+    assert_eq!(recording.duration(), Duration::from_millis(45));
+    let third = recording.get(2).expect("record 2");
+    assert_eq!((third.index, third.stream, third.data), (2, 0, &[1u8; 16][..]));
+    assert!(recording.get(10).is_none());
+}
+
+#[test]
+fn seeks_resolve_against_the_index() -> Result<()> {
+    let path = recording_path("seek");
+    record(&path)?;
+    let recording = Recording::open(&path)?;
+    check_layout(&recording);
+
+    assert_eq!(recording.resolve(ReplaySeek::Index(3)), 3);
+    assert_eq!(recording.resolve(ReplaySeek::Index(99)), 10, "past the end clamps to len");
+    // Exact hits land on the record, gaps round up to the next record.
+    assert_eq!(recording.resolve(ReplaySeek::Timestamp(Duration::from_millis(1010))), 2);
+    assert_eq!(recording.resolve(ReplaySeek::Timestamp(Duration::from_millis(1011))), 3);
+    assert_eq!(recording.resolve(ReplaySeek::Timestamp(Duration::ZERO)), 0);
+    assert_eq!(recording.resolve(ReplaySeek::Timestamp(Duration::from_secs(5))), 10);
+    assert_eq!(recording.resolve(ReplaySeek::Offset(Duration::from_millis(25))), 5);
+    assert_eq!(recording.resolve(ReplaySeek::Offset(Duration::ZERO)), 0);
+    let _ = std::fs::remove_file(&path);
+    Ok(())
+}
+
+#[test]
+fn unfinished_recordings_are_rebuilt_by_scanning() -> Result<()> {
+    let path = recording_path("unfinished");
+    record(&path)?;
+    // Losing the last byte invalidates the footer, as a crash before `finish` would.
+    let bytes = std::fs::read(&path).unwrap();
+    std::fs::write(&path, &bytes[..bytes.len() - 1]).unwrap();
+    let recording = Recording::open(&path)?;
+    check_layout(&recording);
+    assert_eq!(recording.resolve(ReplaySeek::Offset(Duration::from_millis(25))), 5);
+
+    // Empty recordings open and resolve everything to 0.
+    FrameRecorder::create(&path)?.finish()?;
+    let empty = Recording::open(&path)?;
+    assert!(empty.is_empty());
+    assert!(empty.streams().is_empty());
+    assert_eq!(empty.resolve(ReplaySeek::Offset(Duration::from_secs(1))), 0);
+    let _ = std::fs::remove_file(&path);
+    Ok(())
+}
+
+#[test]
+fn encoded_records_replay_as_encoded_frames() -> Result<()> {
+    let path = recording_path("encoded");
+    let recorder = FrameRecorder::create(&path)?;
+    let jpeg = [0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0xFF, 0xD9];
+    let encoded = RingFrameMeta {
+        width: 320,
+        height: 240,
+        format: EncodedFrameProfile::Jpeg as i32,
+        frame_type: EncodedFrameType::I as i32,
+        sequence_num: 42,
+        ..meta(RingPayloadKind::Encoded, 2000)
+    };
+    recorder.record(1, encoded, &jpeg)?;
+    let bogus = RingFrameMeta {
+        format: 77,
+        ..meta(RingPayloadKind::Encoded, 2001)
+    };
+    recorder.record(1, bogus, &jpeg)?;
+    recorder.finish()?;
+
+    let pipeline = Pipeline::new_host_only()?;
+    let options = ReplayOptions {
+        rate: ReplayRate::Unthrottled,
+        ..Default::default()
+    };
+    let source = create_replay_node(&pipeline, Arc::new(Recording::open(&path)?), options)?;
+    let queue = source.output(1).expect("stream 1").create_message_queue(4, true)?;
+    pipeline.start()?;
+    let msg = queue.get(Some(Duration::from_secs(10)))?.expect("replayed frame");
+    let frame = msg.as_encoded_frame()?.expect("an EncodedFrame, not a Buffer");
+    assert_eq!(frame.profile(), Some(EncodedFrameProfile::Jpeg));
+    assert_eq!(frame.frame_type(), Some(EncodedFrameType::I));
+    assert_eq!((frame.width(), frame.height()), (320, 240));
+    assert_eq!(frame.sequence_num(), 42);
+    assert_eq!(frame.timestamp(), Duration::from_millis(2000));
+    assert_eq!(frame.as_bytes(), &jpeg);
+
+    let control = source.control();
+    for _ in 0..200 {
+        if control.is_finished() {
+            break;
+        }
+        std::thread::sleep(Duration::from_millis(10));
+    }
+    pipeline.stop()?;
+    assert_eq!(control.emit_errors(), 1, "the record with an unknown profile is rejected");
+    let err = control.last_emit_error().expect("error kept");
+    assert!(err.to_string().contains("unknown encoded profile"), "{err}");
+    let _ = std::fs::remove_file(&path);
+    Ok(())
+}
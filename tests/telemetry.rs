@@ -0,0 +1,66 @@
+#![cfg(not(target_os = "windows"))]
+
+use std::time::Duration;
+
+use depthai::pipeline::Pipeline;
+use depthai::{Buffer, LatencyHistogram, PipelineStats, Result, ThreadedHostNodeContext, ThreadedHostNodeImpl};
+
+struct Noop;
+impl ThreadedHostNodeImpl for Noop {
+    fn run(&mut self, _ctx: &ThreadedHostNodeContext) {}
+}
+
+fn histogram(entries: &[(usize, u64)], max_us: u64) -> LatencyHistogram {
+    let mut buckets = vec![0u64; 24];
+    for &(bucket, n) in entries {
+        buckets[bucket] += n;
+    }
+    LatencyHistogram {
+        count: buckets.iter().sum(),
+        sum_us: 0,
+        max_us,
+        buckets,
+    }
+}
+
+#[test]
+fn percentiles_report_the_upper_bound_of_their_bucket() {
+    // 90 values in [8, 16) us, 9 in [1024, 2048) us, one at 20 ms.
+    let h = histogram(&[(3, 90), (10, 9), (14, 1)], 20_000);
+    let us = |q| h.percentile(q).map(|d: Duration| d.as_micros());
+    assert_eq!(us(0.0), Some(16));
+    assert_eq!(us(0.5), Some(16));
+    assert_eq!(us(0.9), Some(16));
+    assert_eq!(us(0.91), Some(2048));
+    assert_eq!(us(0.99), Some(2048));
+    // The top bucket's bound (32 ms) is capped at the recorded maximum.
+    assert_eq!(us(1.0), Some(20_000));
+    assert_eq!(us(7.0), Some(20_000), "q is clamped to 1.0");
+
+    assert_eq!(histogram(&[(0, 5)], 1).percentile(0.5), Some(Duration::from_micros(1)));
+    // The last bucket is open-ended, so it reports the maximum.
+    assert_eq!(histogram(&[(23, 1)], 90_000_000).percentile(0.5), Some(Duration::from_secs(90)));
+    assert_eq!(LatencyHistogram::default().percentile(0.5), None);
+    assert_eq!(LatencyHistogram::default().mean(), None);
+}
+
+#[test]
+fn destroyed_queues_leave_the_snapshot() -> Result<()> {
+    PipelineStats::set_enabled(true);
+    let tracked = |output: &str| -> Result<usize> {
+        Ok(PipelineStats::snapshot()?.queues.iter().filter(|q| q.output == output).count())
+    };
+    {
+        let pipeline = Pipeline::new_host_only()?;
+        let node = pipeline.create_threaded_host_node(|_| Ok(Noop))?;
+        let output = node.create_output(Some("telemetry_pruned"))?;
+        let _queue = output.create_queue(4, false)?;
+        output.send_buffer(&Buffer::from_bytes(b"x")?)?;
+        assert_eq!(tracked("telemetry_pruned")?, 1);
+        let stats = PipelineStats::snapshot()?;
+        let q = stats.queues.iter().find(|q| q.output == "telemetry_pruned").unwrap();
+        assert_eq!(q.messages, 1);
+    }
+    assert_eq!(tracked("telemetry_pruned")?, 0, "entries of destroyed queues are pruned");
+    Ok(())
+}